@@ -35,6 +35,7 @@ _f90io_backspace(__INT_T *unit, __INT_T *bitv, __INT_T *iostat, int swap_bytes)
   FILE *fp;
 
   __fortio_errinit03(*unit, *bitv, iostat, "BACKSPACE");
+  __fortio_lock_unit(*unit);
   if (ILLEGAL_UNIT(*unit))
     return __fortio_error(FIO_EUNIT);
 
@@ -17,9 +17,13 @@
 
 #include "stdioInterf.h"
 #include "fioMacros.h"
+#include "memops.h"
 
 void
 __fort_bcopy(char *to, char *fr, size_t n)
 {
-  memmove(to, fr, n);
+  if (n >= __C_PMEM_MINSZ && (to + n <= fr || fr + n <= to))
+    __c_pmcopy(to, fr, n);
+  else
+    memmove(to, fr, n);
 }
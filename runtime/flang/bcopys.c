@@ -17,6 +17,10 @@
 
 #include "stdioInterf.h"
 #include "fioMacros.h"
+#include "memops.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 /* strided-version of bcopy */
 /* handles overlaps correctly if strides are positive */
@@ -46,6 +50,28 @@ __fort_bcopysl(char *to, char *fr, size_t cnt, size_t tostr, size_t frstr,
     return;
   }
 
+#ifdef _OPENMP
+  /* large copies between separate arrays are split over threads */
+  if (cnt * len >= __C_PMEM_MINSZ && (long)tostr > 0 && (long)frstr >= 0 &&
+      (to + ((cnt - 1) * tostr + 1) * len <= fr ||
+       fr + ((cnt - 1) * frstr + 1) * len <= to) &&
+      (n = __c_pmem_nthreads(cnt * len)) > 1) {
+#pragma omp parallel num_threads(n)
+    {
+      size_t hi, lo;
+      int nthr, t;
+
+      nthr = omp_get_num_threads();
+      t = omp_get_thread_num();
+      lo = cnt / nthr * t;
+      hi = t == nthr - 1 ? cnt : cnt / nthr * (t + 1);
+      __fort_bcopysl(to + lo * tostr * len, fr + lo * frstr * len, hi - lo,
+                     tostr, frstr, len);
+    }
+    return;
+  }
+#endif
+
   n = (unsigned long)to | (unsigned long)fr;
 
   if (to < fr) {
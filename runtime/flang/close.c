@@ -96,6 +96,7 @@ _f90io_close(__INT_T *unit, __INT_T *bitv, __INT_T *iostat, char *status,
   FIO_FCB *f;
 
   __fortio_errinit03(*unit, *bitv, iostat, "CLOSE");
+  __fortio_lock_unit(*unit);
   if (ILLEGAL_UNIT(*unit))
     return __fortio_error(FIO_EUNIT); /* illegal unit number */
 
@@ -194,10 +195,10 @@ __fortio_cleanup(void)
     __fort_barrier();
   }
   if ((LOCAL_MODE || (GET_DIST_LCPU == GET_DIST_IOPROC))) {
-    for (f = fioFcbTbls.fcbs; f != (FIO_FCB *)0; f = f_next) {
+    for (f = fioFcbs; f != (FIO_FCB *)0; f = f_next) {
       /*
        * WARNING: __fortio_close() calls __fortio_free_fcb()
-       * which removes 'f' from the fioFcbTbls.fcbs list;
+       * which removes 'f' from the fioFcbs list;
        * consequently, need to extract the 'next' field now.
        */
       f_next = f->next;
@@ -215,5 +216,7 @@ __fortio_cleanup(void)
       }
     }
     __fortio_cleanup_fcb();
+    if (__fortio_io_stats())
+      __fortio_fmt_cache_stats();
   }
 }
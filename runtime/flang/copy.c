@@ -1040,6 +1040,39 @@ sked *ENTFTN(COMM_COPY, comm_copy)(void *rb, void *sb, F90_Desc *rs,
   return I8(__fort_comm_sked)(ch, rp, sp, F90_KIND_G(ss), F90_LEN_G(ss));
 }
 
+/* transpose contiguous local matrices with the blocked transpose, in place
+   when result and source are the same square matrix.  Return 0 to leave
+   other cases to __fort_copy. */
+
+static int I8(transpose_contig)(void *rb, void *sb, F90_Desc *rs,
+                                F90_Desc *ss)
+{
+  char *rp, *sp;
+  size_t len;
+  __INT_T m, n;
+
+  if (F90_RANK_G(rs) != 2 || F90_RANK_G(ss) != 2 ||
+      F90_LEN_G(rs) != F90_LEN_G(ss))
+    return 0;
+  m = F90_DIM_EXTENT_G(ss, 0);
+  n = F90_DIM_EXTENT_G(ss, 1);
+  if (F90_DIM_EXTENT_G(rs, 0) != n || F90_DIM_EXTENT_G(rs, 1) != m)
+    return 0;
+  rp = I8(__fort_contig_address)(rb, rs);
+  sp = I8(__fort_contig_address)(sb, ss);
+  if (rp == NULL || sp == NULL)
+    return 0;
+
+  len = F90_LEN_G(ss);
+  if (rp == sp && m == n)
+    __fort_transpose_square(rp, m, m, len);
+  else if (rp + m * n * len <= sp || sp + m * n * len <= rp)
+    __fort_transpose(rp, n, sp, m, m, n, len);
+  else
+    return 0;
+  return 1;
+}
+
 void ENTFTN(TRANSPOSE, transpose)(void *rb, void *sb, F90_Desc *rs,
                                   F90_Desc *ss)
 {
@@ -1059,6 +1092,9 @@ void ENTFTN(TRANSPOSE, transpose)(void *rb, void *sb, F90_Desc *rs,
   if (ss == NULL || F90_TAG_G(ss) != __DESC)
     __fort_abort("transpose: invalid source descriptor");
 
+  if (I8(transpose_contig)(rb, sb, rs, ss))
+    return;
+
   rp = (char *)rb + DIST_SCOFF_G(rs) * F90_LEN_G(rs);
   sp = (char *)sb + DIST_SCOFF_G(ss) * F90_LEN_G(ss);
   ch = I8(__fort_copy)(rp, sp, rs, ss, src_axis_map);
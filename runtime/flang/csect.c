@@ -21,16 +21,149 @@
  * Define the support of an i/o statement to be a critical section:
  *    ENTF90IO(BEGIN, begin)() - marks the begin of an i/o statement
  *    ENTF90IO(END, end)()   - marks the end of an i/o statement
- * Routines are called by the generated code if the option -x 125 1 is
- * selected.  Functions to be completed by users who need this facility.
+ * Routines are called by the generated code for -mp, or if the option
+ * -x 125 1 is selected.
+ *
+ * Within a marked statement, the first external unit the statement names
+ * is locked by __fortio_lock_unit() until the statement ends, so threads
+ * doing i/o to different units run at the same time.  Internal files
+ * take no lock.  The list of fcbs is guarded by the nestable lock that
+ * used to guard whole statements, held only while the list is searched or
+ * changed (__fortio_lock_fcbs()), so code compiled to take that lock
+ * around its statements still excludes list changes.  Programs that never
+ * mark a statement take no locks at all.
+ *
+ * A statement started within a statement (recursive i/o, from a function
+ * in an i/o list) must not wait for a unit lock while its thread holds
+ * another: two threads each writing a unit from a function called while
+ * writing the other's would wait for each other forever.  So recursive
+ * statements fall back to the nestable lock instead, and exclude every
+ * other statement as before.  A thread entering recursive i/o counts
+ * itself in recursive, waits until no unit-locked statement is running
+ * (running), and then takes the nestable lock.  Unit-locked statements
+ * do not start while recursive is nonzero, and do not count as running
+ * while they wait for a unit lock or their thread is in recursive i/o, so
+ * the wait always ends.  A recursive statement can thus add to a unit
+ * whose record another thread has begun and is itself in recursive i/o;
+ * only programs that write one unit from two threads at once see this.
  */
 
-#include "fioMacros.h"
+#if defined(TARGET_WIN)
+#include <windows.h>
+#define io_yield() SwitchToThread()
+#else
+#include <sched.h>
+#define io_yield() sched_yield()
+#endif
+#include "global.h"
+#include "llcrit.h"
+
+#define NO_UNIT (-99)
+
+/* set once a statement has been marked, and read by every thread without
+   a lock.  a -mp program marks its first statement before other threads
+   can do i/o. */
+static int marked = 0;
+
+static int running;   /* unit-locked statements running */
+static int recursive; /* threads in or waiting for recursive i/o */
+
+static FIO_TLS int stmt_depth;
+static FIO_TLS int stmt_unit = NO_UNIT; /* unit locked by the outer statement */
+
+/* the outer statement of this thread runs, or stops running */
+
+static void
+run_begin(void)
+{
+  for (;;) {
+    while (__atomic_load_n(&recursive, __ATOMIC_SEQ_CST))
+      io_yield();
+    __atomic_add_fetch(&running, 1, __ATOMIC_SEQ_CST);
+    if (!__atomic_load_n(&recursive, __ATOMIC_SEQ_CST))
+      return;
+    __atomic_sub_fetch(&running, 1, __ATOMIC_SEQ_CST);
+  }
+}
+
+static void
+run_end(void)
+{
+  __atomic_sub_fetch(&running, 1, __ATOMIC_SEQ_CST);
+}
+
+static void
+stmt_begin(void)
+{
+  if (!__atomic_load_n(&marked, __ATOMIC_ACQUIRE))
+    __atomic_store_n(&marked, 1, __ATOMIC_RELEASE);
+  if (stmt_depth == 0) {
+    run_begin();
+  } else if (stmt_depth == 1) {
+    /* recursive i/o: stop running, keep unit-locked statements from
+       starting, wait for the running ones, then exclude the others */
+    run_end();
+    __atomic_add_fetch(&recursive, 1, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&running, __ATOMIC_SEQ_CST))
+      io_yield();
+    MP_BCS_NEST;
+  }
+  ++stmt_depth;
+}
+
+static void
+stmt_end(void)
+{
+  if (stmt_depth <= 0)
+    return;
+  --stmt_depth;
+  if (stmt_depth == 0) {
+    run_end();
+    if (stmt_unit != NO_UNIT) {
+      MP_ECS_UNIT(stmt_unit);
+      stmt_unit = NO_UNIT;
+    }
+  } else if (stmt_depth == 1) {
+    MP_ECS_NEST;
+    __atomic_sub_fetch(&recursive, 1, __ATOMIC_SEQ_CST);
+    run_begin();
+  }
+}
+
+/** \brief lock unit for the rest of the current statement, if it is an
+    outer statement that has not locked one yet */
+void
+__fortio_lock_unit(int unit)
+{
+  if (stmt_depth != 1 || stmt_unit != NO_UNIT || unit == NO_UNIT)
+    return;
+  run_end();
+  MP_BCS_UNIT(unit);
+  stmt_unit = unit;
+  run_begin();
+}
+
+/** \brief lock the list of fcbs; returns what __fortio_unlock_fcbs needs */
+int
+__fortio_lock_fcbs(void)
+{
+  if (!__atomic_load_n(&marked, __ATOMIC_ACQUIRE))
+    return 0;
+  MP_BCS_NEST;
+  return 1;
+}
+
+void
+__fortio_unlock_fcbs(int locked)
+{
+  if (locked)
+    MP_ECS_NEST;
+}
 
-void ENTF90IO(BEGIN, begin)() {}
+void ENTF90IO(BEGIN, begin)() { stmt_begin(); }
 
-void ENTF90IO(END, end)() {}
+void ENTF90IO(END, end)() { stmt_end(); }
 
-void ENTCRF90IO(BEGIN, begin)() {}
+void ENTCRF90IO(BEGIN, begin)() { stmt_begin(); }
 
-void ENTCRF90IO(END, end)() {}
+void ENTCRF90IO(END, end)() { stmt_end(); }
@@ -21,6 +21,119 @@
 #include "fioMacros.h"
 
 #include "fort_vars.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Bytes moved before the planes of a contiguous shift are spread over
+   OpenMP threads */
+#define SHIFT_PAR_BYTES (1L << 20)
+
+/* Net positive (left) shift amount; the division is avoided for shifts
+   already in range, as it would dominate planes of a few elements */
+
+static __INT_T cshift_amount(__INT_T shift, __INT_T extent)
+{
+  if (shift < 0 || shift >= extent) {
+    shift %= extent;
+    if (shift < 0)
+      shift += extent;
+  }
+  return shift;
+}
+
+/* Circular shift of one plane of extent x inner elements along its
+   extent.  ns shift values are given for the inner lines, one value
+   meaning the whole plane moves by the same amount. */
+
+static void cshift_plane(char *rp, char *ap, __INT_T *sp, __INT_T ns,
+                         __INT_T extent, __INT_T inner, size_t len)
+{
+  size_t row;
+  __INT_T i, s;
+
+  for (i = 1; i < ns && sp[i] == sp[0]; ++i)
+    ;
+  if (i >= ns) {
+    /* one shift amount: two block moves */
+    row = (size_t)inner * len;
+    s = cshift_amount(sp[0], extent);
+    __fort_bcopy(rp, ap + s * row, (extent - s) * row);
+    __fort_bcopy(rp + (extent - s) * row, ap, s * row);
+    return;
+  }
+  for (i = 0; i < ns; ++i, rp += len, ap += len) {
+    s = cshift_amount(sp[i], extent);
+    __fort_bcopysl(rp, ap + s * inner * len, extent - s, inner, inner, len);
+    __fort_bcopysl(rp + (extent - s) * inner * len, ap, s, inner, inner, len);
+  }
+}
+
+/* CSHIFT when the array, the result and any shift array are whole
+   contiguous arrays.  The array is viewed as outer planes of extent x
+   inner elements, extent being that of the shifted dimension; each plane
+   is shifted by cshift_plane.  Returns 0 if the arguments do not
+   qualify. */
+
+static int I8(cshift_contig)(char *rb,     /* result base */
+                             char *ab,     /* array base */
+                             __INT_T *sb,  /* shift base */
+                             __INT_T dim,  /* dimension to shift */
+                             F90_Desc *rs, /* result descriptor */
+                             F90_Desc *as, /* array descriptor */
+                             F90_Desc *ss) /* shift descriptor or NULL */
+{
+  DECL_DIM_PTRS(ad);
+  char *ap, *rp;
+  __INT_T *sp;
+  size_t len, n, plane;
+  __INT_T extent, i, inner, ns, o, outer;
+
+  ap = I8(__fort_contig_address)(ab, as);
+  rp = I8(__fort_contig_address)(rb, rs);
+  if (ap == NULL || rp == NULL || F90_LEN_G(rs) != F90_LEN_G(as) ||
+      F90_GSIZE_G(rs) != F90_GSIZE_G(as))
+    return 0;
+  len = F90_LEN_G(as);
+  n = (size_t)F90_GSIZE_G(as) * len;
+  if (rp < ap + n && ap < rp + n)
+    return 0;
+
+  extent = inner = outer = 1;
+  for (i = 0; i < F90_RANK_G(as); ++i) {
+    SET_DIM_PTRS(ad, as, i);
+    if (i < dim - 1)
+      inner *= F90_DPTR_EXTENT_G(ad);
+    else if (i == dim - 1)
+      extent = F90_DPTR_EXTENT_G(ad);
+    else
+      outer *= F90_DPTR_EXTENT_G(ad);
+  }
+
+  if (ss == NULL && cshift_amount(*sb, extent) == 0) {
+    __fort_bcopy(rp, ap, n);
+    return 1;
+  }
+
+  sp = sb;
+  ns = 1;
+  if (ss != NULL) {
+    sp = I8(__fort_contig_address)(sb, ss);
+    if (sp == NULL || F90_GSIZE_G(ss) != inner * outer)
+      return 0;
+    ns = inner;
+  }
+
+  plane = (size_t)extent * inner * len;
+#ifdef _OPENMP
+#pragma omp parallel for if (outer > 1 && n >= SHIFT_PAR_BYTES &&             \
+                             !omp_in_parallel())
+#endif
+  for (o = 0; o < outer; ++o)
+    cshift_plane(rp + o * plane, ap + o * plane,
+                 sp + (ss != NULL ? o * inner : 0), ns, extent, inner, len);
+  return 1;
+}
 
 /* result = cshift(array, shift=scalar, dim) */
 
@@ -70,6 +183,11 @@ void ENTFTN(CSHIFTS, cshifts)(void *rb,     /* result base */
   if (sabs < 0)
     sabs += extent;
 
+  /* whole contiguous arrays are moved as two blocks per plane */
+
+  if (I8(cshift_contig)(rb, ab, sb, dim, rs, as, NULL))
+    return;
+
   /* copy straight across if net shift amount is zero */
 
   if (sabs == 0) {
@@ -445,6 +563,9 @@ void ENTFTN(CSHIFT, cshift)(void *rb,     /* result base */
   }
 #endif
 
+  if (I8(cshift_contig)(rb, ab, sb, dim, rs, as, ss))
+    return;
+
   /* initialize rank 1 section descriptors */
 
   __DIST_INIT_SECTION(rc, 1, rs);
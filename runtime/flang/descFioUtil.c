@@ -65,8 +65,8 @@ void I8(__fortio_loop)(fio_parm *z, /* parameter struct */
 
 #if !defined(DESC_I8)
 
-static __INT_T fio_bitv;
-static __INT_T *fio_iostat;
+static FIO_TLS __INT_T fio_bitv;
+static FIO_TLS __INT_T *fio_iostat;
 
 /* init bitv and iostat */
 
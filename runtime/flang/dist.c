@@ -657,6 +657,43 @@ void *I8(__fort_local_address)(void *base, F90_Desc *d, __INT_T *idxv)
   return (char *)base + offset * F90_LEN_G(d);
 }
 
+/* If the elements of section d are local and follow one another in
+   memory in array element order, return the address of the first one,
+   else NULL.  The base address is not adjusted for scalar subscripts, as
+   for __fort_get_scalar. */
+
+void *I8(__fort_contig_address)(void *base, F90_Desc *d)
+{
+  DECL_DIM_PTRS(dd);
+  __INT_T idx[MAXDIMS];
+  __INT_T dx, n;
+  char *af, *first, *last;
+
+  if (F90_TAG_G(d) != __DESC || F90_GSIZE_G(d) <= 0 ||
+      !(F90_FLAGS_G(d) & __LOCAL ||
+        DIST_MAPPED_G(DIST_ALIGN_TARGET_G(d)) == 0))
+    return NULL;
+
+  n = 1;
+  for (dx = 0; dx < F90_RANK_G(d); ++dx) {
+    SET_DIM_PTRS(dd, d, dx);
+    if (F90_DPTR_EXTENT_G(dd) > 1 &&
+        F90_DPTR_SSTRIDE_G(dd) * F90_DPTR_LSTRIDE_G(dd) != n)
+      return NULL;
+    n *= F90_DPTR_EXTENT_G(dd);
+    idx[dx] = F90_DPTR_LBOUND_G(dd);
+  }
+
+  af = (char *)base + DIST_SCOFF_G(d) * F90_LEN_G(d);
+  first = I8(__fort_local_address)(af, d, idx);
+  for (dx = 0; dx < F90_RANK_G(d); ++dx)
+    idx[dx] = DIM_UBOUND_G(d, dx);
+  last = I8(__fort_local_address)(af, d, idx);
+  if (first == NULL || last != first + (n - 1) * F90_LEN_G(d))
+    return NULL;
+  return first;
+}
+
 /* Localize a global index in dimension dim of array a.  This is only
    necessary for dimensions with cyclic or block-cyclic distributions.
    It is assumed that the index is local */
@@ -19,22 +19,24 @@
 
 /*  encodefmt.c - translate format string into encoded form at runtime. */
 
+#include <stdint.h>
 #include "global.h"
 #include "feddesc.h"
+#include "llcrit.h"
 
 #define STACK_SIZE 20 /* max nesting depth of parens */
 #define is_digit(c) ((c) >= '0' && (c) <= '9')
 
 typedef int ERRCODE;
 
-static long numval; /* numeric value computed by ef_getnum */
-static char *firstchar, *lastchar;
-static int curpos; /* current avail posn in output buffer */
-static int paren_stack[STACK_SIZE];
-static bool enclosing_parens;
-static INT *buff = NULL;
-static int buffsize = 0;
-static char quote;
+static FIO_TLS long numval; /* numeric value computed by ef_getnum */
+static FIO_TLS char *firstchar, *lastchar;
+static FIO_TLS int curpos; /* current avail posn in output buffer */
+static FIO_TLS int paren_stack[STACK_SIZE];
+static FIO_TLS bool enclosing_parens;
+static FIO_TLS INT *buff = NULL;
+static FIO_TLS int buffsize = 0;
+static FIO_TLS char quote;
 
 static ERRCODE check_outer_parens(char *, __CLEN_T);
 static bool ef_getnum(char *, int *);
@@ -67,10 +69,6 @@ _f90io_encode_fmt(char *str,      /* unencoded format string */
   int k, n;
   bool unlimited_repeat_count = FALSE;
 
-  /* the following call is just to ensure __fortio_init() has been called: */
-  __fortio_errinit03(0, 0, NULL, "encode format string");
-  __fortio_fmtinit();
-
   /*  make basic checks for legal input and determine if this format has the
       outer set of parentheses present or not.  Set global variables
       enclosing_parens, firstchar and lastchar:  */
@@ -926,6 +924,154 @@ ef_error(ERRCODE code)
   return 1;
 }
 
+/* encoded formats.  a format held in a character variable is encoded
+   each time its statement executes, so the last few encodings are kept
+   keyed by the format text and a statement with the same text copies
+   the cached encoding instead of parsing it again -- e.g. a WRITE in a
+   loop with a format built at runtime.  the copy leaves the caller
+   owning (and freeing) its enctab as before.  errors are cached too,
+   since they also depend only on the text.  */
+
+#define FMT_CACHE_SIZE 64   /* encodings kept */
+#define FMT_CACHE_TEXT 1024 /* longest format text kept, bytes */
+
+typedef struct {
+  uint64_t hash;       /* hash of text */
+  __CLEN_T len;        /* text length, bytes; 0 if the entry is empty */
+  char *text;          /* format text */
+  INT *enc;            /* encoded format */
+  int enclen;          /* encoded length, INTs */
+  __INT_T status;      /* _f90io_encode_fmt result */
+  unsigned long stamp; /* last use, for LRU eviction */
+} fmt_cache_ent;
+
+static fmt_cache_ent fmt_cache[FMT_CACHE_SIZE];
+static unsigned long fmt_cache_clock;
+static long fmt_cache_hits, fmt_cache_misses;
+MP_SEMAPHORE(static, fmt_cache_sem)
+
+static uint64_t
+fmt_cache_hash(char *str, __CLEN_T len)
+{
+  uint64_t h = UINT64_C(14695981039346656037);
+  __CLEN_T i;
+
+  for (i = 0; i < len; ++i)
+    h = (h ^ (unsigned char)str[i]) * UINT64_C(1099511628211);
+  return h;
+}
+
+/* copy a cached encoding of str into the output buffer and its result
+   into *status; return FALSE if str has not been encoded. */
+
+static bool
+fmt_cache_find(char *str, __CLEN_T len, uint64_t hash, __INT_T *status)
+{
+  fmt_cache_ent *e;
+  int k;
+
+  MP_P(fmt_cache_sem);
+  for (k = 0; k < FMT_CACHE_SIZE; ++k) {
+    e = &fmt_cache[k];
+    if (e->len == len && e->hash == hash && memcmp(e->text, str, len) == 0) {
+      ef_alloc(e->enclen);
+      memcpy(buff, e->enc, e->enclen * sizeof(INT));
+      curpos = e->enclen;
+      e->stamp = ++fmt_cache_clock;
+      *status = e->status;
+      ++fmt_cache_hits;
+      MP_V(fmt_cache_sem);
+      return TRUE;
+    }
+  }
+  ++fmt_cache_misses;
+  MP_V(fmt_cache_sem);
+  return FALSE;
+}
+
+/* keep the encoding just made for str in place of the least recently
+   used entry */
+
+static void
+fmt_cache_add(char *str, __CLEN_T len, uint64_t hash, __INT_T status)
+{
+  fmt_cache_ent *e, *lru;
+  char *text;
+  INT *enc;
+  int k;
+
+  text = (char *)malloc(len);
+  enc = (INT *)malloc(curpos * sizeof(INT));
+  if (text == NULL || enc == NULL) {
+    free(text);
+    free(enc);
+    return;
+  }
+  memcpy(text, str, len);
+  memcpy(enc, buff, curpos * sizeof(INT));
+
+  MP_P(fmt_cache_sem);
+  lru = &fmt_cache[0];
+  for (k = 0; k < FMT_CACHE_SIZE; ++k) {
+    e = &fmt_cache[k];
+    if (e->len == len && e->hash == hash && memcmp(e->text, str, len) == 0) {
+      lru = NULL; /* added by another thread meanwhile */
+      break;
+    }
+    if (e->stamp < lru->stamp)
+      lru = e;
+  }
+  if (lru != NULL) {
+    e = lru;
+    free(e->text);
+    free(e->enc);
+    e->hash = hash;
+    e->len = len;
+    e->text = text;
+    e->enc = enc;
+    e->enclen = curpos;
+    e->status = status;
+    e->stamp = ++fmt_cache_clock;
+    text = NULL;
+    enc = NULL;
+  }
+  MP_V(fmt_cache_sem);
+  free(text);
+  free(enc);
+}
+
+static __INT_T
+ef_encode(char *str, __INT_T *nelem, __CLEN_T str_siz)
+{
+  uint64_t hash;
+  __CLEN_T len;
+  __INT_T s;
+
+  /* the following call is just to ensure __fortio_init() has been called: */
+  __fortio_errinit03(0, 0, NULL, "encode format string");
+  __fortio_fmtinit();
+
+  /* ENCODE_FMTV formats have no known length and are not kept */
+  len = str_siz * (*nelem ? *nelem : 1);
+  if (str == NULL || len < 1 || len > FMT_CACHE_TEXT)
+    return _f90io_encode_fmt(str, nelem, str_siz);
+
+  hash = fmt_cache_hash(str, len);
+  if (fmt_cache_find(str, len, hash, &s))
+    return s;
+  s = _f90io_encode_fmt(str, nelem, str_siz);
+  fmt_cache_add(str, len, hash, s);
+  return s;
+}
+
+/** \brief Report format cache hits and misses to stderr */
+void
+__fortio_fmt_cache_stats(void)
+{
+  fprintf(__io_stderr(), "FIO format cache: %ld hits, %ld misses\n",
+          fmt_cache_hits, fmt_cache_misses);
+}
+
 /* handle either character or non-character format string */
 
 __INT_T
@@ -942,13 +1088,13 @@ ENTF90IO(ENCODE_FMTA, encode_fmta)
   buffsize = 0;
 
   if (LOCAL_MODE) {
-    s = _f90io_encode_fmt(CADR(str), nelem, len);
+    s = ef_encode(CADR(str), nelem, len);
     __fortio_errend03();
     return s;
   }
 
   if (GET_DIST_LCPU == GET_DIST_IOPROC)
-    (void)_f90io_encode_fmt(CADR(str), nelem, len);
+    (void)ef_encode(CADR(str), nelem, len);
   __fortio_errend03();
   return 0;
 }
@@ -976,7 +1122,7 @@ ENTCRF90IO(ENCODE_FMTA, encode_fmta)
   buff = NULL;
   buffsize = 0;
   len = (*kind == __STR) ? CLEN(str) : GET_DIST_SIZE_OF(*kind);
-  s = _f90io_encode_fmt(CADR(str), nelem, len);
+  s = ef_encode(CADR(str), nelem, len);
   __fortio_errend03();
   return s;
 }
@@ -1004,13 +1150,13 @@ ENTF90IO(ENCODE_FMTV, encode_fmtv)
   buff = NULL;
   buffsize = 0;
   if (LOCAL_MODE) {
-    s = _f90io_encode_fmt(*str, &nelem, len);
+    s = ef_encode(*str, &nelem, len);
     __fortio_errend03();
     return s;
   }
 
   if (GET_DIST_LCPU == GET_DIST_IOPROC)
-    (void)_f90io_encode_fmt(*str, &nelem, len);
+    (void)ef_encode(*str, &nelem, len);
   __fortio_errend03();
   return 0;
 }
@@ -1024,7 +1170,7 @@ ENTCRF90IO(ENCODE_FMTV, encode_fmtv)
   __INT_T nelem = 1;
   buff = NULL;
   buffsize = 0;
-  s = _f90io_encode_fmt(*str, &nelem, len);
+  s = ef_encode(*str, &nelem, len);
   __fortio_errend03();
   return s;
 }
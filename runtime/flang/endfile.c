@@ -30,6 +30,7 @@ _f90io_endfile(__INT_T *unit, __INT_T *bitv, __INT_T *iostat)
   FIO_FCB *f;
 
   __fortio_errinit03(*unit, *bitv, iostat, "ENDFILE");
+  __fortio_lock_unit(*unit);
   if (ILLEGAL_UNIT(*unit))
     return __fortio_error(FIO_EUNIT);
 
@@ -21,6 +21,161 @@
 #include "fioMacros.h"
 
 #include "fort_vars.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Bytes moved before the planes of a contiguous shift are spread over
+   OpenMP threads */
+#define SHIFT_PAR_BYTES (1L << 20)
+
+/* Store the boundary value bp into cnt elements of len bytes, str
+   elements apart.  A NULL bp is the default character boundary, blanks. */
+
+static void eoshift_fill(char *rp, char *bp, size_t cnt, size_t str,
+                         size_t len)
+{
+  size_t done, n;
+
+  if (cnt == 0)
+    return;
+  if (bp == NULL) {
+    if (str == 1)
+      memset(rp, ' ', cnt * len);
+    else
+      for (; cnt > 0; --cnt, rp += str * len)
+        memset(rp, ' ', len);
+  } else if (str != 1) {
+    __fort_bcopysl(rp, bp, cnt, str, 0, len);
+  } else {
+    /* replicate the first element, doubling the filled run */
+    __fort_bcopy(rp, bp, len);
+    for (done = 1; done < cnt; done += n) {
+      n = done < cnt - done ? done : cnt - done;
+      __fort_bcopy(rp + done * len, rp, n * len);
+    }
+  }
+}
+
+/* End-off shift of one plane of extent x inner elements along its
+   extent.  ns shift values are given for the inner lines, and the
+   boundary values are bstep bytes apart; when the whole plane moves by
+   the same amount and has one boundary value it is done with one block
+   move and one fill. */
+
+static void eoshift_plane(char *rp, char *ap, __INT_T *sp, __INT_T ns,
+                          char *bp, size_t bstep, __INT_T extent,
+                          __INT_T inner, size_t len)
+{
+  size_t row;
+  __INT_T i, s;
+
+  row = (size_t)inner * len;
+  for (i = 1; i < ns && sp[i] == sp[0]; ++i)
+    ;
+  if (i >= ns && bstep == 0) {
+    s = sp[0];
+    if (s >= extent || s <= -extent)
+      eoshift_fill(rp, bp, (size_t)extent * inner, 1, len);
+    else if (s >= 0) {
+      __fort_bcopy(rp, ap + s * row, (extent - s) * row);
+      eoshift_fill(rp + (extent - s) * row, bp, (size_t)s * inner, 1, len);
+    } else {
+      eoshift_fill(rp, bp, (size_t)-s * inner, 1, len);
+      __fort_bcopy(rp - s * row, ap, (extent + s) * row);
+    }
+    return;
+  }
+  for (i = 0; i < inner; ++i, rp += len, ap += len, bp += bstep) {
+    s = sp[ns > 1 ? i : 0];
+    if (s >= extent || s <= -extent)
+      eoshift_fill(rp, bp, extent, inner, len);
+    else if (s >= 0) {
+      __fort_bcopysl(rp, ap + s * row, extent - s, inner, inner, len);
+      eoshift_fill(rp + (extent - s) * row, bp, s, inner, len);
+    } else {
+      eoshift_fill(rp, bp, -s, inner, len);
+      __fort_bcopysl(rp - s * row, ap, extent + s, inner, inner, len);
+    }
+  }
+}
+
+/* EOSHIFT when the array, the result and any shift or boundary arrays
+   are whole contiguous arrays, one plane of the shifted dimension at a
+   time as in cshift.c.  A NULL bb is the default boundary and a NULL ss
+   or bs a scalar shift or boundary.  Returns 0 if the arguments do not
+   qualify. */
+
+static int I8(eoshift_contig)(char *rb,     /* result base */
+                              char *ab,     /* array base */
+                              __INT_T *sb,  /* shift base */
+                              char *bb,     /* boundary base */
+                              __INT_T dim,  /* dimension to shift */
+                              F90_Desc *rs, /* result descriptor */
+                              F90_Desc *as, /* array descriptor */
+                              F90_Desc *ss, /* shift descriptor */
+                              F90_Desc *bs) /* boundary descriptor */
+{
+  DECL_DIM_PTRS(ad);
+  char *ap, *bp, *rp;
+  __INT_T *sp;
+  size_t bstep, len, n, plane;
+  __INT_T extent, i, inner, ns, o, outer;
+
+  ap = I8(__fort_contig_address)(ab, as);
+  rp = I8(__fort_contig_address)(rb, rs);
+  if (ap == NULL || rp == NULL || F90_LEN_G(rs) != F90_LEN_G(as) ||
+      F90_GSIZE_G(rs) != F90_GSIZE_G(as))
+    return 0;
+  len = F90_LEN_G(as);
+  n = (size_t)F90_GSIZE_G(as) * len;
+  if (rp < ap + n && ap < rp + n)
+    return 0;
+
+  extent = inner = outer = 1;
+  for (i = 0; i < F90_RANK_G(as); ++i) {
+    SET_DIM_PTRS(ad, as, i);
+    if (i < dim - 1)
+      inner *= F90_DPTR_EXTENT_G(ad);
+    else if (i == dim - 1)
+      extent = F90_DPTR_EXTENT_G(ad);
+    else
+      outer *= F90_DPTR_EXTENT_G(ad);
+  }
+
+  sp = sb;
+  ns = 1;
+  if (ss != NULL) {
+    sp = I8(__fort_contig_address)(sb, ss);
+    if (sp == NULL || F90_GSIZE_G(ss) != inner * outer)
+      return 0;
+    ns = inner;
+  }
+
+  bp = bb;
+  bstep = 0;
+  if (bb == NULL) {
+    if (F90_KIND_G(rs) != __STR)
+      bp = (char *)GET_DIST_ZED;
+  } else if (bs != NULL) {
+    bp = I8(__fort_contig_address)(bb, bs);
+    if (bp == NULL || F90_GSIZE_G(bs) != inner * outer ||
+        F90_LEN_G(bs) != len)
+      return 0;
+    bstep = len;
+  }
+
+  plane = (size_t)extent * inner * len;
+#ifdef _OPENMP
+#pragma omp parallel for if (outer > 1 && n >= SHIFT_PAR_BYTES &&             \
+                             !omp_in_parallel())
+#endif
+  for (o = 0; o < outer; ++o)
+    eoshift_plane(rp + o * plane, ap + o * plane,
+                  sp + (ss != NULL ? o * inner : 0), ns,
+                  bp + o * inner * bstep, bstep, extent, inner, len);
+  return 1;
+}
 
 static void I8(eoshift_scalar)(char *rb,          /* result base */
                                char *ab,          /* array base */
@@ -373,6 +528,9 @@ void ENTFTN(EOSHIFTSZ, eoshiftsz)(char *rb,     /* result base */
   }
 #endif
 
+  if (I8(eoshift_contig)(rb, ab, sb, NULL, dim, rs, as, NULL, NULL))
+    return;
+
   /* initialize section descriptors */
 
   __DIST_INIT_SECTION(ac, F90_RANK_G(as), as);
@@ -456,6 +614,9 @@ void ENTFTN(EOSHIFTSS, eoshiftss)(char *rb,     /* result base */
   }
 #endif
 
+  if (I8(eoshift_contig)(rb, ab, sb, bb, dim, rs, as, NULL, NULL))
+    return;
+
   /* initialize section descriptors */
 
   __DIST_INIT_SECTION(ac, F90_RANK_G(as), as);
@@ -545,6 +706,9 @@ void ENTFTN(EOSHIFTSA, eoshiftsa)(char *rb,     /* result base */
   }
 #endif
 
+  if (I8(eoshift_contig)(rb, ab, sb, bb, dim, rs, as, NULL, bs))
+    return;
+
   /* initialize rank 1 section descriptors */
 
   __DIST_INIT_SECTION(rc, 1, rs);
@@ -625,6 +789,9 @@ void ENTFTN(EOSHIFTZ, eoshiftz)(char *rb,     /* result base */
   }
 #endif
 
+  if (I8(eoshift_contig)(rb, ab, sb, NULL, dim, rs, as, ss, NULL))
+    return;
+
   /* initialize rank 1 section descriptors */
 
   __DIST_INIT_SECTION(rc, 1, rs);
@@ -699,6 +866,9 @@ void ENTFTN(EOSHIFTS, eoshifts)(char *rb,     /* result base */
   }
 #endif
 
+  if (I8(eoshift_contig)(rb, ab, sb, bb, dim, rs, as, ss, NULL))
+    return;
+
   /* initialize rank 1 section descriptors */
 
   __DIST_INIT_SECTION(rc, 1, rs);
@@ -781,6 +951,9 @@ void ENTFTN(EOSHIFT, eoshift)(char *rb,     /* result base */
   }
 #endif
 
+  if (I8(eoshift_contig)(rb, ab, sb, bb, dim, rs, as, ss, bs))
+    return;
+
   /* initialize rank 1 section descriptors */
 
   __DIST_INIT_SECTION(rc, 1, rs);
@@ -31,16 +31,16 @@ typedef struct {
   int lineno;
 } src_info_struct;
 
-static src_info_struct src_info;
+static FIO_TLS src_info_struct src_info;
 
-static int current_unit;
-static INT *iostat_ptr;
-static int iobitv;
-static char *err_str = "?";
+static FIO_TLS int current_unit;
+static FIO_TLS INT *iostat_ptr;
+static FIO_TLS int iobitv;
+static FIO_TLS char *err_str = "?";
 char *envar_fortranopt;
 
-static char *iomsg; /* pointer for optional IOMSG area */
-static __CLEN_T iomsgl;  /* length of above */
+static FIO_TLS char *iomsg; /* pointer for optional IOMSG area */
+static FIO_TLS __CLEN_T iomsgl;  /* length of above */
 
 typedef struct {
   INT *enctab;
@@ -70,17 +70,20 @@ typedef struct {
 } fioerror;
 
 #define GBL_SIZE 15
-static int gbl_size = 15;
-static int gbl_avl = 0;
-static fioerror static_gbl[GBL_SIZE];
-static fioerror *gbl = &static_gbl[0];
-static fioerror *gbl_head = &static_gbl[0];
-
-static int fmtgbl_size = 15;
-static int fmtgbl_avl = 0;
-static f90fmt static_fmtgbl[GBL_SIZE];
-static f90fmt *fmtgbl = &static_fmtgbl[0];
-static f90fmt *fmtgbl_head = &static_fmtgbl[0];
+static FIO_TLS int gbl_size = 15;
+static FIO_TLS int gbl_avl = 0;
+static FIO_TLS fioerror static_gbl[GBL_SIZE];
+static FIO_TLS fioerror *gbl;
+static FIO_TLS fioerror *gbl_head;
+
+static FIO_TLS int fmtgbl_size = 15;
+static FIO_TLS int fmtgbl_avl = 0;
+static FIO_TLS f90fmt static_fmtgbl[GBL_SIZE];
+static FIO_TLS f90fmt *fmtgbl;
+static FIO_TLS f90fmt *fmtgbl_head;
+
+#define INIT_GBL FIO_INIT_GBL(gbl, gbl_head, static_gbl)
+#define INIT_FMTGBL FIO_INIT_GBL(fmtgbl, fmtgbl_head, static_fmtgbl)
 
 static void ioerrinfo(FIO_FCB *);
 static void __fortio_init(void);
@@ -92,12 +95,14 @@ extern void  f90_compiled();
 void
 set_gbl_newunit(bool newunit)
 {
+  INIT_GBL;
   gbl->newunit = newunit;
 }
 
 bool
 get_gbl_newunit()
 {
+  INIT_GBL;
   return gbl->newunit;
 }
 
@@ -154,6 +159,7 @@ restore_gbl()
 static void
 free_gbl()
 {
+  INIT_GBL;
   --gbl_avl;
   if (gbl_avl <= 0)
     gbl_avl = 0;
@@ -167,6 +173,8 @@ static void
 allocate_new_gbl()
 {
   fioerror *tmp_gbl;
+
+  INIT_GBL;
   if (gbl_avl >= gbl_size) {
     if (gbl_size == GBL_SIZE) {
       gbl_size = gbl_size + 15;
@@ -187,6 +195,8 @@ static void
 allocate_new_fmtgbl()
 {
   f90fmt *tmp_gbl;
+
+  INIT_FMTGBL;
   if (fmtgbl_avl >= fmtgbl_size) {
     if (fmtgbl_size == GBL_SIZE) {
       fmtgbl_size = fmtgbl_size + 15;
@@ -207,6 +217,7 @@ allocate_new_fmtgbl()
 static void
 free_fmtgbl()
 {
+  INIT_FMTGBL;
   --fmtgbl_avl;
   if (fmtgbl_avl <= 0)
     fmtgbl_avl = 0;
@@ -234,11 +245,23 @@ save_fmtgbl()
 
 /* --------------------------------------------------------------- */
 
+/* preconnect the standard units on first use */
+static void
+init_units(void)
+{
+  int locked;
+
+  locked = __fortio_lock_fcbs();
+  if (fioFcbs == NULL)
+    __fortio_init();
+  __fortio_unlock_fcbs(locked);
+}
+
 extern void
 __fortio_errinit(__INT_T unit, __INT_T bitv, __INT_T *iostat, char *str)
 {
-  if (fioFcbTbls.fcbs == NULL)
-    __fortio_init();
+  if (fioFcbs == NULL)
+    init_units();
 
   fioFcbTbls.error = FALSE;
   fioFcbTbls.eof = FALSE;
@@ -261,8 +284,8 @@ __fortio_errinit(__INT_T unit, __INT_T bitv, __INT_T *iostat, char *str)
 extern void
 __fortio_errinit03(__INT_T unit, __INT_T bitv, __INT_T *iostat, char *str)
 {
-  if (fioFcbTbls.fcbs == NULL)
-    __fortio_init();
+  if (fioFcbs == NULL)
+    init_units();
 
   save_gbl();
 
@@ -465,7 +488,7 @@ extern char *
 __fortio_errmsg(int errval)
 {
   char *txt;
-  static char buf[128];
+  static FIO_TLS char buf[128];
   if (errval == 0) {
     buf[0] = ' ';
     buf[1] = '\0';
@@ -798,6 +821,7 @@ void ENTCRF90IO(SRC_INFOX, src_infox)(
 static void
 set_iomsg()
 {
+  INIT_GBL;
   gbl->iomsg = iomsg;
   gbl->iomsgl = iomsgl;
 }
@@ -849,6 +873,7 @@ static int check_format = 1; /* format checking enabled */
 static int crlf = 0;         /* crlf does not denote end-of-line */
 static int no_minus_zero = 0; /* -0 allowed in formatted 0 */
 static int new_fp_formatter = TRUE;
+static int io_stats = 0;     /* report I/O statistics at exit */
 
 /** \brief  initialize Fortran I/O system.  Specifically, initialize
     preconnected units:  */
@@ -857,7 +882,7 @@ __fortio_init(void)
 {
   FIO_FCB *f;
 
-  assert(fioFcbTbls.fcbs == NULL);
+  assert(fioFcbs == NULL);
 
   /* preconnect stdin as unit -5 for * unit specifier */
   f = __fortio_alloc_fcb();
@@ -1032,6 +1057,9 @@ __fortio_init(void)
     } else if (strstr(envar_fortranopt, "new_fp_formatter")) {
       new_fp_formatter = 1;
     }
+    if (strstr(envar_fortranopt, "io_stats")) {
+      io_stats = 1;
+    }
   }
 }
 
@@ -1059,9 +1087,16 @@ __fortio_new_fp_formatter(void)
   return new_fp_formatter;
 }
 
+int
+__fortio_io_stats(void)
+{
+  return io_stats;
+}
+
 static void
 set_pos()
 {
+  INIT_GBL;
   gbl->pos = fioFcbTbls.pos;
   gbl->pos_present = fioFcbTbls.pos_present;
 }
@@ -1532,6 +1532,8 @@ I8(__fort_local_offset)(F90_Desc *d, __INT_T *gidx);
 
 void *I8(__fort_local_address)(void *base, F90_Desc *d, __INT_T *gidx);
 
+void *I8(__fort_contig_address)(void *base, F90_Desc *d);
+
 void I8(__fort_cycle_bounds)(F90_Desc *d);
 
 __INT_T
@@ -1565,6 +1567,11 @@ void __fort_bcopy(char *to, char *fr, size_t n);
 void __fort_bcopysl(char *to, char *fr, size_t cnt, size_t tostr, size_t frstr,
                    size_t size);
 
+void __fort_transpose(char *to, __POINT_T ldt, char *fr, __POINT_T ldf,
+                      __POINT_T rows, __POINT_T cols, size_t len);
+
+void __fort_transpose_square(char *a, __POINT_T lda, __POINT_T n, size_t len);
+
 void I8(__fort_fills)(char *ab, F90_Desc *ad, void *fill);
 
 chdr *I8(__fort_copy)(void *db, void *sb, F90_Desc *dd, F90_Desc *sd, int *smap);
@@ -70,3 +70,11 @@
 #define FIO_NULL 91
 #define FIO_YES 92
 #define FIO_NO 93
+
+/* storage class of the state of the i/o statement being executed, which is
+ * kept per thread (see global.h) */
+#if defined(WINNT)
+#define FIO_TLS __declspec(thread)
+#else
+#define FIO_TLS __thread
+#endif
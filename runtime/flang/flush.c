@@ -33,6 +33,7 @@ __INT_T *iostat;
 
   __fort_status_init(bitv, iostat);
   __fortio_errinit03(*unit, *bitv, iostat, "FLUSH");
+  __fortio_lock_unit(*unit);
   if (ILLEGAL_UNIT(*unit)) {/* check for illegal unit number */
     s = __fortio_error(FIO_EUNIT);
     __fortio_errend03();
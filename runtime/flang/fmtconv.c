@@ -68,17 +68,51 @@ static char *__fortio_fmt_z(unsigned int);
 #define PP_REAL8(i) (*(__REAL8_T *)(i))
 #define PP_REAL16(i) (*(__REAL16_T *)(i))
 
-static int field_overflow;
+static FIO_TLS int field_overflow;
 
-char __f90io_conv_buf[96] = {0}; /* sufficient size for non-char types - must
-                                  * be init'd for 32-bit OSX
-                                  */
-static char *conv_bufp = __f90io_conv_buf;
-static unsigned conv_bufsize = sizeof(__f90io_conv_buf);
+FIO_TLS char __f90io_conv_buf[96] = {0}; /* sufficient size for non-char
+                                          * types - must be init'd for
+                                          * 32-bit OSX
+                                          */
+static FIO_TLS char *conv_bufp;
+static FIO_TLS unsigned conv_bufsize = sizeof(__f90io_conv_buf);
 
-static char cmplx_buf[64]; /* just for list-directed and nml io */
-static char exp_letter = 'E';
-static char *buff_pos;
+static FIO_TLS char cmplx_buf[64]; /* just for list-directed and nml io */
+static FIO_TLS char exp_letter = 'E';
+static FIO_TLS char *buff_pos;
+
+static FIO_TLS char fpbuf[64];
+static FIO_TLS struct {
+  int exp;  /* initially set by ecvt/fcvt. adjusted by the
+             * scale factor.  WARNING: may be set to zero if
+             * value to be printed represents 0.
+             */
+  int sign; /* non-zero if value is negative (initially set by
+             * ecvt/fcvt).  WARNING:  conv_e/conv_f may set to
+             * zero if value to be printed represents zero.
+             */
+  int ndigits;
+  int decimal_char;
+  bool iszero; /* TRUE if after conversions with respect to the
+                * edit descriptor, the string to be printed represents
+                * zero. conv_e/conv_f initializes to TRUE; cvtp_cp
+                * sets FALSE.
+                */
+  char *cvtp;
+  char *curp;
+  char *buf;
+  int bufsize;
+  __BIGREAL_T zero; /* hide 0.0 from the optimizer here */
+} fpdat = {0, 0, 0, '.', 0, 0, 0, NULL, sizeof(fpbuf), 0.0};
+
+/* a thread's buffers start out in its static arrays, set up on first use */
+#define INIT_CONV_BUF                                                          \
+  do {                                                                         \
+    if (conv_bufp == NULL) {                                                   \
+      conv_bufp = __f90io_conv_buf;                                            \
+      fpdat.buf = fpbuf;                                                       \
+    }                                                                          \
+  } while (0)
 
 /* ----------------------------------------------------------------- */
 void
@@ -98,6 +132,7 @@ __fortio_default_convert(char *item, int type,
   char *p;
   INT64 i8val;
 
+  INIT_CONV_BUF;
   switch (type) {
   default:
     assert(0);
@@ -271,6 +306,7 @@ __fortio_fmt_i(__BIGINT_T val, int width,
   int neg;  /* flag word set by conv_int, becomes sign character */
   int olen; /* output length of integer value */
 
+  INIT_CONV_BUF;
   field_overflow = FALSE;
   p = conv_int(val, &len, &neg);
 
@@ -309,7 +345,7 @@ conv_int(__BIGINT_T val, int *lenp, int *negp)
 #define MAX_HX 0x80000000
 #define MAX_STR "2147483648"
 
-  static char tmp[MAX_CONV_INT];
+  static FIO_TLS char tmp[MAX_CONV_INT];
   char *p;
   int len;
   int neg;
@@ -351,6 +387,7 @@ __fortio_fmt_i8(INT64 val,
   int neg;  /* flag word set by conv_int, becomes sign character */
   int olen; /* output length of integer value */
 
+  INIT_CONV_BUF;
   field_overflow = FALSE;
   p = conv_int8(val, &len, &neg);
 
@@ -388,7 +425,7 @@ conv_int8(INT64 val, int *lenp, int *negp)
 {
 #define MAX_CONV_INT8 32
 
-  static char tmp[MAX_CONV_INT8];
+  static FIO_TLS char tmp[MAX_CONV_INT8];
   char *p;
   int len;
   INT64 value;
@@ -423,30 +460,6 @@ conv_int8(INT64 val, int *lenp, int *negp)
   return p;
 }
 
-static char fpbuf[64];
-static struct {
-  int exp;  /* initially set by ecvt/fcvt. adjusted by the
-             * scale factor.  WARNING: may be set to zero if
-             * value to be printed represents 0.
-             */
-  int sign; /* non-zero if value is negative (initially set by
-             * ecvt/fcvt).  WARNING:  conv_e/conv_f may set to
-             * zero if value to be printed represents zero.
-             */
-  int ndigits;
-  int decimal_char;
-  bool iszero; /* TRUE if after conversions with respect to the
-                * edit descriptor, the string to be printed represents
-                * zero. conv_e/conv_f initializes to TRUE; cvtp_cp
-                * sets FALSE.
-                */
-  char *cvtp;
-  char *curp;
-  char *buf;
-  int bufsize;
-  __BIGREAL_T zero; /* hide 0.0 from the optimizer here */
-} fpdat = {0, 0, 0, '.', 0, 0, 0, fpbuf, sizeof(fpbuf), 0.0};
-
 static void put_buf(int width,     /* where width (# bytes) */
                     char *valp,    /* value in string form */
                     int len,       /* length of value */
@@ -512,6 +525,7 @@ __fortio_fmt_d(__BIGREAL_T val, int w, int d, int sf, int type, bool plus_flag,
   int sign_char;
   int newd;
 
+  INIT_CONV_BUF;
   exp_letter = 'D';
   field_overflow = FALSE;
   /*
@@ -580,6 +594,7 @@ __fortio_fmt_g(__BIGREAL_T val, int w, int d, int e, int sf, int type,
       ((int *)&val)[1] |= 0x80000000;
     }
   }
+  INIT_CONV_BUF;
   field_overflow = FALSE;
   /*
       fp_canon(val, type, round);
@@ -696,6 +711,7 @@ __fortio_fmt_e(__BIGREAL_T val, int w, int d, int e, int sf, int type,
   int sign_char;
   int newd, newrnd;
 
+  INIT_CONV_BUF;
   field_overflow = FALSE;
 
   /* Replace this call
@@ -768,6 +784,7 @@ __fortio_fmt_f(__BIGREAL_T val, int w, int d,
   int sign_char;
   void *p;
 
+  INIT_CONV_BUF;
   field_overflow = FALSE;
   /*
    * use fcvt to convert value correctly rounded to a certain number of
@@ -35,9 +35,9 @@ static int dbgflag;
 #undef DBGBIT
 #define DBGBIT(v) (LOCAL_DEBUG && (dbgflag & v))
 
-static char buf[128];
-static char *buf_p = buf;
-static int buf_size = sizeof(buf);
+static FIO_TLS char buf[128];
+static FIO_TLS char *buf_p; /* buf, or malloc'ed if buf is too small */
+static FIO_TLS int buf_size = sizeof(buf);
 
 /*
  *  __fortio_getnum() - extracts integer or __BIGREAL_T scalar values from
@@ -155,6 +155,8 @@ state6: /* digits [ . [ digits ] ] { + | - } */
   do { /* scan past exponent */
     c = *++cp;
   } while (ISDIGIT(c));
+  if (buf_p == NULL)
+    buf_p = buf;
   if ((cp - currc) + 2 > buf_size) {
     buf_size = (cp - currc) + 64;
     if (buf_p != buf)
@@ -36,7 +36,7 @@ typedef struct {
   int fmtpos;
 } rpstack_struct;
 
-static rpstack_struct rpstack[RPSTACK_SIZE];
+static FIO_TLS rpstack_struct rpstack[RPSTACK_SIZE];
 
 union ieee {
   double d;
@@ -96,13 +96,14 @@ typedef struct struct_G G;
 
 #define GBL_SIZE 5
 
-static G static_gbl[GBL_SIZE];
-static G *gbl = &static_gbl[0];
-static G *gbl_head = &static_gbl[0];
-static int gbl_avl = 0;
-static int gbl_size = GBL_SIZE;
+static FIO_TLS G static_gbl[GBL_SIZE];
+static FIO_TLS G *gbl;
+static FIO_TLS G *gbl_head;
+static FIO_TLS int gbl_avl = 0;
+static FIO_TLS int gbl_size = GBL_SIZE;
+#define INIT_GBL FIO_INIT_GBL(gbl, gbl_head, static_gbl)
 
-static int move_fwd_eor;
+static FIO_TLS int move_fwd_eor;
 
 static int fr_read(char *, int, int);
 
@@ -154,6 +155,8 @@ static void
 save_samefcb()
 {
   G *tmp_gbl;
+
+  INIT_GBL;
   tmp_gbl = gbl->same_fcb;
   if (tmp_gbl) {
     tmp_gbl = &gbl_head[gbl->same_fcb_idx];
@@ -187,6 +190,8 @@ allocate_new_gbl()
   long obuff_len = 0;
   int eor_seen;
   int gsize = sizeof(G);
+
+  INIT_GBL;
   if (gbl_avl >= gbl_size) {
     if (gbl_size == GBL_SIZE) {
       gbl_size = gbl_size + GBL_SIZE;
@@ -224,6 +229,8 @@ static void
 free_gbl()
 {
   G *tmp_gbl;
+
+  INIT_GBL;
   tmp_gbl = gbl;
   --gbl_avl;
   if (gbl_avl <= 0)
@@ -265,6 +272,7 @@ fr_init(__INT_T *unit,   /* unit number */
 
   save_gbl();
   __fortio_errinit03(*unit, *bitv, iostat, "formatted read");
+  __fortio_lock_unit(*unit);
   allocate_new_gbl();
   f = __fortio_rwinit(*unit, FIO_FORMATTED, rec, 0 /*read*/);
   if (f == NULL) {
@@ -2389,10 +2397,10 @@ fr_assign(char *item, int type, __BIGINT_T ival, INT64 i8val, __BIGREAL_T dval)
 
 /*  local static variables for octal/hex conversion:  */
 
-static int OZbase;
-static unsigned char *OZbuff;
-static int numbits;
-static unsigned char *buff_pos, *buff_end;
+static FIO_TLS int OZbase;
+static FIO_TLS unsigned char *OZbuff;
+static FIO_TLS int numbits;
+static FIO_TLS unsigned char *buff_pos, *buff_end;
 
 static void fr_OZconv_init(int, int);
 static void fr_OZbyte(int);
@@ -2613,7 +2621,7 @@ fr_OZreadnum(int code, char *item, int type, int item_length)
 static void
 fr_OZconv_init(int w, int sz)
 {
-  static int buff_len = 0;
+  static FIO_TLS int buff_len = 0;
   int len;
 
   if (OZbase == 16)
@@ -3212,7 +3220,6 @@ static int
 fr_read_record(void)
 {
   G *g = gbl;
-  int idx = 0;
 
   if (g->internal_file) {
     if (g->num_internal_recs <= 0)
@@ -3267,46 +3274,25 @@ fr_read_record(void)
         if (__io_fread(g->rec_buff, 1, g->rec_len, fp) != g->rec_len)
           return __io_errno();
       } else { /* sequential read */
-        idx = 0;
-
-        while (TRUE) { /* read one char per iteration until '\n' */
-          int c = __io_fgetc(fp);
-          if (c == EOF) {
-            if (__io_feof(fp)) {
-              if (idx)
-                break;
-              if (g->nonadvance && !g->eor_seen && g->rec_len != 0)
-                break;
-
-              g->eor_seen = 0;
-              return FIO_EEOF;
-            }
+        size_t size = g->obuff_len;
+        long len;
+        int eor;
+
+        assert(g->obuff == g->rec_buff);
+        len = __fortio_getrec(fp, &g->obuff, &size, &eor);
+        g->obuff_len = size;
+        g->rec_buff = g->obuff;
+        if (len < 0) {
+          if (!__io_feof(fp))
             return __io_errno();
+          if (!g->nonadvance || g->eor_seen || g->rec_len == 0) {
+            g->eor_seen = 0;
+            return FIO_EEOF;
           }
-          if (c == '\r' && EOR_CRLF) {
-            c = __io_fgetc(fp);
-            if (c == '\n') {
-              g->eor_len = 2;
-              break;
-            }
-            __io_ungetc(c, fp);
-            c = '\r';
-          }
-          if (c == '\n') {
-            g->eor_len = 1;
-            break;
-          }
-
-          /* else, put character into record:  */
-          g->obuff[idx++] = c;
-          if (idx >= g->obuff_len) {
-            int err;
-            err = realloc_obuff(g, (size_t)(g->obuff_len + INIT_BUFF_LEN));
-            if (err)
-              return err;
-          }
-        }
-        g->rec_len = idx;
+          len = 0;
+        } else if (eor)
+          g->eor_len = eor;
+        g->rec_len = len;
       }
     }
   }
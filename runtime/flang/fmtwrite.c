@@ -36,7 +36,7 @@ typedef struct {
   int fmtpos;
 } rpstack_struct;
 
-static rpstack_struct rpstack[RPSTACK_SIZE];
+static FIO_TLS rpstack_struct rpstack[RPSTACK_SIZE];
 
 #define INIT_BUFF_LEN 200
 
@@ -81,11 +81,12 @@ struct struct_G {
 #define GBL_SIZE 5
 typedef struct struct_G G;
 
-static G static_gbl[GBL_SIZE];
-static G *gbl = &static_gbl[0];
-static G *gbl_head = &static_gbl[0];
-static int gbl_avl = 0;
-static int gbl_size = GBL_SIZE;
+static FIO_TLS G static_gbl[GBL_SIZE];
+static FIO_TLS G *gbl;
+static FIO_TLS G *gbl_head;
+static FIO_TLS int gbl_avl = 0;
+static FIO_TLS int gbl_size = GBL_SIZE;
+#define INIT_GBL FIO_INIT_GBL(gbl, gbl_head, static_gbl)
 
 static int fw_write(char *, int, int);
 static int fw_slashes(G *, int);
@@ -129,6 +130,8 @@ static void
 save_samefcb()
 {
   G *tmp_gbl;
+
+  INIT_GBL;
   tmp_gbl = gbl->same_fcb;
   if (tmp_gbl) {
     tmp_gbl = &gbl_head[gbl->same_fcb_idx];
@@ -150,6 +153,8 @@ allocate_new_gbl()
   char *rec_buff = 0;
   long obuff_len = 0;
   int gsize = sizeof(G);
+
+  INIT_GBL;
   if (gbl_avl >= gbl_size) {
     if (gbl_size == GBL_SIZE) {
       gbl_size = gbl_size + GBL_SIZE;
@@ -186,6 +191,8 @@ static void
 free_gbl()
 {
   G *tmp_gbl = gbl;
+
+  INIT_GBL;
   if (tmp_gbl && tmp_gbl->fmt_alloc) {
     free(tmp_gbl->fmt_base);
     tmp_gbl->fmt_base = NULL;
@@ -223,6 +230,7 @@ fw_init(__INT_T *unit,   /* unit number */
   /* ----- perform initializations.  Get pointer to file control block: */
 
   __fortio_errinit03(*unit, *bitv, iostat, "formatted write");
+  __fortio_lock_unit(*unit);
   f = __fortio_rwinit(*unit, FIO_FORMATTED, rec, 1 /*write*/);
 
   if (f == NULL)
@@ -2233,12 +2241,12 @@ fmt_mismatch:
 
 /*  local static variables for octal/hex conversion:  */
 
-static int OZbase;
+static FIO_TLS int OZbase;
 static char hextab[17] = "0123456789ABCDEF";
-static char *OZbuff;
-static int bits_left;
-static int bits; /* 0, 1 or 2 left over bits */
-static char *buff_pos;
+static FIO_TLS char *OZbuff;
+static FIO_TLS int bits_left;
+static FIO_TLS int bits; /* 0, 1 or 2 left over bits */
+static FIO_TLS char *buff_pos;
 
 static __CLEN_T fw_OZconv_init(__CLEN_T);
 static void fw_OZbyte(unsigned int);
@@ -2484,7 +2492,7 @@ fw_Bbyte(unsigned int c)
 static __CLEN_T
 fw_OZconv_init(__CLEN_T len)
 {
-  static __CLEN_T buff_len = 0;
+  static FIO_TLS __CLEN_T buff_len = 0;
 
   if (OZbase == 16)
     len += len;
@@ -536,6 +536,224 @@ fraction_digits(char buff[MAX_FRACTION_SIGNIFICANT_DECIMAL_DIGITS],
   return frac_leading_zeroes;
 }
 
+/*
+ *  Fast generation of leading significant digits (Grisu, "counted" mode).
+ *  The value is scaled into [2**3, 2**64) * 2**(-60 .. -32) by a cached
+ *  64-bit power of ten, so that its integer and fraction parts can be
+ *  split with shifts; the product is then within 1 unit of exact.  The
+ *  digits are accepted only when that error can't change them.
+ */
+
+struct cached_power {
+  uint64_t significand; /* rounded to nearest */
+  int binary_exponent;
+  int decimal_exponent;
+};
+
+/* 10**k for k = -348, -340, ..., 340 */
+static const struct cached_power cached_powers[] = {
+    {0xfa8fd5a0081c0288ULL, -1220, -348},
+    {0xbaaee17fa23ebf76ULL, -1193, -340},
+    {0x8b16fb203055ac76ULL, -1166, -332},
+    {0xcf42894a5dce35eaULL, -1140, -324},
+    {0x9a6bb0aa55653b2dULL, -1113, -316},
+    {0xe61acf033d1a45dfULL, -1087, -308},
+    {0xab70fe17c79ac6caULL, -1060, -300},
+    {0xff77b1fcbebcdc4fULL, -1034, -292},
+    {0xbe5691ef416bd60cULL, -1007, -284},
+    {0x8dd01fad907ffc3cULL, -980, -276},
+    {0xd3515c2831559a83ULL, -954, -268},
+    {0x9d71ac8fada6c9b5ULL, -927, -260},
+    {0xea9c227723ee8bcbULL, -901, -252},
+    {0xaecc49914078536dULL, -874, -244},
+    {0x823c12795db6ce57ULL, -847, -236},
+    {0xc21094364dfb5637ULL, -821, -228},
+    {0x9096ea6f3848984fULL, -794, -220},
+    {0xd77485cb25823ac7ULL, -768, -212},
+    {0xa086cfcd97bf97f4ULL, -741, -204},
+    {0xef340a98172aace5ULL, -715, -196},
+    {0xb23867fb2a35b28eULL, -688, -188},
+    {0x84c8d4dfd2c63f3bULL, -661, -180},
+    {0xc5dd44271ad3cdbaULL, -635, -172},
+    {0x936b9fcebb25c996ULL, -608, -164},
+    {0xdbac6c247d62a584ULL, -582, -156},
+    {0xa3ab66580d5fdaf6ULL, -555, -148},
+    {0xf3e2f893dec3f126ULL, -529, -140},
+    {0xb5b5ada8aaff80b8ULL, -502, -132},
+    {0x87625f056c7c4a8bULL, -475, -124},
+    {0xc9bcff6034c13053ULL, -449, -116},
+    {0x964e858c91ba2655ULL, -422, -108},
+    {0xdff9772470297ebdULL, -396, -100},
+    {0xa6dfbd9fb8e5b88fULL, -369, -92},
+    {0xf8a95fcf88747d94ULL, -343, -84},
+    {0xb94470938fa89bcfULL, -316, -76},
+    {0x8a08f0f8bf0f156bULL, -289, -68},
+    {0xcdb02555653131b6ULL, -263, -60},
+    {0x993fe2c6d07b7facULL, -236, -52},
+    {0xe45c10c42a2b3b06ULL, -210, -44},
+    {0xaa242499697392d3ULL, -183, -36},
+    {0xfd87b5f28300ca0eULL, -157, -28},
+    {0xbce5086492111aebULL, -130, -20},
+    {0x8cbccc096f5088ccULL, -103, -12},
+    {0xd1b71758e219652cULL, -77, -4},
+    {0x9c40000000000000ULL, -50, 4},
+    {0xe8d4a51000000000ULL, -24, 12},
+    {0xad78ebc5ac620000ULL, 3, 20},
+    {0x813f3978f8940984ULL, 30, 28},
+    {0xc097ce7bc90715b3ULL, 56, 36},
+    {0x8f7e32ce7bea5c70ULL, 83, 44},
+    {0xd5d238a4abe98068ULL, 109, 52},
+    {0x9f4f2726179a2245ULL, 136, 60},
+    {0xed63a231d4c4fb27ULL, 162, 68},
+    {0xb0de65388cc8ada8ULL, 189, 76},
+    {0x83c7088e1aab65dbULL, 216, 84},
+    {0xc45d1df942711d9aULL, 242, 92},
+    {0x924d692ca61be758ULL, 269, 100},
+    {0xda01ee641a708deaULL, 295, 108},
+    {0xa26da3999aef774aULL, 322, 116},
+    {0xf209787bb47d6b85ULL, 348, 124},
+    {0xb454e4a179dd1877ULL, 375, 132},
+    {0x865b86925b9bc5c2ULL, 402, 140},
+    {0xc83553c5c8965d3dULL, 428, 148},
+    {0x952ab45cfa97a0b3ULL, 455, 156},
+    {0xde469fbd99a05fe3ULL, 481, 164},
+    {0xa59bc234db398c25ULL, 508, 172},
+    {0xf6c69a72a3989f5cULL, 534, 180},
+    {0xb7dcbf5354e9beceULL, 561, 188},
+    {0x88fcf317f22241e2ULL, 588, 196},
+    {0xcc20ce9bd35c78a5ULL, 614, 204},
+    {0x98165af37b2153dfULL, 641, 212},
+    {0xe2a0b5dc971f303aULL, 667, 220},
+    {0xa8d9d1535ce3b396ULL, 694, 228},
+    {0xfb9b7cd9a4a7443cULL, 720, 236},
+    {0xbb764c4ca7a44410ULL, 747, 244},
+    {0x8bab8eefb6409c1aULL, 774, 252},
+    {0xd01fef10a657842cULL, 800, 260},
+    {0x9b10a4e5e9913129ULL, 827, 268},
+    {0xe7109bfba19c0c9dULL, 853, 276},
+    {0xac2820d9623bf429ULL, 880, 284},
+    {0x80444b5e7aa7cf85ULL, 907, 292},
+    {0xbf21e44003acdd2dULL, 933, 300},
+    {0x8e679c2f5e44ff8fULL, 960, 308},
+    {0xd433179d9c8cb841ULL, 986, 316},
+    {0x9e19db92b4e31ba9ULL, 1013, 324},
+    {0xeb96bf6ebadf77d9ULL, 1039, 332},
+    {0xaf87023b9bf0ee6bULL, 1066, 340},
+};
+
+#define CACHED_POWERS_OFFSET 348 /* -(first decimal_exponent) */
+#define CACHED_POWERS_STEP 8     /* decimal_exponent distance */
+#define MIN_TARGET_EXPONENT (-60)
+#define MAX_FAST_DIGITS 17       /* plus one more for rounding */
+
+/* (a * b) / 2**64, rounded */
+static inline uint64_t
+multiply_rounded(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 p = (unsigned __int128) a * b;
+  return (uint64_t) (p >> 64) + ((uint64_t) p >> 63);
+#else
+  uint64_t a_hi = a >> 32, a_lo = a & 0xffffffff;
+  uint64_t b_hi = b >> 32, b_lo = b & 0xffffffff;
+  uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo;
+  uint64_t mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff) +
+                 ((uint64_t) 1 << 31);
+  return a_hi * b_hi + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+/*
+ *  Writes the leading 'digits' significant decimal digits of a finite
+ *  x > 0, truncated, and returns the next digit in *next_digit and the
+ *  decimal exponent in *expo, so that x = 0.(digits)(next)... * 10**expo.
+ *  Succeeds only when the digits are certain and some nonzero digit
+ *  follows the next one (i.e., x is inexact at that precision); returns
+ *  0 otherwise, and the exact methods must be used instead.
+ */
+int
+__fortio_fast_digits(char *out, int digits, int *next_digit, int *expo,
+                     double x)
+{
+  uint64_t raw = RAW_BITS(x);
+  uint64_t f = raw & MANTISSA_MASK;
+  int biased_exponent = (raw >> EXPLICIT_MANTISSA_BITS) & RJ_EXPONENT_MASK;
+  int e, k, index, shift, length = 0, kappa, want = digits + 1;
+  const struct cached_power *power;
+  uint64_t w, one, fraction, rest, ten_kappa, unit = 1;
+  uint32_t integral, divisor;
+
+  if (digits < 1 || digits > MAX_FAST_DIGITS ||
+      biased_exponent == INF_OR_NAN_EXPONENT || x <= 0)
+    return false;
+
+  /* normalize so that bit 63 is set */
+  if (biased_exponent == 0) {
+    e = 1 - 1075;
+  } else {
+    f |= IMPLICIT_NORMALIZED_BIT;
+    e = biased_exponent - 1075;
+  }
+  while (!(f & SIGN_BIT)) {
+    f <<= 1;
+    --e;
+  }
+
+  /* the cached power that brings e + 64 into [-60, -32] */
+  k = MIN_TARGET_EXPONENT - (e + 64) + 63;
+  k = k >= 0 ? (k * 78913 + (1 << 18) - 1) >> 18 : -((-k * 78913) >> 18);
+  index = (CACHED_POWERS_OFFSET + k - 1) / CACHED_POWERS_STEP + 1;
+  power = &cached_powers[index];
+  w = multiply_rounded(f, power->significand);
+  shift = -(e + power->binary_exponent + 64);
+  if (shift < 32 || shift > -MIN_TARGET_EXPONENT)
+    return false;
+  one = (uint64_t) 1 << shift;
+  integral = w >> shift;
+  fraction = w & (one - 1);
+
+  /* digits of the integer part */
+  for (divisor = 1000000000, kappa = 10; divisor > integral;
+       divisor /= 10, --kappa) {
+  }
+  while (kappa > 0) {
+    out[length++] = '0' + integral / divisor;
+    integral %= divisor;
+    --kappa;
+    if (length == want)
+      break;
+    divisor /= 10;
+  }
+
+  if (length == want) {
+    rest = ((uint64_t) integral << shift) + fraction;
+    ten_kappa = (uint64_t) divisor << shift;
+  } else {
+    /* digits of the fraction part */
+    while (length < want) {
+      if (fraction <= unit)
+        return false;
+      fraction *= 10;
+      unit *= 10;
+      out[length++] = '0' + (fraction >> shift);
+      fraction &= one - 1;
+      --kappa;
+    }
+    rest = fraction;
+    ten_kappa = one;
+  }
+
+  /* The true remainder lies within 'unit' of 'rest'; it must stay
+   * inside (0, ten_kappa) for the digits to be right and inexact.
+   */
+  if (unit >= ten_kappa || rest <= unit || rest >= ten_kappa - unit)
+    return false;
+
+  *next_digit = out[digits] - '0';
+  *expo = kappa - power->decimal_exponent + want;
+  return true;
+}
+
 /*
  *  Discern the CPU's current FPCR rounding mode by the portable means
  *  of observing its effect on floating-point addition.
@@ -845,8 +1063,8 @@ ED_format(char *out_buffer, int width, const struct formatting_control *control,
 
     char buffer[MAX_INT_DECIMAL_DIGITS +
                 MAX_FRACTION_SIGNIFICANT_DECIMAL_DIGITS];
-    int int_part_digits = format_int_part(buffer, MAX_INT_DECIMAL_DIGITS, absx);
-    char *payload = buffer + MAX_INT_DECIMAL_DIGITS - int_part_digits;
+    int int_part_digits;
+    char *payload = buffer + MAX_INT_DECIMAL_DIGITS;
     int trailing_zeroes = 0;
     int ESN = control->ESN_format;
     int extra_digits = ESN == 'N' ? 3 :
@@ -862,13 +1080,23 @@ ED_format(char *out_buffer, int width, const struct formatting_control *control,
                                ESN == '\0' ? control->exponent_digits : 0;
     int expo_digits = explicit_expo_digits;
     int significant_digits = frac_digits + extra_digits - lost_digits;
-    int frac_part_digits = significant_digits - int_part_digits;
+    int frac_part_digits;
     int expo, abs_expo;
     int leading_spaces;
     bool all_digits_zero = false;
     int next_digit_for_rounding = 0, last_digit_for_rounding = 0;
     bool is_inexact = false;
 
+    if (absx != 0 &&
+        __fortio_fast_digits(payload, significant_digits,
+                             &next_digit_for_rounding, &expo, absx)) {
+      is_inexact = true;
+      goto digits_ready;
+    }
+
+    int_part_digits = format_int_part(buffer, MAX_INT_DECIMAL_DIGITS, absx);
+    payload -= int_part_digits;
+    frac_part_digits = significant_digits - int_part_digits;
     if (frac_part_digits > MAX_FRACTION_SIGNIFICANT_DECIMAL_DIGITS) {
       trailing_zeroes = frac_part_digits -
                         MAX_FRACTION_SIGNIFICANT_DECIMAL_DIGITS;
@@ -896,6 +1124,7 @@ ED_format(char *out_buffer, int width, const struct formatting_control *control,
       expo = int_part_digits;
     }
 
+  digits_ready:
     /* "Engineering" (EN) format: ensure that the exponent is a multiple of 3.
      * extra_digits and scaling are both 3 now, but they can be reduced
      * to 2 or 1 in order to make the exponent a multiple of three.
@@ -54,4 +54,14 @@ void __fortio_format_double(char *out, int width,
                             const struct formatting_control *control,
                             double x);
 
+/*
+ *  Fast path for the leading 1 to 17 significant decimal digits of a
+ *  finite double x > 0, truncated, with the digit that follows them
+ *  in *next_digit and x = 0.(digits)(next)... * 10**(*expo).  Returns
+ *  nonzero only when the digits are certain and x has more nonzero
+ *  digits after *next_digit.
+ */
+int __fortio_fast_digits(char *out, int digits, int *next_digit, int *expo,
+                         double x);
+
 #endif /* FORMAT_DOUBLE_H_ */
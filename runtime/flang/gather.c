@@ -18,50 +18,89 @@
 #include "stdioInterf.h"
 #include "fioMacros.h"
 
+#if defined(__GNUC__) && defined(__x86_64__)
+#define GATHER_HAVE_AVX
+#include <immintrin.h>
+#endif
+
 /* local gather functions */
 
-static void
-local_gather_INT1(int n, __INT1_T *dst, __INT1_T *src, int *gv)
+/* 4 and 8 byte elements are moved as integers of that size, with AVX2 or
+   AVX-512 gathers where the cpu has them. */
+
+#ifdef GATHER_HAVE_AVX
+
+/* 0 neither, 1 AVX2, 2 AVX-512F */
+
+static int
+gather_isa(void)
 {
-  int i;
-  for (i = 0; i < n; ++i)
-    dst[i] = src[gv[i]];
+  static int isa = -1;
+
+  if (isa < 0) {
+    if (__builtin_cpu_supports("avx512f"))
+      isa = 2;
+    else if (__builtin_cpu_supports("avx2"))
+      isa = 1;
+    else
+      isa = 0;
+  }
+  return isa;
 }
 
-static void
-local_gather_INT2(int n, __INT2_T *dst, __INT2_T *src, int *gv)
+static int __attribute__((target("avx512f")))
+gather_avx512_4(int n, __INT4_T *dst, __INT4_T *src, int *gv)
 {
   int i;
-  for (i = 0; i < n; ++i)
-    dst[i] = src[gv[i]];
+
+  for (i = 0; i + 16 <= n; i += 16)
+    _mm512_storeu_si512(
+        dst + i, _mm512_i32gather_epi32(_mm512_loadu_si512(gv + i), src, 4));
+  return i;
 }
 
-static void
-local_gather_INT4(int n, __INT4_T *dst, __INT4_T *src, int *gv)
+static int __attribute__((target("avx512f")))
+gather_avx512_8(int n, __INT8_T *dst, __INT8_T *src, int *gv)
 {
   int i;
-  for (i = 0; i < n; ++i)
-    dst[i] = src[gv[i]];
+
+  for (i = 0; i + 8 <= n; i += 8)
+    _mm512_storeu_si512(
+        dst + i,
+        _mm512_i32gather_epi64(_mm256_loadu_si256((__m256i *)(gv + i)), src,
+                               8));
+  return i;
 }
 
-static void
-local_gather_INT8(int n, __INT8_T *dst, __INT8_T *src, int *gv)
+static int __attribute__((target("avx2")))
+gather_avx2_4(int n, __INT4_T *dst, __INT4_T *src, int *gv)
 {
   int i;
-  for (i = 0; i < n; ++i)
-    dst[i] = src[gv[i]];
+
+  for (i = 0; i + 8 <= n; i += 8)
+    _mm256_storeu_si256(
+        (__m256i *)(dst + i),
+        _mm256_i32gather_epi32((int *)src,
+                               _mm256_loadu_si256((__m256i *)(gv + i)), 4));
+  return i;
 }
 
-static void
-local_gather_LOG1(int n, __LOG1_T *dst, __LOG1_T *src, int *gv)
+static int __attribute__((target("avx2")))
+gather_avx2_8(int n, __INT8_T *dst, __INT8_T *src, int *gv)
 {
   int i;
-  for (i = 0; i < n; ++i)
-    dst[i] = src[gv[i]];
+
+  for (i = 0; i + 4 <= n; i += 4)
+    _mm256_storeu_si256(
+        (__m256i *)(dst + i),
+        _mm256_i32gather_epi64((long long *)src,
+                               _mm_loadu_si128((__m128i *)(gv + i)), 8));
+  return i;
 }
+#endif
 
 static void
-local_gather_LOG2(int n, __LOG2_T *dst, __LOG2_T *src, int *gv)
+local_gather_INT1(int n, __INT1_T *dst, __INT1_T *src, int *gv)
 {
   int i;
   for (i = 0; i < n; ++i)
@@ -69,7 +108,7 @@ local_gather_LOG2(int n, __LOG2_T *dst, __LOG2_T *src, int *gv)
 }
 
 static void
-local_gather_LOG4(int n, __LOG4_T *dst, __LOG4_T *src, int *gv)
+local_gather_INT2(int n, __INT2_T *dst, __INT2_T *src, int *gv)
 {
   int i;
   for (i = 0; i < n; ++i)
@@ -77,7 +116,7 @@ local_gather_LOG4(int n, __LOG4_T *dst, __LOG4_T *src, int *gv)
 }
 
 static void
-local_gather_LOG8(int n, __LOG8_T *dst, __LOG8_T *src, int *gv)
+local_gather_LOG1(int n, __LOG1_T *dst, __LOG1_T *src, int *gv)
 {
   int i;
   for (i = 0; i < n; ++i)
@@ -85,7 +124,7 @@ local_gather_LOG8(int n, __LOG8_T *dst, __LOG8_T *src, int *gv)
 }
 
 static void
-local_gather_REAL4(int n, __REAL4_T *dst, __REAL4_T *src, int *gv)
+local_gather_LOG2(int n, __LOG2_T *dst, __LOG2_T *src, int *gv)
 {
   int i;
   for (i = 0; i < n; ++i)
@@ -93,23 +132,47 @@ local_gather_REAL4(int n, __REAL4_T *dst, __REAL4_T *src, int *gv)
 }
 
 static void
-local_gather_REAL8(int n, __REAL8_T *dst, __REAL8_T *src, int *gv)
+local_gather_4(int n, __INT4_T *dst, __INT4_T *src, int *gv)
 {
   int i;
-  for (i = 0; i < n; ++i)
+
+  i = 0;
+#ifdef GATHER_HAVE_AVX
+  switch (gather_isa()) {
+  case 2:
+    i = gather_avx512_4(n, dst, src, gv);
+    break;
+  case 1:
+    i = gather_avx2_4(n, dst, src, gv);
+    break;
+  }
+#endif
+  for (; i < n; ++i)
     dst[i] = src[gv[i]];
 }
 
 static void
-local_gather_REAL16(int n, __REAL16_T *dst, __REAL16_T *src, int *gv)
+local_gather_8(int n, __INT8_T *dst, __INT8_T *src, int *gv)
 {
   int i;
-  for (i = 0; i < n; ++i)
+
+  i = 0;
+#ifdef GATHER_HAVE_AVX
+  switch (gather_isa()) {
+  case 2:
+    i = gather_avx512_8(n, dst, src, gv);
+    break;
+  case 1:
+    i = gather_avx2_8(n, dst, src, gv);
+    break;
+  }
+#endif
+  for (; i < n; ++i)
     dst[i] = src[gv[i]];
 }
 
 static void
-local_gather_CPLX8(int n, __CPLX8_T *dst, __CPLX8_T *src, int *gv)
+local_gather_REAL16(int n, __REAL16_T *dst, __REAL16_T *src, int *gv)
 {
   int i;
   for (i = 0; i < n; ++i)
@@ -142,7 +205,7 @@ void (*__fort_local_gather[__NTYPES])() = {
     NULL,                /* C   unsigned long int */
     NULL,                /* C   float */
     NULL,                /* C   double */
-    local_gather_CPLX8,  /*   F complex*8 (2x real*4) */
+    local_gather_8,      /*   F complex*8 (2x real*4) */
     local_gather_CPLX16, /*   F complex*16 (2x real*8) */
     NULL,                /* C   signed char */
     NULL,                /* C   unsigned char */
@@ -152,16 +215,16 @@ void (*__fort_local_gather[__NTYPES])() = {
     NULL,                /* C   unsigned long long */
     local_gather_LOG1,   /*   F logical*1 */
     local_gather_LOG2,   /*   F logical*2 */
-    local_gather_LOG4,   /*   F logical*4 */
-    local_gather_LOG8,   /*   F logical*8 */
+    local_gather_4,      /*   F logical*4 */
+    local_gather_8,      /*   F logical*8 */
     NULL,                /*   F typeless */
     NULL,                /*   F double typeless */
     NULL,                /*   F ncharacter - kanji */
     local_gather_INT2,   /*   F integer*2 */
-    local_gather_INT4,   /*   F integer*4, integer */
-    local_gather_INT8,   /*   F integer*8 */
-    local_gather_REAL4,  /*   F real*4, real */
-    local_gather_REAL8,  /*   F real*8, double precision */
+    local_gather_4,      /*   F integer*4, integer */
+    local_gather_8,      /*   F integer*8 */
+    local_gather_4,      /*   F real*4, real */
+    local_gather_8,      /*   F real*8, double precision */
     local_gather_REAL16, /*   F real*16 */
     local_gather_CPLX32, /*   F complex*32 (2x real*16) */
     NULL,                /*   F quad typeless */
@@ -18,60 +18,135 @@
 #include "stdioInterf.h"
 #include "fioMacros.h"
 
+#if defined(__GNUC__) && defined(__x86_64__)
+#define GATHSCAT_HAVE_AVX
+#include <immintrin.h>
+#endif
+
 extern void (*__fort_local_scatter[__NTYPES])();
 extern void (*__fort_local_gathscat[__NTYPES])();
 
-/* local scatter functions */
+/* 4 and 8 byte elements are moved as integers of that size, with AVX2
+   gathers and AVX-512 gathers and scatters where the cpu has them.  A
+   vector scatter stores lanes with equal offsets in lane order, so the
+   last of several elements scattered to one place wins, as in the
+   scalar loops.  dst and src are different arrays here, never sections
+   of one another. */
 
-void
-local_scatter_WRAPPER(int n, void *dst, int *sv, void *src, __INT_T kind)
-{
+#ifdef GATHSCAT_HAVE_AVX
 
-  __fort_local_scatter[kind](n, dst, sv, src);
+/* 0 neither, 1 AVX2, 2 AVX-512F */
+
+static int
+gathscat_isa(void)
+{
+  static int isa = -1;
+
+  if (isa < 0) {
+    if (__builtin_cpu_supports("avx512f"))
+      isa = 2;
+    else if (__builtin_cpu_supports("avx2"))
+      isa = 1;
+    else
+      isa = 0;
+  }
+  return isa;
 }
 
-static void
-local_scatter_INT1(int n, __INT1_T *dst, int *sv, __INT1_T *src)
+static int __attribute__((target("avx512f")))
+scatter_avx512_4(int n, __INT4_T *dst, int *sv, __INT4_T *src)
 {
   int i;
-  for (i = 0; i < n; ++i)
-    dst[sv[i]] = src[i];
+
+  for (i = 0; i + 16 <= n; i += 16)
+    _mm512_i32scatter_epi32(dst, _mm512_loadu_si512(sv + i),
+                            _mm512_loadu_si512(src + i), 4);
+  return i;
 }
 
-static void
-local_scatter_INT2(int n, __INT2_T *dst, int *sv, __INT2_T *src)
+static int __attribute__((target("avx512f")))
+scatter_avx512_8(int n, __INT8_T *dst, int *sv, __INT8_T *src)
 {
   int i;
-  for (i = 0; i < n; ++i)
-    dst[sv[i]] = src[i];
+
+  for (i = 0; i + 8 <= n; i += 8)
+    _mm512_i32scatter_epi64(dst, _mm256_loadu_si256((__m256i *)(sv + i)),
+                            _mm512_loadu_si512(src + i), 8);
+  return i;
 }
 
-static void
-local_scatter_INT4(int n, __INT4_T *dst, int *sv, __INT4_T *src)
+static int __attribute__((target("avx512f")))
+gathscat_avx512_4(int n, __INT4_T *dst, int *sv, __INT4_T *src, int *gv)
 {
   int i;
-  for (i = 0; i < n; ++i)
-    dst[sv[i]] = src[i];
+
+  for (i = 0; i + 16 <= n; i += 16)
+    _mm512_i32scatter_epi32(
+        dst, _mm512_loadu_si512(sv + i),
+        _mm512_i32gather_epi32(_mm512_loadu_si512(gv + i), src, 4), 4);
+  return i;
 }
 
-static void
-local_scatter_INT8(int n, __INT8_T *dst, int *sv, __INT8_T *src)
+static int __attribute__((target("avx512f")))
+gathscat_avx512_8(int n, __INT8_T *dst, int *sv, __INT8_T *src, int *gv)
 {
   int i;
-  for (i = 0; i < n; ++i)
-    dst[sv[i]] = src[i];
+
+  for (i = 0; i + 8 <= n; i += 8)
+    _mm512_i32scatter_epi64(
+        dst, _mm256_loadu_si256((__m256i *)(sv + i)),
+        _mm512_i32gather_epi64(_mm256_loadu_si256((__m256i *)(gv + i)), src,
+                               8),
+        8);
+  return i;
 }
 
-static void
-local_scatter_LOG1(int n, __LOG1_T *dst, int *sv, __LOG1_T *src)
+static int __attribute__((target("avx2")))
+gathscat_avx2_4(int n, __INT4_T *dst, int *sv, __INT4_T *src, int *gv)
 {
-  int i;
-  for (i = 0; i < n; ++i)
-    dst[sv[i]] = src[i];
+  __INT4_T t[8];
+  int i, j;
+
+  for (i = 0; i + 8 <= n; i += 8) {
+    _mm256_storeu_si256(
+        (__m256i *)t,
+        _mm256_i32gather_epi32((int *)src,
+                               _mm256_loadu_si256((__m256i *)(gv + i)), 4));
+    for (j = 0; j < 8; ++j)
+      dst[sv[i + j]] = t[j];
+  }
+  return i;
+}
+
+static int __attribute__((target("avx2")))
+gathscat_avx2_8(int n, __INT8_T *dst, int *sv, __INT8_T *src, int *gv)
+{
+  __INT8_T t[4];
+  int i, j;
+
+  for (i = 0; i + 4 <= n; i += 4) {
+    _mm256_storeu_si256(
+        (__m256i *)t,
+        _mm256_i32gather_epi64((long long *)src,
+                               _mm_loadu_si128((__m128i *)(gv + i)), 8));
+    for (j = 0; j < 4; ++j)
+      dst[sv[i + j]] = t[j];
+  }
+  return i;
+}
+#endif
+
+/* local scatter functions */
+
+void
+local_scatter_WRAPPER(int n, void *dst, int *sv, void *src, __INT_T kind)
+{
+
+  __fort_local_scatter[kind](n, dst, sv, src);
 }
 
 static void
-local_scatter_LOG2(int n, __LOG2_T *dst, int *sv, __LOG2_T *src)
+local_scatter_INT1(int n, __INT1_T *dst, int *sv, __INT1_T *src)
 {
   int i;
   for (i = 0; i < n; ++i)
@@ -79,7 +154,7 @@ local_scatter_LOG2(int n, __LOG2_T *dst, int *sv, __LOG2_T *src)
 }
 
 static void
-local_scatter_LOG4(int n, __LOG4_T *dst, int *sv, __LOG4_T *src)
+local_scatter_INT2(int n, __INT2_T *dst, int *sv, __INT2_T *src)
 {
   int i;
   for (i = 0; i < n; ++i)
@@ -87,7 +162,7 @@ local_scatter_LOG4(int n, __LOG4_T *dst, int *sv, __LOG4_T *src)
 }
 
 static void
-local_scatter_LOG8(int n, __LOG8_T *dst, int *sv, __LOG8_T *src)
+local_scatter_LOG1(int n, __LOG1_T *dst, int *sv, __LOG1_T *src)
 {
   int i;
   for (i = 0; i < n; ++i)
@@ -95,7 +170,7 @@ local_scatter_LOG8(int n, __LOG8_T *dst, int *sv, __LOG8_T *src)
 }
 
 static void
-local_scatter_REAL4(int n, __REAL4_T *dst, int *sv, __REAL4_T *src)
+local_scatter_LOG2(int n, __LOG2_T *dst, int *sv, __LOG2_T *src)
 {
   int i;
   for (i = 0; i < n; ++i)
@@ -103,23 +178,35 @@ local_scatter_REAL4(int n, __REAL4_T *dst, int *sv, __REAL4_T *src)
 }
 
 static void
-local_scatter_REAL8(int n, __REAL8_T *dst, int *sv, __REAL8_T *src)
+local_scatter_4(int n, __INT4_T *dst, int *sv, __INT4_T *src)
 {
   int i;
-  for (i = 0; i < n; ++i)
+
+  i = 0;
+#ifdef GATHSCAT_HAVE_AVX
+  if (gathscat_isa() == 2)
+    i = scatter_avx512_4(n, dst, sv, src);
+#endif
+  for (; i < n; ++i)
     dst[sv[i]] = src[i];
 }
 
 static void
-local_scatter_REAL16(int n, __REAL16_T *dst, int *sv, __REAL16_T *src)
+local_scatter_8(int n, __INT8_T *dst, int *sv, __INT8_T *src)
 {
   int i;
-  for (i = 0; i < n; ++i)
+
+  i = 0;
+#ifdef GATHSCAT_HAVE_AVX
+  if (gathscat_isa() == 2)
+    i = scatter_avx512_8(n, dst, sv, src);
+#endif
+  for (; i < n; ++i)
     dst[sv[i]] = src[i];
 }
 
 static void
-local_scatter_CPLX8(int n, __CPLX8_T *dst, int *sv, __CPLX8_T *src)
+local_scatter_REAL16(int n, __REAL16_T *dst, int *sv, __REAL16_T *src)
 {
   int i;
   for (i = 0; i < n; ++i)
@@ -152,7 +239,7 @@ void (*__fort_local_scatter[__NTYPES])() = {
     NULL,                 /* C   unsigned long int */
     NULL,                 /* C   float */
     NULL,                 /* C   double */
-    local_scatter_CPLX8,  /*   F complex*8 (2x real*4) */
+    local_scatter_8,      /*   F complex*8 (2x real*4) */
     local_scatter_CPLX16, /*   F complex*16 (2x real*8) */
     NULL,                 /* C   signed char */
     NULL,                 /* C   unsigned char */
@@ -162,16 +249,16 @@ void (*__fort_local_scatter[__NTYPES])() = {
     NULL,                 /* C   unsigned long long */
     local_scatter_LOG1,   /*   F logical*1 */
     local_scatter_LOG2,   /*   F logical*2 */
-    local_scatter_LOG4,   /*   F logical*4 */
-    local_scatter_LOG8,   /*   F logical*8 */
+    local_scatter_4,      /*   F logical*4 */
+    local_scatter_8,      /*   F logical*8 */
     NULL,                 /*   F typeless */
     NULL,                 /*   F double typeless */
     NULL,                 /*   F ncharacter - kanji */
     local_scatter_INT2,   /*   F integer*2 */
-    local_scatter_INT4,   /*   F integer*4, integer */
-    local_scatter_INT8,   /*   F integer*8 */
-    local_scatter_REAL4,  /*   F real*4, real */
-    local_scatter_REAL8,  /*   F real*8, double precision */
+    local_scatter_4,      /*   F integer*4, integer */
+    local_scatter_8,      /*   F integer*8 */
+    local_scatter_4,      /*   F real*4, real */
+    local_scatter_8,      /*   F real*8, double precision */
     local_scatter_REAL16, /*   F real*16 */
     local_scatter_CPLX32, /*   F complex*32 (2x real*16) */
     NULL,                 /*   F quad typeless */
@@ -181,6 +268,30 @@ void (*__fort_local_scatter[__NTYPES])() = {
 
 /* local gather-scatter functions */
 
+/* local gather-scatter through the runs of a plan: runs holds nruns
+   (start, count) pairs, in order, of elements whose scatter and gather
+   offsets both go up by one.  each run is one block copy of len byte
+   elements; the elements between runs go to the per-type function. */
+
+void
+local_gathscat_RUNS(int n, char *dst, int *sv, char *src, int *gv,
+                    __INT_T kind, __INT_T len, int *runs, int nruns)
+{
+  int i, r, start;
+
+  i = 0;
+  for (r = 0; r < nruns; ++r) {
+    start = runs[2 * r];
+    if (start > i)
+      __fort_local_gathscat[kind](start - i, dst, sv + i, src, gv + i);
+    memmove(dst + (long)sv[start] * len, src + (long)gv[start] * len,
+            (size_t)runs[2 * r + 1] * len);
+    i = start + runs[2 * r + 1];
+  }
+  if (n > i)
+    __fort_local_gathscat[kind](n - i, dst, sv + i, src, gv + i);
+}
+
 void
 local_gathscat_WRAPPER(int n, void *dst, int *sv, void *src, int *gv,
                        __INT_T kind)
@@ -205,22 +316,6 @@ local_gathscat_INT2(int n, __INT2_T *dst, int *sv, __INT2_T *src, int *gv)
     dst[sv[i]] = src[gv[i]];
 }
 
-static void
-local_gathscat_INT4(int n, __INT4_T *dst, int *sv, __INT4_T *src, int *gv)
-{
-  int i;
-  for (i = 0; i < n; ++i)
-    dst[sv[i]] = src[gv[i]];
-}
-
-static void
-local_gathscat_INT8(int n, __INT8_T *dst, int *sv, __INT8_T *src, int *gv)
-{
-  int i;
-  for (i = 0; i < n; ++i)
-    dst[sv[i]] = src[gv[i]];
-}
-
 static void
 local_gathscat_LOG1(int n, __LOG1_T *dst, int *sv, __LOG1_T *src, int *gv)
 {
@@ -238,34 +333,42 @@ local_gathscat_LOG2(int n, __LOG2_T *dst, int *sv, __LOG2_T *src, int *gv)
 }
 
 static void
-local_gathscat_LOG4(int n, __LOG4_T *dst, int *sv, __LOG4_T *src, int *gv)
+local_gathscat_4(int n, __INT4_T *dst, int *sv, __INT4_T *src, int *gv)
 {
   int i;
-  for (i = 0; i < n; ++i)
-    dst[sv[i]] = src[gv[i]];
-}
 
-static void
-local_gathscat_LOG8(int n, __LOG8_T *dst, int *sv, __LOG8_T *src, int *gv)
-{
-  int i;
-  for (i = 0; i < n; ++i)
+  i = 0;
+#ifdef GATHSCAT_HAVE_AVX
+  switch (gathscat_isa()) {
+  case 2:
+    i = gathscat_avx512_4(n, dst, sv, src, gv);
+    break;
+  case 1:
+    i = gathscat_avx2_4(n, dst, sv, src, gv);
+    break;
+  }
+#endif
+  for (; i < n; ++i)
     dst[sv[i]] = src[gv[i]];
 }
 
 static void
-local_gathscat_REAL4(int n, __REAL4_T *dst, int *sv, __REAL4_T *src, int *gv)
+local_gathscat_8(int n, __INT8_T *dst, int *sv, __INT8_T *src, int *gv)
 {
   int i;
-  for (i = 0; i < n; ++i)
-    dst[sv[i]] = src[gv[i]];
-}
 
-static void
-local_gathscat_REAL8(int n, __REAL8_T *dst, int *sv, __REAL8_T *src, int *gv)
-{
-  int i;
-  for (i = 0; i < n; ++i)
+  i = 0;
+#ifdef GATHSCAT_HAVE_AVX
+  switch (gathscat_isa()) {
+  case 2:
+    i = gathscat_avx512_8(n, dst, sv, src, gv);
+    break;
+  case 1:
+    i = gathscat_avx2_8(n, dst, sv, src, gv);
+    break;
+  }
+#endif
+  for (; i < n; ++i)
     dst[sv[i]] = src[gv[i]];
 }
 
@@ -277,14 +380,6 @@ local_gathscat_REAL16(int n, __REAL16_T *dst, int *sv, __REAL16_T *src, int *gv)
     dst[sv[i]] = src[gv[i]];
 }
 
-static void
-local_gathscat_CPLX8(int n, __CPLX8_T *dst, int *sv, __CPLX8_T *src, int *gv)
-{
-  int i;
-  for (i = 0; i < n; ++i)
-    dst[sv[i]] = src[gv[i]];
-}
-
 static void
 local_gathscat_CPLX16(int n, __CPLX16_T *dst, int *sv, __CPLX16_T *src, int *gv)
 {
@@ -311,7 +406,7 @@ void (*__fort_local_gathscat[__NTYPES])() = {
     NULL,                  /* C   unsigned long int */
     NULL,                  /* C   float */
     NULL,                  /* C   double */
-    local_gathscat_CPLX8,  /*   F complex*8 (2x real*4) */
+    local_gathscat_8,      /*   F complex*8 (2x real*4) */
     local_gathscat_CPLX16, /*   F complex*16 (2x real*8) */
     NULL,                  /* C   signed char */
     NULL,                  /* C   unsigned char */
@@ -321,16 +416,16 @@ void (*__fort_local_gathscat[__NTYPES])() = {
     NULL,                  /* C   unsigned long long */
     local_gathscat_LOG1,   /*   F logical*1 */
     local_gathscat_LOG2,   /*   F logical*2 */
-    local_gathscat_LOG4,   /*   F logical*4 */
-    local_gathscat_LOG8,   /*   F logical*8 */
+    local_gathscat_4,      /*   F logical*4 */
+    local_gathscat_8,      /*   F logical*8 */
     NULL,                  /*   F typeless */
     NULL,                  /*   F double typeless */
     NULL,                  /*   F ncharacter - kanji */
     local_gathscat_INT2,   /*   F integer*2 */
-    local_gathscat_INT4,   /*   F integer*4, integer */
-    local_gathscat_INT8,   /*   F integer*8 */
-    local_gathscat_REAL4,  /*   F real*4, real */
-    local_gathscat_REAL8,  /*   F real*8, double precision */
+    local_gathscat_4,      /*   F integer*4, integer */
+    local_gathscat_8,      /*   F integer*8 */
+    local_gathscat_4,      /*   F real*4, real */
+    local_gathscat_8,      /*   F real*8, double precision */
     local_gathscat_REAL16, /*   F real*16 */
     local_gathscat_CPLX32, /*   F complex*32 (2x real*16) */
     NULL,                  /*   F quad typeless */
@@ -310,8 +310,24 @@ typedef struct atag {
 
 /*  declare global variables for Fortran I/O:  */
 
+/* The state of the I/O statement being executed is per thread (FIO_TLS),
+ * so that statements on different units can run at the same time.  Only
+ * the list of fcbs and the fcbs themselves are shared; see csect.c for the
+ * locks.
+ */
+
+/* Point a thread's stack of saved statement states, head, and its current
+ * entry, g, at the thread's static array the first time they are used; a
+ * thread-local pointer can't be initialized with the address of another
+ * thread-local variable.
+ */
+#define FIO_INIT_GBL(g, head, first)                                           \
+  do {                                                                         \
+    if ((head) == NULL)                                                        \
+      (g) = (head) = &(first)[0];                                              \
+  } while (0)
+
 typedef struct {
-  FIO_FCB *fcbs; /* pointer to list of allocated fcbs */
   INT *enctab;   /* pointer to buffer w encoded format */
   char *fname;   /* file name for OPEN error messages */
   int fnamelen;
@@ -325,12 +341,13 @@ typedef struct {
 
 #include <errno.h>
 
-extern FIO_TBL fioFcbTbls;
+extern FIO_TLS FIO_TBL fioFcbTbls;
+extern FIO_FCB *fioFcbs; /* pointer to list of allocated fcbs */
 #ifdef WINNT
 extern FIO_FCB *__get_fio_fcbs(void);
 #define GET_FIO_FCBS __get_fio_fcbs()
 #else
-#define GET_FIO_FCBS fioFcbTbls.fcbs
+#define GET_FIO_FCBS fioFcbs
 
 #endif
 
@@ -355,7 +372,12 @@ extern int __fortio_assign(char *, int, __CLEN_T, AVAL *);
 extern char *__fortio_ecvt(double, int, int *, int *, int);
 extern char *__fortio_fcvt(__BIGREAL_T, int, int, int *, int *, int);
 WIN_MSVCRT_IMP double WIN_CDECL strtod(const char *, char **);
-#define __fortio_strtod(x, y) strtod(x, y)
+extern double __fortio_strtod(char *, char **);
+
+/*****  csect.c  *****/
+extern void __fortio_lock_unit(int unit);
+extern int __fortio_lock_fcbs(void);
+extern void __fortio_unlock_fcbs(int locked);
 
 /*****  error.c  *****/
 extern VOID set_gbl_newunit(bool newunit);
@@ -383,6 +405,10 @@ extern VOID __fortio_fmtend(void);
 #endif
 extern int __fortio_no_minus_zero(void);
 int __fortio_new_fp_formatter(void);
+extern int __fortio_io_stats(void);
+
+/*****  encodefmt.c  *****/
+extern void __fortio_fmt_cache_stats(void);
 
 /*****  hpfio.c  *****/
 extern VOID __fort_status_init(__INT_T *, __INT_T *);
@@ -399,6 +425,7 @@ extern VOID __fortio_cleanup_fcb(void);
 extern FIO_FCB *__fortio_rwinit(int, int, __INT_T *, int);
 extern FIO_FCB *__fortio_find_unit(int);
 extern int __fortio_zeropad(FILE *, long);
+extern long __fortio_getrec(FILE *, char **, size_t *, int *);
 extern bool __fortio_eq_str(char *, __CLEN_T, char *);
 extern void *__fortio_fiofcb_asyptr(FIO_FCB *);
 extern bool __fortio_fiofcb_asy_rw(FIO_FCB *);
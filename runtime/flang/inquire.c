@@ -30,7 +30,7 @@
 #define access _access
 #endif
 
-static FIO_FCB *f2; /* save fcb for inquire2 */
+static FIO_TLS FIO_FCB *f2; /* save fcb for inquire2 */
 
 static void copystr(char *dst, /*  destination string, blank-filled */
                     int len,   /*  length of destination space */
@@ -45,6 +45,20 @@ static void copystr(char *dst, /*  destination string, blank-filled */
 
 #define SINTN 64 /* max number of return ints */
 
+/* the fcb of the file named by the len characters at name, if it is
+   connected; the caller holds the fcb list lock */
+
+static FIO_FCB *
+find_file(char *name, __CLEN_T len)
+{
+  FIO_FCB *f;
+
+  for (f = fioFcbs; f; f = f->next)
+    if (len == strlen(f->name) && strncmp(name, f->name, len) == 0)
+      break;
+  return f;
+}
+
 /* internal inquire */
 
 static int
@@ -86,10 +100,23 @@ inquire(__INT_T *unit, char *file_ptr, __INT_T *bitv, __INT_T *iostat,
       len = 0;
       f = NULL;
     } else {
-      for (f = fioFcbTbls.fcbs; f; f = f->next)
-        if (len == strlen(f->name) &&
-            strncmp(file_ptr + nleadb, f->name, len) == 0)
-          break;
+      int locked = __fortio_lock_fcbs();
+      int unit = 0;
+      f = find_file(file_ptr + nleadb, len);
+      if (f != NULL)
+        unit = f->unit;
+      __fortio_unlock_fcbs(locked);
+      if (f != NULL) {
+        /* another thread may close the file once the list is unlocked,
+           and a unit lock is taken before the list lock, not after:
+           lock the unit, then look the file up again */
+        __fortio_lock_unit(unit);
+        locked = __fortio_lock_fcbs();
+        f = find_file(file_ptr + nleadb, len);
+        if (f != NULL && f->unit != unit)
+          f = NULL; /* reconnected to another unit meanwhile */
+        __fortio_unlock_fcbs(locked);
+      }
     }
   } else { /*  inquire by unit  */
     if (ILLEGAL_UNIT(*unit)) {
@@ -42,23 +42,29 @@ static int read_record(void);
 static char *alloc_rbuf(int, bool);
 static int skip_record(void);
 
-static FIO_FCB *fcb;  /* fcb of external file */
-static bool accessed; /* file has been read */
-static int byte_cnt;  /* number of bytes read */
-static int n_irecs;   /* number of internal file records */
-static bool internal_file;
-static int rec_len;
+static FIO_TLS FIO_FCB *fcb;  /* fcb of external file */
+static FIO_TLS bool accessed; /* file has been read */
+static FIO_TLS int byte_cnt;  /* number of bytes read */
+static FIO_TLS int n_irecs;   /* number of internal file records */
+static FIO_TLS bool internal_file;
+static FIO_TLS int rec_len;
 
-static int gbl_dtype; /* data type of item (global to local funcs) */
+static FIO_TLS int gbl_dtype; /* data type of item (global to local funcs) */
 
 #define RBUF_SIZE 256
-static char rbuf[RBUF_SIZE + 1];
-static unsigned rbuf_size = RBUF_SIZE;
+static FIO_TLS char rbuf[RBUF_SIZE + 1];
+static FIO_TLS unsigned rbuf_size = RBUF_SIZE;
 
-static char *rbufp = rbuf; /* ptr to read buffer */
-static char *currc;        /* current pointer in buffer */
+static FIO_TLS char *rbufp; /* ptr to read buffer */
+static FIO_TLS char *currc; /* current pointer in buffer */
 
-static char *in_recp; /* internal i/o record (user's space) */
+static FIO_TLS char *in_recp; /* internal i/o record (user's space) */
+
+/*  stuff for returning a string token */
+
+static FIO_TLS char chval[128];
+static FIO_TLS int chval_size = sizeof(chval);
+static FIO_TLS char *chvalp;
 
 struct struct_G {
   short blank_zero; /* FIO_ ZERO or NULL */
@@ -94,11 +100,12 @@ struct struct_G {
 
 typedef struct struct_G G;
 
-static G static_gbl[GBL_SIZE];
-static G *gbl = &static_gbl[0];
-static G *gbl_head = &static_gbl[0];
-static int gbl_avl = 0;
-static int gbl_size = GBL_SIZE;
+static FIO_TLS G static_gbl[GBL_SIZE];
+static FIO_TLS G *gbl;
+static FIO_TLS G *gbl_head;
+static FIO_TLS int gbl_avl = 0;
+static FIO_TLS int gbl_size = GBL_SIZE;
+#define INIT_GBL FIO_INIT_GBL(gbl, gbl_head, static_gbl)
 
 union ieee {
   double d;
@@ -131,14 +138,14 @@ static void get_junk(void);
 static bool skip_spaces(void);
 static bool find_char(int);
 
-static AVAL tknval; /* TK_VAL value returned by get_token */
-static int tkntyp;
-static int scan_err;
+static FIO_TLS AVAL tknval; /* TK_VAL value returned by get_token */
+static FIO_TLS int tkntyp;
+static FIO_TLS int scan_err;
 
 /*  Initial state for a READ statement  */
-static int repeat_cnt;
-static int prev_tkntyp;
-static bool comma_seen;
+static FIO_TLS int repeat_cnt;
+static FIO_TLS int prev_tkntyp;
+static FIO_TLS bool comma_seen;
 
 static void
 save_gbl()
@@ -221,6 +228,8 @@ static void
 save_samefcb()
 {
   G *tmp_gbl;
+
+  INIT_GBL;
   tmp_gbl = gbl->same_fcb;
   if (tmp_gbl) {
     tmp_gbl = &gbl_head[gbl->same_fcb_idx];
@@ -263,6 +272,12 @@ allocate_new_gbl()
 {
   G *tmp_gbl;
   int gsize = sizeof(G);
+
+  INIT_GBL;
+  if (rbufp == NULL) { /* first read on this thread */
+    rbufp = rbuf;
+    chvalp = chval;
+  }
   if (gbl_avl >= gbl_size) {
     if (gbl_size == GBL_SIZE) {
       gbl_size = gbl_size + GBL_SIZE;
@@ -289,6 +304,7 @@ allocate_new_gbl()
 static void
 free_gbl()
 {
+  INIT_GBL;
   --gbl_avl;
   if (gbl_avl <= 0)
     gbl_avl = 0;
@@ -313,6 +329,7 @@ _f90io_ldr_init(__INT_T *unit,   /* unit number */
   G *tmp_gbl;
   save_gbl();
   __fortio_errinit03(*unit, *bitv, iostat, "list-directed read");
+  __fortio_lock_unit(*unit);
   allocate_new_gbl();
   fcb = __fortio_rwinit(*unit, FIO_FORMATTED, rec, 0 /*read*/);
 
@@ -1259,7 +1276,7 @@ get_number(void)
 static void
 get_cmplx(void)
 {
-  static AVAL cmplx[2] = {{__BIGREAL, {0}}, {__BIGREAL, {0}}};
+  static FIO_TLS AVAL cmplx[2] = {{__BIGREAL, {0}}, {__BIGREAL, {0}}};
 
   get_token();
   if (tkntyp != TK_VAL || tknval.dtype == __STR || tknval.dtype == __NCHAR)
@@ -1430,12 +1447,6 @@ to_bigreal(AVAL *valp)
   return (__BIGREAL_T)valp->val.i;
 }
 
-/*  stuff for returning a string token */
-
-static char chval[128];
-static int chval_size = sizeof(chval);
-static char *chvalp = chval;
-
 /** \brief
  * A quote has been seen (' or ").  Create a character constant.
  */
@@ -1614,35 +1625,18 @@ read_record(void)
           return __io_errno();
       } else {
         /* sequential read */
-        int ch;
-        char *p;
-
-        p = rbufp;
-        byte_cnt = 0;
-
-        while (TRUE) {
-          if (byte_cnt >= rbuf_size)
-            p = alloc_rbuf(byte_cnt, TRUE);
-          ch = __io_fgetc(fcb->fp);
-          if (ch == EOF) {
-            if (__io_feof(fcb->fp)) {
-              if (byte_cnt)
-                break;
-              return FIO_EEOF;
-            }
-            return __io_errno();
-          }
-          if (ch == '\r' && EOR_CRLF) {
-            ch = __io_fgetc(fcb->fp);
-            if (ch == '\n')
-              break;
-            __io_ungetc(ch, fcb->fp);
-            ch = '\r';
-          }
-          if (ch == '\n')
-            break;
-          byte_cnt++;
-          *p++ = ch;
+        size_t size;
+        int eor;
+
+        if (rbufp == rbuf)
+          (void) alloc_rbuf(RBUF_SIZE, FALSE);
+        size = rbuf_size;
+        byte_cnt = __fortio_getrec(fcb->fp, &rbufp, &size, &eor);
+        rbuf_size = size;
+        if (byte_cnt < 0) {
+          if (__io_feof(fcb->fp))
+            return FIO_EEOF;
+          return __io_errno();
         }
       }
     }
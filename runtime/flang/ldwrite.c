@@ -30,21 +30,24 @@ static int dbgflag;
 #undef DBGBIT
 #define DBGBIT(v) (LOCAL_DEBUG && (dbgflag & v))
 
-static FIO_FCB *fcb; /* fcb of external file */
+static FIO_TLS FIO_FCB *fcb; /* fcb of external file */
 
-static char *in_recp; /* internal i/o record (user's space) */
-static char *in_curp; /* current position in internal i/o record */
+static FIO_TLS char *in_recp; /* internal i/o record (user's space) */
+static FIO_TLS char *in_curp; /* current position in internal i/o record */
 
-static bool record_written; /* only used for writes to an external file */
-static int byte_cnt;
-static int rec_len;
-static int n_irecs;         /* number of records in internal file */
-static bool write_called;   /* __f90io_ldw called at least once (extern file)*/
-static bool internal_file;  /* TRUE if writing to internal file */
-static char *internal_unit; /* base address of internal file buffer */
-static char delim;          /* delimiter character if DELIM was specified */
+/* only used for writes to an external file */
+static FIO_TLS bool record_written;
+static FIO_TLS int byte_cnt;
+static FIO_TLS int rec_len;
+static FIO_TLS int n_irecs; /* number of records in internal file */
+/* __f90io_ldw called at least once (extern file)*/
+static FIO_TLS bool write_called;
+static FIO_TLS bool internal_file;  /* TRUE if writing to internal file */
+static FIO_TLS char *internal_unit; /* base address of internal file buffer */
+/* delimiter character if DELIM was specified */
+static FIO_TLS char delim;
 
-static int last_type; /* last data type written */
+static FIO_TLS int last_type; /* last data type written */
 
 struct struct_G {
   short decimal; /* COMMA, POINT, NONE */
@@ -73,11 +76,12 @@ struct struct_G {
 #define GBL_SIZE 5
 typedef struct struct_G G;
 
-static G static_gbl[GBL_SIZE];
-static G *gbl = &static_gbl[0];
-static G *gbl_head = &static_gbl[0];
-static int gbl_avl = 0;
-static int gbl_size = GBL_SIZE;
+static FIO_TLS G static_gbl[GBL_SIZE];
+static FIO_TLS G *gbl;
+static FIO_TLS G *gbl_head;
+static FIO_TLS int gbl_avl = 0;
+static FIO_TLS int gbl_size = GBL_SIZE;
+#define INIT_GBL FIO_INIT_GBL(gbl, gbl_head, static_gbl)
 
 /* local functions */
 
@@ -105,6 +109,8 @@ static void
 save_samefcb()
 {
   G *tmp_gbl;
+
+  INIT_GBL;
   tmp_gbl = gbl->same_fcb;
   if (tmp_gbl) {
     tmp_gbl = &gbl_head[gbl->same_fcb_idx];
@@ -144,6 +150,8 @@ allocate_new_gbl()
 {
   G *tmp_gbl;
   int gsize = sizeof(G);
+
+  INIT_GBL;
   if (gbl_avl >= gbl_size) {
     if (gbl_size == GBL_SIZE) {
       gbl_size = gbl_size + 15;
@@ -163,6 +171,7 @@ allocate_new_gbl()
 static void
 free_gbl()
 {
+  INIT_GBL;
   --gbl_avl;
   if (gbl_avl <= 0)
     gbl_avl = 0;
@@ -187,6 +196,7 @@ _f90io_ldw_init(__INT_T *unit,   /* unit number */
   save_gbl();
 
   __fortio_errinit03(*unit, *bitv, iostat, "list-directed write");
+  __fortio_lock_unit(*unit);
 
   allocate_new_gbl();
   fcb = __fortio_rwinit(*unit, FIO_FORMATTED, rec, 1 /*write*/);
@@ -562,7 +572,7 @@ ENTCRF90IO(LDW_INTERN_INITE, ldw_intern_inite)
 /*   list-directed write   */
 /* *************************/
 
-extern char __f90io_conv_buf[];
+extern FIO_TLS char __f90io_conv_buf[];
 
 int
 __f90io_ldw(int type,    /* data type (as defined in pghpft.h) */
@@ -89,3 +89,18 @@ void f90_mm_real8_str1_(__REAL8_T *, __REAL8_T *, __REAL8_T *, __INT_T *,
                           __INT_T *);
 void f90_mm_real8_str1_mxv_t_(__REAL8_T *, __REAL8_T *, __REAL8_T *,
                                 __INT_T *, __INT_T *, __INT_T *, __INT_T *);
+
+/* Blocked GEMM engine, mmul_gemm.c; returns 0 when the product is left to
+ * the caller */
+int __fort_gemm_real4(int, int, __POINT_T, __POINT_T, __POINT_T, __REAL4_T *,
+                      __REAL4_T *, __POINT_T, __REAL4_T *, __POINT_T,
+                      __REAL4_T *, __REAL4_T *, __POINT_T);
+int __fort_gemm_real8(int, int, __POINT_T, __POINT_T, __POINT_T, __REAL8_T *,
+                      __REAL8_T *, __POINT_T, __REAL8_T *, __POINT_T,
+                      __REAL8_T *, __REAL8_T *, __POINT_T);
+int __fort_gemm_cplx8(int, int, __POINT_T, __POINT_T, __POINT_T, __CPLX8_T *,
+                      __CPLX8_T *, __POINT_T, __CPLX8_T *, __POINT_T,
+                      __CPLX8_T *, __CPLX8_T *, __POINT_T);
+int __fort_gemm_cplx16(int, int, __POINT_T, __POINT_T, __POINT_T, __CPLX16_T *,
+                       __CPLX16_T *, __POINT_T, __CPLX16_T *, __POINT_T,
+                       __CPLX16_T *, __CPLX16_T *, __POINT_T);
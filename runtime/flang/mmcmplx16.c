@@ -19,6 +19,7 @@
 
 #include "stdioInterf.h"
 #include "fioMacros.h"
+#include "matmul.h"
 #include "complex.h"
 
 #define SMALL_ROWSA 10
@@ -124,6 +125,13 @@ void ENTF90(MMUL_CMPLX16,
     return;
   }
 
+  /* large products, see mmul_gemm.c */
+  if (__fort_gemm_cplx16(ta, tb, mra, ncb, kab, (__CPLX16_T *)alpha,
+                         (__CPLX16_T *)a, lda, (__CPLX16_T *)b, ldb,
+                         (__CPLX16_T *)beta, (__CPLX16_T *)c, ldc)) {
+    return;
+  }
+
   // Check for really small matrix sizes
   if ((colsb <= SMALL_COLSB) && (rowsa <= SMALL_ROWSA) &&
       (rowsb <= SMALL_ROWSB)) {
@@ -19,6 +19,7 @@
 
 #include "stdioInterf.h"
 #include "fioMacros.h"
+#include "matmul.h"
 #include "complex.h"
 
 #define SMALL_ROWSA 10
@@ -123,6 +124,13 @@ void ENTF90(MMUL_CMPLX8,
     return;
   }
 
+  /* large products, see mmul_gemm.c */
+  if (__fort_gemm_cplx8(ta, tb, mra, ncb, kab, (__CPLX8_T *)alpha,
+                        (__CPLX8_T *)a, lda, (__CPLX8_T *)b, ldb,
+                        (__CPLX8_T *)beta, (__CPLX8_T *)c, ldc)) {
+    return;
+  }
+
   // Check for really small matrix sizes
   if ((colsb <= SMALL_COLSB) && (rowsa <= SMALL_ROWSA) &&
       (rowsb <= SMALL_ROWSB)) {
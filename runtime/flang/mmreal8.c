@@ -21,6 +21,7 @@
 
 #include "stdioInterf.h"
 #include "fioMacros.h"
+#include "matmul.h"
 
 #define SMALL_ROWSA 10
 #define SMALL_ROWSB 10
@@ -98,6 +99,12 @@ void ENTF90(MMUL_REAL8, mmul_real8)(int ta, int tb, __POINT_T mra,
     return;
   }
 
+  /* large products, see mmul_gemm.c */
+  if (__fort_gemm_real8(ta, tb, mra, ncb, kab, alpha, a, lda, b, ldb, beta,
+                        c, ldc)) {
+    return;
+  }
+
   calpha = *alpha;
   cbeta = *beta;
   rowsa = mra;
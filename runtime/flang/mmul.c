@@ -33,12 +33,50 @@ void ENTFTN(QOPY_IN, qopy_in)(char **dptr, __POINT_T *doff, char *dbase,
                               __INT_T *p_rank, __INT_T *p_kind, __INT_T *p_len,
                               __INT_T *p_flags, ...);
 
+/* Unit stride DOT_PRODUCT and MATMUL dot products: the products go to
+   four (complex: two) independent partial sums instead of one chain of
+   dependent adds, and the strided loop that follows finishes the last few
+   elements.  Integer results are unchanged; real ones may round
+   differently. */
+
+#define DOTP_CONTIG(ATYP)                                                      \
+  if (ais == 1 && bks == 1 && nj >= 8) {                                       \
+    ATYP c1 = 0, c2 = 0, c3 = 0;                                               \
+    a += ai;                                                                   \
+    b += bk;                                                                   \
+    ai = bk = 0;                                                               \
+    for (; nj >= 4; nj -= 4, a += 4, b += 4) {                                 \
+      cc += a[0] * b[0];                                                       \
+      c1 += a[1] * b[1];                                                       \
+      c2 += a[2] * b[2];                                                       \
+      c3 += a[3] * b[3];                                                       \
+    }                                                                          \
+    cc = (cc + c1) + (c2 + c3);                                                \
+  }
+
+#define DOTP_CONTIG_CPLX(ATYP)                                                 \
+  if (ais == 1 && bks == 1 && nj >= 4) {                                       \
+    ATYP cr1 = 0, ci1 = 0;                                                     \
+    a += ai;                                                                   \
+    b += bk;                                                                   \
+    ai = bk = 0;                                                               \
+    for (; nj >= 2; nj -= 2, a += 2, b += 2) {                                 \
+      cr += a[0].r * b[0].r + a[0].i * b[0].i;                                 \
+      ci += a[0].r * b[0].i - a[0].i * b[0].r;                                 \
+      cr1 += a[1].r * b[1].r + a[1].i * b[1].i;                                \
+      ci1 += a[1].r * b[1].i - a[1].i * b[1].r;                                \
+    }                                                                          \
+    cr += cr1;                                                                 \
+    ci += ci1;                                                                 \
+  }
+
 static void
 dotp_real4(__REAL4_T *c, int nj, __REAL4_T *a, int ai, int ais, __REAL4_T *b,
            int bk, int bks)
 {
   register double cc;
   cc = *c;
+  DOTP_CONTIG(double)
   for (; --nj >= 0; ai += ais, bk += bks)
     cc += a[ai] * b[bk];
   *c = cc;
@@ -50,6 +88,7 @@ dotp_real8(__REAL8_T *c, int nj, __REAL8_T *a, int ai, int ais, __REAL8_T *b,
 {
   register double cc;
   cc = *c;
+  DOTP_CONTIG(double)
   for (; --nj >= 0; ai += ais, bk += bks)
     cc += a[ai] * b[bk];
   *c = cc;
@@ -62,6 +101,7 @@ dotp_cplx8(__CPLX8_T *c, int nj, __CPLX8_T *a, int ai, int ais, __CPLX8_T *b,
   register double cr, ci;
   cr = c->r;
   ci = c->i;
+  DOTP_CONTIG_CPLX(double)
   for (; --nj >= 0; ai += ais, bk += bks) {
     cr += a[ai].r * b[bk].r + a[ai].i * b[bk].i;
     ci += a[ai].r * b[bk].i - a[ai].i * b[bk].r;
@@ -92,6 +132,7 @@ dotp_cplx16(__CPLX16_T *c, int nj, __CPLX16_T *a, int ai, int ais,
   register double cr, ci;
   cr = c->r;
   ci = c->i;
+  DOTP_CONTIG_CPLX(double)
   for (; --nj >= 0; ai += ais, bk += bks) {
     cr += a[ai].r * b[bk].r + a[ai].i * b[bk].i;
     ci += a[ai].r * b[bk].i - a[ai].i * b[bk].r;
@@ -121,6 +162,7 @@ dotp_int1(__INT1_T *c, int nj, __INT1_T *a, int ai, int ais, __INT1_T *b,
 {
   register long cc;
   cc = *c;
+  DOTP_CONTIG(long)
   for (; --nj >= 0; ai += ais, bk += bks)
     cc += a[ai] * b[bk];
   *c = cc;
@@ -132,6 +174,7 @@ dotp_int2(__INT2_T *c, int nj, __INT2_T *a, int ai, int ais, __INT2_T *b,
 {
   register long cc;
   cc = *c;
+  DOTP_CONTIG(long)
   for (; --nj >= 0; ai += ais, bk += bks)
     cc += a[ai] * b[bk];
   *c = cc;
@@ -143,6 +186,7 @@ dotp_int4(__INT4_T *c, int nj, __INT4_T *a, int ai, int ais, __INT4_T *b,
 {
   register long cc;
   cc = *c;
+  DOTP_CONTIG(long)
   for (; --nj >= 0; ai += ais, bk += bks)
     cc += a[ai] * b[bk];
   *c = cc;
@@ -199,6 +243,7 @@ dotp_int8(__INT8_T *c, int nj, __INT8_T *a, int ai, int ais, __INT8_T *b,
 {
   register long cc;
   cc = *c;
+  DOTP_CONTIG(long)
   for (; --nj >= 0; ai += ais, bk += bks)
     cc += a[ai] * b[bk];
   *c = cc;
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* clang-format off */
+
+/** \file
+ * \brief Packed, register-tiled GEMM engine for the REAL and COMPLEX MATMUL
+ * intrinsics
+ *
+ * __fort_gemm_<type>() computes C = alpha * op(A) * op(B) + beta * C the
+ * way tuned BLAS libraries do:
+ *
+ *   for jc in steps of NC columns of C
+ *     for pc in steps of KC
+ *       pack op(B)(pc:pc+KC, jc:jc+NC) into NR wide panels     (L3)
+ *       for ic in steps of MC rows of C                  <- threads
+ *         pack op(A)(ic:ic+MC, pc:pc+KC) into MR high panels  (L2)
+ *         for each NR panel, for each MR panel
+ *           MR x NR micro-kernel over KC                 (registers, L1)
+ *
+ * The micro-kernels are written with vector extensions and compiled for
+ * AVX2 and AVX-512 through target attributes; the one to use is picked
+ * from the cpu at run time.  When the file is built with OpenMP the row
+ * blocks, and the NR panels of short and wide products, are spread over the
+ * threads of a parallel region unless the caller is already inside one.
+ *
+ * MATMUL and MMUL entries call this for large products only and fall back
+ * to their own code when it returns 0.
+ */
+
+#include "stdioInterf.h"
+#include "fioMacros.h"
+#include "matmul.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Blocking, in elements of op(A) and op(B) */
+#define GEMM_KC 256
+#define GEMM_MC_BYTES (256 * 1024) /* op(A) block kept in L2 */
+#define GEMM_NC 4096
+
+/* Smaller products are left to the callers */
+#define GEMM_MIN_DIM 16
+#define GEMM_MIN_MNK (64.0 * 64.0 * 64.0)
+
+/* Real multiply-adds per thread before another thread is worth starting */
+#define GEMM_PAR_MNK (64.0 * 64.0 * 64.0)
+
+#define GEMM_ALIGN 64
+#define GEMM_TILE (64 / sizeof(float) * 2 * 12) /* largest MR x NB tile */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GEMM_HAVE_KERNELS
+#endif
+
+#if defined(__clang__)
+#define GEMM_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__)
+#define GEMM_UNROLL _Pragma("GCC unroll 16")
+#else
+#define GEMM_UNROLL
+#endif
+
+/*
+ * MV vector by NB scalar micro-kernel: tile = Ap * Bp over kc steps.  Ap
+ * holds MV vectors per step, Bp NB scalars per step.  The accumulators are
+ * stored to tile column by column, MV vectors each.
+ */
+#ifdef GEMM_HAVE_KERNELS
+#define GEMM_KERNEL(NAME, TGT, T, V, MV, NB)                                   \
+  static void __attribute__((target(TGT)))                                     \
+  NAME(__POINT_T kc, T *ap, T *bp, T *tile)                                    \
+  {                                                                            \
+    V acc[NB][MV];                                                             \
+    V av[MV];                                                                  \
+    __POINT_T p;                                                               \
+    int i, j;                                                                  \
+                                                                               \
+    GEMM_UNROLL                                                                \
+    for (j = 0; j < NB; j++)                                                   \
+      GEMM_UNROLL                                                              \
+      for (i = 0; i < MV; i++)                                                 \
+        acc[j][i] = (V){0};                                                    \
+    for (p = 0; p < kc; p++) {                                                 \
+      GEMM_UNROLL                                                              \
+      for (i = 0; i < MV; i++)                                                 \
+        av[i] = ((V *)ap)[i];                                                  \
+      GEMM_UNROLL                                                              \
+      for (j = 0; j < NB; j++) {                                               \
+        T bj = bp[j];                                                          \
+        GEMM_UNROLL                                                            \
+        for (i = 0; i < MV; i++)                                               \
+          acc[j][i] += av[i] * bj;                                             \
+      }                                                                        \
+      ap += MV * sizeof(V) / sizeof(T);                                        \
+      bp += NB;                                                                \
+    }                                                                          \
+    GEMM_UNROLL                                                                \
+    for (j = 0; j < NB; j++)                                                   \
+      GEMM_UNROLL                                                              \
+      for (i = 0; i < MV; i++)                                                 \
+        ((V *)tile)[j * MV + i] = acc[j][i];                                   \
+  }
+#endif
+
+typedef float gemm_v8sf __attribute__((vector_size(32)));
+typedef float gemm_v16sf __attribute__((vector_size(64)));
+typedef double gemm_v4df __attribute__((vector_size(32)));
+typedef double gemm_v8df __attribute__((vector_size(64)));
+
+/* Entries of the per-type micro-kernel tables, see gemm_isa_level() */
+#define GEMM_NISA 3
+
+/*
+ * 0 no usable vector unit, 1 AVX2 and FMA, 2 AVX-512F.
+ * The cpu does not change under us; a racy first call just repeats the test.
+ */
+static int
+gemm_isa_level(void)
+{
+  static int level = -1;
+
+  if (level < 0) {
+#ifdef GEMM_HAVE_KERNELS
+    if (__builtin_cpu_supports("avx512f"))
+      level = 2;
+    else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      level = 1;
+    else
+#endif
+      level = 0;
+  }
+  return level;
+}
+
+#ifdef _OPENMP
+static int
+gemm_nthreads(double mnk)
+{
+  int n = 1;
+
+  if (!omp_in_parallel()) {
+    n = omp_get_max_threads();
+    if (mnk / GEMM_PAR_MNK < n)
+      n = mnk / GEMM_PAR_MNK < 1 ? 1 : (int)(mnk / GEMM_PAR_MNK);
+  }
+  return n;
+}
+#else
+#define gemm_nthreads(mnk) 1
+#endif
+
+#define GEMM_SFX real4
+#define GEMM_ELEM __REAL4_T
+#define GEMM_REAL float
+#define GEMM_CPLX 0
+#define GEMM_V256 gemm_v8sf
+#define GEMM_V512 gemm_v16sf
+#include "mmul_gemm.h"
+#undef GEMM_SFX
+#undef GEMM_ELEM
+#undef GEMM_REAL
+#undef GEMM_CPLX
+#undef GEMM_V256
+#undef GEMM_V512
+
+#define GEMM_SFX real8
+#define GEMM_ELEM __REAL8_T
+#define GEMM_REAL double
+#define GEMM_CPLX 0
+#define GEMM_V256 gemm_v4df
+#define GEMM_V512 gemm_v8df
+#include "mmul_gemm.h"
+#undef GEMM_SFX
+#undef GEMM_ELEM
+#undef GEMM_REAL
+#undef GEMM_CPLX
+#undef GEMM_V256
+#undef GEMM_V512
+
+#define GEMM_SFX cplx8
+#define GEMM_ELEM __CPLX8_T
+#define GEMM_REAL float
+#define GEMM_CPLX 1
+#define GEMM_V256 gemm_v8sf
+#define GEMM_V512 gemm_v16sf
+#include "mmul_gemm.h"
+#undef GEMM_SFX
+#undef GEMM_ELEM
+#undef GEMM_REAL
+#undef GEMM_CPLX
+#undef GEMM_V256
+#undef GEMM_V512
+
+#define GEMM_SFX cplx16
+#define GEMM_ELEM __CPLX16_T
+#define GEMM_REAL double
+#define GEMM_CPLX 1
+#define GEMM_V256 gemm_v4df
+#define GEMM_V512 gemm_v8df
+#include "mmul_gemm.h"
+#undef GEMM_SFX
+#undef GEMM_ELEM
+#undef GEMM_REAL
+#undef GEMM_CPLX
+#undef GEMM_V256
+#undef GEMM_V512
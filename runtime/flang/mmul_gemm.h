@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* clang-format off */
+
+/** \file
+ * \brief Type generic body of the blocked GEMM engine in mmul_gemm.c
+ *
+ * Included once per type after defining
+ *   GEMM_SFX   suffix of the generated names (real4, real8, cplx8, cplx16)
+ *   GEMM_ELEM  Fortran element type
+ *   GEMM_REAL  type of one real component of an element
+ *   GEMM_CPLX  1 for the COMPLEX types, 0 for the REAL types
+ *   GEMM_V256, GEMM_V512  AVX2 and AVX-512 vectors of GEMM_REAL
+ *
+ * A COMPLEX element is carried as two adjacent reals everywhere below.  The
+ * micro-kernels never see the difference: a packed B element contributes
+ * one broadcast per real component, so a COMPLEX column needs two
+ * accumulator columns, one for Re(b) and one for Im(b), that are combined
+ * when the tile is written back to C.
+ */
+
+#define GEMM_CW (GEMM_CPLX + 1)   /* reals per element */
+#define GEMM_NM(x) GEMM_NM_(x, GEMM_SFX)
+#define GEMM_NM_(x, s) GEMM_NM__(x, s)
+#define GEMM_NM__(x, s) x##_##s
+
+/*
+ * Micro-kernels.  Register tile of MV vectors (MR elements) by NR elements;
+ * MV * NB accumulators with NB = NR * GEMM_CW.
+ *   AVX2      MV = 2, NB = 6     12 of 16 ymm
+ *   AVX-512   MV = 2, NB = 12    24 of 32 zmm
+ */
+
+
+/* Micro-kernel and its MR x NR shape in elements */
+struct GEMM_NM(gemm_isa) {
+  int mr;
+  int nr;
+  void (*kern)(__POINT_T, GEMM_REAL *, GEMM_REAL *, GEMM_REAL *);
+};
+
+#ifdef GEMM_HAVE_KERNELS
+GEMM_KERNEL(GEMM_NM(gemm_kern_avx2), "avx2,fma", GEMM_REAL, GEMM_V256, 2, 6)
+GEMM_KERNEL(GEMM_NM(gemm_kern_avx512), "avx512f", GEMM_REAL, GEMM_V512, 2, 12)
+
+static const struct GEMM_NM(gemm_isa) GEMM_NM(gemm_isas)[GEMM_NISA] = {
+    {0, 0, NULL},
+    {2 * sizeof(GEMM_V256) / sizeof(GEMM_ELEM), 6 / GEMM_CW,
+     GEMM_NM(gemm_kern_avx2)},
+    {2 * sizeof(GEMM_V512) / sizeof(GEMM_ELEM), 12 / GEMM_CW,
+     GEMM_NM(gemm_kern_avx512)},
+};
+#else
+static const struct GEMM_NM(gemm_isa) GEMM_NM(gemm_isas)[GEMM_NISA] = {
+    {0, 0, NULL}};
+#endif
+
+/*
+ * Pack rows [i0, i0 + mc) and columns [p0, p0 + kc) of op(A), scaled by
+ * alpha, into MR row panels.  Within a panel the MR elements of a column are
+ * contiguous, columns follow one another, and rows past the end of the
+ * matrix are zero.
+ */
+static void
+GEMM_NM(gemm_pack_a)(int ta, GEMM_REAL *ap, GEMM_REAL *a, __POINT_T lda,
+                     __POINT_T i0, __POINT_T p0, __POINT_T mc, __POINT_T kc,
+                     int mr, GEMM_REAL *alpha)
+{
+  __POINT_T ir, i, p, mi;
+  GEMM_REAL *s;
+#if GEMM_CPLX
+  GEMM_REAL ar, ai, xr, xi;
+  int one = alpha[0] == 1 && alpha[1] == 0;
+
+  ar = alpha[0];
+  ai = alpha[1];
+#else
+  GEMM_REAL ar = *alpha;
+#endif
+
+  for (ir = 0; ir < mc; ir += mr) {
+    mi = mc - ir < mr ? mc - ir : mr;
+    for (p = 0; p < kc; p++) {
+      for (i = 0; i < mi; i++) {
+        if (ta == 0)
+          s = a + ((i0 + ir + i) + (p0 + p) * lda) * GEMM_CW;
+        else
+          s = a + ((p0 + p) + (i0 + ir + i) * lda) * GEMM_CW;
+#if GEMM_CPLX
+        xr = s[0];
+        xi = ta == 2 ? -s[1] : s[1];
+        if (one) {
+          ap[2 * i] = xr;
+          ap[2 * i + 1] = xi;
+        } else {
+          ap[2 * i] = ar * xr - ai * xi;
+          ap[2 * i + 1] = ar * xi + ai * xr;
+        }
+#else
+        ap[i] = ar * s[0];
+#endif
+      }
+      for (; i < mr; i++) {
+#if GEMM_CPLX
+        ap[2 * i] = 0;
+        ap[2 * i + 1] = 0;
+#else
+        ap[i] = 0;
+#endif
+      }
+      ap += mr * GEMM_CW;
+    }
+  }
+}
+
+/*
+ * Pack the NR column panel of op(B) starting at column j0, rows
+ * [p0, p0 + kc), with the NR elements of a row contiguous.  Columns past
+ * nc are zero.
+ */
+static void
+GEMM_NM(gemm_pack_b)(int tb, GEMM_REAL *bp, GEMM_REAL *b, __POINT_T ldb,
+                     __POINT_T p0, __POINT_T j0, __POINT_T nc, __POINT_T kc,
+                     int nr)
+{
+  __POINT_T j, p, nj;
+  GEMM_REAL *s;
+
+  nj = nc - j0 < nr ? nc - j0 : nr;
+  for (p = 0; p < kc; p++) {
+    for (j = 0; j < nj; j++) {
+      if (tb == 0)
+        s = b + ((p0 + p) + (j0 + j) * ldb) * GEMM_CW;
+      else
+        s = b + ((j0 + j) + (p0 + p) * ldb) * GEMM_CW;
+#if GEMM_CPLX
+      bp[2 * j] = s[0];
+      bp[2 * j + 1] = tb == 2 ? -s[1] : s[1];
+#else
+      bp[j] = s[0];
+#endif
+    }
+    for (; j < nr; j++) {
+#if GEMM_CPLX
+      bp[2 * j] = 0;
+      bp[2 * j + 1] = 0;
+#else
+      bp[j] = 0;
+#endif
+    }
+    bp += nr * GEMM_CW;
+  }
+}
+
+/*
+ * C = beta * C + tile for the leading mi x nj part of a micro-kernel tile.
+ * beta is NULL for the 2nd and later kc blocks, which just accumulate.
+ */
+static void
+GEMM_NM(gemm_update)(GEMM_REAL *c, __POINT_T ldc, GEMM_REAL *tile, int mr,
+                     int mi, int nj, GEMM_REAL *beta)
+{
+  int i, j;
+#if GEMM_CPLX
+  GEMM_REAL *tr, *ti, xr, xi, cr, ci;
+
+  for (j = 0; j < nj; j++) {
+    /* accumulator columns for Re(b) and Im(b) */
+    tr = tile + (2 * j) * 2 * mr;
+    ti = tr + 2 * mr;
+    for (i = 0; i < mi; i++) {
+      xr = tr[2 * i] - ti[2 * i + 1];
+      xi = tr[2 * i + 1] + ti[2 * i];
+      if (beta == NULL) {
+        c[2 * i] += xr;
+        c[2 * i + 1] += xi;
+      } else if (beta[0] == 0 && beta[1] == 0) {
+        c[2 * i] = xr;
+        c[2 * i + 1] = xi;
+      } else {
+        cr = c[2 * i];
+        ci = c[2 * i + 1];
+        c[2 * i] = beta[0] * cr - beta[1] * ci + xr;
+        c[2 * i + 1] = beta[0] * ci + beta[1] * cr + xi;
+      }
+    }
+    c += ldc * 2;
+  }
+#else
+  for (j = 0; j < nj; j++) {
+    if (beta == NULL)
+      for (i = 0; i < mi; i++)
+        c[i] += tile[i];
+    else if (*beta == 0)
+      for (i = 0; i < mi; i++)
+        c[i] = tile[i];
+    else
+      for (i = 0; i < mi; i++)
+        c[i] = *beta * c[i] + tile[i];
+    tile += mr;
+    c += ldc;
+  }
+#endif
+}
+
+/*
+ * C = alpha * op(A) * op(B) + beta * C, op() selected by ta/tb as for
+ * ENTF90(MMUL_*): 0 none, 1 transpose, 2 conjugate transpose.
+ * Returns 0, without touching C, when the product is too small to pay for
+ * the packing or the machine has no supported vector unit; the caller then
+ * uses its own code.
+ */
+int
+GEMM_NM(__fort_gemm)(int ta, int tb, __POINT_T m, __POINT_T n, __POINT_T k,
+                     GEMM_ELEM *alpha, GEMM_ELEM *a, __POINT_T lda,
+                     GEMM_ELEM *b, __POINT_T ldb, GEMM_ELEM *beta,
+                     GEMM_ELEM *c, __POINT_T ldc)
+{
+  const struct GEMM_NM(gemm_isa) *isa;
+  __POINT_T mc, nc, kc, nbmax, mblocks, nparts, asize, bsize;
+  char *buf;
+  int nthreads, mr, nr;
+
+  if (m < GEMM_MIN_DIM || n < GEMM_MIN_DIM || k < GEMM_MIN_DIM ||
+      (double)m * n * k < GEMM_MIN_MNK)
+    return 0;
+  isa = &GEMM_NM(gemm_isas)[gemm_isa_level()];
+  if (isa->kern == NULL)
+    return 0;
+  mr = isa->mr;
+  nr = isa->nr;
+
+  nthreads = gemm_nthreads((double)m * n * k * GEMM_CW * GEMM_CW);
+
+  kc = k < GEMM_KC ? k : GEMM_KC;
+  mc = GEMM_MC_BYTES / (kc * sizeof(GEMM_ELEM)) / mr * mr;
+  if (nthreads > 1 && (m + nthreads - 1) / nthreads < mc)
+    mc = ((m + nthreads - 1) / nthreads + mr - 1) / mr * mr;
+  if (mc > (m + mr - 1) / mr * mr)
+    mc = (m + mr - 1) / mr * mr;
+  nc = GEMM_NC / nr * nr;
+  if (nc > n)
+    nc = n;
+  nbmax = (nc + nr - 1) / nr;
+
+  /* Split the columns too when there are fewer row blocks than threads */
+  mblocks = (m + mc - 1) / mc;
+  nparts = 1;
+  if (mblocks < nthreads) {
+    nparts = (nthreads + mblocks - 1) / mblocks;
+    if (nparts > nbmax)
+      nparts = nbmax;
+  }
+
+  asize = (mc * kc * sizeof(GEMM_ELEM) + GEMM_ALIGN - 1) & ~(GEMM_ALIGN - 1);
+  bsize = nbmax * nr * kc * sizeof(GEMM_ELEM);
+  buf = __fort_malloc_without_abort(bsize + nthreads * asize + GEMM_ALIGN);
+  if (buf == NULL)
+    return 0;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) if (nthreads > 1)
+#endif
+  {
+    GEMM_REAL tile[GEMM_TILE] __attribute__((aligned(GEMM_ALIGN)));
+    GEMM_REAL *bp, *ap;
+    GEMM_REAL *ra = (GEMM_REAL *)a, *rb = (GEMM_REAL *)b;
+    GEMM_REAL *rc = (GEMM_REAL *)c;
+    __POINT_T jc, pc, ic, jr, ir, kcur, ncur, mcur, npan, it, ib, jp, jlo, jhi;
+    __POINT_T packed;
+    int tid = 0;
+
+#ifdef _OPENMP
+    tid = omp_get_thread_num();
+#endif
+    bp = (GEMM_REAL *)(((size_t)buf + GEMM_ALIGN - 1) &
+                       ~(size_t)(GEMM_ALIGN - 1));
+    ap = (GEMM_REAL *)((char *)bp + bsize + tid * asize);
+
+    for (jc = 0; jc < n; jc += nc) {
+      ncur = n - jc < nc ? n - jc : nc;
+      npan = (ncur + nr - 1) / nr;
+      for (pc = 0; pc < k; pc += kc) {
+        kcur = k - pc < kc ? k - pc : kc;
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (jp = 0; jp < npan; jp++)
+          GEMM_NM(gemm_pack_b)(tb, bp + jp * nr * kcur * GEMM_CW, rb, ldb,
+                               pc, jc + jp * nr, jc + ncur, kcur, nr);
+
+        /* Each item is one mc row block times one part of the panels */
+        packed = -1;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (it = 0; it < mblocks * nparts; it++) {
+          ib = it / nparts;
+          ic = ib * mc;
+          mcur = m - ic < mc ? m - ic : mc;
+          if (ib != packed) {
+            GEMM_NM(gemm_pack_a)(ta, ap, ra, lda, ic, pc, mcur, kcur, mr,
+                                 (GEMM_REAL *)alpha);
+            packed = ib;
+          }
+          jlo = npan * (it % nparts) / nparts;
+          jhi = npan * (it % nparts + 1) / nparts;
+          for (jr = jlo * nr; jr < jhi * nr; jr += nr) {
+            for (ir = 0; ir < mcur; ir += mr) {
+              isa->kern(kcur, ap + ir * kcur * GEMM_CW,
+                        bp + jr * kcur * GEMM_CW, tile);
+              GEMM_NM(gemm_update)(
+                  rc + ((ic + ir) + (jc + jr) * ldc) * GEMM_CW, ldc, tile, mr,
+                  mcur - ir < mr ? mcur - ir : mr,
+                  ncur - jr < nr ? ncur - jr : nr,
+                  pc == 0 ? (GEMM_REAL *)beta : NULL);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  __fort_free(buf);
+  return 1;
+}
+
+#undef GEMM_CW
+#undef GEMM_NM
+#undef GEMM_NM_
+#undef GEMM_NM__
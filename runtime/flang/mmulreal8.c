@@ -38,6 +38,8 @@ void ENTF90(MATMUL_REAL8, matmul_real8)(char *dest_addr, char *s1_addr,
   __REAL8_T *s2_elem_p;
 
   __REAL8_T rslt_tmp;
+  __REAL8_T one = 1;
+  __REAL8_T zero = 0;
 
   __INT_T s1_d1_lstride;
   __INT_T s1_d1_sstride;
@@ -216,7 +218,14 @@ void ENTF90(MATMUL_REAL8, matmul_real8)(char *dest_addr, char *s1_addr,
                                      s2_base + s2_d2_soffset * s2_d2_lstride,
                                      &k_extent,&m_extent,
                                      &s2_d2_lstride, &d_d1_lstride);
-    } else {
+    } else if (d_d1_lstride != 1 ||
+               !__fort_gemm_real8(0, 0, n_extent, k_extent, m_extent, &one,
+                       s1_base + s1_d1_soffset * s1_d1_lstride, s1_d2_lstride,
+                       s2_base + s2_d2_soffset * s2_d2_lstride, s2_d2_lstride,
+                       &zero, dest_base + d_d1_soffset*d_d1_lstride +
+                                    d_d2_soffset*d_d2_lstride,
+                       d_d2_lstride)) {
+      /* too small for the blocked engine, or no vector unit for it */
       F90_MATMUL(real8_str1)(dest_base + d_d1_soffset*d_d1_lstride +
                                             d_d2_soffset*d_d2_lstride,
                                     s1_base + s1_d1_soffset * s1_d1_lstride,
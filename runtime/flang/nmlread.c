@@ -52,10 +52,10 @@ static int dbgflag;
 #define VRF_SECTION 2
 #define VRF_MEMBER 3
 
-static TRI tri;
+static FIO_TLS TRI tri;
 
 /* Record the presence of a substring in a reference */
-static struct {
+static FIO_TLS struct {
   bool present;
   __BIGINT_T start;
   __BIGINT_T end;
@@ -73,43 +73,43 @@ typedef struct {
   char *addr;
 } VRF;
 
-static struct {
+static FIO_TLS struct {
   int size;
   int avl;
   VRF *base;
 } vrf;
 
-static int vrf_cur;
+static FIO_TLS int vrf_cur;
 
 #define VRF_TYPE(i) vrf.base[i].type
 #define VRF_SUBSCRIPT(i) vrf.base[i].subscript
 #define VRF_DESCP(i) vrf.base[i].descp
 #define VRF_ADDR(i) vrf.base[i].addr
 
-static FIO_FCB *f;
-static bool accessed; /* file has been read */
-static int byte_cnt;  /* number of bytes read */
-static int n_irecs;   /* number of internal file records */
-static bool internal_file;
-static int rec_len;
-static int token;
-static char token_buff[MAX_TOKEN_LEN + 1];
-static INT tokenval;
-static int live_token;
-static AVAL constval;
-static AVAL cmplxval[2];
-static bool lparen_is_token;
-static bool comma_is_token;
-static FILE *gblfp;
+static FIO_TLS FIO_FCB *f;
+static FIO_TLS bool accessed; /* file has been read */
+static FIO_TLS int byte_cnt;  /* number of bytes read */
+static FIO_TLS int n_irecs;   /* number of internal file records */
+static FIO_TLS bool internal_file;
+static FIO_TLS int rec_len;
+static FIO_TLS int token;
+static FIO_TLS char token_buff[MAX_TOKEN_LEN + 1];
+static FIO_TLS INT tokenval;
+static FIO_TLS int live_token;
+static FIO_TLS AVAL constval;
+static FIO_TLS AVAL cmplxval[2];
+static FIO_TLS bool lparen_is_token;
+static FIO_TLS bool comma_is_token;
+static FIO_TLS FILE *gblfp;
 
 #define RBUF_SIZE 256
-static char rbuf[RBUF_SIZE + 1];
-static unsigned rbuf_size = RBUF_SIZE;
+static FIO_TLS char rbuf[RBUF_SIZE + 1];
+static FIO_TLS unsigned rbuf_size = RBUF_SIZE;
 
-static char *rbufp = rbuf; /* ptr to read buffer */
-static char *currc;        /* current pointer in buffer */
+static FIO_TLS char *rbufp; /* ptr to read buffer, rbuf once init_gbl */
+static FIO_TLS char *currc; /* current pointer in buffer */
 
-static char *in_recp; /* internal i/o record (user's space) */
+static FIO_TLS char *in_recp; /* internal i/o record (user's space) */
 
 typedef struct {
   short blank_zero; /* FIO_ ZERO or NULL */
@@ -142,11 +142,20 @@ typedef struct {
 
 } G;
 
-static G static_gbl[GBL_SIZE];
-static G *gbl = &static_gbl[0];
-static G *gbl_head = &static_gbl[0];
-static int gbl_avl = 0;
-static int gbl_size = GBL_SIZE;
+static FIO_TLS G static_gbl[GBL_SIZE];
+static FIO_TLS G *gbl;
+static FIO_TLS G *gbl_head;
+static FIO_TLS int gbl_avl = 0;
+static FIO_TLS int gbl_size = GBL_SIZE;
+
+/* set up the calling thread's state on its first namelist read */
+static void
+init_gbl(void)
+{
+  FIO_INIT_GBL(gbl, gbl_head, static_gbl);
+  if (rbufp == NULL)
+    rbufp = rbuf;
+}
 
 static void shared_init(void);
 static NML_DESC *skip_to_next(NML_DESC *);
@@ -164,7 +173,7 @@ static int eval_ptr(int, char *);
 static void I8(fillup_sb)(int, NML_DESC *, char *);
 static int dtio_read_scalar(NML_DESC *, char *);
 
-static bool comma_live;
+static FIO_TLS bool comma_live;
 static int eval(int, char *);
 static int I8(eval_dtio_sb)(int d);
 static int assign(NML_DESC *, char *, char **, bool, bool);
@@ -180,7 +189,7 @@ static int dtio_assign(NML_DESC *, char *, char **, bool, bool);
 
 static int read_record(void);
 static char *alloc_rbuf(int, bool);
-static SB sb;
+static FIO_TLS SB sb;
 
 /* ------------------------------------------------------------------- */
 
@@ -196,7 +205,9 @@ _f90io_nmlr_init(__INT_T *unit,
                 __INT_T *bitv,   
                 __INT_T *iostat) 
 {
+  init_gbl();
   __fortio_errinit03(*unit, *bitv, iostat, "namelist read");
+  __fortio_lock_unit(*unit);
 
   /* -------  perform error checking and initialization of unit:  */
 
@@ -348,8 +359,9 @@ I8(_f90io_nmlr_intern_init)( char *cunit,
                              __INT_T *iostat,  
                              __CLEN_T cunit_siz)
 {
-  static FIO_FCB dumfcb;
+  static FIO_TLS FIO_FCB dumfcb;
 
+  init_gbl();
   __fortio_errinit03(-99, *bitv, iostat, "namelist read");
 
   f = &dumfcb; /* so the f-> refs don't have to be guarded */
@@ -686,7 +698,7 @@ find_group(char *str, int nlen)
 static int
 get_token(void)
 {
-  static int recur = 0;
+  static FIO_TLS int recur = 0;
   int i, c;
   FILE *fp = gblfp;
   char delim;
@@ -2119,6 +2131,7 @@ exit_loop:
 static int
 _f90io_nmlr_end()
 {
+  init_gbl();
   gbl->decimal = 0;
   if (!gbl->same_fcb_idx) {
     gbl->unit = 0;
@@ -2177,36 +2190,19 @@ read_record(void)
     accessed = TRUE;
   } else {
     /* sequential read */
-    int ch;
-    char *p;
+    size_t size;
+    int eor;
 
     f->nextrec++;
-    p = rbufp;
-    byte_cnt = 0;
-
-    while (TRUE) {
-      if (byte_cnt >= rbuf_size)
-        p = alloc_rbuf(byte_cnt, TRUE);
-      ch = __io_fgetc(f->fp);
-      if (ch == EOF) {
-        if (__io_feof(f->fp)) {
-          if (byte_cnt)
-            break;
-          return FIO_EEOF;
-        }
-        return __io_errno();
-      }
-      if (ch == '\r' && EOR_CRLF) {
-        ch = __io_fgetc(f->fp);
-        if (ch == '\n')
-          break;
-        __io_ungetc(ch, f->fp);
-        ch = '\r';
-      }
-      if (ch == '\n')
-        break;
-      byte_cnt++;
-      *p++ = ch;
+    if (rbufp == rbuf)
+      (void) alloc_rbuf(RBUF_SIZE, FALSE);
+    size = rbuf_size;
+    byte_cnt = __fortio_getrec(f->fp, &rbufp, &size, &eor);
+    rbuf_size = size;
+    if (byte_cnt < 0) {
+      if (__io_feof(f->fp))
+        return FIO_EEOF;
+      return __io_errno();
     }
   }
   rbufp[byte_cnt] = '\n';
@@ -2239,7 +2235,7 @@ static int
 dtio_read_scalar(NML_DESC *descp, char *loc_addr)
 {
 
-  static __INT_T internal_unit = -1;
+  static FIO_TLS __INT_T internal_unit = -1;
   __INT_T tmp_iostat = 0;
   __INT_T *iostat;
   __INT_T *unit;
@@ -2253,7 +2249,7 @@ dtio_read_scalar(NML_DESC *descp, char *loc_addr)
   NML_DESC *start_descp;
   __CLEN_T iotypelen = 8;
   __CLEN_T iomsglen = 250;
-  static char iomsg[250];
+  static FIO_TLS char iomsg[250];
   int k, num_consts, ret_err, j;
   char *iotype = "NAMELIST";
   char *start_addr;
@@ -32,19 +32,19 @@ static int dbgflag;
 #undef DBGBIT
 #define DBGBIT(v) (LOCAL_DEBUG && (dbgflag & v))
 
-static FIO_FCB *f;
+static FIO_TLS FIO_FCB *f;
 
-static char *in_recp; /* internal i/o record (user's space) */
-static char *in_curp; /* current position in internal i/o record */
+static FIO_TLS char *in_recp; /* internal i/o record (user's space) */
+static FIO_TLS char *in_curp; /* current position in internal i/o record */
 
-static int byte_cnt;
-static int rec_len;
-static int n_irecs;         /* number of records in internal file */
-static bool internal_file;  /* TRUE if writing to internal file */
-static char *internal_unit; /* base address of internal file buffer */
-static char delim;
-static bool need_comma;
-static int skip;
+static FIO_TLS int byte_cnt;
+static FIO_TLS int rec_len;
+static FIO_TLS int n_irecs;         /* number of records in internal file */
+static FIO_TLS bool internal_file;  /* TRUE if writing to internal file */
+static FIO_TLS char *internal_unit; /* base address of internal file buffer */
+static FIO_TLS char delim;
+static FIO_TLS bool need_comma;
+static FIO_TLS int skip;
 
 typedef struct {
   short decimal; /* COMMA, POINT, NONE */
@@ -72,11 +72,12 @@ typedef struct {
   __INT_T *iostat; /* used in user defined io */
 } G;
 
-static G static_gbl[GBL_SIZE];
-static G *gbl = &static_gbl[0];
-static G *gbl_head = &static_gbl[0];
-static int gbl_avl = 0;
-static int gbl_size = GBL_SIZE;
+static FIO_TLS G static_gbl[GBL_SIZE];
+static FIO_TLS G *gbl;
+static FIO_TLS G *gbl_head;
+static FIO_TLS int gbl_avl = 0;
+static FIO_TLS int gbl_size = GBL_SIZE;
+#define INIT_GBL FIO_INIT_GBL(gbl, gbl_head, static_gbl)
 
 static int emit_eol(void);
 static int write_nml_val(NML_DESC **, NML_DESC *, char *);
@@ -88,8 +89,8 @@ static int I8(eval_sb)(NML_DESC **, NML_DESC *, char *, int);
 static int I8(eval_dtio_sb)(NML_DESC **, NML_DESC *, char *, int);
 static int dtio_write_scalar(NML_DESC **, NML_DESC *, char *, int);
 
-static SB sb;
-static TRI tri;
+static FIO_TLS SB sb;
+static FIO_TLS TRI tri;
 
 /* ---------------------------------------------------------------- */
 
@@ -101,7 +102,9 @@ _f90io_nmlw_init(__INT_T *unit, /* unit number */
                 __INT_T *bitv,   /* same as for ENTF90IO(open_) */
                 __INT_T *iostat) /* same as for ENTF90IO(open_) */
 {
+  INIT_GBL;
   __fortio_errinit03(*unit, *bitv, iostat, "namelist write");
+  __fortio_lock_unit(*unit);
 
   f = __fortio_rwinit(*unit, FIO_FORMATTED, rec, 1 /*write*/);
   if (f == NULL)
@@ -229,8 +232,9 @@ _f90io_nmlw_intern_init(char *cunit,      /* pointer to variable or array to
                        __INT_T *iostat,  /* same as for ENTF90IO(open_) */
                        __CLEN_T cunit_len)
 {
-  static FIO_FCB dumfcb;
+  static FIO_TLS FIO_FCB dumfcb;
 
+  INIT_GBL;
   __fortio_errinit03(-99, *bitv, iostat, "internal namelist write");
   rec_len = cunit_len;
   byte_cnt = 0;
@@ -879,6 +883,7 @@ ENTCRF90IO(NMLW, nmlw)(NML_GROUP *nmldesc) /* namelist group descriptor */
 static int
 _f90io_nmlw_end()
 {
+  INIT_GBL;
   gbl->decimal = 0;
   gbl->sign = 0;
   gbl->round = 0;
@@ -929,7 +934,7 @@ static int
 dtio_write_scalar(NML_DESC **NextDescp, NML_DESC *descp, char *loc_addr,
                   int dtvsize)
 {
-  static __INT_T internal_unit = -1;
+  static FIO_TLS __INT_T internal_unit = -1;
   __INT_T tmp_iostat = 0;
   __INT_T *iostat;
   __INT_T *unit;
@@ -943,7 +948,7 @@ dtio_write_scalar(NML_DESC **NextDescp, NML_DESC *descp, char *loc_addr,
   NML_DESC *start_descp;
   __CLEN_T iotypelen = 8;
   __CLEN_T iomsglen = 250;
-  static char iomsg[250];
+  static FIO_TLS char iomsg[250];
   int k, num_consts, ret_err, j;
   char *iotype = "NAMELIST";
   char *start_addr;
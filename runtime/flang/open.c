@@ -34,7 +34,7 @@
 #define access _access
 #endif
 
-static FIO_FCB *Fcb; /* pointer to the file control block */
+static FIO_TLS FIO_FCB *Fcb; /* pointer to the file control block */
 
 int next_newunit = -13;
 
@@ -65,6 +65,7 @@ __fortio_open(int unit, int action_flag, int status_flag, int dispose_flag,
   FIO_FCB *f;   /* local file control block ptr */
   __CLEN_T i;
   int fd;
+  int locked;
 
   if (ILLEGAL_UNIT(unit))
     return __fortio_error(FIO_EUNIT);
@@ -114,10 +115,13 @@ __fortio_open(int unit, int action_flag, int status_flag, int dispose_flag,
     }
 #endif
     /*  check that file is not already connected to different unit: */
-    for (f = fioFcbTbls.fcbs; f; f = f->next)
-      if (f->named && strcmp(filename, f->name) == 0)
-        if (unit != f->unit)
-          EXIT_OPEN(__fortio_error(FIO_EOPENED))
+    locked = __fortio_lock_fcbs();
+    for (f = fioFcbs; f; f = f->next)
+      if (f->named && strcmp(filename, f->name) == 0 && unit != f->unit)
+        break;
+    __fortio_unlock_fcbs(locked);
+    if (f != NULL)
+      EXIT_OPEN(__fortio_error(FIO_EOPENED))
   }
 
   /* ------- handle situation in which unit is already connected:  */
@@ -343,6 +347,7 @@ f90_open(__INT_T *unit, __INT_T *bitv, char *acc_ptr, char *action_ptr,
   bool binary;
 
   __fortio_errinit03(*unit, *bitv, iostat, "OPEN");
+  __fortio_lock_unit(*unit);
 
   if (name_ptr != NULL) {
     fioFcbTbls.fname = name_ptr;
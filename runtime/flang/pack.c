@@ -37,6 +37,262 @@ static int I8(next_index)(__INT_T *index, F90_Desc *s)
   return 0; /* finished */
 }
 
+/* Whole contiguous arrays are packed and unpacked PACK_BLK elements at a
+   time: the mask block is first turned into one byte per element, which
+   is then used to move the data without looking at the mask kind again. */
+
+#define PACK_BLK 1024
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define PACK_HAVE_AVX512
+#include <immintrin.h>
+#endif
+
+/* sel[0:n] = the mask elements at mb are true; 0 for an unknown kind */
+
+static int
+pack_sel(unsigned char *sel, char *mb, int kind, __INT_T n)
+{
+  __INT_T i;
+
+#define PACK_SEL(T, MASK)                                                      \
+  {                                                                            \
+    T ml = MASK;                                                               \
+    for (i = 0; i < n; i++)                                                    \
+      sel[i] = (((T *)mb)[i] & ml) != 0;                                       \
+  }                                                                            \
+  return 1;
+
+  switch (kind) {
+  case __LOG1:
+    PACK_SEL(__LOG1_T, GET_DIST_MASK_LOG1)
+  case __LOG2:
+    PACK_SEL(__LOG2_T, GET_DIST_MASK_LOG2)
+  case __LOG4:
+    PACK_SEL(__LOG4_T, GET_DIST_MASK_LOG4)
+  case __LOG8:
+    PACK_SEL(__LOG8_T, GET_DIST_MASK_LOG8)
+  case __INT1:
+    PACK_SEL(__INT1_T, GET_DIST_MASK_INT1)
+  case __INT2:
+    PACK_SEL(__INT2_T, GET_DIST_MASK_INT2)
+  case __INT4:
+    PACK_SEL(__INT4_T, GET_DIST_MASK_INT4)
+  case __INT8:
+    PACK_SEL(__INT8_T, GET_DIST_MASK_INT8)
+  }
+#undef PACK_SEL
+  return 0;
+}
+
+#ifdef PACK_HAVE_AVX512
+static __INT_T __attribute__((target("avx512f")))
+pack_avx512_4(__INT4_T *rp, __INT4_T *ap, unsigned char *sel, __INT_T n)
+{
+  __INT_T i, k;
+  __mmask16 m;
+
+  for (i = k = 0; i + 16 <= n; i += 16) {
+    m = _mm512_test_epi32_mask(
+        _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i *)(sel + i))),
+        _mm512_set1_epi32(1));
+    _mm512_mask_compressstoreu_epi32(rp + k, m,
+                                     _mm512_loadu_si512(ap + i));
+    k += __builtin_popcount(m);
+  }
+  for (; i < n; i++)
+    if (sel[i])
+      rp[k++] = ap[i];
+  return k;
+}
+
+static __INT_T __attribute__((target("avx512f")))
+pack_avx512_8(__INT8_T *rp, __INT8_T *ap, unsigned char *sel, __INT_T n)
+{
+  __INT_T i, k;
+  __mmask8 m;
+
+  for (i = k = 0; i + 8 <= n; i += 8) {
+    m = _mm512_test_epi64_mask(
+        _mm512_cvtepu8_epi64(_mm_loadl_epi64((__m128i *)(sel + i))),
+        _mm512_set1_epi64(1));
+    _mm512_mask_compressstoreu_epi64(rp + k, m,
+                                     _mm512_loadu_si512(ap + i));
+    k += __builtin_popcount(m);
+  }
+  for (; i < n; i++)
+    if (sel[i])
+      rp[k++] = ap[i];
+  return k;
+}
+
+static int
+pack_avx512(void)
+{
+  static int avx512 = -1;
+
+  if (avx512 < 0)
+    avx512 = __builtin_cpu_supports("avx512f") != 0;
+  return avx512;
+}
+#endif
+
+/* Store the selected ones of the n len byte elements at ap at rp, which
+   has room for room elements; return the number stored.  With room for
+   all of them a selected element is known not to run past the end, and
+   every element can be stored whether it is selected or not. */
+
+static __INT_T
+pack_block(char *rp, char *ap, unsigned char *sel, __INT_T n, __INT_T room,
+           int len)
+{
+  __INT_T i, j, k;
+
+#define PACK_ALL(T)                                                            \
+  {                                                                            \
+    T *rt = (T *)rp, *at = (T *)ap;                                            \
+    for (i = k = 0; i < n; i++) {                                              \
+      rt[k] = at[i];                                                           \
+      k += sel[i];                                                             \
+    }                                                                          \
+  }                                                                            \
+  return k;
+
+  if (n <= room) {
+#ifdef PACK_HAVE_AVX512
+    if (len == 4 && pack_avx512())
+      return pack_avx512_4((__INT4_T *)rp, (__INT4_T *)ap, sel, n);
+    if (len == 8 && pack_avx512())
+      return pack_avx512_8((__INT8_T *)rp, (__INT8_T *)ap, sel, n);
+#endif
+    switch (len) {
+    case 1:
+      PACK_ALL(__INT1_T)
+    case 2:
+      PACK_ALL(__INT2_T)
+    case 4:
+      PACK_ALL(__INT4_T)
+    case 8:
+      PACK_ALL(__INT8_T)
+    case 16:
+      PACK_ALL(__CPLX16_T)
+    }
+  }
+#undef PACK_ALL
+
+  /* runs of selected elements */
+  for (i = k = 0; i < n && k < room; i = j) {
+    while (i < n && !sel[i])
+      i++;
+    for (j = i; j < n && sel[j] && k + j - i < room; j++)
+      ;
+    memcpy(rp + k * len, ap + i * len, (j - i) * len);
+    k += j - i;
+  }
+  return k;
+}
+
+/* PACK of whole contiguous arrays; return 0 to leave it to the element by
+   element loop.  The result is filled from vb (if not NULL) past the
+   packed elements. */
+
+static int I8(pack_contig)(void *rb, void *ab, void *mb, void *vb,
+                           F90_Desc *result, F90_Desc *array, F90_Desc *mask,
+                           F90_Desc *vector)
+{
+  unsigned char sel[PACK_BLK];
+  char *rp, *ap, *mp, *vp;
+  __INT_T i, k, n, nr;
+  int len, mlen;
+
+  len = F90_LEN_G(result);
+  if (F90_LEN_G(array) != len || F90_GSIZE_G(array) <= 0)
+    return 0;
+  rp = I8(__fort_contig_address)(rb, result);
+  ap = I8(__fort_contig_address)(ab, array);
+  mp = I8(__fort_contig_address)(mb, mask);
+  vp = vb ? I8(__fort_contig_address)(vb, vector) : NULL;
+  if (rp == NULL || ap == NULL || mp == NULL || (vb && vp == NULL) ||
+      F90_GSIZE_G(mask) != F90_GSIZE_G(array) ||
+      (vb && (F90_LEN_G(vector) != len ||
+              F90_GSIZE_G(vector) < F90_GSIZE_G(result))))
+    return 0;
+  mlen = F90_LEN_G(mask);
+
+  n = F90_GSIZE_G(array);
+  nr = F90_GSIZE_G(result);
+  for (i = k = 0; i < n && k < nr; i += PACK_BLK) {
+    if (!pack_sel(sel, mp + i * mlen, F90_KIND_G(mask), Min(n - i, PACK_BLK)))
+      return 0; /* only on the first block */
+    k += pack_block(rp + k * len, ap + i * len, sel, Min(n - i, PACK_BLK),
+                    nr - k, len);
+  }
+  if (vb && k < nr)
+    memcpy(rp + k * len, vp + k * len, (nr - k) * len);
+  return 1;
+}
+
+/* UNPACK of whole contiguous arrays; return 0 to leave it to the element
+   by element loop.  A scalar FIELD is at fb. */
+
+static int I8(unpack_contig)(void *rb, void *vb, void *mb, void *fb,
+                             F90_Desc *result, F90_Desc *vector,
+                             F90_Desc *mask, F90_Desc *field,
+                             int field_is_array)
+{
+  unsigned char sel[PACK_BLK];
+  char *rp, *vp, *mp, *fp;
+  __INT_T fs, i, j, k, m, n;
+  int len, mlen;
+
+  len = F90_LEN_G(result);
+  rp = I8(__fort_contig_address)(rb, result);
+  vp = I8(__fort_contig_address)(vb, vector);
+  mp = I8(__fort_contig_address)(mb, mask);
+  fp = field_is_array ? I8(__fort_contig_address)(fb, field) : (char *)fb;
+  if (rp == NULL || vp == NULL || mp == NULL || fp == NULL ||
+      F90_LEN_G(vector) != len ||
+      F90_GSIZE_G(mask) != F90_GSIZE_G(result) ||
+      (field_is_array && (F90_LEN_G(field) != len ||
+                          F90_GSIZE_G(field) != F90_GSIZE_G(result))))
+    return 0;
+  mlen = F90_LEN_G(mask);
+  fs = field_is_array; /* field element stride */
+
+#define UNPACK_ELEMS(T)                                                        \
+  {                                                                            \
+    T *rt = (T *)rp, *vt = (T *)vp, *ft = (T *)fp;                             \
+    for (j = 0; j < m; j++)                                                    \
+      rt[i + j] = sel[j] ? vt[k++] : ft[fs * (i + j)];                         \
+  }                                                                            \
+  break;
+
+  n = F90_GSIZE_G(result);
+  for (i = k = 0; i < n; i += PACK_BLK) {
+    m = Min(n - i, PACK_BLK);
+    if (!pack_sel(sel, mp + i * mlen, F90_KIND_G(mask), m))
+      return 0; /* only on the first block */
+    switch (len) {
+    case 1:
+      UNPACK_ELEMS(__INT1_T)
+    case 2:
+      UNPACK_ELEMS(__INT2_T)
+    case 4:
+      UNPACK_ELEMS(__INT4_T)
+    case 8:
+      UNPACK_ELEMS(__INT8_T)
+    case 16:
+      UNPACK_ELEMS(__CPLX16_T)
+    default:
+      for (j = 0; j < m; j++)
+        memcpy(rp + (i + j) * len,
+               sel[j] ? vp + k++ * len : fp + fs * (i + j) * len, len);
+    }
+  }
+#undef UNPACK_ELEMS
+  return 1;
+}
+
 /* pack, optional vector arg present.  pack masked elements of array
    into result and fill remainder of result with corresponding
    elements of vector */
@@ -90,6 +346,10 @@ void ENTFTN(PACK, pack)(void *rb,         /* result base */
   } else
     __fort_abort("PACK: invalid mask descriptor");
 
+  if (mask_is_array &&
+      I8(pack_contig)(rb, ab, mb, vb, result, array, mask, vector))
+    return;
+
   more_array = more_vector = 1;
   while (more_array & more_vector) {
 
@@ -233,6 +493,10 @@ void ENTFTN(PACKZ, packz)(void *rb,         /* result base */
   } else
     __fort_abort("PACK: invalid mask descriptor");
 
+  if (mask_is_array &&
+      I8(pack_contig)(rb, ab, mb, NULL, result, array, mask, NULL))
+    return;
+
   more = 1;
   while (more) {
 
@@ -359,6 +623,10 @@ void ENTFTN(UNPACK, unpack)(void *rb,         /* result base */
   } else
     __fort_abort("UNPACK: invalid field descriptor");
 
+  if (I8(unpack_contig)(rb, vb, mb, fb, result, vector, mask, field,
+                        field_is_array))
+    return;
+
   more = 1;
   while (more) {
 
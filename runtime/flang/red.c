@@ -24,6 +24,9 @@
 #include "stdioInterf.h"
 #include "fioMacros.h"
 #include "red.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 extern void (*__fort_scalar_copy[__NTYPES])(void *rp, void *sp, int len);
 
@@ -157,6 +160,153 @@ static void I8(red_scalar_loop)(red_parm *z, __INT_T aof, __INT_T ll, int dim)
   }
 }
 
+#ifdef _OPENMP
+
+/* Large reductions are spread over the threads of a parallel region unless
+ * the caller is already in one.  Each thread reduces a static share of the
+ * outermost dimension, and a scalar result combines the partial results in
+ * thread order through g_fn, so for a given number of threads the result
+ * does not depend on scheduling.
+ *
+ * F90_RED_PAR_MINSZ is the number of elements worth another thread
+ * (default RED_PAR_MINSZ); 0 keeps all reductions serial.
+ */
+#define RED_PAR_MINSZ (256 * 1024)
+
+/** \brief number of threads to reduce n elements on, 1 for serial */
+static int
+red_nthreads(__INT_T n)
+{
+  static long minsz = -1;
+  char *p;
+  int nthr;
+
+  if (minsz < 0) {
+    p = getenv("F90_RED_PAR_MINSZ");
+    minsz = p != NULL ? atol(p) : RED_PAR_MINSZ;
+    if (minsz < 0)
+      minsz = 0;
+  }
+  if (minsz == 0 || n / minsz < 2 || omp_in_parallel())
+    return 1;
+  nthr = omp_get_max_threads();
+  if (n / minsz < nthr)
+    nthr = n / minsz;
+  return nthr;
+}
+
+/** \brief red_scalar_loop on threads; returns 0 to leave it to the caller.
+ * xsz is the size of the locations l_fn stores for MAXLOC/MINLOC.
+ */
+static int I8(red_scalar_par)(red_parm *z, __INT_T aof, int dim, int xsz)
+{
+  DECL_HDR_PTRS(as);
+  DECL_DIM_PTRS(asd);
+  DECL_DIM_PTRS(msd);
+  char *pb;
+  __INT8_T *px;
+  __INT_T abl, abn, abu, ahop, ao, i, mhop, mlow;
+  int found, nteam, nthr, psz, t;
+
+  as = z->as;
+  SET_DIM_PTRS(asd, as, dim - 1);
+
+  /* FINDLOC stops at its first hit and stays serial */
+  if (z->l_fn_b != NULL || z->l_fn == NULL || z->g_fn == NULL ||
+      DIST_DPTR_CN_G(asd) != 1)
+    return 0;
+  nthr = red_nthreads(F90_GSIZE_G(as));
+  if (nthr < 2)
+    return 0;
+  abn = I8(__fort_block_bounds)(as, dim, DIST_DPTR_CL_G(asd), &abl, &abu);
+  if (dim > 1 && abn < nthr)
+    nthr = abn;
+  if (nthr < 2)
+    return 0;
+
+  /* partial results and locations, for at most nthr threads */
+  psz = (z->len + 15) & ~15;
+  pb = __fort_malloc_without_abort(nthr * (psz + sizeof(__INT8_T)));
+  if (pb == NULL)
+    return 0;
+  px = (__INT8_T *)(pb + nthr * psz);
+  memset(px, 0, nthr * sizeof(__INT8_T));
+
+  ahop = F90_DPTR_SSTRIDE_G(asd) * F90_DPTR_LSTRIDE_G(asd);
+  ao = aof +
+       (F90_DPTR_SSTRIDE_G(asd) * abl + F90_DPTR_SOFFSET_G(asd) -
+        DIST_DPTR_CLOF_G(asd)) *
+           F90_DPTR_LSTRIDE_G(asd);
+  i = abl - F90_DPTR_LBOUND_G(asd); /* ordinal index (zero-based) */
+  if (z->mask_present) {
+    SET_DIM_PTRS(msd, z->ms, dim - 1);
+    mlow = F90_DPTR_LBOUND_G(msd);
+    mhop = F90_DPTR_SSTRIDE_G(msd) * F90_DPTR_LSTRIDE_G(msd);
+  } else {
+    mlow = mhop = 0;
+  }
+
+  /* The team may be smaller than asked for, so it is partitioned by its
+     actual size. */
+  nteam = 1;
+#pragma omp parallel num_threads(nthr)
+  {
+    red_parm zt = *z;
+    __LOG_T *mp = z->mb;
+    int me = omp_get_thread_num();
+    int nt = omp_get_num_threads();
+    __INT_T k = (__INT_T)((long long)abn * me / nt);
+    __INT_T ke = (__INT_T)((long long)abn * (me + 1) / nt);
+
+    if (me == 0)
+      nteam = nt;
+
+    zt.rb = pb + me * psz;
+    zt.xb = (__INT_T *)(px + me);
+    __fort_scalar_copy[z->kind](zt.rb, z->zb, z->len);
+    if (dim > 1) {
+      for (; k < ke; k++) {
+        zt.mi[dim - 1] = mlow + i + k;
+        I8(red_scalar_loop)(&zt, ao + k * ahop, i + k + 1, dim - 1);
+      }
+    } else if (k < ke) {
+      if (z->mask_present) {
+        if (z->mask_stored_alike)
+          mp = (__LOG_T *)((char *)(z->mb) + ((ao + k * ahop) << z->lk_shift));
+        else {
+          zt.mi[0] = mlow + i + k;
+          mp = I8(__fort_local_address)(z->mb, z->ms, zt.mi);
+          if (mp == NULL)
+            __fort_red_abort("mask misalignment");
+        }
+      }
+      z->l_fn(zt.rb, ke - k, z->ab + (ao + k * ahop) * F90_LEN_G(as), ahop, mp,
+              mhop, zt.xb, i + k + 1, 1, z->len);
+    }
+  }
+
+  /* A share without a location has nothing to add to MAXLOC/MINLOC; the
+     first one with a location is taken as is, since g_fn keeps the smaller
+     location of equal values. */
+  found = 0;
+  for (t = 0; t < nteam; t++) {
+    if (z->xb == NULL) {
+      z->g_fn(1, z->rb, pb + t * psz, NULL, NULL, z->len);
+    } else if (px[t] != 0) {
+      if (found) {
+        z->g_fn(1, z->rb, pb + t * psz, z->xb, px + t, z->len);
+      } else {
+        __fort_scalar_copy[z->kind](z->rb, pb + t * psz, z->len);
+        memcpy(z->xb, px + t, xsz);
+        found = 1;
+      }
+    }
+  }
+  __fort_free(pb);
+  return 1;
+}
+#endif
+
 void I8(__fort_red_scalar)(red_parm *z, char *rb, char *ab, char *mb,
                           F90_Desc *rs, F90_Desc *as, F90_Desc *ms, __INT_T *xb,
                           red_enum op)
@@ -198,7 +348,10 @@ void I8(__fort_red_scalar)(red_parm *z, char *rb, char *ab, char *mb,
   if (~F90_FLAGS_G(as) & __OFF_TEMPLATE) {
     z->ab += F90_LBASE_G(as) * F90_LEN_G(as);
     ao = -1;
-    I8(red_scalar_loop)(z, ao, 0, F90_RANK_G(as));
+#ifdef _OPENMP
+    if (!I8(red_scalar_par)(z, ao, F90_RANK_G(as), sizeof(__INT4_T)))
+#endif
+      I8(red_scalar_loop)(z, ao, 0, F90_RANK_G(as));
   }
 
   I8(__fort_reduce_section)(rb, z->kind, z->len,
@@ -262,7 +415,10 @@ void I8(__fort_red_scalarlk)(red_parm *z, char *rb, char *ab, char *mb,
     z->ab += F90_LBASE_G(as) * F90_LEN_G(as);
     ao = -1;
 
-    I8(red_scalar_loop)(z, ao, 0, F90_RANK_G(as));
+#ifdef _OPENMP
+    if (!I8(red_scalar_par)(z, ao, F90_RANK_G(as), sizeof(__INT4_T)))
+#endif
+      I8(red_scalar_loop)(z, ao, 0, F90_RANK_G(as));
   }
 
   I8(__fort_reduce_section)(rb, z->kind, z->len,
@@ -486,7 +642,10 @@ void I8(__fort_kred_scalarlk)(red_parm *z, char *rb, char *ab, char *mb,
   if (~F90_FLAGS_G(as) & __OFF_TEMPLATE) {
     z->ab += F90_LBASE_G(as) * F90_LEN_G(as);
     ao = -1;
-    I8(red_scalar_loop)(z, ao, 0, F90_RANK_G(as));
+#ifdef _OPENMP
+    if (!I8(red_scalar_par)(z, ao, F90_RANK_G(as), sizeof(__INT8_T)))
+#endif
+      I8(red_scalar_loop)(z, ao, 0, F90_RANK_G(as));
   }
 
   I8(__fort_reduce_section)(rb, z->kind, z->len,
@@ -669,6 +828,74 @@ static void I8(kred_array_loop)(red_parm *z, __INT_T rof, __INT_T aof, int rdim,
 #endif
 }
 
+#ifdef _OPENMP
+/** \brief red_array_loop or kred_array_loop on threads; returns 0 to leave
+ * it to the caller.  The threads take static shares of the outermost result
+ * dimension, whose elements are reduced independently.
+ */
+static int I8(red_array_par)(red_parm *z, __INT_T rof, __INT_T aof, int rdim,
+                             int adim, void (*loop)(red_parm *, __INT_T,
+                                                    __INT_T, int, int))
+{
+  DECL_DIM_PTRS(asd);
+  DECL_DIM_PTRS(rsd);
+  DECL_DIM_PTRS(msd);
+  __INT_T abl, abn, abu, ahop, ao, i, mlow, rbl, rbu, rhop, ro;
+  int nthr;
+
+  if (rdim <= 0)
+    return 0;
+  if (adim == z->dim)
+    --adim;
+  SET_DIM_PTRS(rsd, z->rs, rdim - 1);
+  SET_DIM_PTRS(asd, z->as, adim - 1);
+  if (DIST_DPTR_CN_G(asd) != 1 || DIST_DPTR_CN_G(rsd) != 1)
+    return 0;
+  nthr = red_nthreads(F90_GSIZE_G(z->as));
+  if (nthr < 2)
+    return 0;
+  abn = I8(__fort_block_bounds)(z->as, adim, DIST_DPTR_CL_G(asd), &abl, &abu);
+  if (abn < nthr)
+    nthr = abn;
+  if (nthr < 2)
+    return 0;
+  I8(__fort_block_bounds)(z->rs, rdim, DIST_DPTR_CL_G(rsd), &rbl, &rbu);
+
+  ahop = F90_DPTR_SSTRIDE_G(asd) * F90_DPTR_LSTRIDE_G(asd);
+  ao = aof +
+       (F90_DPTR_SSTRIDE_G(asd) * abl + F90_DPTR_SOFFSET_G(asd) -
+        DIST_DPTR_CLOF_G(asd)) *
+           F90_DPTR_LSTRIDE_G(asd);
+  rhop = F90_DPTR_SSTRIDE_G(rsd) * F90_DPTR_LSTRIDE_G(rsd);
+  ro = rof +
+       (F90_DPTR_SSTRIDE_G(rsd) * rbl + F90_DPTR_SOFFSET_G(rsd) -
+        DIST_DPTR_CLOF_G(rsd)) *
+           F90_DPTR_LSTRIDE_G(rsd);
+  i = abl - F90_DPTR_LBOUND_G(asd); /* ordinal index (zero-based) */
+  if (z->mask_present) {
+    SET_DIM_PTRS(msd, z->ms, adim - 1);
+    mlow = F90_DPTR_LBOUND_G(msd);
+  } else {
+    mlow = 0;
+  }
+
+#pragma omp parallel num_threads(nthr)
+  {
+    red_parm zt = *z;
+    int me = omp_get_thread_num();
+    int nt = omp_get_num_threads();
+    __INT_T k = (__INT_T)((long long)abn * me / nt);
+    __INT_T ke = (__INT_T)((long long)abn * (me + 1) / nt);
+
+    for (; k < ke; k++) {
+      zt.mi[adim - 1] = mlow + i + k;
+      loop(&zt, ro + k * rhop, ao + k * ahop, rdim - 1, adim - 1);
+    }
+  }
+  return 1;
+}
+#endif
+
 void I8(__fort_red_array)(red_parm *z, char *rb0, char *ab, char *mb, char *db,
                          F90_Desc *rs0, F90_Desc *as, F90_Desc *ms,
                          F90_Desc *ds, red_enum op)
@@ -842,7 +1069,11 @@ void I8(__fort_red_array)(red_parm *z, char *rb0, char *ab, char *mb, char *db,
   if (~F90_FLAGS_G(as) & __OFF_TEMPLATE) {
     z->ab += F90_LBASE_G(as) * F90_LEN_G(as);
     ao = -1;
-    I8(red_array_loop)(z, ro, ao, rank, F90_RANK_G(as));
+#ifdef _OPENMP
+    if (!I8(red_array_par)(z, ro, ao, rank, F90_RANK_G(as),
+                           I8(red_array_loop)))
+#endif
+      I8(red_array_loop)(z, ro, ao, rank, F90_RANK_G(as));
   }
 
   I8(__fort_reduce_section)(rb, z->kind, z->len,
@@ -1034,7 +1265,11 @@ void I8(__fort_red_arraylk)(red_parm *z, char *rb0, char *ab, char *mb, char *db
   if (~F90_FLAGS_G(as) & __OFF_TEMPLATE) {
     z->ab += F90_LBASE_G(as) * F90_LEN_G(as);
     ao = -1;
-    I8(red_array_loop)(z, ro, ao, rank, F90_RANK_G(as));
+#ifdef _OPENMP
+    if (!I8(red_array_par)(z, ro, ao, rank, F90_RANK_G(as),
+                           I8(red_array_loop)))
+#endif
+      I8(red_array_loop)(z, ro, ao, rank, F90_RANK_G(as));
   }
 
   I8(__fort_reduce_section)(rb, z->kind, z->len,
@@ -1225,7 +1460,11 @@ void I8(__fort_kred_arraylk)(red_parm *z, char *rb0, char *ab, char *mb,
   if (~F90_FLAGS_G(as) & __OFF_TEMPLATE) {
     z->ab += F90_LBASE_G(as) * F90_LEN_G(as);
     ao = -1;
-    I8(kred_array_loop)(z, ro, ao, rank, F90_RANK_G(as));
+#ifdef _OPENMP
+    if (!I8(red_array_par)(z, ro, ao, rank, F90_RANK_G(as),
+                           I8(kred_array_loop)))
+#endif
+      I8(kred_array_loop)(z, ro, ao, rank, F90_RANK_G(as));
   }
 
   I8(__fort_reduce_section)(rb, z->kind, z->len,
@@ -136,9 +136,47 @@ void I8(__fort_global_reduce)(char *rb, char *hb, int dims, F90_Desc *rd,
 /* arithmetic reduction functions
    RTYP = result & vector type
    ATYP = accumulator type
+
+   The unmasked reduction is done by
+
+   void k_NAME(ATYP *x, RTYP *v, __INT_T n, __INT_T vs);
+      x = x OP the n elements of v, vs elements apart
+
+   ARITHK's kernel splits a contiguous vector among four accumulators,
+   so that each OP does not wait for the one before it.  This reorders
+   OP, which is exact for integers and logicals and changes only the
+   rounding of reals.  ARITHKFN builds the l_ and g_ functions around a
+   k_NAME of the caller's; ARITHFN uses ARITHK's, which ARITHFNLKN also
+   calls.
 */
 
-#define ARITHFN(OP, NAME, RTYP, ATYP)                                          \
+#define ARITHK(OP, NAME, RTYP, ATYP)                                           \
+  static void k_##NAME(ATYP *x, RTYP *v, __INT_T n, __INT_T vs)                \
+  {                                                                            \
+    ATYP a0 = *x, a1, a2, a3;                                                  \
+    __INT_T i;                                                                 \
+    if (vs == 1 && n >= 8) {                                                   \
+      a0 = a0 OP v[0];                                                         \
+      a1 = v[1];                                                               \
+      a2 = v[2];                                                               \
+      a3 = v[3];                                                               \
+      for (i = 4; i + 4 <= n; i += 4) {                                        \
+        a0 = a0 OP v[i];                                                       \
+        a1 = a1 OP v[i + 1];                                                   \
+        a2 = a2 OP v[i + 2];                                                   \
+        a3 = a3 OP v[i + 3];                                                   \
+      }                                                                        \
+      a0 = (a0 OP a1) OP(a2 OP a3);                                            \
+      for (; i < n; i++)                                                       \
+        a0 = a0 OP v[i];                                                       \
+    } else {                                                                   \
+      for (i = 0; n > 0; n--, i += vs)                                         \
+        a0 = a0 OP v[i];                                                       \
+    }                                                                          \
+    *x = a0;                                                                   \
+  }
+
+#define ARITHKFN(OP, NAME, RTYP, ATYP)                                         \
   static void l_##NAME(RTYP *r, __INT_T n, RTYP *v, __INT_T vs, __LOG_T *m,    \
                        __INT_T ms, __INT_T *loc, __INT_T li, __INT_T ls,       \
                        __INT_T len)                                            \
@@ -147,11 +185,9 @@ void I8(__fort_global_reduce)(char *rb, char *hb, int dims, F90_Desc *rd,
     ATYP x = *r;                                                               \
     __LOG_T mask_log;                                                          \
     if (ms == 0)                                                               \
-      for (i = 0; n > 0; n--, i += vs) {                                       \
-        x = x OP v[i];                                                         \
-      }                                                                        \
+      k_##NAME(&x, v, n, vs);                                                  \
     else {                                                                     \
-      mask_log = GET_DIST_MASK_LOG;                                           \
+      mask_log = GET_DIST_MASK_LOG;                                            \
       for (i = j = 0; n > 0; n--, i += vs, j += ms) {                          \
         if (m[j] & mask_log)                                                   \
           x = x OP v[i];                                                       \
@@ -167,6 +203,10 @@ void I8(__fort_global_reduce)(char *rb, char *hb, int dims, F90_Desc *rd,
     }                                                                          \
   }
 
+#define ARITHFN(OP, NAME, RTYP, ATYP)                                          \
+  ARITHK(OP, NAME, RTYP, ATYP)                                                 \
+  ARITHKFN(OP, NAME, RTYP, ATYP)
+
 #define ARITHFNLKN(OP, NAME, RTYP, ATYP, N)                                    \
   static void l_##NAME##l##N(RTYP *r, __INT_T n, RTYP *v, __INT_T vs,          \
                              __LOG##N##_T *m, __INT_T ms, __INT_T *loc,        \
@@ -176,11 +216,9 @@ void I8(__fort_global_reduce)(char *rb, char *hb, int dims, F90_Desc *rd,
     ATYP x = *r;                                                               \
     __LOG##N##_T mask_log;                                                     \
     if (ms == 0)                                                               \
-      for (i = 0; n > 0; n--, i += vs) {                                       \
-        x = x OP v[i];                                                         \
-      }                                                                        \
+      k_##NAME(&x, v, n, vs);                                                  \
     else {                                                                     \
-      mask_log = GET_DIST_MASK_LOG##N;                                        \
+      mask_log = GET_DIST_MASK_LOG##N;                                         \
       for (i = j = 0; n > 0; n--, i += vs, j += ms) {                          \
         if (m[j] & mask_log)                                                   \
           x = x OP v[i];                                                       \
@@ -330,6 +368,200 @@ void I8(__fort_global_reduce)(char *rb, char *hb, int dims, F90_Desc *rd,
     strncpy(r, x, len);                                                        \
   }
 
+/* Contiguous location searches.
+
+   The MINLOC/MAXLOC/FINDLOC local functions below hand a slice with unit
+   vector stride, and no mask or a unit stride mask of the element size,
+   to these helpers.  Only the elements of v[i:n] whose mask element has a
+   bit of ml set (m == NULL: all of them) take part:
+
+   RTYP vext_NAME(RTYP *v, __INT_T i, __INT_T n, LTYP *m, LTYP ml, RTYP x)
+      extreme under COND of x and the elements
+   __INT_T vfind_NAME(RTYP *v, __INT_T i, __INT_T n, LTYP *m, LTYP ml,
+                      RTYP x, __LOG_T back)
+      index of the first (back: last) element with v[k] COND x, or -1
+
+   LOCV_L elements are compared at a time with vector extensions; without
+   them the local functions keep to their own loops.
+*/
+
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9)
+
+#define LOCV_BYTES 16
+
+/* vector types of LOCV_L elements and of as many mask elements */
+#define LOCV_TYPES(RTYP, LTYP)                                                 \
+  enum { LOCV_L = LOCV_BYTES / sizeof(RTYP) };                                 \
+  typedef RTYP locv_t __attribute__((vector_size(LOCV_BYTES)));                \
+  typedef LTYP locv_lt __attribute__((vector_size(LOCV_BYTES)));               \
+  typedef __typeof__((locv_t){0} == (locv_t){0}) locv_ct;
+
+/* c = v[i:i+LOCV_L] COND y, in the lanes the mask at m + i selects */
+#define LOCV_CMP(c, a, COND, v, i, y, m, ml)                                   \
+  {                                                                            \
+    memcpy(&a, v + (i), sizeof(a));                                            \
+    c = a COND y;                                                              \
+    if (m) {                                                                   \
+      locv_lt mv_;                                                             \
+      memcpy(&mv_, m + (i), sizeof(mv_));                                      \
+      c &= (locv_ct)((mv_ & ml) != (locv_lt){0});                              \
+    }                                                                          \
+  }
+
+/* b = the lanes of b or of v[i:i+LOCV_L], whichever is COND */
+#define LOCV_SEL(b, COND, v, i, m, ml)                                         \
+  {                                                                            \
+    locv_t a_;                                                                 \
+    locv_ct c_;                                                                \
+    LOCV_CMP(c_, a_, COND, v, i, b, m, ml)                                     \
+    b = (locv_t)(((locv_ct)a_ & c_) | ((locv_ct)b & ~c_));                     \
+  }
+
+static inline int
+locv_any(void *c)
+{
+  unsigned long long u[LOCV_BYTES / sizeof(unsigned long long)], r = 0;
+  size_t i;
+
+  memcpy(u, c, sizeof(u));
+  for (i = 0; i < sizeof(u) / sizeof(u[0]); i++)
+    r |= u[i];
+  return r != 0;
+}
+
+/* Four vectors a step, with separate accumulators in vext */
+#define LOCVEXT(COND, NAME, RTYP, LTYP)                                        \
+  static RTYP vext_##NAME(RTYP *v, __INT_T i, __INT_T n, LTYP *m, LTYP ml,     \
+                          RTYP x)                                              \
+  {                                                                            \
+    LOCV_TYPES(RTYP, LTYP)                                                     \
+    locv_t b0, b1, b2, b3;                                                     \
+    int j;                                                                     \
+    if (i + 4 * LOCV_L <= n) {                                                 \
+      b0 = b1 = b2 = b3 = (locv_t){0} + x;                                     \
+      for (; i + 4 * LOCV_L <= n; i += 4 * LOCV_L) {                           \
+        LOCV_SEL(b0, COND, v, i, m, ml)                                        \
+        LOCV_SEL(b1, COND, v, i + LOCV_L, m, ml)                               \
+        LOCV_SEL(b2, COND, v, i + 2 * LOCV_L, m, ml)                           \
+        LOCV_SEL(b3, COND, v, i + 3 * LOCV_L, m, ml)                           \
+      }                                                                        \
+      for (j = 0; j < LOCV_L; j++) {                                           \
+        if (b0[j] COND x)                                                      \
+          x = b0[j];                                                           \
+        if (b1[j] COND x)                                                      \
+          x = b1[j];                                                           \
+        if (b2[j] COND x)                                                      \
+          x = b2[j];                                                           \
+        if (b3[j] COND x)                                                      \
+          x = b3[j];                                                           \
+      }                                                                        \
+    }                                                                          \
+    for (; i < n; i++)                                                         \
+      if ((!m || (m[i] & ml)) && v[i] COND x)                                  \
+        x = v[i];                                                              \
+    return x;                                                                  \
+  }
+
+#define LOCVFIND(COND, NAME, RTYP, LTYP)                                       \
+  static __INT_T vfind_##NAME(RTYP *v, __INT_T i, __INT_T n, LTYP *m,          \
+                              LTYP ml, RTYP x, __LOG_T back)                   \
+  {                                                                            \
+    LOCV_TYPES(RTYP, LTYP)                                                     \
+    locv_t a, xv = (locv_t){0} + x;                                            \
+    locv_ct c0, c1, c2, c3;                                                    \
+    /* narrow [i,n) down to the first (last) four vectors with a hit */        \
+    if (!back) {                                                               \
+      for (; i + 4 * LOCV_L <= n; i += 4 * LOCV_L) {                           \
+        LOCV_CMP(c0, a, COND, v, i, xv, m, ml)                                 \
+        LOCV_CMP(c1, a, COND, v, i + LOCV_L, xv, m, ml)                        \
+        LOCV_CMP(c2, a, COND, v, i + 2 * LOCV_L, xv, m, ml)                    \
+        LOCV_CMP(c3, a, COND, v, i + 3 * LOCV_L, xv, m, ml)                    \
+        c0 |= c1 | c2 | c3;                                                    \
+        if (locv_any(&c0))                                                     \
+          break;                                                               \
+      }                                                                        \
+      for (; i < n; i++)                                                       \
+        if ((!m || (m[i] & ml)) && v[i] COND x)                                \
+          return i;                                                            \
+    } else {                                                                   \
+      for (; n - 4 * LOCV_L >= i; n -= 4 * LOCV_L) {                           \
+        LOCV_CMP(c0, a, COND, v, n - 4 * LOCV_L, xv, m, ml)                    \
+        LOCV_CMP(c1, a, COND, v, n - 3 * LOCV_L, xv, m, ml)                    \
+        LOCV_CMP(c2, a, COND, v, n - 2 * LOCV_L, xv, m, ml)                    \
+        LOCV_CMP(c3, a, COND, v, n - LOCV_L, xv, m, ml)                        \
+        c0 |= c1 | c2 | c3;                                                    \
+        if (locv_any(&c0))                                                     \
+          break;                                                               \
+      }                                                                        \
+      while (--n >= i)                                                         \
+        if ((!m || (m[n] & ml)) && v[n] COND x)                                \
+          return n;                                                            \
+    }                                                                          \
+    return -1;                                                                 \
+  }
+
+/* Unit stride, and a mask of the element size or none */
+#define LOCV_CONTIG(RTYP, LTYP)                                                \
+  (vs == 1 && (ms == 0 || (ms == 1 && sizeof(LTYP) == sizeof(RTYP))))
+
+/* Elements per MINLOC/MAXLOC block, small enough to rescan from L1 */
+#define LOCV_BLK 1024
+
+/* MINLOC/MAXLOC of a contiguous slice, one block at a time.  A block
+   holding a strictly better element moves the location to its first
+   occurrence; failing that, a location not yet set goes to the first
+   element equal to the incoming value. */
+#define MLOC_CONTIG(COND, NAME, RTYP, LTYP, N)                                 \
+  if (LOCV_CONTIG(RTYP, LTYP)) {                                               \
+    LTYP *mp = NULL;                                                           \
+    __INT_T b, e, k = -1;                                                      \
+    RTYP x;                                                                    \
+    mask_log = 0;                                                              \
+    if (ms != 0) {                                                             \
+      mp = m;                                                                  \
+      mask_log = GET_DIST_MASK_LOG##N;                                         \
+    }                                                                          \
+    for (b = 0; b < n; b = e) {                                                \
+      e = n - b > LOCV_BLK ? b + LOCV_BLK : n;                                 \
+      x = vext_##NAME(v, b, e, mp, mask_log, val);                             \
+      if (x COND val) {                                                        \
+        k = vfind_##NAME(v, b, e, mp, mask_log, x, 0);                         \
+        val = v[k];                                                            \
+      } else if (k < 0 && *loc == 0) {                                         \
+        k = vfind_##NAME(v, b, e, mp, mask_log, val, 0);                       \
+      }                                                                        \
+    }                                                                          \
+    *r = val;                                                                  \
+    if (k >= 0)                                                                \
+      *loc = li + k * ls;                                                      \
+    return;                                                                    \
+  }
+
+/* FINDLOC of a contiguous slice */
+#define FLOC_CONTIG(NAME, RTYP, LTYP, N)                                       \
+  if (LOCV_CONTIG(RTYP, LTYP)) {                                               \
+    LTYP *mp = NULL;                                                           \
+    __INT_T k;                                                                 \
+    mask_log = 0;                                                              \
+    if (ms != 0) {                                                             \
+      mp = m;                                                                  \
+      mask_log = GET_DIST_MASK_LOG##N;                                         \
+    }                                                                          \
+    k = vfind_##NAME(v, 0, n, mp, mask_log, val, back);                        \
+    if (k >= 0)                                                                \
+      *loc = li + k * ls;                                                      \
+    return;                                                                    \
+  }
+
+#else
+
+#define LOCVEXT(COND, NAME, RTYP, LTYP)
+#define LOCVFIND(COND, NAME, RTYP, LTYP)
+#define MLOC_CONTIG(COND, NAME, RTYP, LTYP, N)
+#define FLOC_CONTIG(NAME, RTYP, LTYP, N)
+
+#endif
+
 #define MLOCFN(COND, NAME, RTYP)                                               \
   static void l_##NAME(RTYP *r, __INT_T n, RTYP *v, __INT_T vs, __LOG_T *m,    \
                        __INT_T ms, __INT4_T *loc, __INT_T li, __INT_T ls,      \
@@ -460,6 +692,8 @@ void I8(__fort_global_reduce)(char *rb, char *hb, int dims, F90_Desc *rd,
   }
 
 #define MLOCFNLKN(COND, NAME, RTYP, N)                                         \
+  LOCVEXT(COND, NAME##l##N, RTYP, __LOG##N##_T)                                \
+  LOCVFIND(==, NAME##l##N, RTYP, __LOG##N##_T)                                 \
   static void l_##NAME##l##N(RTYP *r, __INT_T n, RTYP *v, __INT_T vs,          \
                              __LOG##N##_T *m, __INT_T ms, __INT4_T *loc,       \
                              __INT_T li, __INT_T ls, __INT_T len)              \
@@ -467,6 +701,7 @@ void I8(__fort_global_reduce)(char *rb, char *hb, int dims, F90_Desc *rd,
     __INT4_T i, j, t_loc = 0;                                                  \
     RTYP val = *r;                                                             \
     __LOG##N##_T mask_log;                                                     \
+    MLOC_CONTIG(COND, NAME##l##N, RTYP, __LOG##N##_T, N)                       \
     if (ms == 0) {                                                             \
       for (i = 0; n > 0; n--, i += vs, li += ls) {                             \
         if (v[i] COND val) {                                                   \
@@ -561,6 +796,8 @@ void I8(__fort_global_reduce)(char *rb, char *hb, int dims, F90_Desc *rd,
   }
 
 #define KMLOCFNLKN(COND, NAME, RTYP, N)                                        \
+  LOCVEXT(COND, NAME##l##N, RTYP, __LOG##N##_T)                                \
+  LOCVFIND(==, NAME##l##N, RTYP, __LOG##N##_T)                                 \
   static void l_##NAME##l##N(RTYP *r, __INT_T n, RTYP *v, __INT_T vs,          \
                              __LOG##N##_T *m, __INT_T ms, __INT8_T *loc,       \
                              __INT_T li, __INT_T ls, __INT_T len)              \
@@ -568,6 +805,7 @@ void I8(__fort_global_reduce)(char *rb, char *hb, int dims, F90_Desc *rd,
     __INT_T i, j, t_loc = 0;                                                   \
     RTYP val = *r;                                                             \
     __LOG##N##_T mask_log;                                                     \
+    MLOC_CONTIG(COND, NAME##l##N, RTYP, __LOG##N##_T, N)                       \
     if (ms == 0) {                                                             \
       for (i = 0; n > 0; n--, i += vs, li += ls) {                             \
         if (v[i] COND val) {                                                   \
@@ -757,6 +995,7 @@ static void l_ ## NAME(RTYP *r, __INT_T n, RTYP *v, __INT_T vs, \
   }
 
 #define FLOCFNLKN(COND, NAME, RTYP, N)                                         \
+  LOCVFIND(COND, NAME##l##N, RTYP, __LOG##N##_T)                               \
   static void l_##NAME##l##N(                                                  \
       RTYP *r, __INT_T n, RTYP *v, __INT_T vs, __LOG##N##_T *m, __INT_T ms,    \
       __INT4_T *loc, __INT_T li, __INT_T ls, __INT_T len, __LOG_T back)        \
@@ -766,6 +1005,7 @@ static void l_ ## NAME(RTYP *r, __INT_T n, RTYP *v, __INT_T vs, \
     __LOG##N##_T mask_log;                                                     \
     if (!back && *loc != 0)                                                    \
       return;                                                                  \
+    FLOC_CONTIG(NAME##l##N, RTYP, __LOG##N##_T, N)                             \
     if (ms == 0) {                                                             \
       for (i = 0; n > 0; n--, i += vs, li += ls) {                             \
         if (v[i] COND val) {                                                   \
@@ -862,6 +1102,7 @@ static void l_ ## NAME(RTYP *r, __INT_T n, RTYP *v, __INT_T vs, \
   }
 
 #define KFLOCFNLKN(COND, NAME, RTYP, N)                                        \
+  LOCVFIND(COND, NAME##l##N, RTYP, __LOG##N##_T)                               \
   static void l_##NAME##l##N(                                                  \
       RTYP *r, __INT_T n, RTYP *v, __INT_T vs, __LOG##N##_T *m, __INT_T ms,    \
       __INT8_T *loc, __INT_T li, __INT_T ls, __INT_T len, __LOG_T back)        \
@@ -871,6 +1112,7 @@ static void l_ ## NAME(RTYP *r, __INT_T n, RTYP *v, __INT_T vs, \
     __LOG##N##_T mask_log;                                                     \
     if (!back && *loc != 0)                                                    \
       return;                                                                  \
+    FLOC_CONTIG(NAME##l##N, RTYP, __LOG##N##_T, N)                             \
     if (ms == 0) {                                                             \
       for (i = 0; n > 0; n--, i += vs, li += ls) {                             \
         if (v[i] COND val) {                                                   \
@@ -23,19 +23,167 @@
 #include "fioMacros.h"
 #include "red.h"
 
+/* Unmasked sums
+
+   void k_NAME(ATYP *x, RTYP *v, __INT_T n, __INT_T vs);
+      x += sum of the n elements of v, vs elements apart; complex x holds
+      the real and the imaginary part
+
+   Contiguous vectors, the common case, are added up in SUMV_BYTES wide
+   vectors with four independent accumulators instead of in one scalar
+   whose every add waits for the previous one.  Complex vectors are added
+   up as 2n reals, the even lanes taking the real and the odd lanes the
+   imaginary parts.  Integer sums are exact in any order and use the four
+   scalar accumulators of red.h's ARITHK.
+
+   With F90_SUM_PAIRWISE=1 in the environment, real and complex sums of any
+   stride are split in halves down to SUMV_BLK elements and the halves are
+   added pairwise, which bounds the rounding error by O(log n) rather than
+   O(n) ulps at about the same speed.
+*/
+
+#define SUMV_BYTES 16
+#define SUMV_BLK 256
+
+static int
+sum_pairwise(void)
+{
+  static int pairwise = -1;
+  char *p;
+
+  if (pairwise < 0) {
+    p = getenv("F90_SUM_PAIRWISE");
+    pairwise = p != NULL && atol(p) != 0;
+  }
+  return pairwise;
+}
+
+/* helpers on w (1 real, 2 complex) interleaved sums of reals of type T
+
+   sumv_VN(x, v, n, w): x[0:w] += sums of v[0:n], v[i] going to x[i % w]
+   sumb_VN(x, v, n, vs, w): x[0:w] += sums of n groups of w reals, vs
+                            groups apart, in order unless contiguous
+   sump_VN(x, v, n, vs, w): the same added up pairwise
+*/
+#if defined(__GNUC__)
+#define SUMV_VEC(VN, T)                                                        \
+  static void sumv_##VN(T *x, T *v, __INT_T n, int w)                          \
+  {                                                                            \
+    typedef T sumv_t __attribute__((vector_size(SUMV_BYTES)));                 \
+    enum { SUMV_L = SUMV_BYTES / sizeof(T) };                                  \
+    sumv_t a0 = {0}, a1 = {0}, a2 = {0}, a3 = {0}, t0, t1, t2, t3;             \
+    T a[SUMV_L];                                                               \
+    __INT_T i;                                                                 \
+    int j;                                                                     \
+                                                                               \
+    for (i = 0; SUMV_L % w == 0 && i + 4 * SUMV_L <= n; i += 4 * SUMV_L) {     \
+      memcpy(&t0, v + i, sizeof(t0));                                          \
+      memcpy(&t1, v + i + SUMV_L, sizeof(t1));                                 \
+      memcpy(&t2, v + i + 2 * SUMV_L, sizeof(t2));                             \
+      memcpy(&t3, v + i + 3 * SUMV_L, sizeof(t3));                             \
+      a0 += t0;                                                                \
+      a1 += t1;                                                                \
+      a2 += t2;                                                                \
+      a3 += t3;                                                                \
+    }                                                                          \
+    a0 = (a0 + a1) + (a2 + a3);                                                \
+    memcpy(a, &a0, sizeof(a));                                                 \
+    for (j = 0; j < SUMV_L; j++)                                               \
+      x[j % w] += a[j];                                                        \
+    for (; i < n; i++)                                                         \
+      x[i % w] += v[i];                                                        \
+  }
+#else
+#define SUMV_VEC(VN, T)                                                        \
+  static void sumv_##VN(T *x, T *v, __INT_T n, int w)                          \
+  {                                                                            \
+    T a0 = 0, a1 = 0, a2 = 0, a3 = 0;                                          \
+    __INT_T i;                                                                 \
+                                                                               \
+    for (i = 0; i + 4 <= n; i += 4) {                                          \
+      a0 += v[i];                                                              \
+      a1 += v[i + 1];                                                          \
+      a2 += v[i + 2];                                                          \
+      a3 += v[i + 3];                                                          \
+    }                                                                          \
+    if (w == 1) {                                                              \
+      x[0] += (a0 + a1) + (a2 + a3);                                           \
+    } else {                                                                   \
+      x[0] += a0 + a2;                                                         \
+      x[1] += a1 + a3;                                                         \
+    }                                                                          \
+    for (; i < n; i++)                                                         \
+      x[i % w] += v[i];                                                        \
+  }
+#endif
+
+#define SUMVFN(VN, T)                                                          \
+  SUMV_VEC(VN, T)                                                              \
+  static void sumb_##VN(T *x, T *v, __INT_T n, __INT_T vs, int w)              \
+  {                                                                            \
+    T s0 = x[0], s1 = x[w - 1];                                                \
+    __INT_T i;                                                                 \
+                                                                               \
+    if (vs == 1) {                                                             \
+      sumv_##VN(x, v, n * w, w);                                               \
+      return;                                                                  \
+    }                                                                          \
+    if (w == 1) {                                                              \
+      for (i = 0; n > 0; n--, i += vs)                                         \
+        s0 += v[i];                                                            \
+    } else {                                                                   \
+      for (i = 0; n > 0; n--, i += 2 * vs) {                                   \
+        s0 += v[i];                                                            \
+        s1 += v[i + 1];                                                        \
+      }                                                                        \
+      x[1] = s1;                                                               \
+    }                                                                          \
+    x[0] = s0;                                                                 \
+  }                                                                            \
+  static void sump_##VN(T *x, T *v, __INT_T n, __INT_T vs, int w)              \
+  {                                                                            \
+    T s[2] = {0, 0}, t[2] = {0, 0};                                            \
+    __INT_T h;                                                                 \
+                                                                               \
+    if (n <= SUMV_BLK) {                                                       \
+      sumb_##VN(s, v, n, vs, w);                                               \
+    } else {                                                                   \
+      h = n / 2;                                                               \
+      sump_##VN(s, v, h, vs, w);                                               \
+      sump_##VN(t, v + h * vs * w, n - h, vs, w);                              \
+      s[0] += t[0];                                                            \
+      s[1] += t[1];                                                            \
+    }                                                                          \
+    x[0] += s[0];                                                              \
+    if (w == 2)                                                                \
+      x[1] += s[1];                                                            \
+  }
+
+/* real (W 1) and complex (W 2) sums, VN naming the helpers for ATYP */
+#define RSUMK(NAME, RTYP, ATYP, VN, W)                                         \
+  static void k_##NAME(ATYP *x, RTYP *v, __INT_T n, __INT_T vs)                \
+  {                                                                            \
+    if (sum_pairwise())                                                        \
+      sump_##VN(x, (ATYP *)v, n, vs, W);                                       \
+    else                                                                       \
+      sumb_##VN(x, (ATYP *)v, n, vs, W);                                       \
+  }
+
 #define CSUMFN(NAME, RTYP, ATYP)                                               \
   static void l_##NAME(RTYP *r, __INT_T n, RTYP *v, __INT_T vs, __LOG_T *m,    \
                        __INT_T ms, __INT_T *loc, __INT_T li, __INT_T ls)       \
   {                                                                            \
     __INT_T i, j;                                                              \
     ATYP xr = r->r, xi = r->i;                                                 \
+    ATYP x[2];                                                                 \
     __LOG_T mask_log;                                                          \
-    if (ms == 0)                                                               \
-      for (i = 0; n > 0; n--, i += vs) {                                       \
-        xr += v[i].r;                                                          \
-        xi += v[i].i;                                                          \
-      }                                                                        \
-    else {                                                                     \
+    if (ms == 0) {                                                             \
+      x[0] = xr;                                                               \
+      x[1] = xi;                                                               \
+      k_##NAME(x, v, n, vs);                                                   \
+      xr = x[0];                                                               \
+      xi = x[1];                                                               \
+    } else {                                                                   \
       mask_log = GET_DIST_MASK_LOG;                                           \
       for (i = j = 0; n > 0; n--, i += vs, j += ms)                            \
         if (m[j] & mask_log) {                                                 \
@@ -62,13 +210,15 @@
   {                                                                            \
     __INT_T i, j;                                                              \
     ATYP xr = r->r, xi = r->i;                                                 \
+    ATYP x[2];                                                                 \
     __LOG##N##_T mask_log;                                                     \
-    if (ms == 0)                                                               \
-      for (i = 0; n > 0; n--, i += vs) {                                       \
-        xr += v[i].r;                                                          \
-        xi += v[i].i;                                                          \
-      }                                                                        \
-    else {                                                                     \
+    if (ms == 0) {                                                             \
+      x[0] = xr;                                                               \
+      x[1] = xi;                                                               \
+      k_##NAME(x, v, n, vs);                                                   \
+      xr = x[0];                                                               \
+      xi = x[1];                                                               \
+    } else {                                                                   \
       mask_log = GET_DIST_MASK_LOG##N;                                        \
       for (i = j = 0; n > 0; n--, i += vs, j += ms)                            \
         if (m[j] & mask_log) {                                                 \
@@ -80,13 +230,28 @@
     r->i = xi;                                                                 \
   }
 
-ARITHFN(+, sum_int1, __INT1_T, long)
-ARITHFN(+, sum_int2, __INT2_T, long)
-ARITHFN(+, sum_int4, __INT4_T, long)
-ARITHFN(+, sum_int8, __INT8_T, __INT8_T)
-ARITHFN(+, sum_real4, __REAL4_T, __REAL4_T)
-ARITHFN(+, sum_real8, __REAL8_T, __REAL8_T)
-ARITHFN(+, sum_real16, __REAL16_T, __REAL16_T)
+SUMVFN(real4, __REAL4_T)
+SUMVFN(real8, __REAL8_T)
+SUMVFN(real16, __REAL16_T)
+
+ARITHK(+, sum_int1, __INT1_T, long)
+ARITHK(+, sum_int2, __INT2_T, long)
+ARITHK(+, sum_int4, __INT4_T, long)
+ARITHK(+, sum_int8, __INT8_T, __INT8_T)
+RSUMK(sum_real4, __REAL4_T, __REAL4_T, real4, 1)
+RSUMK(sum_real8, __REAL8_T, __REAL8_T, real8, 1)
+RSUMK(sum_real16, __REAL16_T, __REAL16_T, real16, 1)
+RSUMK(sum_cplx8, __CPLX8_T, __REAL4_T, real4, 2)
+RSUMK(sum_cplx16, __CPLX16_T, __REAL8_T, real8, 2)
+RSUMK(sum_cplx32, __CPLX32_T, __REAL16_T, real16, 2)
+
+ARITHKFN(+, sum_int1, __INT1_T, long)
+ARITHKFN(+, sum_int2, __INT2_T, long)
+ARITHKFN(+, sum_int4, __INT4_T, long)
+ARITHKFN(+, sum_int8, __INT8_T, __INT8_T)
+ARITHKFN(+, sum_real4, __REAL4_T, __REAL4_T)
+ARITHKFN(+, sum_real8, __REAL8_T, __REAL8_T)
+ARITHKFN(+, sum_real16, __REAL16_T, __REAL16_T)
 CSUMFN(sum_cplx8, __CPLX8_T, __REAL4_T)
 CSUMFN(sum_cplx16, __CPLX16_T, __REAL8_T)
 CSUMFN(sum_cplx32, __CPLX32_T, __REAL16_T)
@@ -76,6 +76,85 @@ static int I8(advance_permuted)(F90_Desc *d, __INT_T *index, int *order,
   return 0;
 }
 
+/* RESHAPE to a rank 2 result with ORDER=(2,1) from contiguous arrays,
+   when SOURCE fills the result */
+
+static int I8(reshape_transpose)(char *resb, char *srcb, F90_Desc *resd,
+                                 F90_Desc *srcd)
+{
+  char *rp, *sp;
+  size_t len;
+  __INT_T m, n;
+
+  m = F90_DIM_EXTENT_G(resd, 0);
+  n = F90_DIM_EXTENT_G(resd, 1);
+  if (F90_GSIZE_G(srcd) < m * n)
+    return 0;
+  rp = I8(__fort_contig_address)(resb, resd);
+  sp = I8(__fort_contig_address)(srcb, srcd);
+  if (rp == NULL || sp == NULL)
+    return 0;
+  len = F90_LEN_G(resd);
+  if (rp < sp + m * n * len && sp < rp + m * n * len)
+    return 0;
+  __fort_transpose(rp, m, sp, n, n, m, len);
+  return 1;
+}
+
+/* RESHAPE of whole contiguous arrays in array element order: the result
+   is SOURCE followed by as many copies of PAD as it takes.  A rank 2
+   result with ORDER=(2,1) and no padding is the transpose of SOURCE taken
+   as a shape(2) x shape(1) matrix.  Return 0 to leave other cases to the
+   element by element code. */
+
+static int I8(reshape_contig)(char *resb, char *srcb, char *padb,
+                              F90_Desc *resd, F90_Desc *srcd, F90_Desc *padd,
+                              int *order)
+{
+  char *rp, *sp, *pp;
+  size_t len;
+  __INT_T k, m, n, np;
+  int i;
+
+  if (F90_RANK_G(resd) == 2 && order[0] == 1 && order[1] == 0)
+    return I8(reshape_transpose)(resb, srcb, resd, srcd);
+  for (i = F90_RANK_G(resd); --i >= 0;) {
+    if (order[i] != i)
+      return 0;
+  }
+  rp = I8(__fort_contig_address)(resb, resd);
+  if (rp == NULL)
+    return 0;
+  n = F90_GSIZE_G(resd);
+  m = 0;
+  sp = pp = NULL;
+  if (F90_GSIZE_G(srcd) > 0) {
+    sp = I8(__fort_contig_address)(srcb, srcd);
+    if (sp == NULL)
+      return 0;
+    m = Min(n, F90_GSIZE_G(srcd));
+  }
+  np = 0;
+  if (m < n) {
+    if (F90_TAG_G(padd) == __DESC)
+      pp = I8(__fort_contig_address)(padb, padd);
+    if (pp == NULL)
+      return 0;
+    np = F90_GSIZE_G(padd);
+    if (np <= 0) /* let the general code report the missing elements */
+      return 0;
+  }
+
+  len = F90_LEN_G(resd);
+  if (m > 0)
+    memmove(rp, sp, m * len);
+  for (; m < n; m += k) {
+    k = Min(n - m, np);
+    memmove(rp + m * len, pp, k * len);
+  }
+  return 1;
+}
+
 /* reshape intrinsic */
 
 void ENTFTN(RESHAPE, reshape)(char *resb,     /* result base */
@@ -159,6 +238,8 @@ void ENTFTN(RESHAPE, reshape)(char *resb,     /* result base */
 
   if (F90_GSIZE_G(resd) <= 0)
     return;
+  if (I8(reshape_contig)(resb, srcb, padb, resd, srcd, padd, order))
+    return;
   for (i = r; --i >= 0;)
     resx[i] = F90_DIM_LBOUND_G(resd, i);
   k = order[0];
@@ -31,6 +31,7 @@ _f90io_rewind(__INT_T *unit, __INT_T *bitv, __INT_T *iostat)
   FIO_FCB *f;
 
   __fortio_errinit03(*unit, *bitv, iostat, "REWIND");
+  __fortio_lock_unit(*unit);
   if (ILLEGAL_UNIT(*unit)) /* check for illegal unit number */
     return __fortio_error(FIO_EUNIT);
 
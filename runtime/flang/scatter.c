@@ -53,9 +53,11 @@
  * replicated or aligned with the corresponding dimension of array.
  */
 
+#include <stdint.h>
 #include "stdioInterf.h"
 #include "fioMacros.h"
 #include "scatter.h"
+#include "llcrit.h"
 
 extern double __fort_second();
 #include "fort_vars.h"
@@ -64,6 +66,7 @@ extern void (*__fort_local_gathscat[__NTYPES])();
 extern void (*__fort_local_scatter[__NTYPES])();
 
 extern void local_gathscat_WRAPPER();
+extern void local_gathscat_RUNS();
 extern void local_scatter_WRAPPER();
 
 /* un-permuted axis map */
@@ -93,8 +96,229 @@ typedef struct {
   int *soff;   /* scatter offsets */
   int lclcnt;  /* number of local elements */
   int maxcnt;  /* maximum send/receive count */
+  struct gathscat_plan *plan; /* cached plan holding goff/soff */
 } gathscat_sked;
 
+/* gather-scatter plans.  the offsets of a local gather-scatter depend
+   only on the descriptors, the index values and the mask, so the last
+   few are kept and a schedule with the same key reuses them instead of
+   visiting every element again -- e.g. a scatter through the same index
+   vector at each time step.  keys are compared in full, not just by
+   hash.  a plan also lists the runs of offset pairs that both go up by
+   one, which are then moved as blocks. */
+
+#define GATHSCAT_PLANS 8              /* plans kept */
+#define GATHSCAT_PLAN_KEY (1L << 24) /* largest key kept, bytes */
+#define GATHSCAT_RUN 16               /* shortest run copied as a block */
+
+typedef struct gathscat_plan gathscat_plan;
+struct gathscat_plan {
+  gathscat_plan *next; /* next less recently used */
+  uint64_t hash;       /* hash of key */
+  size_t keylen;       /* key length, bytes */
+  char *key;           /* descriptors, index values and mask */
+  int *offsetbuf;      /* offset buffer */
+  int *soff, *goff;    /* scatter and gather offsets */
+  int lclcnt;          /* number of offset pairs */
+  int *runs;           /* (start, count) of each run */
+  int nruns;           /* number of runs */
+  int refs;            /* plan list and schedules using it */
+};
+
+static gathscat_plan *plans;
+MP_SEMAPHORE(static, plan_sem);
+
+static uint64_t
+gathscat_hash(char *key, size_t len)
+{
+  uint64_t h = UINT64_C(14695981039346656037), w;
+  size_t i;
+
+  for (i = 0; i + sizeof(w) <= len; i += sizeof(w)) {
+    memcpy(&w, key + i, sizeof(w));
+    h = (h ^ w) * UINT64_C(1099511628211);
+    h ^= h >> 29;
+  }
+  for (; i < len; ++i)
+    h = (h ^ (unsigned char)key[i]) * UINT64_C(1099511628211);
+  return h;
+}
+
+/* append n bytes at p to the key, or just count them if key is NULL */
+
+static size_t
+gathscat_key_add(char *key, size_t len, void *p, size_t n)
+{
+  if (key)
+    memcpy(key + len, p, n);
+  return len + n;
+}
+
+/* the key of a local gather-scatter: everything its offsets depend on.
+   return NULL if an index or mask array is not contiguous. */
+
+static char *I8(gathscat_key)(gathscat_parm *z, size_t *keylen)
+{
+  gathscat_dim *zd;
+  char *key, *p;
+  size_t len;
+  int pass, vx, hdr[5];
+
+  hdr[0] = z->dir;
+  hdr[1] = z->indirect;
+  hdr[2] = z->permuted;
+  hdr[3] = z->group_offset;
+  hdr[4] = F90_FLAGS_G(z->ud) & __OFF_TEMPLATE;
+  key = NULL;
+  for (pass = 0; pass < 2; ++pass) {
+    len = gathscat_key_add(key, 0, hdr, sizeof(hdr));
+    len = gathscat_key_add(key, len, z->ud,
+                           SIZE_OF_RANK_n_ARRAY_DESC(F90_RANK_G(z->ud)));
+    len = gathscat_key_add(key, len, z->vd,
+                           SIZE_OF_RANK_n_ARRAY_DESC(F90_RANK_G(z->vd)));
+    if (F90_TAG_G(z->md) == __DESC) {
+      p = I8(__fort_contig_address)(z->mb, z->md);
+      if (p == NULL)
+        return NULL;
+      len = gathscat_key_add(key, len, z->md,
+                             SIZE_OF_RANK_n_ARRAY_DESC(F90_RANK_G(z->md)));
+      len = gathscat_key_add(key, len, p,
+                             F90_GSIZE_G(z->md) * F90_LEN_G(z->md));
+    }
+    for (vx = 0; vx < F90_RANK_G(z->vd); ++vx) {
+      zd = &z->dim[vx];
+      if (z->indirect >> vx & 1) {
+        p = I8(__fort_contig_address)(zd->xb, zd->xd);
+        if (p == NULL)
+          return NULL;
+        len = gathscat_key_add(key, len, zd->xd,
+                               SIZE_OF_RANK_n_ARRAY_DESC(F90_RANK_G(zd->xd)));
+        len = gathscat_key_add(key, len, p,
+                               F90_GSIZE_G(zd->xd) * sizeof(__INT_T));
+        if (z->permuted >> vx & 1)
+          len = gathscat_key_add(key, len, zd->xmap,
+                                 F90_RANK_G(zd->xd) * sizeof(__INT_T));
+      } else if (z->permuted >> vx & 1)
+        len = gathscat_key_add(key, len, zd->xmap, sizeof(__INT_T));
+    }
+    if (key == NULL) {
+      if (len > GATHSCAT_PLAN_KEY)
+        return NULL;
+      key = (char *)__fort_malloc(len);
+    }
+  }
+  *keylen = len;
+  return key;
+}
+
+/* find the plan for key and take a reference to it */
+
+static gathscat_plan *
+gathscat_find_plan(char *key, size_t keylen, uint64_t hash)
+{
+  gathscat_plan *p, **pp;
+
+  MP_P(plan_sem);
+  for (pp = &plans; (p = *pp) != NULL; pp = &p->next) {
+    if (p->hash == hash && p->keylen == keylen &&
+        memcmp(p->key, key, keylen) == 0) {
+      *pp = p->next; /* move to front */
+      p->next = plans;
+      plans = p;
+      ++p->refs;
+      break;
+    }
+  }
+  MP_V(plan_sem);
+  return p;
+}
+
+static void
+gathscat_release_plan(gathscat_plan *p)
+{
+  int refs;
+
+  MP_P(plan_sem);
+  refs = --p->refs;
+  MP_V(plan_sem);
+  if (refs == 0) {
+    __fort_free(p->key);
+    __fort_free(p->offsetbuf);
+    if (p->runs)
+      __fort_free(p->runs);
+    __fort_free(p);
+  }
+}
+
+/* find the runs of at least GATHSCAT_RUN of the n offset pairs in which
+   both offsets go up by one.  return them as (start, count) pairs, or
+   NULL if there are none. */
+
+static int *
+gathscat_find_runs(int *soff, int *goff, int n, int *nruns)
+{
+  int *runs;
+  int i, j, k, pass;
+
+  runs = NULL;
+  for (pass = 0; pass < 2; ++pass) {
+    k = 0;
+    for (i = 0; i < n; i = j) {
+      for (j = i + 1; j < n && soff[j] == soff[j - 1] + 1 &&
+                      goff[j] == goff[j - 1] + 1;
+           ++j)
+        ;
+      if (j - i >= GATHSCAT_RUN) {
+        if (runs) {
+          runs[2 * k] = i;
+          runs[2 * k + 1] = j - i;
+        }
+        ++k;
+      }
+    }
+    if (k == 0)
+      break;
+    if (runs == NULL)
+      runs = (int *)__fort_malloc(2 * k * sizeof(int));
+  }
+  *nruns = k;
+  return runs;
+}
+
+/* keep a new plan, referenced by the list and the caller, and drop the
+   least recently used one if there are too many */
+
+static gathscat_plan *
+gathscat_add_plan(char *key, size_t keylen, uint64_t hash,
+                  int *offsetbuf, int *soff, int *goff, int lclcnt)
+{
+  gathscat_plan *p, *old, **pp;
+  int n;
+
+  p = (gathscat_plan *)__fort_malloc(sizeof(gathscat_plan));
+  p->hash = hash;
+  p->keylen = keylen;
+  p->key = key;
+  p->offsetbuf = offsetbuf;
+  p->soff = soff;
+  p->goff = goff;
+  p->lclcnt = lclcnt;
+  p->runs = gathscat_find_runs(soff, goff, lclcnt, &p->nruns);
+  p->refs = 2;
+
+  MP_P(plan_sem);
+  p->next = plans;
+  plans = p;
+  for (n = 0, pp = &plans; *pp != NULL && n < GATHSCAT_PLANS; ++n)
+    pp = &(*pp)->next;
+  old = *pp;
+  *pp = NULL;
+  MP_V(plan_sem);
+  if (old != NULL)
+    gathscat_release_plan(old);
+  return p;
+}
+
 /* ENTFTN(comm_start) function: gather, transfer, scatter */
 
 static void I8(gathscat_start)(gathscat_sked *sk, char *rb, char *sb,
@@ -120,7 +344,13 @@ static void I8(gathscat_start)(gathscat_sked *sk, char *rb, char *sb,
      * This can occur when we share schedules across objects ...
      */
 
-    if (sk->gathscatfn == local_gathscat_WRAPPER) {
+    if (sk->gathscatfn == local_gathscat_WRAPPER && sk->plan &&
+        sk->plan->runs) {
+
+      local_gathscat_RUNS(k, rp, sk->soff, sp, sk->goff, F90_KIND_G(rd),
+                          F90_LEN_G(rd), sk->plan->runs, sk->plan->nruns);
+
+    } else if (sk->gathscatfn == local_gathscat_WRAPPER) {
 
       local_gathscat_WRAPPER(k, rp, sk->soff, sp, sk->goff, F90_KIND_G(rd));
 
@@ -218,6 +448,8 @@ gathscat_free(gathscat_sked *sk)
     __fort_gfree(sk->countbuf);
   if (sk->offsetbuf)
     __fort_free(sk->offsetbuf);
+  if (sk->plan)
+    gathscat_release_plan(sk->plan);
   __fort_free(sk);
 }
 
@@ -535,8 +767,9 @@ static void I8(gathscat_loop)(gathscat_parm *z, /* parameters */
 sked *I8(__fort_gathscat)(gathscat_parm *z)
 {
   gathscat_sked *sk;
+  gathscat_plan *plan;
   gathscat_dim *zd;
-  char *rp;
+  char *key, *rp;
   chdr *repchn;
   DECL_HDR_PTRS(md);
   DECL_HDR_PTRS(ud);
@@ -559,6 +792,8 @@ sked *I8(__fort_gathscat)(gathscat_parm *z)
   __INT_T mx, uoff, ux, vx, xx, xoff[MAXDIMS + 1];
 
   repl_t u_repl; /* unvectored array replication descriptor */
+  size_t keylen;
+  uint64_t hash;
 
   double t;
   if (__fort_test & DEBUG_TIME)
@@ -933,7 +1168,25 @@ zero_lsize_ok_for_gen_block:
 
   z->outgoing = 0;
 
-  if (!(z->communicate | z->replicate)) {
+  plan = NULL;
+  if (!(z->communicate | z->replicate) &&
+      (key = I8(gathscat_key)(z, &keylen)) != NULL) {
+
+    /* local gather-scatter seen before */
+
+    hash = gathscat_hash(key, keylen);
+    plan = gathscat_find_plan(key, keylen, hash);
+    if (plan != NULL)
+      __fort_free(key);
+  }
+
+  if (plan != NULL) {
+    soff = plan->soff;
+    goff = plan->goff;
+    lclcnt = plan->lclcnt;
+    maxcnt = 0;
+    offsetbuf = countbuf = counts = countr = NULL;
+  } else if (!(z->communicate | z->replicate)) {
 
     /* local gather-scatter. allocate buffers for offsets */
 
@@ -967,6 +1220,11 @@ zero_lsize_ok_for_gen_block:
     }
     lclcnt = z->outgoing;
     maxcnt = 0;
+    if (key != NULL) {
+      plan = gathscat_add_plan(key, keylen, hash, offsetbuf, soff, goff,
+                               lclcnt);
+      offsetbuf = NULL;
+    }
   } else {
 
     /* non-local gather-scatter.  allocate buffers for offsets and
@@ -1161,6 +1419,7 @@ zero_lsize_ok_for_gen_block:
   sk->maxcnt = maxcnt;
   sk->countbuf = countbuf;
   sk->offsetbuf = offsetbuf;
+  sk->plan = plan;
   if (z->dir == __GATHER) { /* swap */
     sk->counts = countr;
     sk->countr = counts;
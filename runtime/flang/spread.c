@@ -20,6 +20,65 @@
 #include "stdioInterf.h"
 #include "fioMacros.h"
 
+#define SPREAD_BLOCK 4096 /* bytes of replicated data copied out at once */
+
+/* store cnt copies of the len bytes at sp from rp on.  the filled run is
+   doubled until it is SPREAD_BLOCK bytes and then copied out whole, so
+   the stores are wide and the reads stay in the cache. */
+
+static void spread_fill(char *rp, char *sp, size_t cnt, size_t len)
+{
+  size_t done, n, run;
+
+  if (cnt == 0)
+    return;
+  __fort_bcopy(rp, sp, len);
+  for (done = 1; done < cnt && done * len < SPREAD_BLOCK; done += n) {
+    n = Min(done, cnt - done);
+    __fort_bcopy(rp + done * len, rp, n * len);
+  }
+  for (run = done; done < cnt; done += n) {
+    n = Min(run, cnt - done);
+    __fort_bcopy(rp + done * len, rp, n * len);
+  }
+}
+
+/* spread of whole contiguous local arrays.  the result is the source
+   with each block of the dimensions before dim repeated ncopies times,
+   whatever the rank.  Return 0 to leave other cases to the section
+   copies. */
+
+static int I8(spread_contig)(char *rb, char *sb, F90_Desc *rd, F90_Desc *sd,
+                             int dim, int ncopies)
+{
+  char *rp, *sp;
+  size_t blk, len;
+  __INT_T i, inner, o, outer;
+
+  if (F90_TAG_G(sd) != __DESC || F90_RANK_G(rd) != F90_RANK_G(sd) + 1 ||
+      dim < 1 || dim > F90_RANK_G(rd) || ncopies <= 0 ||
+      F90_DIM_EXTENT_G(rd, dim - 1) != ncopies ||
+      F90_LEN_G(rd) != F90_LEN_G(sd) ||
+      F90_GSIZE_G(rd) != F90_GSIZE_G(sd) * ncopies)
+    return 0;
+  rp = I8(__fort_contig_address)(rb, rd);
+  sp = I8(__fort_contig_address)(sb, sd);
+  if (rp == NULL || sp == NULL)
+    return 0;
+
+  len = F90_LEN_G(sd);
+  if (rp < sp + F90_GSIZE_G(sd) * len && sp < rp + F90_GSIZE_G(rd) * len)
+    return 0;
+  inner = 1;
+  for (i = 0; i < dim - 1; ++i)
+    inner *= F90_DIM_EXTENT_G(rd, i);
+  outer = F90_GSIZE_G(sd) / inner;
+  blk = inner * len;
+  for (o = 0; o < outer; ++o)
+    spread_fill(rp + o * ncopies * blk, sp + o * blk, ncopies, blk);
+  return 1;
+}
+
 /* spread intrinsic -- copy sections for ncopies into appropriate
    dimensions */
 
@@ -44,6 +103,9 @@ void ENTFTN(SPREAD, spread)(void *rb,           /* result base */
   dim = I8(__fort_fetch_int)(dimb, dimd);
   ncopies = I8(__fort_fetch_int)(ncopiesb, ncopiesd);
 
+  if (I8(spread_contig)(rb, sb, rd, sd, dim, ncopies))
+    return;
+
   /* form temporary descriptor with a scalar subscript in the spread
      dimension */
 
@@ -109,19 +171,13 @@ void ENTFTN(SPREADSA, spreadsa)(void *rb,           /* result base */
                               F90_Desc *ncopiesd, /* ncopies descriptor */
                               F90_Desc *szd)      /* sizeof source descriptor */
 {
-  char *rp;
   int ncopies;
-  __CLEN_T size;
 
   /* we assume that result is replicated and contiguous */
 
   ncopies = I8(__fort_fetch_int)(ncopiesb, ncopiesd);
-  size = *szb;
-  rp = (char *)rb;
-  while (ncopies-- > 0) {
-    __fort_bcopy(rp, sb, size);
-    rp = rp + size;
-  }
+  if (ncopies > 0)
+    spread_fill(rb, sb, ncopies, *szb);
 }
 /* 32 bit CLEN version */
 void ENTFTN(SPREADS, spreads)(void *rb,           /* result base */
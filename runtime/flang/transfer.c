@@ -127,6 +127,18 @@ void ENTFTN(TRANSFER, transfer)(void *rb,         /* result base */
       extent = 0;
     ssize *= extent;
   }
+
+  /* a contiguous source is already the byte stream to transfer */
+
+  if (*ms == F90_LEN_G(source)) {
+    ptemp = I8(__fort_contig_address)(sb, source);
+    if (ptemp != NULL) {
+      if (rsize > 0)
+        __fort_bcopy(rb, ptemp, Min(ssize, rsize));
+      return;
+    }
+  }
+
   ptemp = (char *)&temp;
   if (*ms > sizeof(temp)) {
     ptemp = __fort_malloc(*ms);
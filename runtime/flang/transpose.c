@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* clang-format off */
+
+/** \file
+ * \brief Blocked transpose engine for TRANSPOSE, RESHAPE with ORDER= and
+ * the transposed MATMUL buffers
+ *
+ * __fort_transpose() halves the longer side of the matrix until a block
+ * fits in the L1 cache, whatever its size (cache oblivious), and then
+ * moves the block in TP_TILE x TP_TILE tiles.  Tiles of 4 and 8 byte
+ * elements are transposed in registers with SSE or AVX shuffles, picked
+ * from the cpu at run time; other element lengths use plain loops.
+ * __fort_transpose_square() transposes a square matrix in place.
+ */
+
+#include "stdioInterf.h"
+#include "fioMacros.h"
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define TP_HAVE_KERNELS
+#endif
+
+#define TP_TILE 8                 /* tile side, elements */
+#define TP_LEAF_BYTES (16 * 1024) /* blocks smaller than this are tiled */
+#define TP_SQUARE 32              /* block side of the in-place transpose */
+
+/* Transpose one TP_TILE x TP_TILE tile: to(j,i) = fr(i,j) */
+typedef void (*tp_kernel)(char *to, __POINT_T ldt, char *fr, __POINT_T ldf);
+
+#define TP_LOOP_KERNEL(NAME, T)                                                \
+  static void NAME(char *to, __POINT_T ldt, char *fr, __POINT_T ldf)           \
+  {                                                                            \
+    int i, j;                                                                  \
+                                                                               \
+    for (i = 0; i < TP_TILE; i++)                                              \
+      for (j = 0; j < TP_TILE; j++)                                            \
+        ((T *)to)[j + i * ldt] = ((T *)fr)[i + j * ldf];                       \
+  }
+
+TP_LOOP_KERNEL(tp_loop1, __INT1_T)
+TP_LOOP_KERNEL(tp_loop2, __INT2_T)
+TP_LOOP_KERNEL(tp_loop16, __CPLX16_T)
+#ifndef TP_HAVE_KERNELS
+TP_LOOP_KERNEL(tp_loop4, __INT4_T)
+TP_LOOP_KERNEL(tp_loop8, __INT8_T)
+#endif
+
+#ifdef TP_HAVE_KERNELS
+/* SSE: the tile as four 4 x 4 blocks of 4 byte elements */
+static void
+tp_sse4(char *to, __POINT_T ldt, char *fr, __POINT_T ldf)
+{
+  __m128 r0, r1, r2, r3;
+  float *f, *t;
+  int i, j;
+
+  for (j = 0; j < TP_TILE; j += 4)
+    for (i = 0; i < TP_TILE; i += 4) {
+      f = (float *)fr + i + j * ldf;
+      t = (float *)to + j + i * ldt;
+      r0 = _mm_loadu_ps(f);
+      r1 = _mm_loadu_ps(f + ldf);
+      r2 = _mm_loadu_ps(f + 2 * ldf);
+      r3 = _mm_loadu_ps(f + 3 * ldf);
+      _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+      _mm_storeu_ps(t, r0);
+      _mm_storeu_ps(t + ldt, r1);
+      _mm_storeu_ps(t + 2 * ldt, r2);
+      _mm_storeu_ps(t + 3 * ldt, r3);
+    }
+}
+
+/* SSE2: the tile as 2 x 2 blocks of 8 byte elements */
+static void
+tp_sse8(char *to, __POINT_T ldt, char *fr, __POINT_T ldf)
+{
+  __m128d r0, r1;
+  double *f, *t;
+  int i, j;
+
+  for (j = 0; j < TP_TILE; j += 2)
+    for (i = 0; i < TP_TILE; i += 2) {
+      f = (double *)fr + i + j * ldf;
+      t = (double *)to + j + i * ldt;
+      r0 = _mm_loadu_pd(f);
+      r1 = _mm_loadu_pd(f + ldf);
+      _mm_storeu_pd(t, _mm_unpacklo_pd(r0, r1));
+      _mm_storeu_pd(t + ldt, _mm_unpackhi_pd(r0, r1));
+    }
+}
+
+/* AVX: the whole tile of 4 byte elements in eight registers */
+static void __attribute__((target("avx")))
+tp_avx4(char *to, __POINT_T ldt, char *fr, __POINT_T ldf)
+{
+  __m256 r0, r1, r2, r3, r4, r5, r6, r7;
+  __m256 t0, t1, t2, t3, t4, t5, t6, t7;
+  float *f = (float *)fr, *t = (float *)to;
+
+  r0 = _mm256_loadu_ps(f);
+  r1 = _mm256_loadu_ps(f + ldf);
+  r2 = _mm256_loadu_ps(f + 2 * ldf);
+  r3 = _mm256_loadu_ps(f + 3 * ldf);
+  r4 = _mm256_loadu_ps(f + 4 * ldf);
+  r5 = _mm256_loadu_ps(f + 5 * ldf);
+  r6 = _mm256_loadu_ps(f + 6 * ldf);
+  r7 = _mm256_loadu_ps(f + 7 * ldf);
+
+  t0 = _mm256_unpacklo_ps(r0, r1);
+  t1 = _mm256_unpackhi_ps(r0, r1);
+  t2 = _mm256_unpacklo_ps(r2, r3);
+  t3 = _mm256_unpackhi_ps(r2, r3);
+  t4 = _mm256_unpacklo_ps(r4, r5);
+  t5 = _mm256_unpackhi_ps(r4, r5);
+  t6 = _mm256_unpacklo_ps(r6, r7);
+  t7 = _mm256_unpackhi_ps(r6, r7);
+
+  r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+  r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+  r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+  r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+  r4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+  r5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+  r6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+  r7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+  _mm256_storeu_ps(t, _mm256_permute2f128_ps(r0, r4, 0x20));
+  _mm256_storeu_ps(t + ldt, _mm256_permute2f128_ps(r1, r5, 0x20));
+  _mm256_storeu_ps(t + 2 * ldt, _mm256_permute2f128_ps(r2, r6, 0x20));
+  _mm256_storeu_ps(t + 3 * ldt, _mm256_permute2f128_ps(r3, r7, 0x20));
+  _mm256_storeu_ps(t + 4 * ldt, _mm256_permute2f128_ps(r0, r4, 0x31));
+  _mm256_storeu_ps(t + 5 * ldt, _mm256_permute2f128_ps(r1, r5, 0x31));
+  _mm256_storeu_ps(t + 6 * ldt, _mm256_permute2f128_ps(r2, r6, 0x31));
+  _mm256_storeu_ps(t + 7 * ldt, _mm256_permute2f128_ps(r3, r7, 0x31));
+}
+
+/* AVX: the tile as four 4 x 4 blocks of 8 byte elements */
+static void __attribute__((target("avx")))
+tp_avx8(char *to, __POINT_T ldt, char *fr, __POINT_T ldf)
+{
+  __m256d r0, r1, r2, r3, t0, t1, t2, t3;
+  double *f, *t;
+  int i, j;
+
+  for (j = 0; j < TP_TILE; j += 4)
+    for (i = 0; i < TP_TILE; i += 4) {
+      f = (double *)fr + i + j * ldf;
+      t = (double *)to + j + i * ldt;
+      r0 = _mm256_loadu_pd(f);
+      r1 = _mm256_loadu_pd(f + ldf);
+      r2 = _mm256_loadu_pd(f + 2 * ldf);
+      r3 = _mm256_loadu_pd(f + 3 * ldf);
+      t0 = _mm256_unpacklo_pd(r0, r1);
+      t1 = _mm256_unpackhi_pd(r0, r1);
+      t2 = _mm256_unpacklo_pd(r2, r3);
+      t3 = _mm256_unpackhi_pd(r2, r3);
+      _mm256_storeu_pd(t, _mm256_permute2f128_pd(t0, t2, 0x20));
+      _mm256_storeu_pd(t + ldt, _mm256_permute2f128_pd(t1, t3, 0x20));
+      _mm256_storeu_pd(t + 2 * ldt, _mm256_permute2f128_pd(t0, t2, 0x31));
+      _mm256_storeu_pd(t + 3 * ldt, _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
+}
+#endif
+
+/* The tile kernel for elements of len bytes, NULL if there is none.
+   The cpu does not change under us; a racy first call just repeats the
+   test. */
+static tp_kernel
+tp_kernel_for(size_t len)
+{
+#ifdef TP_HAVE_KERNELS
+  static int avx = -1;
+
+  if (avx < 0)
+    avx = __builtin_cpu_supports("avx") != 0;
+#endif
+
+  switch (len) {
+  case 1:
+    return tp_loop1;
+  case 2:
+    return tp_loop2;
+  case 4:
+#ifdef TP_HAVE_KERNELS
+    return avx ? tp_avx4 : tp_sse4;
+#else
+    return tp_loop4;
+#endif
+  case 8:
+#ifdef TP_HAVE_KERNELS
+    return avx ? tp_avx8 : tp_sse8;
+#else
+    return tp_loop8;
+#endif
+  case 16:
+    return tp_loop16;
+  }
+  return NULL;
+}
+
+/* Transpose a block small enough to stay in the cache, tile by tile, with
+   the edges that do not fill a tile element by element */
+static void
+tp_leaf(tp_kernel kern, char *to, __POINT_T ldt, char *fr, __POINT_T ldf,
+        __POINT_T rows, __POINT_T cols, size_t len)
+{
+  __POINT_T i, j, ti, tj;
+
+  ti = kern ? rows - rows % TP_TILE : 0;
+  tj = kern ? cols - cols % TP_TILE : 0;
+  for (i = 0; i < ti; i += TP_TILE)
+    for (j = 0; j < tj; j += TP_TILE)
+      kern(to + (j + i * ldt) * len, ldt, fr + (i + j * ldf) * len, ldf);
+  for (j = 0; j < cols; ++j)
+    for (i = j < tj ? ti : 0; i < rows; ++i)
+      memcpy(to + (j + i * ldt) * len, fr + (i + j * ldf) * len, len);
+}
+
+/* Halve the longer side, on a tile boundary, until the block is a leaf */
+static void
+tp_recurse(tp_kernel kern, char *to, __POINT_T ldt, char *fr, __POINT_T ldf,
+           __POINT_T rows, __POINT_T cols, size_t len)
+{
+  __POINT_T h;
+
+  while ((size_t)rows * cols * len > TP_LEAF_BYTES &&
+         (rows > TP_TILE || cols > TP_TILE)) {
+    if (rows >= cols) {
+      h = (rows / 2 + TP_TILE - 1) / TP_TILE * TP_TILE;
+      tp_recurse(kern, to, ldt, fr, ldf, h, cols, len);
+      fr += h * len;
+      to += h * ldt * len;
+      rows -= h;
+    } else {
+      h = (cols / 2 + TP_TILE - 1) / TP_TILE * TP_TILE;
+      tp_recurse(kern, to, ldt, fr, ldf, rows, h, len);
+      fr += h * ldf * len;
+      to += h * len;
+      cols -= h;
+    }
+  }
+  tp_leaf(kern, to, ldt, fr, ldf, rows, cols, len);
+}
+
+/** \brief to(j,i) = fr(i,j) for the rows x cols column-major matrix fr
+ *
+ * \param to result, leading dimension ldt elements
+ * \param fr source, leading dimension ldf elements
+ * \param len element length in bytes
+ *
+ * The matrices must not overlap.
+ */
+void
+__fort_transpose(char *to, __POINT_T ldt, char *fr, __POINT_T ldf,
+                 __POINT_T rows, __POINT_T cols, size_t len)
+{
+  if (rows <= 0 || cols <= 0)
+    return;
+  tp_recurse(tp_kernel_for(len), to, ldt, fr, ldf, rows, cols, len);
+}
+
+/** \brief Transpose the n x n matrix a, leading dimension lda, in place
+ *
+ * Diagonal blocks go through a buffer, and each pair of blocks mirrored
+ * across the diagonal is exchanged: one is transposed into the buffer, the
+ * other onto the first and the buffer onto the second.
+ */
+void
+__fort_transpose_square(char *a, __POINT_T lda, __POINT_T n, size_t len)
+{
+  __CPLX16_T buf[TP_SQUARE * TP_SQUARE];
+  char *b = (char *)buf, *x, *y;
+  __POINT_T bi, bj, c, i, ib, j, jb;
+  size_t k;
+
+  if (len > sizeof(__CPLX16_T)) {
+    for (j = 0; j < n; ++j)
+      for (i = j + 1; i < n; ++i) {
+        x = a + (i + j * lda) * len;
+        y = a + (j + i * lda) * len;
+        for (k = 0; k < len; ++k) {
+          char t = x[k];
+          x[k] = y[k];
+          y[k] = t;
+        }
+      }
+    return;
+  }
+
+  for (jb = 0; jb < n; jb += TP_SQUARE) {
+    bj = Min(TP_SQUARE, n - jb);
+    for (ib = jb; ib < n; ib += TP_SQUARE) {
+      bi = Min(TP_SQUARE, n - ib);
+      x = a + (ib + jb * lda) * len; /* bi x bj */
+      y = a + (jb + ib * lda) * len; /* bj x bi */
+      __fort_transpose(b, bj, x, lda, bi, bj, len);
+      if (ib != jb)
+        __fort_transpose(x, lda, y, lda, bj, bi, len);
+      for (c = 0; c < bi; ++c)
+        memcpy(y + c * lda * len, b + c * bj * len, bj * len);
+    }
+  }
+}
+
+/*
+ * buffer(bufrows, bufcols) = alpha * transpose(a(1:bufcols, 1:bufrows)), the
+ * transposed operands of the MATMUL routines (mnaxtb_*, mtaxtb_* ...).
+ * For the complex kinds ta == 2 also conjugates the elements.
+ */
+
+#ifdef TARGET_X8664
+#define TP_LDA_T __INT8_T
+#else
+#define TP_LDA_T __INT4_T
+#endif
+
+void
+ftn_transpose_real4_(__REAL4_T *a, TP_LDA_T *lda, __REAL4_T *alpha,
+                     __REAL4_T *buffer, __INT4_T *bufrows, __INT4_T *bufcols)
+{
+  __POINT_T i, n = (__POINT_T)*bufrows * *bufcols;
+
+  __fort_transpose((char *)buffer, *bufrows, (char *)a, *lda, *bufcols,
+                   *bufrows, sizeof(__REAL4_T));
+  if (*alpha != 1.0f)
+    for (i = 0; i < n; ++i)
+      buffer[i] = *alpha * buffer[i];
+}
+
+void
+ftn_transpose_real8_(__REAL8_T *a, TP_LDA_T *lda, __REAL8_T *alpha,
+                     __REAL8_T *buffer, __INT4_T *bufrows, __INT4_T *bufcols)
+{
+  __POINT_T i, n = (__POINT_T)*bufrows * *bufcols;
+
+  __fort_transpose((char *)buffer, *bufrows, (char *)a, *lda, *bufcols,
+                   *bufrows, sizeof(__REAL8_T));
+  if (*alpha != 1.0)
+    for (i = 0; i < n; ++i)
+      buffer[i] = *alpha * buffer[i];
+}
+
+#define TP_CPLX(NAME, CT, RT)                                                  \
+  void NAME(__INT4_T *ta, CT *a, TP_LDA_T *lda, CT *alpha, CT *buffer,         \
+            __INT4_T *bufrows, __INT4_T *bufcols)                              \
+  {                                                                            \
+    __POINT_T i, n = (__POINT_T)*bufrows * *bufcols;                           \
+    RT ar = alpha->r, ai = alpha->i, xr, xi;                                   \
+                                                                               \
+    __fort_transpose((char *)buffer, *bufrows, (char *)a, *lda, *bufcols,      \
+                     *bufrows, sizeof(CT));                                    \
+    if (*ta == 2)                                                              \
+      for (i = 0; i < n; ++i)                                                  \
+        buffer[i].i = -buffer[i].i;                                            \
+    if (ar != 1 || ai != 0)                                                    \
+      for (i = 0; i < n; ++i) {                                                \
+        xr = buffer[i].r;                                                      \
+        xi = buffer[i].i;                                                      \
+        buffer[i].r = ar * xr - ai * xi;                                       \
+        buffer[i].i = ar * xi + ai * xr;                                       \
+      }                                                                        \
+  }
+
+TP_CPLX(ftn_transpose_cmplx8_, __CPLX8_T, __REAL4_T)
+TP_CPLX(ftn_transpose_cmplx16_, __CPLX16_T, __REAL8_T)
@@ -57,19 +57,20 @@ static int dbgflag;
  * and updated on __f90io_unf_writes and __f90io_unf_reads. All are
  * active till an __f90io_unf_end.  */
 
-static FIO_FCB *Fcb;     /* pointer to the file control block */
-static char *buf_ptr;    /* pointer to current location in buffer */
-static size_t rw_size;   /* size of user-requested items (write only) */
-static int rec_len;      /* record length */
-static bool rec_in_buf;  /* true if variable len record in buffer; false
-                            if access is direct. */
-static bool read_flag;   /* true if a read, otherwise a write */
-static bool io_transfer; /* indicates that init-end calls were made
-                            with no intervening read or write calls */
-static bool continued;   /* data requires multople records */
-static bool async;       /* true if asynch i/o requested */
-static bool actual_init;
-static int has_same_fcb;
+static FIO_TLS FIO_FCB *Fcb;     /* pointer to the file control block */
+static FIO_TLS char *buf_ptr;    /* pointer to current location in buffer */
+static FIO_TLS size_t rw_size;   /* size of user-requested items (write only) */
+static FIO_TLS int rec_len;      /* record length */
+static FIO_TLS bool rec_in_buf;  /* true if variable len record in buffer;
+                                    false if access is direct. */
+static FIO_TLS bool read_flag;   /* true if a read, otherwise a write */
+static FIO_TLS bool io_transfer; /* indicates that init-end calls were
+                                    made with no intervening read or
+                                    write calls */
+static FIO_TLS bool continued;   /* data requires multople records */
+static FIO_TLS bool async;       /* true if asynch i/o requested */
+static FIO_TLS bool actual_init;
+static FIO_TLS int has_same_fcb;
 
 /*
  * define a structure which can be used to buffer a variable length
@@ -112,7 +113,7 @@ typedef struct {
   int pad;             /* just in case we need trailing count */
 } unf_rec_struct;
 
-static unf_rec_struct unf_rec;
+static FIO_TLS unf_rec_struct unf_rec;
 
 typedef struct {
   FIO_FCB *Fcb;
@@ -130,11 +131,12 @@ typedef struct {
 
 #define GBL_SIZE 5
 
-static G static_gbl[GBL_SIZE];
-static G *gbl = &static_gbl[0];
-static G *gbl_head = &static_gbl[0];
-static int gbl_avl = 0;
-static int gbl_size = GBL_SIZE;
+static FIO_TLS G static_gbl[GBL_SIZE];
+static FIO_TLS G *gbl;
+static FIO_TLS G *gbl_head;
+static FIO_TLS int gbl_avl = 0;
+static FIO_TLS int gbl_size = GBL_SIZE;
+#define INIT_GBL FIO_INIT_GBL(gbl, gbl_head, static_gbl)
 
 #define WRITE_UNF_LEN (unf_fwrite((char *)&unf_rec.u.s.bytecnt, RCWSZ, 1, Fcb) != TRUE)
 #define WRITE_UNF_REC \
@@ -198,6 +200,8 @@ static void
 allocate_new_gbl()
 {
   G *tmp_gbl;
+
+  INIT_GBL;
   if (gbl_avl >= gbl_size) {
     if (gbl_size == GBL_SIZE) {
       gbl_size = gbl_size + 15;
@@ -217,6 +221,7 @@ allocate_new_gbl()
 static void
 free_gbl()
 {
+  INIT_GBL;
   --gbl_avl;
   if (gbl_avl <= 0)
     gbl_avl = 0;
@@ -296,6 +301,7 @@ __f90io_unf_init(__INT_T *read,   /* TRUE indicates READ statement. */
     __fortio_errinit03(*unit, *bitv, iostat, "unformatted read");
   else
     __fortio_errinit03(*unit, *bitv, iostat, "unformatted write");
+  __fortio_lock_unit(*unit);
 
   allocate_new_gbl();
   Fcb = __fortio_rwinit(*unit, FIO_UNFORMATTED, rec, 1 - *read);
@@ -1375,6 +1381,7 @@ __f90io_usw_init(__INT_T *read,   /* TRUE indicates READ statement. */
     __fortio_errinit(*unit, *bitv, iostat, "unformatted read");
   else
     __fortio_errinit(*unit, *bitv, iostat, "unformatted write");
+  __fortio_lock_unit(*unit);
 
   allocate_new_gbl();
   Fcb = __fortio_rwinit(*unit, FIO_UNFORMATTED, rec, 1 - *read);
@@ -91,7 +91,9 @@ extern FIO_FCB *
 __fortio_alloc_fcb(void)
 {
   FIO_FCB *p;
+  int locked;
 
+  locked = __fortio_lock_fcbs();
   if (fcb_avail) { /* return item from avail list */
     p = fcb_avail;
     fcb_avail = p->next;
@@ -116,19 +118,23 @@ __fortio_alloc_fcb(void)
   }
 
   memset(p, 0, sizeof(FIO_FCB));
-  p[0].next = fioFcbTbls.fcbs; /* add new FCB to front of list */
-  fioFcbTbls.fcbs = p;
+  p[0].next = fioFcbs; /* add new FCB to front of list */
+  fioFcbs = p;
+  __fortio_unlock_fcbs(locked);
   return p;
 }
 
 extern void
 __fortio_free_fcb(FIO_FCB *p)
 {
-  if (fioFcbTbls.fcbs == p) /* delete p from list */
-    fioFcbTbls.fcbs = p->next;
+  int locked;
+
+  locked = __fortio_lock_fcbs();
+  if (fioFcbs == p) /* delete p from list */
+    fioFcbs = p->next;
   else {
     FIO_FCB *q;
-    for (q = fioFcbTbls.fcbs; q; q = q->next) /* find predecessor of p */
+    for (q = fioFcbs; q; q = q->next) /* find predecessor of p */
       if (q->next == p)
         break;
     assert(q != NULL); /* trying to free unallocated block */
@@ -137,6 +143,7 @@ __fortio_free_fcb(FIO_FCB *p)
 
   p->next = fcb_avail; /* add to front of avail list */
   fcb_avail = p;
+  __fortio_unlock_fcbs(locked);
 }
 
 extern void
@@ -433,12 +440,15 @@ __fortio_find_unit(
     int unit)
 {
   FIO_FCB *p;
+  int locked;
 
-  for (p = fioFcbTbls.fcbs; p; p = p->next)
+  locked = __fortio_lock_fcbs();
+  for (p = fioFcbs; p; p = p->next)
     if (p->unit == unit)
-      return p;
+      break;
+  __fortio_unlock_fcbs(locked);
 
-  return NULL; /* not found */
+  return p; /* NULL if not found */
 }
 
 /* ---------------------------------------------------------------- */
@@ -465,6 +475,83 @@ __fortio_zeropad(FILE *fp, long len)
   return 0;
 }
 
+/* ---------------------------------------------------------------- */
+
+/** \brief Read the next record of a sequential formatted file.
+ *
+ * The record is read into *buf, a buffer of *size bytes which must have
+ * come from malloc() and which is grown as needed, leaving room for at
+ * least one byte past the record.  Returns the length of the record
+ * without its end, and sets *eor to the length of the end of record: 1
+ * for a newline, 2 for a carriage return and newline (if EOR_CRLF), or
+ * 0 if the record ends at the end of the file.  Returns -1 if no
+ * character could be read; __io_feof() then tells end of file from an
+ * error.
+ *
+ * The search for the end of record runs over the stdio buffer a block at
+ * a time, rather than a character per call, and leaves the file at the
+ * start of the next record.
+ */
+extern long
+__fortio_getrec(FILE *fp, char **buf, size_t *size, int *eor)
+{
+  long n;
+  char *p;
+
+#if !defined(WINNT)
+  n = __io_getdelim(buf, size, '\n', fp);
+  if (n <= 0)
+    return -1;
+  p = *buf;
+  *eor = 0;
+  if (p[n - 1] == '\n') {
+    --n;
+    *eor = 1;
+    if (n > 0 && p[n - 1] == '\r' && EOR_CRLF) {
+      --n;
+      *eor = 2;
+    }
+  }
+#else
+  int c;
+
+  n = 0;
+  *eor = 0;
+  while (TRUE) {
+    if (n + 1 >= *size) {
+      p = realloc(*buf, *size + 512);
+      if (p == NULL) {
+        errno = ENOMEM;
+        return -1;
+      }
+      *buf = p;
+      *size += 512;
+    }
+    c = __io_fgetc(fp);
+    if (c == EOF) {
+      if (n == 0)
+        return -1;
+      break;
+    }
+    if (c == '\r' && EOR_CRLF) {
+      c = __io_fgetc(fp);
+      if (c == '\n') {
+        *eor = 2;
+        break;
+      }
+      __io_ungetc(c, fp);
+      c = '\r';
+    }
+    if (c == '\n') {
+      *eor = 1;
+      break;
+    }
+    (*buf)[n++] = c;
+  }
+#endif
+  return n;
+}
+
 /* --------------------------------------------------------------- */
 
 extern bool __fortio_eq_str(
@@ -42,6 +42,7 @@ __INT_T *id;
 
   __fort_status_init(bitv, iostat);
   __fortio_errinit03(*unit, *bitv, iostat, "WAIT");
+  __fortio_lock_unit(*unit);
   if (ILLEGAL_UNIT(*unit)) {
     s = __fortio_error(FIO_EUNIT);
     __fortio_errend03();
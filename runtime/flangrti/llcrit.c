@@ -72,16 +72,19 @@ _mp_ecs_stdio(void)
 static kmp_critical_name nest_sem;
 static omp_nest_lock_t nest_lock;
 
+/* is_init_nest and is_init_unit are read outside nest_sem: the acquire
+ * load pairs with the release store that follows the lock initialization.
+ */
 static int is_init_nest = 0;
 
 void
 _mp_bcs_nest(void)
 {
-  if (!is_init_nest) {
+  if (!__atomic_load_n(&is_init_nest, __ATOMIC_ACQUIRE)) {
     _mp_p(&nest_sem);
     if (!is_init_nest) {
       omp_init_nest_lock(&nest_lock);
-      is_init_nest = 1;
+      __atomic_store_n(&is_init_nest, 1, __ATOMIC_RELEASE);
     }
     _mp_v(&nest_sem);
   }
@@ -94,6 +97,47 @@ _mp_ecs_nest(void)
   omp_unset_nest_lock(&nest_lock);
 }
 
+/* i/o unit locks.  Unit numbers hash onto MP_UNIT_LOCKS nestable locks;
+ * units * and 6 (and * and 5) share a lock since they share a file.  The
+ * locks are never freed, so a unit may be closed while another thread waits.
+ */
+#define MP_UNIT_LOCKS 64
+
+static omp_nest_lock_t unit_lock[MP_UNIT_LOCKS];
+
+static int is_init_unit = 0;
+
+static omp_nest_lock_t *
+unit_lock_of(int unit)
+{
+  int i;
+
+  if (!__atomic_load_n(&is_init_unit, __ATOMIC_ACQUIRE)) {
+    _mp_p(&nest_sem);
+    if (!is_init_unit) {
+      for (i = 0; i < MP_UNIT_LOCKS; ++i)
+        omp_init_nest_lock(&unit_lock[i]);
+      __atomic_store_n(&is_init_unit, 1, __ATOMIC_RELEASE);
+    }
+    _mp_v(&nest_sem);
+  }
+  if (unit < 0)
+    unit = -unit;
+  return &unit_lock[unit % MP_UNIT_LOCKS];
+}
+
+void
+_mp_bcs_unit(int unit)
+{
+  omp_set_nest_lock(unit_lock_of(unit));
+}
+
+void
+_mp_ecs_unit(int unit)
+{
+  omp_unset_nest_lock(unit_lock_of(unit));
+}
+
 
 
 /* allocate and initialize a thread-private common block */
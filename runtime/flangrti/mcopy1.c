@@ -22,6 +22,12 @@ __c_mcopy1(char *dest, char *src, long cnt)
 {
   long i;
 
+  if (cnt * (long)sizeof(char) >= __C_PMEM_MINSZ &&
+      (dest + cnt <= src || src + cnt <= dest)) {
+    __c_pmcopy(dest, src, cnt * sizeof(char));
+    return;
+  }
+
   for (i = 0; i < cnt; i++) {
     dest[i] = src[i];
   }
@@ -22,6 +22,12 @@ __c_mcopy2(short *dest, short *src, long cnt)
 {
   long i;
 
+  if (cnt * (long)sizeof(short) >= __C_PMEM_MINSZ &&
+      (dest + cnt <= src || src + cnt <= dest)) {
+    __c_pmcopy(dest, src, cnt * sizeof(short));
+    return;
+  }
+
   for (i = 0; i < cnt; i++) {
     dest[i] = src[i];
   }
@@ -22,6 +22,12 @@ __c_mcopy4(int *dest, int *src, long cnt)
 {
   long i;
 
+  if (cnt * (long)sizeof(int) >= __C_PMEM_MINSZ &&
+      (dest + cnt <= src || src + cnt <= dest)) {
+    __c_pmcopy(dest, src, cnt * sizeof(int));
+    return;
+  }
+
   for (i = 0; i < cnt; i++) {
     dest[i] = src[i];
   }
@@ -22,6 +22,12 @@ __c_mcopy8(long long *dest, long long *src, long cnt)
 {
   long i;
 
+  if (cnt * (long)sizeof(long long) >= __C_PMEM_MINSZ &&
+      (dest + cnt <= src || src + cnt <= dest)) {
+    __c_pmcopy(dest, src, cnt * sizeof(long long));
+    return;
+  }
+
   for (i = 0; i < cnt; i++) {
     dest[i] = src[i];
   }
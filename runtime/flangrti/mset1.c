@@ -22,6 +22,13 @@ __c_mset1(char *dest, int value, long cnt)
 {
   long i;
 
+  if (cnt * (long)sizeof(char) >= __C_PMEM_MINSZ) {
+    char v = value;
+
+    __c_pmset(dest, &v, sizeof(v), cnt);
+    return;
+  }
+
   for (i = 0; i < cnt; i++) {
     dest[i] = value;
   }
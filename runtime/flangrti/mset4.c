@@ -22,6 +22,11 @@ __c_mset4(int *dest, int value, long cnt)
 {
   long i;
 
+  if (cnt * (long)sizeof(int) >= __C_PMEM_MINSZ) {
+    __c_pmset(dest, &value, sizeof(value), cnt);
+    return;
+  }
+
   for (i = 0; i < cnt; i++) {
     dest[i] = value;
   }
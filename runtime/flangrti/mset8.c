@@ -22,6 +22,11 @@ __c_mset8(long long *dest, long long value, long cnt)
 {
   long i;
 
+  if (cnt * (long)sizeof(long long) >= __C_PMEM_MINSZ) {
+    __c_pmset(dest, &value, sizeof(value), cnt);
+    return;
+  }
+
   for (i = 0; i < cnt; i++) {
     dest[i] = value;
   }
@@ -22,6 +22,13 @@ __c_mzero1(char *dest, long cnt)
 {
   long i;
 
+  if (cnt * (long)sizeof(char) >= __C_PMEM_MINSZ) {
+    char v = 0;
+
+    __c_pmset(dest, &v, sizeof(v), cnt);
+    return;
+  }
+
   for (i = 0; i < cnt; i++) {
     dest[i] = 0;
   }
@@ -22,6 +22,13 @@ __c_mzero2(short *dest, long cnt)
 {
   long i;
 
+  if (cnt * (long)sizeof(short) >= __C_PMEM_MINSZ) {
+    short v = 0;
+
+    __c_pmset(dest, &v, sizeof(v), cnt);
+    return;
+  }
+
   for (i = 0; i < cnt; i++) {
     dest[i] = 0;
   }
@@ -22,6 +22,13 @@ __c_mzero4(int *dest, long cnt)
 {
   long i;
 
+  if (cnt * (long)sizeof(int) >= __C_PMEM_MINSZ) {
+    int v = 0;
+
+    __c_pmset(dest, &v, sizeof(v), cnt);
+    return;
+  }
+
   for (i = 0; i < cnt; i++) {
     dest[i] = 0;
   }
@@ -22,6 +22,13 @@ __c_mzero8(long long *dest, long cnt)
 {
   long i;
 
+  if (cnt * (long)sizeof(long long) >= __C_PMEM_MINSZ) {
+    long long v = 0;
+
+    __c_pmset(dest, &v, sizeof(v), cnt);
+    return;
+  }
+
   for (i = 0; i < cnt; i++) {
     dest[i] = 0;
   }
@@ -15,6 +15,25 @@
  *
  */
 
+#ifdef HAVE_LIBNUMA
+
+/* the libnuma routines are the real ones, so there are no dummies.  CMake
+   puts libnuma on the link interface of the static library as well as
+   linking it into the shared one. */
+
+#include <numa.h>
+
+/** \brief number of NUMA nodes, 1 if the system has no NUMA support */
+int
+__c_numa_nodes(void)
+{
+  if (numa_available() < 0)
+    return 1;
+  return numa_num_configured_nodes();
+}
+
+#else
+
 /* dummy libnuma.a routines */
 
 int
@@ -76,3 +95,11 @@ mbind()
 {
   return (0);
 }
+
+int
+__c_numa_nodes(void)
+{
+  return 1;
+}
+
+#endif
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/** \file
+ * \brief Copy and fill engine for large arrays
+ *
+ * A copy or fill is split over the threads of a parallel region when the
+ * library is built with OpenMP, the caller is not already in one and there
+ * are at least F90_COPY_PAR_MINSZ bytes (default PMEM_PAR_MINSZ) for each
+ * thread; 0 keeps everything serial.  Thread t always writes the t-th of
+ * equal shares of the destination, the share a static schedule over the
+ * array gives it, so filling a new array places its pages on the nodes of
+ * the threads that go on to use them (first touch).  On NUMA systems the
+ * shares are cut at page boundaries so no page is written by two threads.
+ *
+ * Fills of at least F90_COPY_NT_MINSZ bytes (default PMEM_NT_MINSZ) are too
+ * large to stay in the cache and are written with non-temporal stores where
+ * the target has them; 0 never uses them.  Copies are left to memcpy(),
+ * which already streams its stores above a size of its own.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "memops.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <emmintrin.h>
+#define PMEM_HAVE_STREAM
+#endif
+
+#define PMEM_PAR_MINSZ (4L * 1024 * 1024) /* bytes worth another thread */
+#define PMEM_NT_MINSZ (32L * 1024 * 1024) /* fill bytes to stream */
+#define PMEM_LINE 64                      /* cache line, bytes */
+#define PMEM_FILL_BLOCK 4096              /* fill pattern run, bytes */
+
+static long par_minsz = -1;
+static long nt_minsz;
+static long share_align;
+
+static long
+pmem_getenv(const char *name, long dflt)
+{
+  char *p;
+  long v;
+
+  p = getenv(name);
+  v = p != NULL ? atol(p) : dflt;
+  return v < 0 ? 0 : v;
+}
+
+static void
+pmem_init(void)
+{
+  if (par_minsz >= 0)
+    return;
+  nt_minsz = pmem_getenv("F90_COPY_NT_MINSZ", PMEM_NT_MINSZ);
+  share_align = PMEM_LINE;
+  if (__c_numa_nodes() > 1)
+    share_align = sysconf(_SC_PAGESIZE);
+  par_minsz = pmem_getenv("F90_COPY_PAR_MINSZ", PMEM_PAR_MINSZ);
+}
+
+/** \brief number of threads to copy or fill n bytes on, 1 for serial */
+int
+__c_pmem_nthreads(size_t n)
+{
+#ifdef _OPENMP
+  int nthr;
+
+  pmem_init();
+  if (par_minsz == 0 || n / par_minsz < 2 || omp_in_parallel())
+    return 1;
+  nthr = omp_get_max_threads();
+  if (n / par_minsz < nthr)
+    nthr = n / par_minsz;
+  return nthr;
+#else
+  return 1;
+#endif
+}
+
+#ifdef _OPENMP
+
+/* share t of nthr of the n bytes at dest, cut at share_align boundaries */
+static void
+pmem_share(char *dest, size_t n, int nthr, int t, size_t *lo, size_t *hi)
+{
+  size_t a, b, m;
+
+  m = share_align - 1;
+  a = t == 0 ? 0 : (((size_t)dest + n / nthr * t + m) & ~m) - (size_t)dest;
+  b = t == nthr - 1 ? n
+                    : (((size_t)dest + n / nthr * (t + 1) + m) & ~m) -
+                          (size_t)dest;
+  *lo = a < n ? a : n;
+  *hi = b < n ? b : n;
+}
+
+#endif
+
+static void
+pmem_fence(int nt)
+{
+#ifdef PMEM_HAVE_STREAM
+  if (nt)
+    _mm_sfence();
+#endif
+}
+
+/* fill n bytes at to with copies of the len byte value at val, the first
+   byte written being byte ph of the value */
+
+static void
+pmem_fill(char *to, size_t n, const char *val, size_t len, size_t ph, int nt)
+{
+  size_t i, k;
+
+#ifdef PMEM_HAVE_STREAM
+  if (16 % len == 0) {
+    char pat[16];
+    __m128i x;
+
+    k = -(size_t)to & 15;
+    if (k > n)
+      k = n;
+    for (i = 0; i < k; ++i)
+      to[i] = val[(ph + i) % len];
+    for (i = 0; i < 16; ++i)
+      pat[i] = val[(ph + k + i) % len];
+    x = _mm_loadu_si128((const __m128i *)pat);
+    if (nt) {
+      for (i = k; i + 16 <= n; i += 16)
+        _mm_stream_si128((__m128i *)(to + i), x);
+    } else {
+      for (i = k; i + 16 <= n; i += 16)
+        _mm_store_si128((__m128i *)(to + i), x);
+    }
+    for (; i < n; ++i)
+      to[i] = val[(ph + i) % len];
+    return;
+  }
+#endif
+
+  /* lay down one value, then double the run up to a block, and copy
+     the block out */
+
+  k = len < n ? len : n;
+  for (i = 0; i < k; ++i)
+    to[i] = val[(ph + i) % len];
+  while (k < n && k < PMEM_FILL_BLOCK) {
+    i = n - k < k ? n - k : k;
+    memcpy(to + k, to, i);
+    k += i;
+  }
+  i = k - k % len;
+  for (; k < n; k += i)
+    memcpy(to + k, to, n - k < i ? n - k : i);
+}
+
+/** \brief copy n bytes from src to dest; the two must not overlap */
+void
+__c_pmcopy(void *dest, const void *src, size_t n)
+{
+  int nthr;
+
+  nthr = __c_pmem_nthreads(n);
+  if (nthr <= 1) {
+    memcpy(dest, src, n);
+    return;
+  }
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthr)
+  {
+    size_t lo, hi;
+
+    pmem_share(dest, n, omp_get_num_threads(), omp_get_thread_num(), &lo,
+               &hi);
+    memcpy((char *)dest + lo, (const char *)src + lo, hi - lo);
+  }
+#endif
+}
+
+/** \brief fill cnt elements of len bytes at dest with the value at val */
+void
+__c_pmset(void *dest, const void *val, size_t len, size_t cnt)
+{
+  size_t n;
+  int nt, nthr;
+
+  pmem_init();
+  n = len * cnt;
+  if (n == 0)
+    return;
+  nt = nt_minsz > 0 && n >= (size_t)nt_minsz;
+  nthr = __c_pmem_nthreads(n);
+  if (nthr <= 1) {
+    pmem_fill(dest, n, val, len, 0, nt);
+    pmem_fence(nt);
+    return;
+  }
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthr)
+  {
+    size_t lo, hi;
+
+    pmem_share(dest, n, omp_get_num_threads(), omp_get_thread_num(), &lo,
+               &hi);
+    if (hi > lo)
+      pmem_fill((char *)dest + lo, hi - lo, val, len, lo % len, nt);
+    pmem_fence(nt);
+  }
+#endif
+}
@@ -30,6 +30,8 @@ extern void _mp_bcs_stdio(void);
 extern void _mp_ecs_stdio(void);
 extern void _mp_bcs_nest(void);
 extern void _mp_ecs_nest(void);
+extern void _mp_bcs_unit(int unit);
+extern void _mp_ecs_unit(int unit);
 extern void _mp_cdeclp(void *blk, void ***blk_tp, int size);
 extern void _mp_cdecli(void *blk, void ***blk_tp, int size);
 extern void _mp_cdecl(void *blk, void ***blk_tp, int size);
@@ -53,6 +55,8 @@ extern void _mp_copyin_move_al(void *blk_tp, int off, long size);
 #define MP_V_STDIO _mp_ecs_stdio()
 #define MP_BCS_NEST _mp_bcs_nest()
 #define MP_ECS_NEST _mp_ecs_nest()
+#define MP_BCS_UNIT(unit) _mp_bcs_unit(unit)
+#define MP_ECS_UNIT(unit) _mp_ecs_unit(unit)
 #define MP_CDECLP(blk, blk_tp, size) _mp_cdeclp(blk, blk_tp, size)
 #define MP_CDECLI(blk, blk_tp, size) _mp_cdecli(blk, blk_tp, size)
 #define MP_CDECL(blk, blk_tp, size) _mp_cdecl(blk, blk_tp, size)
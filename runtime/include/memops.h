@@ -19,6 +19,8 @@
  * \brief Various memory operations
  */
 
+#include <stddef.h>
+
 void __c_mcopy1(char *dest, char *src, long cnt);
 void __c_mcopy2(short *dest, short *src, long cnt);
 void __c_mcopy4(int *dest, int *src, long cnt);
@@ -33,3 +35,13 @@ void __c_mzero1(char *dest, long cnt);
 void __c_mzero2(short *dest, long cnt);
 void __c_mzero4(int *dest, long cnt);
 void __c_mzero8(long long *dest, long cnt);
+
+/* copies and fills of at least this many bytes go to the copy engine,
+   which may thread them and use non-temporal stores */
+#define __C_PMEM_MINSZ (64 * 1024)
+
+int __c_pmem_nthreads(size_t n);
+void __c_pmcopy(void *dest, const void *src, size_t n);
+void __c_pmset(void *dest, const void *val, size_t len, size_t cnt);
+
+int __c_numa_nodes(void);
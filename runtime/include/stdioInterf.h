@@ -28,6 +28,7 @@
 #define __io_fflush(fp) fflush(fp)
 #define __io_fgetc(fp) fgetc(fp)
 #define __io_fgets(ptr, n, fp) fgets(ptr, n, fp)
+#define __io_getdelim(pp, n, d, fp) getdelim(pp, n, d, fp)
 
 #define __io_fopen(file, typ) fopen(file, typ)
 
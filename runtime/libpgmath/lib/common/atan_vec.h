@@ -0,0 +1,438 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Vector atan(x) and atan2(y, x), shared by the kernels in atan/ and atan2/.
+ *
+ * Must be included after one of helperavx2_128.h, helperavx2.h or
+ * helperavx512f.h, which supply the vfloat/vdouble abstraction.
+ *
+ * Both functions reduce to atan(n/d) with n, d >= 0.  The ratio selects
+ * one of five intervals with breakpoints 7/16, 11/16, 19/16 and 39/16, and
+ *
+ *   atan(n/d) = atan(c) + atan(t),  t = (n - c*d)/(d + c*n)
+ *
+ * for c = 0, 1/2, 1 and 3/2, or pi/2 + atan(-d/n) above the last
+ * breakpoint.  This keeps |t| <= 7/16, where atan(t) is approximated as
+ * t + t**3*P(t**2) with a minimax polynomial of degree:
+ *
+ *          float   double
+ *   fast     5       11
+ *   relaxed  3        9
+ *   precise  5       11
+ *
+ * The precise variants also carry the rounding error of t and the low part
+ * of atan(c), which keeps the result within about half an ulp of the
+ * correctly rounded value.
+ */
+
+#ifndef __ATAN_VEC_H__
+#define __ATAN_VEC_H__
+
+#define ATAN_FAST     0
+#define ATAN_RELAXED  1
+#define ATAN_PRECISE  2
+
+/*
+ * Single precision
+ */
+
+#define ATAN_F_HALF_HI      0.463647604f            /* atan(0.5) */
+#define ATAN_F_HALF_LO      5.01215869e-09f
+#define ATAN_F_PI4_HI       0.785398185f            /* pi/4 */
+#define ATAN_F_PI4_LO       -2.18556941e-08f
+#define ATAN_F_3HALF_HI     0.982793748f            /* atan(1.5) */
+#define ATAN_F_3HALF_LO     -2.51314241e-08f
+#define ATAN_F_PI2_HI       1.57079637f             /* pi/2 */
+#define ATAN_F_PI2_LO       -4.37113883e-08f
+#define ATAN_F_PIHALF_HI    2.67794514f             /* pi - atan(0.5) */
+#define ATAN_F_PIHALF_LO    -9.24349379e-08f
+#define ATAN_F_3PI4_HI      2.3561945f              /* 3*pi/4 */
+#define ATAN_F_3PI4_LO      -5.96244032e-09f
+#define ATAN_F_PI3HALF_HI   2.15879893f             /* pi - atan(1.5) */
+#define ATAN_F_PI3HALF_LO   -2.68671063e-09f
+#define ATAN_F_PI_HI        3.14159274f             /* pi */
+#define ATAN_F_PI_LO        -8.74227766e-08f
+
+/* P(z), relaxed */
+#define ATAN_F_R0   -0.333332628f
+#define ATAN_F_R1   0.199881867f
+#define ATAN_F_R2   -0.139687285f
+#define ATAN_F_R3   0.0827785283f
+
+/* P(z), fast and precise */
+#define ATAN_F_P0   -0.333333343f
+#define ATAN_F_P1   0.19999963f
+#define ATAN_F_P2   -0.142833993f
+#define ATAN_F_P3   0.110582277f
+#define ATAN_F_P4   -0.0853212774f
+#define ATAN_F_P5   0.0482230298f
+
+/* Pick c0..c4 by interval; o0..o3 are the ratio < breakpoint masks. */
+vfloat static INLINE
+__atan_sel_f(vopmask const o0, vopmask const o1, vopmask const o2,
+             vopmask const o3, float const c0, float const c1, float const c2,
+             float const c3, float const c4)
+{
+    vfloat r;
+
+    r = vsel_vf_vo_vf_vf(o3, vcast_vf_f(c3), vcast_vf_f(c4));
+    r = vsel_vf_vo_vf_vf(o2, vcast_vf_f(c2), r);
+    r = vsel_vf_vo_vf_vf(o1, vcast_vf_f(c1), r);
+    return vsel_vf_vo_vf_vf(o0, vcast_vf_f(c0), r);
+}
+
+/*
+ * atan(n/d) for n, d >= 0, not both zero nor infinite.  If xneg is not NULL
+ * the lanes it selects return pi - atan(n/d) instead, as needed by atan2.
+ */
+vfloat static INLINE
+__atan_kernel_f(vfloat const n, vfloat const d, vopmask const *xneg,
+                int const precise)
+{
+    vopmask o0, o1, o2, o3;
+    vfloat p, q, bh, bl, num, den, t, tl, z, w, r, rl;
+
+    o0 = vlt_vo_vf_vf(n, vmul_vf_vf_vf(d, vcast_vf_f(0.4375f)));
+    o1 = vlt_vo_vf_vf(n, vmul_vf_vf_vf(d, vcast_vf_f(0.6875f)));
+    o2 = vlt_vo_vf_vf(n, vmul_vf_vf_vf(d, vcast_vf_f(1.1875f)));
+    o3 = vlt_vo_vf_vf(n, vmul_vf_vf_vf(d, vcast_vf_f(2.4375f)));
+
+    /* num = p*n - c*d, den = p*d + c*n with p = 0 in the last interval. */
+    p = vsel_vf_vo_vf_vf(o3, vcast_vf_f(1.0f), vcast_vf_f(0.0f));
+    q = __atan_sel_f(o0, o1, o2, o3, 0.0f, 0.5f, 1.0f, 1.5f, 1.0f);
+    num = vfma_vf_vf_vf_vf(vneg_vf_vf(q), d, vmul_vf_vf_vf(p, n));
+    den = vfma_vf_vf_vf_vf(q, n, vmul_vf_vf_vf(p, d));
+
+    bh = __atan_sel_f(o0, o1, o2, o3, 0.0f, ATAN_F_HALF_HI, ATAN_F_PI4_HI,
+                      ATAN_F_3HALF_HI, ATAN_F_PI2_HI);
+    bl = __atan_sel_f(o0, o1, o2, o3, 0.0f, ATAN_F_HALF_LO, ATAN_F_PI4_LO,
+                      ATAN_F_3HALF_LO, ATAN_F_PI2_LO);
+    if (xneg) {
+        num = vsel_vf_vo_vf_vf(*xneg, vneg_vf_vf(num), num);
+        bh = vsel_vf_vo_vf_vf(*xneg,
+                 __atan_sel_f(o0, o1, o2, o3, ATAN_F_PI_HI, ATAN_F_PIHALF_HI,
+                              ATAN_F_3PI4_HI, ATAN_F_PI3HALF_HI, ATAN_F_PI2_HI),
+                 bh);
+        bl = vsel_vf_vo_vf_vf(*xneg,
+                 __atan_sel_f(o0, o1, o2, o3, ATAN_F_PI_LO, ATAN_F_PIHALF_LO,
+                              ATAN_F_3PI4_LO, ATAN_F_PI3HALF_LO, ATAN_F_PI2_LO),
+                 bl);
+    }
+
+    t = vdiv_vf_vf_vf(num, den);
+    z = vmul_vf_vf_vf(t, t);
+    if (precise == ATAN_RELAXED) {
+        w = vfma_vf_vf_vf_vf(vcast_vf_f(ATAN_F_R3), z, vcast_vf_f(ATAN_F_R2));
+        w = vfma_vf_vf_vf_vf(w, z, vcast_vf_f(ATAN_F_R1));
+        w = vfma_vf_vf_vf_vf(w, z, vcast_vf_f(ATAN_F_R0));
+    } else {
+        w = vfma_vf_vf_vf_vf(vcast_vf_f(ATAN_F_P5), z, vcast_vf_f(ATAN_F_P4));
+        w = vfma_vf_vf_vf_vf(w, z, vcast_vf_f(ATAN_F_P3));
+        w = vfma_vf_vf_vf_vf(w, z, vcast_vf_f(ATAN_F_P2));
+        w = vfma_vf_vf_vf_vf(w, z, vcast_vf_f(ATAN_F_P1));
+        w = vfma_vf_vf_vf_vf(w, z, vcast_vf_f(ATAN_F_P0));
+    }
+    w = vmul_vf_vf_vf(vmul_vf_vf_vf(t, z), w);
+
+    if (precise != ATAN_PRECISE) {
+        return vadd_vf_vf_vf(bh, vadd_vf_vf_vf(t, vadd_vf_vf_vf(w, bl)));
+    }
+
+    /*
+     * tl is the rounding error of num/den; atan(t + tl) ~ atan(t) + tl*(1 - z).
+     * |bh| >= |t| unless bh is zero, so the error of bh + t is exact.
+     */
+    tl = vdiv_vf_vf_vf(vfma_vf_vf_vf_vf(vneg_vf_vf(t), den, num), den);
+    rl = vadd_vf_vf_vf(vadd_vf_vf_vf(bl, w), vfma_vf_vf_vf_vf(vneg_vf_vf(tl), z, tl));
+    r = vadd_vf_vf_vf(bh, t);
+    rl = vadd_vf_vf_vf(vsub_vf_vf_vf(t, vsub_vf_vf_vf(r, bh)), rl);
+    return vadd_vf_vf_vf(r, rl);
+}
+
+/* |r| with the sign of x. */
+vfloat static INLINE
+__atan_copysign_f(vfloat const r, vfloat const x)
+{
+    vmask sgn;
+
+    sgn = vand_vm_vm_vm(vreinterpret_vm_vf(x),
+                        vreinterpret_vm_vf(vcast_vf_f(-0.0f)));
+    return vreinterpret_vf_vm(vor_vm_vm_vm(
+               vandnot_vm_vm_vm(vreinterpret_vm_vf(vcast_vf_f(-0.0f)),
+                                vreinterpret_vm_vf(r)), sgn));
+}
+
+vfloat static INLINE
+__atan_f_vec(vfloat const x, int const precise)
+{
+    vfloat a, r;
+
+    /* atan(|x|) rounds to pi/2 well before the clamp. */
+    a = vmin_vf_vf_vf(vabs_vf_vf(x), vcast_vf_f(0x1p+30f));
+    r = __atan_kernel_f(a, vcast_vf_f(1.0f), NULL, precise);
+    r = __atan_copysign_f(r, x);
+    return vsel_vf_vo_vf_vf(visnan_vo_vf(x), x, r);
+}
+
+vfloat static INLINE
+__atan2_f_vec(vfloat const y, vfloat const x, int const precise)
+{
+    vopmask xneg, big, small, yzero, xinf, yinf;
+    vfloat ax, ay, m, r;
+
+    ax = vabs_vf_vf(x);
+    ay = vabs_vf_vf(y);
+
+    /* Sign of x, including -0. */
+    xneg = vlt_vo_vf_vf(__atan_copysign_f(vcast_vf_f(1.0f), x), vcast_vf_f(0.0f));
+
+    /*
+     * Map the special operands onto finite ones with the same result:
+     * y = 0 -> (0, 1), x = inf -> (0, 1), y = inf -> (1, 0) and both
+     * infinite -> (1, 1).
+     */
+    yzero = veq_vo_vf_vf(ay, vcast_vf_f(0.0f));
+    xinf = visinf_vo_vf(ax);
+    yinf = visinf_vo_vf(ay);
+    ay = vsel_vf_vo_vf_vf(vandnot_vo_vo_vo(yinf, xinf), vcast_vf_f(0.0f), ay);
+    ay = vsel_vf_vo_vf_vf(yinf, vcast_vf_f(1.0f), ay);
+    ax = vsel_vf_vo_vf_vf(vor_vo_vo_vo(yzero, xinf), vcast_vf_f(1.0f), ax);
+    ax = vsel_vf_vo_vf_vf(vandnot_vo_vo_vo(xinf, yinf), vcast_vf_f(0.0f), ax);
+
+    /* Keep n, d and their sums clear of overflow and of denormals. */
+    m = vmax_vf_vf_vf(ax, ay);
+    big = vgt_vo_vf_vf(m, vcast_vf_f(0x1p+64f));
+    small = vlt_vo_vf_vf(m, vcast_vf_f(0x1p-64f));
+    m = vsel_vf_vo_vf_vf(big, vcast_vf_f(0x1p-32f),
+            vsel_vf_vo_vf_vf(small, vcast_vf_f(0x1p+32f), vcast_vf_f(1.0f)));
+    ax = vmul_vf_vf_vf(ax, m);
+    ay = vmul_vf_vf_vf(ay, m);
+
+    r = __atan_kernel_f(ay, ax, &xneg, precise);
+    r = __atan_copysign_f(r, y);
+    return vsel_vf_vo_vf_vf(vor_vo_vo_vo(visnan_vo_vf(x), visnan_vo_vf(y)),
+                          vadd_vf_vf_vf(x, y), r);
+}
+
+/*
+ * Double precision
+ */
+
+#define ATAN_D_HALF_HI      0.46364760900080609     /* atan(0.5) */
+#define ATAN_D_HALF_LO      2.2698777452961687e-17
+#define ATAN_D_PI4_HI       0.78539816339744828     /* pi/4 */
+#define ATAN_D_PI4_LO       3.061616997868383e-17
+#define ATAN_D_3HALF_HI     0.98279372324732905     /* atan(1.5) */
+#define ATAN_D_3HALF_LO     1.3903311031230998e-17
+#define ATAN_D_PI2_HI       1.5707963267948966      /* pi/2 */
+#define ATAN_D_PI2_LO       6.123233995736766e-17
+#define ATAN_D_PIHALF_HI    2.677945044588987       /* pi - atan(0.5) */
+#define ATAN_D_PIHALF_LO    1.5527705369303147e-16
+#define ATAN_D_3PI4_HI      2.3561944901923448      /* 3*pi/4 */
+#define ATAN_D_3PI4_LO      9.1848509936051484e-17
+#define ATAN_D_PI3HALF_HI   2.158798930342464       /* pi - atan(1.5) */
+#define ATAN_D_PI3HALF_LO   2.1958367134601997e-16
+#define ATAN_D_PI_HI        3.1415926535897931      /* pi */
+#define ATAN_D_PI_LO        1.2246467991473532e-16
+
+/* P(z), relaxed */
+#define ATAN_D_R0   -0.33333333333333093
+#define ATAN_D_R1   0.19999999999749166
+#define ATAN_D_R2   -0.14285714242276859
+#define ATAN_D_R3   0.11111108181898402
+#define ATAN_D_R4   -0.090908082863568995
+#define ATAN_D_R5   0.076903015472115477
+#define ATAN_D_R6   -0.066421050987302027
+#define ATAN_D_R7   0.056928631401462294
+#define ATAN_D_R8   -0.043479767183723747
+#define ATAN_D_R9   0.020998139039457391
+
+/* P(z), fast and precise */
+#define ATAN_D_P0   -0.33333333333333331
+#define ATAN_D_P1   0.1999999999999941
+#define ATAN_D_P2   -0.14285714285566806
+#define ATAN_D_P3   0.11111111096645038
+#define ATAN_D_P4   -0.090909083556025921
+#define ATAN_D_P5   0.07692285554889286
+#define ATAN_D_P6   -0.06666241923359964
+#define ATAN_D_P7   0.058769464567550611
+#define ATAN_D_P8   -0.052166797393136559
+#define ATAN_D_P9   0.04492259293193656
+#define ATAN_D_P10  -0.033128134256069586
+#define ATAN_D_P11  0.014773184616983806
+
+/* Pick c0..c4 by interval; o0..o3 are the ratio < breakpoint masks. */
+vdouble static INLINE
+__atan_sel_d(vopmask const o0, vopmask const o1, vopmask const o2,
+             vopmask const o3, double const c0, double const c1, double const c2,
+             double const c3, double const c4)
+{
+    vdouble r;
+
+    r = vsel_vd_vo_vd_vd(o3, vcast_vd_d(c3), vcast_vd_d(c4));
+    r = vsel_vd_vo_vd_vd(o2, vcast_vd_d(c2), r);
+    r = vsel_vd_vo_vd_vd(o1, vcast_vd_d(c1), r);
+    return vsel_vd_vo_vd_vd(o0, vcast_vd_d(c0), r);
+}
+
+/*
+ * atan(n/d) for n, d >= 0, not both zero nor infinite.  If xneg is not NULL
+ * the lanes it selects return pi - atan(n/d) instead, as needed by atan2.
+ */
+vdouble static INLINE
+__atan_kernel_d(vdouble const n, vdouble const d, vopmask const *xneg,
+                int const precise)
+{
+    vopmask o0, o1, o2, o3;
+    vdouble p, q, bh, bl, num, den, t, tl, z, w, r, rl;
+
+    o0 = vlt_vo_vd_vd(n, vmul_vd_vd_vd(d, vcast_vd_d(0.4375)));
+    o1 = vlt_vo_vd_vd(n, vmul_vd_vd_vd(d, vcast_vd_d(0.6875)));
+    o2 = vlt_vo_vd_vd(n, vmul_vd_vd_vd(d, vcast_vd_d(1.1875)));
+    o3 = vlt_vo_vd_vd(n, vmul_vd_vd_vd(d, vcast_vd_d(2.4375)));
+
+    /* num = p*n - c*d, den = p*d + c*n with p = 0 in the last interval. */
+    p = vsel_vd_vo_vd_vd(o3, vcast_vd_d(1.0), vcast_vd_d(0.0));
+    q = __atan_sel_d(o0, o1, o2, o3, 0.0, 0.5, 1.0, 1.5, 1.0);
+    num = vfma_vd_vd_vd_vd(vneg_vd_vd(q), d, vmul_vd_vd_vd(p, n));
+    den = vfma_vd_vd_vd_vd(q, n, vmul_vd_vd_vd(p, d));
+
+    bh = __atan_sel_d(o0, o1, o2, o3, 0.0, ATAN_D_HALF_HI, ATAN_D_PI4_HI,
+                      ATAN_D_3HALF_HI, ATAN_D_PI2_HI);
+    bl = __atan_sel_d(o0, o1, o2, o3, 0.0, ATAN_D_HALF_LO, ATAN_D_PI4_LO,
+                      ATAN_D_3HALF_LO, ATAN_D_PI2_LO);
+    if (xneg) {
+        num = vsel_vd_vo_vd_vd(*xneg, vneg_vd_vd(num), num);
+        bh = vsel_vd_vo_vd_vd(*xneg,
+                 __atan_sel_d(o0, o1, o2, o3, ATAN_D_PI_HI, ATAN_D_PIHALF_HI,
+                              ATAN_D_3PI4_HI, ATAN_D_PI3HALF_HI, ATAN_D_PI2_HI),
+                 bh);
+        bl = vsel_vd_vo_vd_vd(*xneg,
+                 __atan_sel_d(o0, o1, o2, o3, ATAN_D_PI_LO, ATAN_D_PIHALF_LO,
+                              ATAN_D_3PI4_LO, ATAN_D_PI3HALF_LO, ATAN_D_PI2_LO),
+                 bl);
+    }
+
+    t = vdiv_vd_vd_vd(num, den);
+    z = vmul_vd_vd_vd(t, t);
+    if (precise == ATAN_RELAXED) {
+        w = vfma_vd_vd_vd_vd(vcast_vd_d(ATAN_D_R9), z, vcast_vd_d(ATAN_D_R8));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_R7));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_R6));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_R5));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_R4));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_R3));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_R2));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_R1));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_R0));
+    } else {
+        w = vfma_vd_vd_vd_vd(vcast_vd_d(ATAN_D_P11), z, vcast_vd_d(ATAN_D_P10));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_P9));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_P8));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_P7));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_P6));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_P5));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_P4));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_P3));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_P2));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_P1));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(ATAN_D_P0));
+    }
+    w = vmul_vd_vd_vd(vmul_vd_vd_vd(t, z), w);
+
+    if (precise != ATAN_PRECISE) {
+        return vadd_vd_vd_vd(bh, vadd_vd_vd_vd(t, vadd_vd_vd_vd(w, bl)));
+    }
+
+    /*
+     * tl is the rounding error of num/den; atan(t + tl) ~ atan(t) + tl*(1 - z).
+     * |bh| >= |t| unless bh is zero, so the error of bh + t is exact.
+     */
+    tl = vdiv_vd_vd_vd(vfma_vd_vd_vd_vd(vneg_vd_vd(t), den, num), den);
+    rl = vadd_vd_vd_vd(vadd_vd_vd_vd(bl, w), vfma_vd_vd_vd_vd(vneg_vd_vd(tl), z, tl));
+    r = vadd_vd_vd_vd(bh, t);
+    rl = vadd_vd_vd_vd(vsub_vd_vd_vd(t, vsub_vd_vd_vd(r, bh)), rl);
+    return vadd_vd_vd_vd(r, rl);
+}
+
+/* |r| with the sign of x. */
+vdouble static INLINE
+__atan_copysign_d(vdouble const r, vdouble const x)
+{
+    vmask sgn;
+
+    sgn = vand_vm_vm_vm(vreinterpret_vm_vd(x),
+                        vreinterpret_vm_vd(vcast_vd_d(-0.0)));
+    return vreinterpret_vd_vm(vor_vm_vm_vm(
+               vandnot_vm_vm_vm(vreinterpret_vm_vd(vcast_vd_d(-0.0)),
+                                vreinterpret_vm_vd(r)), sgn));
+}
+
+vdouble static INLINE
+__atan_d_vec(vdouble const x, int const precise)
+{
+    vdouble a, r;
+
+    /* atan(|x|) rounds to pi/2 well before the clamp. */
+    a = vmin_vd_vd_vd(vabs_vd_vd(x), vcast_vd_d(0x1p+60));
+    r = __atan_kernel_d(a, vcast_vd_d(1.0), NULL, precise);
+    r = __atan_copysign_d(r, x);
+    return vsel_vd_vo_vd_vd(visnan_vo_vd(x), x, r);
+}
+
+vdouble static INLINE
+__atan2_d_vec(vdouble const y, vdouble const x, int const precise)
+{
+    vopmask xneg, big, small, yzero, xinf, yinf;
+    vdouble ax, ay, m, r;
+
+    ax = vabs_vd_vd(x);
+    ay = vabs_vd_vd(y);
+
+    /* Sign of x, including -0. */
+    xneg = vlt_vo_vd_vd(__atan_copysign_d(vcast_vd_d(1.0), x), vcast_vd_d(0.0));
+
+    /*
+     * Map the special operands onto finite ones with the same result:
+     * y = 0 -> (0, 1), x = inf -> (0, 1), y = inf -> (1, 0) and both
+     * infinite -> (1, 1).
+     */
+    yzero = veq_vo_vd_vd(ay, vcast_vd_d(0.0));
+    xinf = visinf_vo_vd(ax);
+    yinf = visinf_vo_vd(ay);
+    ay = vsel_vd_vo_vd_vd(vandnot_vo_vo_vo(yinf, xinf), vcast_vd_d(0.0), ay);
+    ay = vsel_vd_vo_vd_vd(yinf, vcast_vd_d(1.0), ay);
+    ax = vsel_vd_vo_vd_vd(vor_vo_vo_vo(yzero, xinf), vcast_vd_d(1.0), ax);
+    ax = vsel_vd_vo_vd_vd(vandnot_vo_vo_vo(xinf, yinf), vcast_vd_d(0.0), ax);
+
+    /* Keep n, d and their sums clear of overflow and of denormals. */
+    m = vmax_vd_vd_vd(ax, ay);
+    big = vgt_vo_vd_vd(m, vcast_vd_d(0x1p+512));
+    small = vlt_vo_vd_vd(m, vcast_vd_d(0x1p-512));
+    m = vsel_vd_vo_vd_vd(big, vcast_vd_d(0x1p-256),
+            vsel_vd_vo_vd_vd(small, vcast_vd_d(0x1p+256), vcast_vd_d(1.0)));
+    ax = vmul_vd_vd_vd(ax, m);
+    ay = vmul_vd_vd_vd(ay, m);
+
+    r = __atan_kernel_d(ay, ax, &xneg, precise);
+    r = __atan_copysign_d(r, y);
+    return vsel_vd_vo_vd_vd(vor_vo_vo_vo(visnan_vo_vd(x), visnan_vo_vd(y)),
+                          vadd_vd_vd_vd(x, y), r);
+}
+
+#endif // __ATAN_VEC_H__
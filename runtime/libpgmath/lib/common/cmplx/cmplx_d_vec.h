@@ -0,0 +1,534 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Double precision complex vector kernels: division, sqrt, exp, log and
+ * pow.
+ *
+ * Must be included after one of helperavx2_128.h, helperavx2.h or
+ * helperavx512f.h, which supply the vfloat/vdouble abstraction.  The
+ * kernels work on separate vectors of real and imaginary parts; the entry
+ * points split the interleaved (re, im) pairs of the vcd*_t types.
+ *
+ * div   Smith's algorithm: the larger of |c| and |d| is divided into the
+ *       smaller, so that neither the ratio nor the denominator can
+ *       overflow.  The precise variant divides twice instead of
+ *       multiplying by a reciprocal, recovers a ratio that underflows
+ *       (Baudin and Smith) and gives the infinities and zeros of C99
+ *       Annex G where the quotient would be NaN.
+ * sqrt  t = sqrt((|x| + |z|)/2) and y/(2t), with z scaled by an even power
+ *       of two so that neither |z| nor the sum can overflow or lose bits
+ *       to denormals.  The precise variant adds the Annex G special cases.
+ * exp   exp(x)*(cos(y) + i*sin(y)).  exp(x) = 2**n*(1 + expm1(s)) uses
+ *       the kernel of hyperbolic_vec.h, and 2**n is applied in two steps
+ *       so that e.g. exp(720)*cos(y) is finite when it should be.
+ * log   log|z| = log(|z|**2)/2, with |z|**2 formed exactly as a double
+ *       double of a scaled z, so that log|z| stays accurate for |z| close
+ *       to 1; arg(z) comes from __atan2_d_vec.
+ * pow   exp(w*log(z)); the precise variant keeps the product in extended
+ *       precision, using the log of pow_vec.h.
+ *
+ * sin and cos share the polynomial of sin_d_vec.h: cos(y) is evaluated as
+ * -sin(y - (2k + 1)*pi/2) the same way __cos_d_vec does.
+ */
+
+#ifndef __CMPLX_D_VEC_H__
+#define __CMPLX_D_VEC_H__
+
+#include "misc.h"
+#include "atan_vec.h"
+#include "pow_vec.h"
+#include "sin_d_vec.h"
+
+#define CMPLX_FAST     0
+#define CMPLX_RELAXED  1
+#define CMPLX_PRECISE  2
+
+/* Accuracy class of the real kernels, whose classes are named alike. */
+#define CMPLX_CLASS(_p, _pfx) ((_p) == CMPLX_FAST ? _pfx##_FAST : \
+                               (_p) == CMPLX_RELAXED ? _pfx##_RELAXED : \
+                               _pfx##_PRECISE)
+
+/*
+ * |z| is scaled by 2**-+CMPLX_D_SCALE above or below 2**+-CMPLX_D_BIG, which
+ * keeps |z|**2 a normal double.
+ */
+#define CMPLX_D_BIG     0x1p+500
+#define CMPLX_D_SMALL   0x1p-500
+#define CMPLX_D_SCALE   600.0
+#define CMPLX_D_DOWN    0x1p-600
+#define CMPLX_D_UP      0x1p+600
+#define CMPLX_D_SQDOWN  0x1p-300
+#define CMPLX_D_SQUP    0x1p+300
+
+/*
+ * exp(x) is only certainly out of range beyond these, as |cos(y)| and
+ * |sin(y)| can be as small as about 2**-61 for double y.
+ */
+#define CMPLX_D_XMAX    760.0
+#define CMPLX_D_XMIN    -746.0
+
+/* Copy the sign of x on to r. */
+vdouble static INLINE
+__cmplx_copysign_d(vdouble const r, vdouble const x)
+{
+    vmask sgn = vreinterpret_vm_vd(vcast_vd_d(-0.0));
+
+    return vreinterpret_vd_vm(vor_vm_vm_vm(
+               vandnot_vm_vm_vm(sgn, vreinterpret_vm_vd(r)),
+               vand_vm_vm_vm(sgn, vreinterpret_vm_vd(x))));
+}
+
+/* x is neither infinite nor NaN. */
+vopmask static INLINE
+__cmplx_isfinite_d(vdouble const x)
+{
+    return vlt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(INFINITY));
+}
+
+/* a*b + c*d = result + *lo, with both products exact. */
+vdouble static INLINE
+__cmplx_dot_d(vdouble const a, vdouble const b, vdouble const c, vdouble const d,
+              vdouble *lo)
+{
+    vdouble p, q, s, t;
+
+    p = vmul_vd_vd_vd(a, b);
+    q = vmul_vd_vd_vd(c, d);
+    s = vadd_vd_vd_vd(p, q);
+    t = vsub_vd_vd_vd(s, p);
+    *lo = vadd_vd_vd_vd(vsub_vd_vd_vd(p, vsub_vd_vd_vd(s, t)), vsub_vd_vd_vd(q, t));
+    *lo = vadd_vd_vd_vd(*lo, vfmapn_vd_vd_vd_vd(a, b, p));
+    *lo = vadd_vd_vd_vd(*lo, vfmapn_vd_vd_vd_vd(c, d, q));
+    return s;
+}
+
+/* __reduction_slowpath, with the sign of cos(y) in *hc as well. */
+vdouble static INLINE
+__cmplx_reduction_slowpath_d(vdouble const a, vmask *h, vmask *hc)
+{
+    union {
+        vdouble vd;
+        vmask vm;
+        double sd[sizeof(vdouble) / sizeof(double)];
+        uint64_t sm[sizeof(vmask) / sizeof(uint64_t)];
+    } rv, av, hv, cv;
+    av.vd = a;
+
+    for (int i = 0; i < sizeof(vdouble) / sizeof(double); i++) {
+        rv.sd[i] = reduction_slowpath_sc(av.sd[i], hv.sm + i, cv.sm + i);
+    }
+    *h = hv.vm;
+    *hc = cv.vm;
+
+    return rv.vd;
+}
+
+/* sin(y) and cos(y). */
+void static INLINE
+__cmplx_sincos_d(vdouble const y, vdouble *s, vdouble *c)
+{
+    vdouble k, a;
+    vint2 p, h;
+    vopmask m;
+
+    k = vfma_vd_vd_vd_vd(y, vcast_vd_d(_1_OVER_PI), vcast_vd_d(6755399441055744.0));
+    h = vsll64_vi2_vi2_i((vint2)k, 63);
+    k = vsub_vd_vd_vd(k, vcast_vd_d(6755399441055744.0));
+    a = vfma_vd_vd_vd_vd(k, vcast_vd_d(-PI_HI), y);
+    a = vfma_vd_vd_vd_vd(k, vcast_vd_d(-PI_MI), a);
+    a = vfma_vd_vd_vd_vd(k, vcast_vd_d(-PI_LO), a);
+    *s = __sin_d_kernel(a, h);
+
+    /* The sign of the kernel flips for -sin. */
+    k = vfma_vd_vd_vd_vd(y, vcast_vd_d(_1_OVER_PI), vcast_vd_d(-0.5));
+    k = vadd_vd_vd_vd(k, vcast_vd_d(6755399441055744.0));
+    h = vsll64_vi2_vi2_i((vint2)k, 63);
+    h = vxor_vi2_vi2_vi2(h, (vint2)vcast_vm_i_i(0x80000000, 0));
+    k = vsub_vd_vd_vd(k, vcast_vd_d(6755399441055744.0));
+    k = vfma_vd_vd_vd_vd(vcast_vd_d(2.0), k, vcast_vd_d(1.0));
+    a = vfma_vd_vd_vd_vd(k, vcast_vd_d(-0.5 * PI_HI), y);
+    a = vfma_vd_vd_vd_vd(k, vcast_vd_d(-0.5 * PI_MI), a);
+    a = vfma_vd_vd_vd_vd(k, vcast_vd_d(-0.5 * PI_LO), a);
+    *c = __sin_d_kernel(a, h);
+
+    p = vand_vi2_vi2_vi2((vint2)y, (vint2)vcast_vm_i_i(0x7fffffff, 0xffffffff));
+    m = vgt64_vo_vi2_vi2(p, (vint2)vcast_vm_i_i(0x3e46a09e, 0x667f3bcc));
+    *c = vsel_vd_vo_vd_vd(m, *c, vcast_vd_d(1.0));
+
+    m = vgt64_vo_vi2_vi2(p, (vint2)vcast_vd_d(THRESHOLD));
+    if (__builtin_expect(!vtestz_i_vo(m), 0)) {
+        vdouble r, rs, rc;
+        vopmask ninf;
+        vmask half, chalf;
+
+        /*
+         * |r| <= pi/2 with sin(y) = +-sin(r) and cos(y) = +-sin(pi/2 - |r|),
+         * the signs in half and chalf.
+         */
+        r = __cmplx_reduction_slowpath_d(y, &half, &chalf);
+        rs = __sin_d_kernel(r, half);
+        a = vsub_vd_vd_vd(vcast_vd_d(0.5 * PI_HI), vabs_vd_vd(r));
+        a = vadd_vd_vd_vd(a, vcast_vd_d(0.5 * PI_MI));
+        rc = __sin_d_kernel(a, chalf);
+        ninf = vgt64_vo_vi2_vi2((vint2)vcast_vm_i_i(0x7ff00000, 0), p);
+        rs = vsel_vd_vo_vd_vd(ninf, rs, vmul_vd_vd_vd(y, vcast_vd_d(0.0)));
+        rc = vsel_vd_vo_vd_vd(ninf, rc, vmul_vd_vd_vd(y, vcast_vd_d(0.0)));
+        *s = vsel_vd_vo_vd_vd(m, rs, *s);
+        *c = vsel_vd_vo_vd_vd(m, rc, *c);
+    }
+}
+
+/*
+ * exp(x + xl)*(cos(y + yl) + i*sin(y + yl)) for finite or infinite x,
+ * without the special cases of NaN x.  yl is only used by the precise
+ * variants.
+ */
+void static INLINE
+__cmplx_exp_kernel_d(vdouble x, vdouble xl, vdouble const y, vdouble const yl,
+                     int const precise, vdouble *re, vdouble *im)
+{
+    vdouble k, s, sl, t, u, ul, e, sn, cs, sc;
+    vopmask o;
+
+    o = vand_vo_vo_vo(vlt_vo_vd_vd(x, vcast_vd_d(CMPLX_D_XMAX)),
+                      vgt_vo_vd_vd(x, vcast_vd_d(CMPLX_D_XMIN)));
+    xl = vsel_vd_vo_vd_vd(o, xl, vcast_vd_d(0.0));
+    x = vmax_vd_vd_vd(vmin_vd_vd_vd(x, vcast_vd_d(CMPLX_D_XMAX)),
+                      vcast_vd_d(CMPLX_D_XMIN));
+
+    s = __hyp_reduce_d(x, &k, &sl);
+    sl = vadd_vd_vd_vd(sl, xl);
+    t = vadd_vd_vd_vd(s, sl);
+    sl = vadd_vd_vd_vd(vsub_vd_vd_vd(s, t), sl);
+    s = t;
+    u = __hyp_expm1_kernel_d(s, sl, CMPLX_CLASS(precise, HYP), &ul);
+    e = vadd_vd_vd_vd(vcast_vd_d(1.0), u);
+    if (precise == CMPLX_PRECISE) {
+        ul = vadd_vd_vd_vd(vadd_vd_vd_vd(vsub_vd_vd_vd(vcast_vd_d(1.0), e), u),
+                           ul);
+        e = vadd_vd_vd_vd(e, ul);
+    }
+
+    __cmplx_sincos_d(y, &sn, &cs);
+    if (precise == CMPLX_PRECISE) {
+        t = sn;
+        sn = vfma_vd_vd_vd_vd(yl, cs, sn);
+        cs = vfmanp_vd_vd_vd_vd(yl, t, cs);
+    }
+
+    /* e*2**(n -+ POW_D_SCALE) is exact; the second step rounds once. */
+    o = vgt_vo_vd_vd(x, vcast_vd_d(0.0));
+    k = vadd_vd_vd_vd(k, vsel_vd_vo_vd_vd(o, vcast_vd_d(-POW_D_SCALE),
+                                          vcast_vd_d(POW_D_SCALE)));
+    e = vmul_vd_vd_vd(e, __hyp_pow2_d(k, 0.0));
+    sc = vsel_vd_vo_vd_vd(o, vcast_vd_d(POW_D_POW2SCALE),
+                          vcast_vd_d(1.0 / POW_D_POW2SCALE));
+    /*
+     * When e is scaled down, sin and cos are scaled up first instead, so
+     * that a subnormal sin(y) or cos(y) is not lost before e is applied.
+     */
+    *re = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(vmul_vd_vd_vd(cs, sc), e),
+                           vmul_vd_vd_vd(vmul_vd_vd_vd(e, cs), sc));
+    *im = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(vmul_vd_vd_vd(sn, sc), e),
+                           vmul_vd_vd_vd(vmul_vd_vd_vd(e, sn), sc));
+}
+
+/*
+ * log|x + iy| = result + *lo.  Zero, infinite and NaN operands are left to
+ * the caller.
+ */
+vdouble static INLINE
+__cmplx_logabs_d(vdouble const x, vdouble const y, int const precise,
+                 vdouble *lo)
+{
+    vdouble m, n, sc, e, p, q, h, l, r, rl, t;
+    vopmask big, small;
+
+    m = vmax_vd_vd_vd(vabs_vd_vd(x), vabs_vd_vd(y));
+    n = vmin_vd_vd_vd(vabs_vd_vd(x), vabs_vd_vd(y));
+    big = vgt_vo_vd_vd(m, vcast_vd_d(CMPLX_D_BIG));
+    small = vlt_vo_vd_vd(m, vcast_vd_d(CMPLX_D_SMALL));
+    sc = vsel_vd_vo_vd_vd(big, vcast_vd_d(CMPLX_D_DOWN),
+             vsel_vd_vo_vd_vd(small, vcast_vd_d(CMPLX_D_UP), vcast_vd_d(1.0)));
+    e = vsel_vd_vo_vd_vd(big, vcast_vd_d(CMPLX_D_SCALE),
+             vsel_vd_vo_vd_vd(small, vcast_vd_d(-CMPLX_D_SCALE), vcast_vd_d(0.0)));
+    m = vmul_vd_vd_vd(m, sc);
+    n = vmul_vd_vd_vd(n, sc);
+
+    /* h + l = m**2 + n**2; m**2 >= n**2, so the error of the sum is exact. */
+    p = vmul_vd_vd_vd(m, m);
+    q = vmul_vd_vd_vd(n, n);
+    h = vadd_vd_vd_vd(p, q);
+    if (precise == CMPLX_PRECISE) {
+        r = __pow_log_d(h, &rl);
+    } else {
+        r = __log_kernel_d(h, CMPLX_CLASS(precise, LOG), &rl);
+    }
+    l = vadd_vd_vd_vd(vsub_vd_vd_vd(p, h), q);
+    l = vadd_vd_vd_vd(l, vfma_vd_vd_vd_vd(m, m, vneg_vd_vd(p)));
+    l = vadd_vd_vd_vd(l, vfma_vd_vd_vd_vd(n, n, vneg_vd_vd(q)));
+    rl = vadd_vd_vd_vd(rl, vdiv_vd_vd_vd(l, h));
+
+    /*
+     * log|z| = log(h + l)/2 + e*ln2.  e*ln2_hi is exact and, unless e is
+     * zero, larger than |r|/2.
+     */
+    r = vmul_vd_vd_vd(r, vcast_vd_d(0.5));
+    rl = vfma_vd_vd_vd_vd(rl, vcast_vd_d(0.5), vmul_vd_vd_vd(e, vcast_vd_d(L2L)));
+    e = vmul_vd_vd_vd(e, vcast_vd_d(L2U));
+    t = vadd_vd_vd_vd(e, r);
+    *lo = vadd_vd_vd_vd(vsub_vd_vd_vd(r, vsub_vd_vd_vd(t, e)), rl);
+    return t;
+}
+
+/*
+ * Division
+ */
+
+void static INLINE
+__cmplx_div_d_vec(vdouble const a, vdouble const b, vdouble const c,
+                  vdouble const d, int const precise, vdouble *re, vdouble *im)
+{
+    vdouble u, v, s, t, r, den, e, f, ac, ad;
+    vopmask o, nan;
+
+    /* (a + ib)/(c + id) with the roles of c and d chosen so |v| <= |u|. */
+    o = vge_vo_vd_vd(vabs_vd_vd(c), vabs_vd_vd(d));
+    u = vsel_vd_vo_vd_vd(o, c, d);
+    v = vsel_vd_vo_vd_vd(o, d, c);
+    s = vsel_vd_vo_vd_vd(o, a, b);
+    t = vsel_vd_vo_vd_vd(o, b, a);
+
+    r = vdiv_vd_vd_vd(v, u);
+    den = vfma_vd_vd_vd_vd(v, r, u);
+    if (precise != CMPLX_PRECISE) {
+        den = vrec_vd_vd(den);
+        e = vmul_vd_vd_vd(vfma_vd_vd_vd_vd(t, r, s), den);
+        f = vmul_vd_vd_vd(vfmanp_vd_vd_vd_vd(s, r, t), den);
+    } else {
+        vopmask rzero = veq_vo_vd_vd(r, vcast_vd_d(0.0));
+
+        /* A ratio that underflowed is folded in after the division. */
+        e = vsel_vd_vo_vd_vd(rzero,
+                vfma_vd_vd_vd_vd(v, vdiv_vd_vd_vd(t, u), s),
+                vfma_vd_vd_vd_vd(t, r, s));
+        f = vsel_vd_vo_vd_vd(rzero,
+                vfmanp_vd_vd_vd_vd(v, vdiv_vd_vd_vd(s, u), t),
+                vfmanp_vd_vd_vd_vd(s, r, t));
+        e = vdiv_vd_vd_vd(e, den);
+        f = vdiv_vd_vd_vd(f, den);
+    }
+    f = vsel_vd_vo_vd_vd(o, f, vneg_vd_vd(f));
+
+    if (precise == CMPLX_PRECISE) {
+        nan = vand_vo_vo_vo(visnan_vo_vd(e), visnan_vo_vd(f));
+        if (__builtin_expect(!vtestz_i_vo(nan), 0)) {
+            vdouble a1, b1, c1, d1, inf;
+            vopmask o1, o2, o3;
+
+            /* nonzero/zero */
+            inf = __cmplx_copysign_d(vcast_vd_d(INFINITY), c);
+            o1 = vand_vo_vo_vo(veq_vo_vd_vd(c, vcast_vd_d(0.0)),
+                               veq_vo_vd_vd(d, vcast_vd_d(0.0)));
+            o1 = vandnot_vo_vo_vo(vand_vo_vo_vo(visnan_vo_vd(a),
+                                                visnan_vo_vd(b)), o1);
+            ac = vmul_vd_vd_vd(inf, a);
+            ad = vmul_vd_vd_vd(inf, b);
+
+            /* infinite/finite */
+            o2 = vand_vo_vo_vo(vor_vo_vo_vo(visinf_vo_vd(a), visinf_vo_vd(b)),
+                    vand_vo_vo_vo(__cmplx_isfinite_d(c), __cmplx_isfinite_d(d)));
+            a1 = __cmplx_copysign_d(vsel_vd_vo_vd_vd(visinf_vo_vd(a),
+                                    vcast_vd_d(1.0), vcast_vd_d(0.0)), a);
+            b1 = __cmplx_copysign_d(vsel_vd_vo_vd_vd(visinf_vo_vd(b),
+                                    vcast_vd_d(1.0), vcast_vd_d(0.0)), b);
+            ac = vsel_vd_vo_vd_vd(o2, vmul_vd_vd_vd(vcast_vd_d(INFINITY),
+                     vfma_vd_vd_vd_vd(a1, c, vmul_vd_vd_vd(b1, d))), ac);
+            ad = vsel_vd_vo_vd_vd(o2, vmul_vd_vd_vd(vcast_vd_d(INFINITY),
+                     vfmapn_vd_vd_vd_vd(b1, c, vmul_vd_vd_vd(a1, d))), ad);
+
+            /* finite/infinite */
+            o3 = vand_vo_vo_vo(vor_vo_vo_vo(visinf_vo_vd(c), visinf_vo_vd(d)),
+                    vand_vo_vo_vo(__cmplx_isfinite_d(a), __cmplx_isfinite_d(b)));
+            c1 = __cmplx_copysign_d(vsel_vd_vo_vd_vd(visinf_vo_vd(c),
+                                    vcast_vd_d(1.0), vcast_vd_d(0.0)), c);
+            d1 = __cmplx_copysign_d(vsel_vd_vo_vd_vd(visinf_vo_vd(d),
+                                    vcast_vd_d(1.0), vcast_vd_d(0.0)), d);
+            ac = vsel_vd_vo_vd_vd(o3, vmul_vd_vd_vd(vcast_vd_d(0.0),
+                     vfma_vd_vd_vd_vd(a, c1, vmul_vd_vd_vd(b, d1))), ac);
+            ad = vsel_vd_vo_vd_vd(o3, vmul_vd_vd_vd(vcast_vd_d(0.0),
+                     vfmapn_vd_vd_vd_vd(b, c1, vmul_vd_vd_vd(a, d1))), ad);
+
+            o1 = vand_vo_vo_vo(nan, vor_vo_vo_vo(o1, vor_vo_vo_vo(o2, o3)));
+            e = vsel_vd_vo_vd_vd(o1, ac, e);
+            f = vsel_vd_vo_vd_vd(o1, ad, f);
+        }
+    }
+    *re = e;
+    *im = f;
+}
+
+/*
+ * Square root
+ */
+
+void static INLINE
+__cmplx_sqrt_d_vec(vdouble const x, vdouble const y, int const precise,
+                   vdouble *re, vdouble *im)
+{
+    vdouble ax, ay, m, sc, sq, w, t, q;
+    vopmask big, small, o;
+
+    ax = vabs_vd_vd(x);
+    ay = vabs_vd_vd(y);
+    m = vmax_vd_vd_vd(ax, ay);
+    big = vgt_vo_vd_vd(m, vcast_vd_d(CMPLX_D_BIG));
+    small = vlt_vo_vd_vd(m, vcast_vd_d(CMPLX_D_SMALL));
+    sc = vsel_vd_vo_vd_vd(big, vcast_vd_d(CMPLX_D_DOWN),
+             vsel_vd_vo_vd_vd(small, vcast_vd_d(CMPLX_D_UP), vcast_vd_d(1.0)));
+    sq = vsel_vd_vo_vd_vd(big, vcast_vd_d(CMPLX_D_SQUP),
+             vsel_vd_vo_vd_vd(small, vcast_vd_d(CMPLX_D_SQDOWN), vcast_vd_d(1.0)));
+    ax = vmul_vd_vd_vd(ax, sc);
+    ay = vmul_vd_vd_vd(ay, sc);
+
+    /* t = sqrt((|x| + |z|)/2) and q = |y|/(2t), both of the scaled z. */
+    w = vsqrt_vd_vd(vfma_vd_vd_vd_vd(ax, ax, vmul_vd_vd_vd(ay, ay)));
+    t = vsqrt_vd_vd(vmul_vd_vd_vd(vadd_vd_vd_vd(ax, w), vcast_vd_d(0.5)));
+    q = vdiv_vd_vd_vd(ay, vadd_vd_vd_vd(t, t));
+    t = vmul_vd_vd_vd(t, sq);
+    q = vmul_vd_vd_vd(q, sq);
+
+    o = vlt_vo_vd_vd(x, vcast_vd_d(0.0));
+    *re = vsel_vd_vo_vd_vd(o, q, t);
+    *im = __cmplx_copysign_d(vsel_vd_vo_vd_vd(o, t, q), y);
+
+    /* sqrt(+-0 + iy) for y = +-0 */
+    o = veq_vo_vd_vd(m, vcast_vd_d(0.0));
+    *re = vsel_vd_vo_vd_vd(o, vcast_vd_d(0.0), *re);
+    *im = vsel_vd_vo_vd_vd(o, y, *im);
+
+    if (precise == CMPLX_PRECISE) {
+        o = vor_vo_vo_vo(visnan_vo_vd(x), visnan_vo_vd(y));
+        *re = vsel_vd_vo_vd_vd(o, vadd_vd_vd_vd(x, y), *re);
+        *im = vsel_vd_vo_vd_vd(o, vadd_vd_vd_vd(x, y), *im);
+        o = vand_vo_vo_vo(visinf_vo_vd(x), visnan_vo_vd(y));
+        *re = vsel_vd_vo_vd_vd(vand_vo_vo_vo(o, vgt_vo_vd_vd(x, vcast_vd_d(0.0))),
+                               x, *re);
+        *im = vsel_vd_vo_vd_vd(vand_vo_vo_vo(o, vlt_vo_vd_vd(x, vcast_vd_d(0.0))),
+                               vcast_vd_d(INFINITY), *im);
+        o = visinf_vo_vd(y);
+        *re = vsel_vd_vo_vd_vd(o, vcast_vd_d(INFINITY), *re);
+        *im = vsel_vd_vo_vd_vd(o, y, *im);
+    }
+}
+
+/*
+ * Exponential
+ */
+
+void static INLINE
+__cmplx_exp_d_vec(vdouble const x, vdouble const y, int const precise,
+                  vdouble *re, vdouble *im)
+{
+    vopmask o;
+
+    __cmplx_exp_kernel_d(x, vcast_vd_d(0.0), y, vcast_vd_d(0.0), precise,
+                         re, im);
+
+    /* exp(+-inf + iy) for infinite or NaN y */
+    o = vand_vo_vo_vo(visinf_vo_vd(x),
+                      vor_vo_vo_vo(visinf_vo_vd(y), visnan_vo_vd(y)));
+    *re = vsel_vd_vo_vd_vd(o, vsel_vd_vo_vd_vd(vgt_vo_vd_vd(x, vcast_vd_d(0.0)),
+                           x, vcast_vd_d(0.0)), *re);
+    *im = vsel_vd_vo_vd_vd(o, vsel_vd_vo_vd_vd(vgt_vo_vd_vd(x, vcast_vd_d(0.0)),
+                           vcast_vd_d(NAN), vcast_vd_d(0.0)), *im);
+
+    o = visnan_vo_vd(x);
+    *re = vsel_vd_vo_vd_vd(o, x, *re);
+    *im = vsel_vd_vo_vd_vd(o, x, *im);
+
+    /* exp(x + i0) is real, even for NaN x. */
+    *im = vsel_vd_vo_vd_vd(veq_vo_vd_vd(y, vcast_vd_d(0.0)), y, *im);
+}
+
+/*
+ * Logarithm
+ */
+
+void static INLINE
+__cmplx_log_d_vec(vdouble const x, vdouble const y, int const precise,
+                  vdouble *re, vdouble *im)
+{
+    vdouble l;
+    vopmask o;
+
+    *re = __cmplx_logabs_d(x, y, precise, &l);
+    *re = vadd_vd_vd_vd(*re, l);
+    *im = __atan2_d_vec(y, x, CMPLX_CLASS(precise, ATAN));
+
+    o = vand_vo_vo_vo(veq_vo_vd_vd(x, vcast_vd_d(0.0)),
+                      veq_vo_vd_vd(y, vcast_vd_d(0.0)));
+    *re = vsel_vd_vo_vd_vd(o, vcast_vd_d(-INFINITY), *re);
+    o = vor_vo_vo_vo(visnan_vo_vd(x), visnan_vo_vd(y));
+    *re = vsel_vd_vo_vd_vd(o, vadd_vd_vd_vd(x, y), *re);
+    o = vor_vo_vo_vo(visinf_vo_vd(x), visinf_vo_vd(y));
+    *re = vsel_vd_vo_vd_vd(o, vcast_vd_d(INFINITY), *re);
+}
+
+/*
+ * Power
+ */
+
+void static INLINE
+__cmplx_pow_d_vec(vdouble const x, vdouble const y, vdouble const wr,
+                  vdouble const wi, int const precise, vdouble *re,
+                  vdouble *im)
+{
+    vdouble lh, ll, a, xh, xl, yh, yl;
+    vopmask o;
+
+    /* w*log(z) = (lh + ll)*wr - a*wi + i*((lh + ll)*wi + a*wr) */
+    lh = __cmplx_logabs_d(x, y, precise, &ll);
+    a = __atan2_d_vec(y, x, CMPLX_CLASS(precise, ATAN));
+    if (precise == CMPLX_PRECISE) {
+        xh = __cmplx_dot_d(lh, wr, vneg_vd_vd(a), wi, &xl);
+        yh = __cmplx_dot_d(lh, wi, a, wr, &yl);
+        xl = vfma_vd_vd_vd_vd(ll, wr, xl);
+        yl = vfma_vd_vd_vd_vd(ll, wi, yl);
+    } else {
+        xh = vfmanp_vd_vd_vd_vd(a, wi, vmul_vd_vd_vd(vadd_vd_vd_vd(lh, ll), wr));
+        yh = vfma_vd_vd_vd_vd(a, wr, vmul_vd_vd_vd(vadd_vd_vd_vd(lh, ll), wi));
+        xl = vcast_vd_d(0.0);
+        yl = xl;
+    }
+
+    __cmplx_exp_kernel_d(xh, xl, yh, yl, precise, re, im);
+
+    /* z**w = 0 for z = 0 and Re(w) > 0; z**0 = 1 for every z. */
+    o = vand_vo_vo_vo(veq_vo_vd_vd(x, vcast_vd_d(0.0)),
+                      veq_vo_vd_vd(y, vcast_vd_d(0.0)));
+    o = vand_vo_vo_vo(o, vgt_vo_vd_vd(wr, vcast_vd_d(0.0)));
+    *re = vsel_vd_vo_vd_vd(o, vcast_vd_d(0.0), *re);
+    *im = vsel_vd_vo_vd_vd(o, vcast_vd_d(0.0), *im);
+    o = vand_vo_vo_vo(veq_vo_vd_vd(wr, vcast_vd_d(0.0)),
+                      veq_vo_vd_vd(wi, vcast_vd_d(0.0)));
+    *re = vsel_vd_vo_vd_vd(o, vcast_vd_d(1.0), *re);
+    *im = vsel_vd_vo_vd_vd(o, vcast_vd_d(0.0), *im);
+}
+
+#endif // __CMPLX_D_VEC_H__
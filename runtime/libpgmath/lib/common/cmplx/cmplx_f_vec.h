@@ -0,0 +1,515 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Single precision complex vector kernels: division, sqrt, exp, log and
+ * pow.
+ *
+ * Must be included after one of helperavx2_128.h, helperavx2.h or
+ * helperavx512f.h, which supply the vfloat/vdouble abstraction.  The
+ * kernels work on separate vectors of real and imaginary parts; the entry
+ * points split the interleaved (re, im) pairs of the vcs*_t types.
+ *
+ * div   Smith's algorithm: the larger of |c| and |d| is divided into the
+ *       smaller, so that neither the ratio nor the denominator can
+ *       overflow.  The precise variant divides twice instead of
+ *       multiplying by a reciprocal, recovers a ratio that underflows
+ *       (Baudin and Smith) and gives the infinities and zeros of C99
+ *       Annex G where the quotient would be NaN.
+ * sqrt  t = sqrt((|x| + |z|)/2) and y/(2t), with z scaled by an even power
+ *       of two so that neither |z| nor the sum can overflow or lose bits
+ *       to denormals.  The precise variant adds the Annex G special cases.
+ * exp   exp(x)*(cos(y) + i*sin(y)).  exp(x) = 2**n*(1 + expm1(s)) uses
+ *       the kernel of hyperbolic_vec.h, and 2**n is applied in two steps
+ *       so that e.g. exp(100)*cos(y) is finite when it should be.
+ * log   log|z| = log(|z|**2)/2, with |z|**2 formed exactly as a float
+ *       pair of a scaled z, so that log|z| stays accurate for |z| close
+ *       to 1; arg(z) comes from __atan2_f_vec.
+ * pow   exp(w*log(z)); the precise variant keeps the product in extended
+ *       precision, using the log of pow_vec.h.
+ *
+ * sin and cos share the polynomial of sin_f_vec.h: cos(y) is evaluated as
+ * -sin(y - (2k + 1)*pi/2) the same way __cos_f_vec does.
+ */
+
+#ifndef __CMPLX_F_VEC_H__
+#define __CMPLX_F_VEC_H__
+
+#include "misc.h"
+#include "atan_vec.h"
+#include "pow_vec.h"
+#include "sin_f_vec.h"
+
+#define CMPLX_FAST     0
+#define CMPLX_RELAXED  1
+#define CMPLX_PRECISE  2
+
+/* Accuracy class of the real kernels, whose classes are named alike. */
+#define CMPLX_CLASS(_p, _pfx) ((_p) == CMPLX_FAST ? _pfx##_FAST : \
+                               (_p) == CMPLX_RELAXED ? _pfx##_RELAXED : \
+                               _pfx##_PRECISE)
+
+/*
+ * |z| is scaled by 2**-+CMPLX_F_SCALE above or below 2**+-CMPLX_F_BIG, which
+ * keeps |z|**2 a normal float.
+ */
+#define CMPLX_F_BIG     0x1p+60f
+#define CMPLX_F_SMALL   0x1p-60f
+#define CMPLX_F_SCALE   90.0f
+#define CMPLX_F_DOWN    0x1p-90f
+#define CMPLX_F_UP      0x1p+90f
+#define CMPLX_F_SQDOWN  0x1p-45f
+#define CMPLX_F_SQUP    0x1p+45f
+
+/*
+ * exp(x) is only certainly out of range beyond these, as |cos(y)| and
+ * |sin(y)| can be as small as about 2**-30 for float y.
+ */
+#define CMPLX_F_XMAX    110.0f
+#define CMPLX_F_XMIN    -104.0f
+
+/* Copy the sign of x on to r. */
+vfloat static INLINE
+__cmplx_copysign_f(vfloat const r, vfloat const x)
+{
+    vmask sgn = vreinterpret_vm_vf(vcast_vf_f(-0.0f));
+
+    return vreinterpret_vf_vm(vor_vm_vm_vm(
+               vandnot_vm_vm_vm(sgn, vreinterpret_vm_vf(r)),
+               vand_vm_vm_vm(sgn, vreinterpret_vm_vf(x))));
+}
+
+/* x is neither infinite nor NaN. */
+vopmask static INLINE
+__cmplx_isfinite_f(vfloat const x)
+{
+    return vlt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(INFINITYf));
+}
+
+/* a*b + c*d = result + *lo, with both products exact. */
+vfloat static INLINE
+__cmplx_dot_f(vfloat const a, vfloat const b, vfloat const c, vfloat const d,
+              vfloat *lo)
+{
+    vfloat p, q, s, t;
+
+    p = vmul_vf_vf_vf(a, b);
+    q = vmul_vf_vf_vf(c, d);
+    s = vadd_vf_vf_vf(p, q);
+    t = vsub_vf_vf_vf(s, p);
+    *lo = vadd_vf_vf_vf(vsub_vf_vf_vf(p, vsub_vf_vf_vf(s, t)), vsub_vf_vf_vf(q, t));
+    *lo = vadd_vf_vf_vf(*lo, vfmapn_vf_vf_vf_vf(a, b, p));
+    *lo = vadd_vf_vf_vf(*lo, vfmapn_vf_vf_vf_vf(c, d, q));
+    return s;
+}
+
+/* sin(y) and cos(y). */
+void static INLINE
+__cmplx_sincos_f(vfloat const y, vfloat *s, vfloat *c)
+{
+    vfloat k, a;
+    vint2 p, h;
+    vopmask m;
+
+    k = vfma_vf_vf_vf_vf(y, vcast_vf_f(_1_OVER_PI_F), vcast_vf_f(12582912.0f));
+    h = vsll_vi2_vi2_i((vint2)k, 31);
+    k = vsub_vf_vf_vf(k, vcast_vf_f(12582912.0f));
+    a = vfma_vf_vf_vf_vf(k, vcast_vf_f(-PI_HI_F), y);
+    a = vfma_vf_vf_vf_vf(k, vcast_vf_f(-PI_MI_F), a);
+    a = vfma_vf_vf_vf_vf(k, vcast_vf_f(-PI_LO_F), a);
+    *s = __sin_kernel(a, h);
+
+    /* The sign of the kernel flips for -sin. */
+    k = vfma_vf_vf_vf_vf(y, vcast_vf_f(_1_OVER_PI_F), vcast_vf_f(-0.5f));
+    k = vadd_vf_vf_vf(k, vcast_vf_f(12582912.0f));
+    h = vsll_vi2_vi2_i((vint2)k, 31);
+    h = vxor_vi2_vi2_vi2(h, vcast_vi2_i(0x80000000));
+    k = vsub_vf_vf_vf(k, vcast_vf_f(12582912.0f));
+    k = vfma_vf_vf_vf_vf(vcast_vf_f(2.0f), k, vcast_vf_f(1.0f));
+    a = vfma_vf_vf_vf_vf(k, vcast_vf_f(-0.5f * PI_HI_F), y);
+    a = vfma_vf_vf_vf_vf(k, vcast_vf_f(-0.5f * PI_MI_F), a);
+    a = vfma_vf_vf_vf_vf(k, vcast_vf_f(-0.5f * PI_LO_F), a);
+    *c = __sin_kernel(a, h);
+
+    p = vand_vi2_vi2_vi2((vint2)y, vcast_vi2_i(0x7fffffff));
+    m = vgt_vo_vi2_vi2(p, vcast_vi2_i(0x39800000));
+    *c = vsel_vf_vo_vf_vf(m, *c, vcast_vf_f(1.0f));
+
+    m = vgt_vo_vi2_vi2(p, (vint2)vcast_vf_f(THRESHOLD_F));
+    if (__builtin_expect(!vtestz_i_vo(m), 0)) {
+        vfloat r, rs, rc;
+        vopmask ninf;
+        vmask half;
+
+        /*
+         * |y| = j*pi + r with |r| <= pi/2 and half the sign of y times
+         * (-1)**j, so cos(y) = +-sin(pi/2 - |r|) without the sign of y.
+         */
+        r = __reduction_slowpath(y, &half);
+        rs = __sin_kernel(r, half);
+        a = vsub_vf_vf_vf(vcast_vf_f(0.5f * PI_HI_F), vabs_vf_vf(r));
+        a = vadd_vf_vf_vf(a, vcast_vf_f(0.5f * PI_MI_F));
+        h = vxor_vi2_vi2_vi2((vint2)half,
+                             vand_vi2_vi2_vi2((vint2)y, vcast_vi2_i(0x80000000)));
+        rc = __sin_kernel(a, h);
+        ninf = vgt_vo_vi2_vi2(vcast_vi2_i(0x7f800000), p);
+        rs = vsel_vf_vo_vf_vf(ninf, rs, vmul_vf_vf_vf(y, vcast_vf_f(0.0f)));
+        rc = vsel_vf_vo_vf_vf(ninf, rc, vmul_vf_vf_vf(y, vcast_vf_f(0.0f)));
+        *s = vsel_vf_vo_vf_vf(m, rs, *s);
+        *c = vsel_vf_vo_vf_vf(m, rc, *c);
+    }
+}
+
+/*
+ * exp(x + xl)*(cos(y + yl) + i*sin(y + yl)) for finite or infinite x,
+ * without the special cases of NaN x.  yl is only used by the precise
+ * variants.
+ */
+void static INLINE
+__cmplx_exp_kernel_f(vfloat x, vfloat xl, vfloat const y, vfloat const yl,
+                     int const precise, vfloat *re, vfloat *im)
+{
+    vfloat k, s, sl, t, u, ul, e, sn, cs, sc;
+    vopmask o;
+
+    o = vand_vo_vo_vo(vlt_vo_vf_vf(x, vcast_vf_f(CMPLX_F_XMAX)),
+                      vgt_vo_vf_vf(x, vcast_vf_f(CMPLX_F_XMIN)));
+    xl = vsel_vf_vo_vf_vf(o, xl, vcast_vf_f(0.0f));
+    x = vmax_vf_vf_vf(vmin_vf_vf_vf(x, vcast_vf_f(CMPLX_F_XMAX)),
+                      vcast_vf_f(CMPLX_F_XMIN));
+
+    s = __hyp_reduce_f(x, &k, &sl);
+    sl = vadd_vf_vf_vf(sl, xl);
+    t = vadd_vf_vf_vf(s, sl);
+    sl = vadd_vf_vf_vf(vsub_vf_vf_vf(s, t), sl);
+    s = t;
+    u = __hyp_expm1_kernel_f(s, sl, CMPLX_CLASS(precise, HYP), &ul);
+    e = vadd_vf_vf_vf(vcast_vf_f(1.0f), u);
+    if (precise == CMPLX_PRECISE) {
+        ul = vadd_vf_vf_vf(vadd_vf_vf_vf(vsub_vf_vf_vf(vcast_vf_f(1.0f), e), u),
+                           ul);
+        e = vadd_vf_vf_vf(e, ul);
+    }
+
+    __cmplx_sincos_f(y, &sn, &cs);
+    if (precise == CMPLX_PRECISE) {
+        t = sn;
+        sn = vfma_vf_vf_vf_vf(yl, cs, sn);
+        cs = vfmanp_vf_vf_vf_vf(yl, t, cs);
+    }
+
+    /* e*2**(n -+ POW_F_SCALE) is exact; the second step rounds once. */
+    o = vgt_vo_vf_vf(x, vcast_vf_f(0.0f));
+    k = vadd_vf_vf_vf(k, vsel_vf_vo_vf_vf(o, vcast_vf_f(-POW_F_SCALE),
+                                          vcast_vf_f(POW_F_SCALE)));
+    e = vmul_vf_vf_vf(e, __hyp_pow2_f(k, 0.0f));
+    sc = vsel_vf_vo_vf_vf(o, vcast_vf_f(POW_F_POW2SCALE),
+                          vcast_vf_f(1.0 / POW_F_POW2SCALE));
+    /*
+     * When e is scaled down, sin and cos are scaled up first instead, so
+     * that a subnormal sin(y) or cos(y) is not lost before e is applied.
+     */
+    *re = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(vmul_vf_vf_vf(cs, sc), e),
+                           vmul_vf_vf_vf(vmul_vf_vf_vf(e, cs), sc));
+    *im = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(vmul_vf_vf_vf(sn, sc), e),
+                           vmul_vf_vf_vf(vmul_vf_vf_vf(e, sn), sc));
+}
+
+/*
+ * log|x + iy| = result + *lo.  Zero, infinite and NaN operands are left to
+ * the caller.
+ */
+vfloat static INLINE
+__cmplx_logabs_f(vfloat const x, vfloat const y, int const precise,
+                 vfloat *lo)
+{
+    vfloat m, n, sc, e, p, q, h, l, r, rl, t;
+    vopmask big, small;
+
+    m = vmax_vf_vf_vf(vabs_vf_vf(x), vabs_vf_vf(y));
+    n = vmin_vf_vf_vf(vabs_vf_vf(x), vabs_vf_vf(y));
+    big = vgt_vo_vf_vf(m, vcast_vf_f(CMPLX_F_BIG));
+    small = vlt_vo_vf_vf(m, vcast_vf_f(CMPLX_F_SMALL));
+    sc = vsel_vf_vo_vf_vf(big, vcast_vf_f(CMPLX_F_DOWN),
+             vsel_vf_vo_vf_vf(small, vcast_vf_f(CMPLX_F_UP), vcast_vf_f(1.0f)));
+    e = vsel_vf_vo_vf_vf(big, vcast_vf_f(CMPLX_F_SCALE),
+             vsel_vf_vo_vf_vf(small, vcast_vf_f(-CMPLX_F_SCALE), vcast_vf_f(0.0f)));
+    m = vmul_vf_vf_vf(m, sc);
+    n = vmul_vf_vf_vf(n, sc);
+
+    /* h + l = m**2 + n**2; m**2 >= n**2, so the error of the sum is exact. */
+    p = vmul_vf_vf_vf(m, m);
+    q = vmul_vf_vf_vf(n, n);
+    h = vadd_vf_vf_vf(p, q);
+    if (precise == CMPLX_PRECISE) {
+        r = __pow_log_f(h, &rl);
+    } else {
+        r = __log_kernel_f(h, CMPLX_CLASS(precise, LOG), &rl);
+    }
+    l = vadd_vf_vf_vf(vsub_vf_vf_vf(p, h), q);
+    l = vadd_vf_vf_vf(l, vfma_vf_vf_vf_vf(m, m, vneg_vf_vf(p)));
+    l = vadd_vf_vf_vf(l, vfma_vf_vf_vf_vf(n, n, vneg_vf_vf(q)));
+    rl = vadd_vf_vf_vf(rl, vdiv_vf_vf_vf(l, h));
+
+    /*
+     * log|z| = log(h + l)/2 + e*ln2.  e*ln2_hi is exact and, unless e is
+     * zero, larger than |r|/2.
+     */
+    r = vmul_vf_vf_vf(r, vcast_vf_f(0.5f));
+    rl = vfma_vf_vf_vf_vf(rl, vcast_vf_f(0.5f), vmul_vf_vf_vf(e, vcast_vf_f(L2Lf)));
+    e = vmul_vf_vf_vf(e, vcast_vf_f(L2Uf));
+    t = vadd_vf_vf_vf(e, r);
+    *lo = vadd_vf_vf_vf(vsub_vf_vf_vf(r, vsub_vf_vf_vf(t, e)), rl);
+    return t;
+}
+
+/*
+ * Division
+ */
+
+void static INLINE
+__cmplx_div_f_vec(vfloat const a, vfloat const b, vfloat const c,
+                  vfloat const d, int const precise, vfloat *re, vfloat *im)
+{
+    vfloat u, v, s, t, r, den, e, f, ac, ad;
+    vopmask o, nan;
+
+    /* (a + ib)/(c + id) with the roles of c and d chosen so |v| <= |u|. */
+    o = vge_vo_vf_vf(vabs_vf_vf(c), vabs_vf_vf(d));
+    u = vsel_vf_vo_vf_vf(o, c, d);
+    v = vsel_vf_vo_vf_vf(o, d, c);
+    s = vsel_vf_vo_vf_vf(o, a, b);
+    t = vsel_vf_vo_vf_vf(o, b, a);
+
+    r = vdiv_vf_vf_vf(v, u);
+    den = vfma_vf_vf_vf_vf(v, r, u);
+    if (precise != CMPLX_PRECISE) {
+        den = vrec_vf_vf(den);
+        e = vmul_vf_vf_vf(vfma_vf_vf_vf_vf(t, r, s), den);
+        f = vmul_vf_vf_vf(vfmanp_vf_vf_vf_vf(s, r, t), den);
+    } else {
+        vopmask rzero = veq_vo_vf_vf(r, vcast_vf_f(0.0f));
+
+        /* A ratio that underflowed is folded in after the division. */
+        e = vsel_vf_vo_vf_vf(rzero,
+                vfma_vf_vf_vf_vf(v, vdiv_vf_vf_vf(t, u), s),
+                vfma_vf_vf_vf_vf(t, r, s));
+        f = vsel_vf_vo_vf_vf(rzero,
+                vfmanp_vf_vf_vf_vf(v, vdiv_vf_vf_vf(s, u), t),
+                vfmanp_vf_vf_vf_vf(s, r, t));
+        e = vdiv_vf_vf_vf(e, den);
+        f = vdiv_vf_vf_vf(f, den);
+    }
+    f = vsel_vf_vo_vf_vf(o, f, vneg_vf_vf(f));
+
+    if (precise == CMPLX_PRECISE) {
+        nan = vand_vo_vo_vo(visnan_vo_vf(e), visnan_vo_vf(f));
+        if (__builtin_expect(!vtestz_i_vo(nan), 0)) {
+            vfloat a1, b1, c1, d1, inf;
+            vopmask o1, o2, o3;
+
+            /* nonzero/zero */
+            inf = __cmplx_copysign_f(vcast_vf_f(INFINITYf), c);
+            o1 = vand_vo_vo_vo(veq_vo_vf_vf(c, vcast_vf_f(0.0f)),
+                               veq_vo_vf_vf(d, vcast_vf_f(0.0f)));
+            o1 = vandnot_vo_vo_vo(vand_vo_vo_vo(visnan_vo_vf(a),
+                                                visnan_vo_vf(b)), o1);
+            ac = vmul_vf_vf_vf(inf, a);
+            ad = vmul_vf_vf_vf(inf, b);
+
+            /* infinite/finite */
+            o2 = vand_vo_vo_vo(vor_vo_vo_vo(visinf_vo_vf(a), visinf_vo_vf(b)),
+                    vand_vo_vo_vo(__cmplx_isfinite_f(c), __cmplx_isfinite_f(d)));
+            a1 = __cmplx_copysign_f(vsel_vf_vo_vf_vf(visinf_vo_vf(a),
+                                    vcast_vf_f(1.0f), vcast_vf_f(0.0f)), a);
+            b1 = __cmplx_copysign_f(vsel_vf_vo_vf_vf(visinf_vo_vf(b),
+                                    vcast_vf_f(1.0f), vcast_vf_f(0.0f)), b);
+            ac = vsel_vf_vo_vf_vf(o2, vmul_vf_vf_vf(vcast_vf_f(INFINITYf),
+                     vfma_vf_vf_vf_vf(a1, c, vmul_vf_vf_vf(b1, d))), ac);
+            ad = vsel_vf_vo_vf_vf(o2, vmul_vf_vf_vf(vcast_vf_f(INFINITYf),
+                     vfmapn_vf_vf_vf_vf(b1, c, vmul_vf_vf_vf(a1, d))), ad);
+
+            /* finite/infinite */
+            o3 = vand_vo_vo_vo(vor_vo_vo_vo(visinf_vo_vf(c), visinf_vo_vf(d)),
+                    vand_vo_vo_vo(__cmplx_isfinite_f(a), __cmplx_isfinite_f(b)));
+            c1 = __cmplx_copysign_f(vsel_vf_vo_vf_vf(visinf_vo_vf(c),
+                                    vcast_vf_f(1.0f), vcast_vf_f(0.0f)), c);
+            d1 = __cmplx_copysign_f(vsel_vf_vo_vf_vf(visinf_vo_vf(d),
+                                    vcast_vf_f(1.0f), vcast_vf_f(0.0f)), d);
+            ac = vsel_vf_vo_vf_vf(o3, vmul_vf_vf_vf(vcast_vf_f(0.0f),
+                     vfma_vf_vf_vf_vf(a, c1, vmul_vf_vf_vf(b, d1))), ac);
+            ad = vsel_vf_vo_vf_vf(o3, vmul_vf_vf_vf(vcast_vf_f(0.0f),
+                     vfmapn_vf_vf_vf_vf(b, c1, vmul_vf_vf_vf(a, d1))), ad);
+
+            o1 = vand_vo_vo_vo(nan, vor_vo_vo_vo(o1, vor_vo_vo_vo(o2, o3)));
+            e = vsel_vf_vo_vf_vf(o1, ac, e);
+            f = vsel_vf_vo_vf_vf(o1, ad, f);
+        }
+    }
+    *re = e;
+    *im = f;
+}
+
+/*
+ * Square root
+ */
+
+void static INLINE
+__cmplx_sqrt_f_vec(vfloat const x, vfloat const y, int const precise,
+                   vfloat *re, vfloat *im)
+{
+    vfloat ax, ay, m, sc, sq, w, t, q;
+    vopmask big, small, o;
+
+    ax = vabs_vf_vf(x);
+    ay = vabs_vf_vf(y);
+    m = vmax_vf_vf_vf(ax, ay);
+    big = vgt_vo_vf_vf(m, vcast_vf_f(CMPLX_F_BIG));
+    small = vlt_vo_vf_vf(m, vcast_vf_f(CMPLX_F_SMALL));
+    sc = vsel_vf_vo_vf_vf(big, vcast_vf_f(CMPLX_F_DOWN),
+             vsel_vf_vo_vf_vf(small, vcast_vf_f(CMPLX_F_UP), vcast_vf_f(1.0f)));
+    sq = vsel_vf_vo_vf_vf(big, vcast_vf_f(CMPLX_F_SQUP),
+             vsel_vf_vo_vf_vf(small, vcast_vf_f(CMPLX_F_SQDOWN), vcast_vf_f(1.0f)));
+    ax = vmul_vf_vf_vf(ax, sc);
+    ay = vmul_vf_vf_vf(ay, sc);
+
+    /* t = sqrt((|x| + |z|)/2) and q = |y|/(2t), both of the scaled z. */
+    w = vsqrt_vf_vf(vfma_vf_vf_vf_vf(ax, ax, vmul_vf_vf_vf(ay, ay)));
+    t = vsqrt_vf_vf(vmul_vf_vf_vf(vadd_vf_vf_vf(ax, w), vcast_vf_f(0.5f)));
+    q = vdiv_vf_vf_vf(ay, vadd_vf_vf_vf(t, t));
+    t = vmul_vf_vf_vf(t, sq);
+    q = vmul_vf_vf_vf(q, sq);
+
+    o = vlt_vo_vf_vf(x, vcast_vf_f(0.0f));
+    *re = vsel_vf_vo_vf_vf(o, q, t);
+    *im = __cmplx_copysign_f(vsel_vf_vo_vf_vf(o, t, q), y);
+
+    /* sqrt(+-0 + iy) for y = +-0 */
+    o = veq_vo_vf_vf(m, vcast_vf_f(0.0f));
+    *re = vsel_vf_vo_vf_vf(o, vcast_vf_f(0.0f), *re);
+    *im = vsel_vf_vo_vf_vf(o, y, *im);
+
+    if (precise == CMPLX_PRECISE) {
+        o = vor_vo_vo_vo(visnan_vo_vf(x), visnan_vo_vf(y));
+        *re = vsel_vf_vo_vf_vf(o, vadd_vf_vf_vf(x, y), *re);
+        *im = vsel_vf_vo_vf_vf(o, vadd_vf_vf_vf(x, y), *im);
+        o = vand_vo_vo_vo(visinf_vo_vf(x), visnan_vo_vf(y));
+        *re = vsel_vf_vo_vf_vf(vand_vo_vo_vo(o, vgt_vo_vf_vf(x, vcast_vf_f(0.0f))),
+                               x, *re);
+        *im = vsel_vf_vo_vf_vf(vand_vo_vo_vo(o, vlt_vo_vf_vf(x, vcast_vf_f(0.0f))),
+                               vcast_vf_f(INFINITYf), *im);
+        o = visinf_vo_vf(y);
+        *re = vsel_vf_vo_vf_vf(o, vcast_vf_f(INFINITYf), *re);
+        *im = vsel_vf_vo_vf_vf(o, y, *im);
+    }
+}
+
+/*
+ * Exponential
+ */
+
+void static INLINE
+__cmplx_exp_f_vec(vfloat const x, vfloat const y, int const precise,
+                  vfloat *re, vfloat *im)
+{
+    vopmask o;
+
+    __cmplx_exp_kernel_f(x, vcast_vf_f(0.0f), y, vcast_vf_f(0.0f), precise,
+                         re, im);
+
+    /* exp(+-inf + iy) for infinite or NaN y */
+    o = vand_vo_vo_vo(visinf_vo_vf(x),
+                      vor_vo_vo_vo(visinf_vo_vf(y), visnan_vo_vf(y)));
+    *re = vsel_vf_vo_vf_vf(o, vsel_vf_vo_vf_vf(vgt_vo_vf_vf(x, vcast_vf_f(0.0f)),
+                           x, vcast_vf_f(0.0f)), *re);
+    *im = vsel_vf_vo_vf_vf(o, vsel_vf_vo_vf_vf(vgt_vo_vf_vf(x, vcast_vf_f(0.0f)),
+                           vcast_vf_f(NANf), vcast_vf_f(0.0f)), *im);
+
+    o = visnan_vo_vf(x);
+    *re = vsel_vf_vo_vf_vf(o, x, *re);
+    *im = vsel_vf_vo_vf_vf(o, x, *im);
+
+    /* exp(x + i0) is real, even for NaN x. */
+    *im = vsel_vf_vo_vf_vf(veq_vo_vf_vf(y, vcast_vf_f(0.0f)), y, *im);
+}
+
+/*
+ * Logarithm
+ */
+
+void static INLINE
+__cmplx_log_f_vec(vfloat const x, vfloat const y, int const precise,
+                  vfloat *re, vfloat *im)
+{
+    vfloat l;
+    vopmask o;
+
+    *re = __cmplx_logabs_f(x, y, precise, &l);
+    *re = vadd_vf_vf_vf(*re, l);
+    *im = __atan2_f_vec(y, x, CMPLX_CLASS(precise, ATAN));
+
+    o = vand_vo_vo_vo(veq_vo_vf_vf(x, vcast_vf_f(0.0f)),
+                      veq_vo_vf_vf(y, vcast_vf_f(0.0f)));
+    *re = vsel_vf_vo_vf_vf(o, vcast_vf_f(-INFINITYf), *re);
+    o = vor_vo_vo_vo(visnan_vo_vf(x), visnan_vo_vf(y));
+    *re = vsel_vf_vo_vf_vf(o, vadd_vf_vf_vf(x, y), *re);
+    o = vor_vo_vo_vo(visinf_vo_vf(x), visinf_vo_vf(y));
+    *re = vsel_vf_vo_vf_vf(o, vcast_vf_f(INFINITYf), *re);
+}
+
+/*
+ * Power
+ */
+
+void static INLINE
+__cmplx_pow_f_vec(vfloat const x, vfloat const y, vfloat const wr,
+                  vfloat const wi, int const precise, vfloat *re,
+                  vfloat *im)
+{
+    vfloat lh, ll, a, xh, xl, yh, yl;
+    vopmask o;
+
+    /* w*log(z) = (lh + ll)*wr - a*wi + i*((lh + ll)*wi + a*wr) */
+    lh = __cmplx_logabs_f(x, y, precise, &ll);
+    a = __atan2_f_vec(y, x, CMPLX_CLASS(precise, ATAN));
+    if (precise == CMPLX_PRECISE) {
+        xh = __cmplx_dot_f(lh, wr, vneg_vf_vf(a), wi, &xl);
+        yh = __cmplx_dot_f(lh, wi, a, wr, &yl);
+        xl = vfma_vf_vf_vf_vf(ll, wr, xl);
+        yl = vfma_vf_vf_vf_vf(ll, wi, yl);
+    } else {
+        xh = vfmanp_vf_vf_vf_vf(a, wi, vmul_vf_vf_vf(vadd_vf_vf_vf(lh, ll), wr));
+        yh = vfma_vf_vf_vf_vf(a, wr, vmul_vf_vf_vf(vadd_vf_vf_vf(lh, ll), wi));
+        xl = vcast_vf_f(0.0f);
+        yl = xl;
+    }
+
+    __cmplx_exp_kernel_f(xh, xl, yh, yl, precise, re, im);
+
+    /* z**w = 0 for z = 0 and Re(w) > 0; z**0 = 1 for every z. */
+    o = vand_vo_vo_vo(veq_vo_vf_vf(x, vcast_vf_f(0.0f)),
+                      veq_vo_vf_vf(y, vcast_vf_f(0.0f)));
+    o = vand_vo_vo_vo(o, vgt_vo_vf_vf(wr, vcast_vf_f(0.0f)));
+    *re = vsel_vf_vo_vf_vf(o, vcast_vf_f(0.0f), *re);
+    *im = vsel_vf_vo_vf_vf(o, vcast_vf_f(0.0f), *im);
+    o = vand_vo_vo_vo(veq_vo_vf_vf(wr, vcast_vf_f(0.0f)),
+                      veq_vo_vf_vf(wi, vcast_vf_f(0.0f)));
+    *re = vsel_vf_vo_vf_vf(o, vcast_vf_f(1.0f), *re);
+    *im = vsel_vf_vo_vf_vf(o, vcast_vf_f(0.0f), *im);
+}
+
+#endif // __CMPLX_F_VEC_H__
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Single precision complex division, sqrt, exp, log and pow on __m128.  The
+ * two (re, im) pairs are duplicated into the upper lanes.
+ */
+
+#ifndef __CMPLX_C_AVX2_2_H__
+#define __CMPLX_C_AVX2_2_H__
+
+#include <immintrin.h>
+#define CONFIG 1
+#include "helperavx2_128.h"
+#include "cmplx_f_vec.h"
+
+extern "C" __m128 __attribute__ ((noinline)) __fc_div_2_avx2(__m128 const a, __m128 const b);
+extern "C" __m128 __attribute__ ((noinline)) __rc_div_2_avx2(__m128 const a, __m128 const b);
+extern "C" __m128 __attribute__ ((noinline)) __pc_div_2_avx2(__m128 const a, __m128 const b);
+extern "C" __m128 __attribute__ ((noinline)) __fc_sqrt_2_avx2(__m128 const a);
+extern "C" __m128 __attribute__ ((noinline)) __rc_sqrt_2_avx2(__m128 const a);
+extern "C" __m128 __attribute__ ((noinline)) __pc_sqrt_2_avx2(__m128 const a);
+extern "C" __m128 __attribute__ ((noinline)) __fc_exp_2_avx2(__m128 const a);
+extern "C" __m128 __attribute__ ((noinline)) __rc_exp_2_avx2(__m128 const a);
+extern "C" __m128 __attribute__ ((noinline)) __pc_exp_2_avx2(__m128 const a);
+extern "C" __m128 __attribute__ ((noinline)) __fc_log_2_avx2(__m128 const a);
+extern "C" __m128 __attribute__ ((noinline)) __rc_log_2_avx2(__m128 const a);
+extern "C" __m128 __attribute__ ((noinline)) __pc_log_2_avx2(__m128 const a);
+extern "C" __m128 __attribute__ ((noinline)) __fc_pow_2_avx2(__m128 const a, __m128 const b);
+extern "C" __m128 __attribute__ ((noinline)) __rc_pow_2_avx2(__m128 const a, __m128 const b);
+extern "C" __m128 __attribute__ ((noinline)) __pc_pow_2_avx2(__m128 const a, __m128 const b);
+
+static INLINE void
+__cmplx_split(__m128 const z, vfloat *re, vfloat *im)
+{
+    *re = _mm_shuffle_ps(z, z, _MM_SHUFFLE(2, 0, 2, 0));
+    *im = _mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+static INLINE __m128
+__cmplx_join(vfloat const re, vfloat const im)
+{
+    return _mm_unpacklo_ps(re, im);
+}
+
+static INLINE __m128
+__cmplx_div(__m128 const a, __m128 const b, int const precise)
+{
+    vfloat ar, ai, br, bi, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_split(b, &br, &bi);
+    __cmplx_div_f_vec(ar, ai, br, bi, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m128
+__cmplx_sqrt(__m128 const a, int const precise)
+{
+    vfloat ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_sqrt_f_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m128
+__cmplx_exp(__m128 const a, int const precise)
+{
+    vfloat ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_exp_f_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m128
+__cmplx_log(__m128 const a, int const precise)
+{
+    vfloat ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_log_f_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m128
+__cmplx_pow(__m128 const a, __m128 const b, int const precise)
+{
+    vfloat ar, ai, br, bi, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_split(b, &br, &bi);
+    __cmplx_pow_f_vec(ar, ai, br, bi, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+__m128 __attribute__ ((noinline))
+__fc_div_2_avx2(__m128 const a, __m128 const b)
+{
+	return __cmplx_div(a, b, CMPLX_FAST);
+}
+
+__m128 __attribute__ ((noinline))
+__rc_div_2_avx2(__m128 const a, __m128 const b)
+{
+	return __cmplx_div(a, b, CMPLX_RELAXED);
+}
+
+__m128 __attribute__ ((noinline))
+__pc_div_2_avx2(__m128 const a, __m128 const b)
+{
+	return __cmplx_div(a, b, CMPLX_PRECISE);
+}
+
+__m128 __attribute__ ((noinline))
+__fc_sqrt_2_avx2(__m128 const a)
+{
+	return __cmplx_sqrt(a, CMPLX_FAST);
+}
+
+__m128 __attribute__ ((noinline))
+__rc_sqrt_2_avx2(__m128 const a)
+{
+	return __cmplx_sqrt(a, CMPLX_RELAXED);
+}
+
+__m128 __attribute__ ((noinline))
+__pc_sqrt_2_avx2(__m128 const a)
+{
+	return __cmplx_sqrt(a, CMPLX_PRECISE);
+}
+
+__m128 __attribute__ ((noinline))
+__fc_exp_2_avx2(__m128 const a)
+{
+	return __cmplx_exp(a, CMPLX_FAST);
+}
+
+__m128 __attribute__ ((noinline))
+__rc_exp_2_avx2(__m128 const a)
+{
+	return __cmplx_exp(a, CMPLX_RELAXED);
+}
+
+__m128 __attribute__ ((noinline))
+__pc_exp_2_avx2(__m128 const a)
+{
+	return __cmplx_exp(a, CMPLX_PRECISE);
+}
+
+__m128 __attribute__ ((noinline))
+__fc_log_2_avx2(__m128 const a)
+{
+	return __cmplx_log(a, CMPLX_FAST);
+}
+
+__m128 __attribute__ ((noinline))
+__rc_log_2_avx2(__m128 const a)
+{
+	return __cmplx_log(a, CMPLX_RELAXED);
+}
+
+__m128 __attribute__ ((noinline))
+__pc_log_2_avx2(__m128 const a)
+{
+	return __cmplx_log(a, CMPLX_PRECISE);
+}
+
+__m128 __attribute__ ((noinline))
+__fc_pow_2_avx2(__m128 const a, __m128 const b)
+{
+	return __cmplx_pow(a, b, CMPLX_FAST);
+}
+
+__m128 __attribute__ ((noinline))
+__rc_pow_2_avx2(__m128 const a, __m128 const b)
+{
+	return __cmplx_pow(a, b, CMPLX_RELAXED);
+}
+
+__m128 __attribute__ ((noinline))
+__pc_pow_2_avx2(__m128 const a, __m128 const b)
+{
+	return __cmplx_pow(a, b, CMPLX_PRECISE);
+}
+
+#endif // __CMPLX_C_AVX2_2_H__
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Single precision complex division, sqrt, exp, log and pow on __m256.  The
+ * four (re, im) pairs are split into 128-bit vectors of real and imaginary
+ * parts.
+ */
+
+#ifndef __CMPLX_C_AVX2_4_H__
+#define __CMPLX_C_AVX2_4_H__
+
+#include <immintrin.h>
+#define CONFIG 1
+#include "helperavx2_128.h"
+#include "cmplx_f_vec.h"
+
+extern "C" __m256 __attribute__ ((noinline)) __fc_div_4_avx2(__m256 const a, __m256 const b);
+extern "C" __m256 __attribute__ ((noinline)) __rc_div_4_avx2(__m256 const a, __m256 const b);
+extern "C" __m256 __attribute__ ((noinline)) __pc_div_4_avx2(__m256 const a, __m256 const b);
+extern "C" __m256 __attribute__ ((noinline)) __fc_sqrt_4_avx2(__m256 const a);
+extern "C" __m256 __attribute__ ((noinline)) __rc_sqrt_4_avx2(__m256 const a);
+extern "C" __m256 __attribute__ ((noinline)) __pc_sqrt_4_avx2(__m256 const a);
+extern "C" __m256 __attribute__ ((noinline)) __fc_exp_4_avx2(__m256 const a);
+extern "C" __m256 __attribute__ ((noinline)) __rc_exp_4_avx2(__m256 const a);
+extern "C" __m256 __attribute__ ((noinline)) __pc_exp_4_avx2(__m256 const a);
+extern "C" __m256 __attribute__ ((noinline)) __fc_log_4_avx2(__m256 const a);
+extern "C" __m256 __attribute__ ((noinline)) __rc_log_4_avx2(__m256 const a);
+extern "C" __m256 __attribute__ ((noinline)) __pc_log_4_avx2(__m256 const a);
+extern "C" __m256 __attribute__ ((noinline)) __fc_pow_4_avx2(__m256 const a, __m256 const b);
+extern "C" __m256 __attribute__ ((noinline)) __rc_pow_4_avx2(__m256 const a, __m256 const b);
+extern "C" __m256 __attribute__ ((noinline)) __pc_pow_4_avx2(__m256 const a, __m256 const b);
+
+static INLINE void
+__cmplx_split(__m256 const z, vfloat *re, vfloat *im)
+{
+    __m128 lo = _mm256_castps256_ps128(z);
+    __m128 hi = _mm256_extractf128_ps(z, 1);
+
+    *re = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+    *im = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+static INLINE __m256
+__cmplx_join(vfloat const re, vfloat const im)
+{
+    __m256 z = _mm256_castps128_ps256(_mm_unpacklo_ps(re, im));
+
+    return _mm256_insertf128_ps(z, _mm_unpackhi_ps(re, im), 1);
+}
+
+static INLINE __m256
+__cmplx_div(__m256 const a, __m256 const b, int const precise)
+{
+    vfloat ar, ai, br, bi, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_split(b, &br, &bi);
+    __cmplx_div_f_vec(ar, ai, br, bi, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m256
+__cmplx_sqrt(__m256 const a, int const precise)
+{
+    vfloat ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_sqrt_f_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m256
+__cmplx_exp(__m256 const a, int const precise)
+{
+    vfloat ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_exp_f_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m256
+__cmplx_log(__m256 const a, int const precise)
+{
+    vfloat ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_log_f_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m256
+__cmplx_pow(__m256 const a, __m256 const b, int const precise)
+{
+    vfloat ar, ai, br, bi, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_split(b, &br, &bi);
+    __cmplx_pow_f_vec(ar, ai, br, bi, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+__m256 __attribute__ ((noinline))
+__fc_div_4_avx2(__m256 const a, __m256 const b)
+{
+	return __cmplx_div(a, b, CMPLX_FAST);
+}
+
+__m256 __attribute__ ((noinline))
+__rc_div_4_avx2(__m256 const a, __m256 const b)
+{
+	return __cmplx_div(a, b, CMPLX_RELAXED);
+}
+
+__m256 __attribute__ ((noinline))
+__pc_div_4_avx2(__m256 const a, __m256 const b)
+{
+	return __cmplx_div(a, b, CMPLX_PRECISE);
+}
+
+__m256 __attribute__ ((noinline))
+__fc_sqrt_4_avx2(__m256 const a)
+{
+	return __cmplx_sqrt(a, CMPLX_FAST);
+}
+
+__m256 __attribute__ ((noinline))
+__rc_sqrt_4_avx2(__m256 const a)
+{
+	return __cmplx_sqrt(a, CMPLX_RELAXED);
+}
+
+__m256 __attribute__ ((noinline))
+__pc_sqrt_4_avx2(__m256 const a)
+{
+	return __cmplx_sqrt(a, CMPLX_PRECISE);
+}
+
+__m256 __attribute__ ((noinline))
+__fc_exp_4_avx2(__m256 const a)
+{
+	return __cmplx_exp(a, CMPLX_FAST);
+}
+
+__m256 __attribute__ ((noinline))
+__rc_exp_4_avx2(__m256 const a)
+{
+	return __cmplx_exp(a, CMPLX_RELAXED);
+}
+
+__m256 __attribute__ ((noinline))
+__pc_exp_4_avx2(__m256 const a)
+{
+	return __cmplx_exp(a, CMPLX_PRECISE);
+}
+
+__m256 __attribute__ ((noinline))
+__fc_log_4_avx2(__m256 const a)
+{
+	return __cmplx_log(a, CMPLX_FAST);
+}
+
+__m256 __attribute__ ((noinline))
+__rc_log_4_avx2(__m256 const a)
+{
+	return __cmplx_log(a, CMPLX_RELAXED);
+}
+
+__m256 __attribute__ ((noinline))
+__pc_log_4_avx2(__m256 const a)
+{
+	return __cmplx_log(a, CMPLX_PRECISE);
+}
+
+__m256 __attribute__ ((noinline))
+__fc_pow_4_avx2(__m256 const a, __m256 const b)
+{
+	return __cmplx_pow(a, b, CMPLX_FAST);
+}
+
+__m256 __attribute__ ((noinline))
+__rc_pow_4_avx2(__m256 const a, __m256 const b)
+{
+	return __cmplx_pow(a, b, CMPLX_RELAXED);
+}
+
+__m256 __attribute__ ((noinline))
+__pc_pow_4_avx2(__m256 const a, __m256 const b)
+{
+	return __cmplx_pow(a, b, CMPLX_PRECISE);
+}
+
+#endif // __CMPLX_C_AVX2_4_H__
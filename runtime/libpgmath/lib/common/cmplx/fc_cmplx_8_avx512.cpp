@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Single precision complex division, sqrt, exp, log and pow on __m512.  The
+ * eight (re, im) pairs are split into 256-bit vectors of real and imaginary
+ * parts, in the lane order of the in-lane shuffles, which the join undoes.
+ */
+
+#ifndef __CMPLX_C_AVX512_8_H__
+#define __CMPLX_C_AVX512_8_H__
+
+#include <assert.h>
+#include <immintrin.h>
+#define CONFIG 1
+#include "helperavx2.h"
+#ifndef TARGET_OSX_X8664
+#include "cmplx_f_vec.h"
+#endif
+
+extern "C" __m512 __attribute__ ((noinline)) __fc_div_8_avx512(__m512 const a, __m512 const b);
+extern "C" __m512 __attribute__ ((noinline)) __rc_div_8_avx512(__m512 const a, __m512 const b);
+extern "C" __m512 __attribute__ ((noinline)) __pc_div_8_avx512(__m512 const a, __m512 const b);
+extern "C" __m512 __attribute__ ((noinline)) __fc_sqrt_8_avx512(__m512 const a);
+extern "C" __m512 __attribute__ ((noinline)) __rc_sqrt_8_avx512(__m512 const a);
+extern "C" __m512 __attribute__ ((noinline)) __pc_sqrt_8_avx512(__m512 const a);
+extern "C" __m512 __attribute__ ((noinline)) __fc_exp_8_avx512(__m512 const a);
+extern "C" __m512 __attribute__ ((noinline)) __rc_exp_8_avx512(__m512 const a);
+extern "C" __m512 __attribute__ ((noinline)) __pc_exp_8_avx512(__m512 const a);
+extern "C" __m512 __attribute__ ((noinline)) __fc_log_8_avx512(__m512 const a);
+extern "C" __m512 __attribute__ ((noinline)) __rc_log_8_avx512(__m512 const a);
+extern "C" __m512 __attribute__ ((noinline)) __pc_log_8_avx512(__m512 const a);
+extern "C" __m512 __attribute__ ((noinline)) __fc_pow_8_avx512(__m512 const a, __m512 const b);
+extern "C" __m512 __attribute__ ((noinline)) __rc_pow_8_avx512(__m512 const a, __m512 const b);
+extern "C" __m512 __attribute__ ((noinline)) __pc_pow_8_avx512(__m512 const a, __m512 const b);
+
+#ifndef TARGET_OSX_X8664
+static INLINE void
+__cmplx_split(__m512 const z, vfloat *re, vfloat *im)
+{
+    __m256 lo = _mm512_castps512_ps256(z);
+    __m256 hi = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(z), 1));
+
+    *re = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+    *im = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+static INLINE __m512
+__cmplx_join(vfloat const re, vfloat const im)
+{
+    __m512d z = _mm512_castpd256_pd512(_mm256_castps_pd(_mm256_unpacklo_ps(re, im)));
+
+    z = _mm512_insertf64x4(z, _mm256_castps_pd(_mm256_unpackhi_ps(re, im)), 1);
+    return _mm512_castpd_ps(z);
+}
+
+static INLINE __m512
+__cmplx_div(__m512 const a, __m512 const b, int const precise)
+{
+    vfloat ar, ai, br, bi, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_split(b, &br, &bi);
+    __cmplx_div_f_vec(ar, ai, br, bi, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m512
+__cmplx_sqrt(__m512 const a, int const precise)
+{
+    vfloat ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_sqrt_f_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m512
+__cmplx_exp(__m512 const a, int const precise)
+{
+    vfloat ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_exp_f_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m512
+__cmplx_log(__m512 const a, int const precise)
+{
+    vfloat ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_log_f_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m512
+__cmplx_pow(__m512 const a, __m512 const b, int const precise)
+{
+    vfloat ar, ai, br, bi, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_split(b, &br, &bi);
+    __cmplx_pow_f_vec(ar, ai, br, bi, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+#endif
+
+__m512 __attribute__ ((noinline))
+__fc_div_8_avx512(__m512 const a, __m512 const b)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_div(a, b, CMPLX_FAST);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__rc_div_8_avx512(__m512 const a, __m512 const b)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_div(a, b, CMPLX_RELAXED);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__pc_div_8_avx512(__m512 const a, __m512 const b)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_div(a, b, CMPLX_PRECISE);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__fc_sqrt_8_avx512(__m512 const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_sqrt(a, CMPLX_FAST);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__rc_sqrt_8_avx512(__m512 const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_sqrt(a, CMPLX_RELAXED);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__pc_sqrt_8_avx512(__m512 const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_sqrt(a, CMPLX_PRECISE);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__fc_exp_8_avx512(__m512 const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_exp(a, CMPLX_FAST);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__rc_exp_8_avx512(__m512 const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_exp(a, CMPLX_RELAXED);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__pc_exp_8_avx512(__m512 const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_exp(a, CMPLX_PRECISE);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__fc_log_8_avx512(__m512 const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_log(a, CMPLX_FAST);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__rc_log_8_avx512(__m512 const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_log(a, CMPLX_RELAXED);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__pc_log_8_avx512(__m512 const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_log(a, CMPLX_PRECISE);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__fc_pow_8_avx512(__m512 const a, __m512 const b)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_pow(a, b, CMPLX_FAST);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__rc_pow_8_avx512(__m512 const a, __m512 const b)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_pow(a, b, CMPLX_RELAXED);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512 __attribute__ ((noinline))
+__pc_pow_8_avx512(__m512 const a, __m512 const b)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_pow(a, b, CMPLX_PRECISE);
+#else
+        assert(0);
+        return ((__m512) _mm512_set1_epi32(0));
+#endif
+}
+
+#endif // __CMPLX_C_AVX512_8_H__
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Double precision complex division, sqrt, exp, log and pow on __m256d.
+ * The two (re, im) pairs are split into 128-bit vectors of real and
+ * imaginary parts.
+ */
+
+#ifndef __CMPLX_Z_AVX2_2_H__
+#define __CMPLX_Z_AVX2_2_H__
+
+#include <immintrin.h>
+#define CONFIG 1
+#include "helperavx2_128.h"
+#include "cmplx_d_vec.h"
+
+extern "C" __m256d __attribute__ ((noinline)) __fz_div_2_avx2(__m256d const a, __m256d const b);
+extern "C" __m256d __attribute__ ((noinline)) __rz_div_2_avx2(__m256d const a, __m256d const b);
+extern "C" __m256d __attribute__ ((noinline)) __pz_div_2_avx2(__m256d const a, __m256d const b);
+extern "C" __m256d __attribute__ ((noinline)) __fz_sqrt_2_avx2(__m256d const a);
+extern "C" __m256d __attribute__ ((noinline)) __rz_sqrt_2_avx2(__m256d const a);
+extern "C" __m256d __attribute__ ((noinline)) __pz_sqrt_2_avx2(__m256d const a);
+extern "C" __m256d __attribute__ ((noinline)) __fz_exp_2_avx2(__m256d const a);
+extern "C" __m256d __attribute__ ((noinline)) __rz_exp_2_avx2(__m256d const a);
+extern "C" __m256d __attribute__ ((noinline)) __pz_exp_2_avx2(__m256d const a);
+extern "C" __m256d __attribute__ ((noinline)) __fz_log_2_avx2(__m256d const a);
+extern "C" __m256d __attribute__ ((noinline)) __rz_log_2_avx2(__m256d const a);
+extern "C" __m256d __attribute__ ((noinline)) __pz_log_2_avx2(__m256d const a);
+extern "C" __m256d __attribute__ ((noinline)) __fz_pow_2_avx2(__m256d const a, __m256d const b);
+extern "C" __m256d __attribute__ ((noinline)) __rz_pow_2_avx2(__m256d const a, __m256d const b);
+extern "C" __m256d __attribute__ ((noinline)) __pz_pow_2_avx2(__m256d const a, __m256d const b);
+
+static INLINE void
+__cmplx_split(__m256d const z, vdouble *re, vdouble *im)
+{
+    __m128d lo = _mm256_castpd256_pd128(z);
+    __m128d hi = _mm256_extractf128_pd(z, 1);
+
+    *re = _mm_unpacklo_pd(lo, hi);
+    *im = _mm_unpackhi_pd(lo, hi);
+}
+
+static INLINE __m256d
+__cmplx_join(vdouble const re, vdouble const im)
+{
+    __m256d z = _mm256_castpd128_pd256(_mm_unpacklo_pd(re, im));
+
+    return _mm256_insertf128_pd(z, _mm_unpackhi_pd(re, im), 1);
+}
+
+static INLINE __m256d
+__cmplx_div(__m256d const a, __m256d const b, int const precise)
+{
+    vdouble ar, ai, br, bi, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_split(b, &br, &bi);
+    __cmplx_div_d_vec(ar, ai, br, bi, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m256d
+__cmplx_sqrt(__m256d const a, int const precise)
+{
+    vdouble ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_sqrt_d_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m256d
+__cmplx_exp(__m256d const a, int const precise)
+{
+    vdouble ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_exp_d_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m256d
+__cmplx_log(__m256d const a, int const precise)
+{
+    vdouble ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_log_d_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m256d
+__cmplx_pow(__m256d const a, __m256d const b, int const precise)
+{
+    vdouble ar, ai, br, bi, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_split(b, &br, &bi);
+    __cmplx_pow_d_vec(ar, ai, br, bi, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+__m256d __attribute__ ((noinline))
+__fz_div_2_avx2(__m256d const a, __m256d const b)
+{
+	return __cmplx_div(a, b, CMPLX_FAST);
+}
+
+__m256d __attribute__ ((noinline))
+__rz_div_2_avx2(__m256d const a, __m256d const b)
+{
+	return __cmplx_div(a, b, CMPLX_RELAXED);
+}
+
+__m256d __attribute__ ((noinline))
+__pz_div_2_avx2(__m256d const a, __m256d const b)
+{
+	return __cmplx_div(a, b, CMPLX_PRECISE);
+}
+
+__m256d __attribute__ ((noinline))
+__fz_sqrt_2_avx2(__m256d const a)
+{
+	return __cmplx_sqrt(a, CMPLX_FAST);
+}
+
+__m256d __attribute__ ((noinline))
+__rz_sqrt_2_avx2(__m256d const a)
+{
+	return __cmplx_sqrt(a, CMPLX_RELAXED);
+}
+
+__m256d __attribute__ ((noinline))
+__pz_sqrt_2_avx2(__m256d const a)
+{
+	return __cmplx_sqrt(a, CMPLX_PRECISE);
+}
+
+__m256d __attribute__ ((noinline))
+__fz_exp_2_avx2(__m256d const a)
+{
+	return __cmplx_exp(a, CMPLX_FAST);
+}
+
+__m256d __attribute__ ((noinline))
+__rz_exp_2_avx2(__m256d const a)
+{
+	return __cmplx_exp(a, CMPLX_RELAXED);
+}
+
+__m256d __attribute__ ((noinline))
+__pz_exp_2_avx2(__m256d const a)
+{
+	return __cmplx_exp(a, CMPLX_PRECISE);
+}
+
+__m256d __attribute__ ((noinline))
+__fz_log_2_avx2(__m256d const a)
+{
+	return __cmplx_log(a, CMPLX_FAST);
+}
+
+__m256d __attribute__ ((noinline))
+__rz_log_2_avx2(__m256d const a)
+{
+	return __cmplx_log(a, CMPLX_RELAXED);
+}
+
+__m256d __attribute__ ((noinline))
+__pz_log_2_avx2(__m256d const a)
+{
+	return __cmplx_log(a, CMPLX_PRECISE);
+}
+
+__m256d __attribute__ ((noinline))
+__fz_pow_2_avx2(__m256d const a, __m256d const b)
+{
+	return __cmplx_pow(a, b, CMPLX_FAST);
+}
+
+__m256d __attribute__ ((noinline))
+__rz_pow_2_avx2(__m256d const a, __m256d const b)
+{
+	return __cmplx_pow(a, b, CMPLX_RELAXED);
+}
+
+__m256d __attribute__ ((noinline))
+__pz_pow_2_avx2(__m256d const a, __m256d const b)
+{
+	return __cmplx_pow(a, b, CMPLX_PRECISE);
+}
+
+#endif // __CMPLX_Z_AVX2_2_H__
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Double precision complex division, sqrt, exp, log and pow on __m512d.
+ * The four (re, im) pairs are split into 256-bit vectors of real and
+ * imaginary parts, in the lane order of unpacklo/unpackhi, which the join
+ * undoes.
+ */
+
+#ifndef __CMPLX_Z_AVX512_4_H__
+#define __CMPLX_Z_AVX512_4_H__
+
+#include <assert.h>
+#include <immintrin.h>
+#define CONFIG 1
+#include "helperavx2.h"
+#ifndef TARGET_OSX_X8664
+#include "cmplx_d_vec.h"
+#endif
+
+extern "C" __m512d __attribute__ ((noinline)) __fz_div_4_avx512(__m512d const a, __m512d const b);
+extern "C" __m512d __attribute__ ((noinline)) __rz_div_4_avx512(__m512d const a, __m512d const b);
+extern "C" __m512d __attribute__ ((noinline)) __pz_div_4_avx512(__m512d const a, __m512d const b);
+extern "C" __m512d __attribute__ ((noinline)) __fz_sqrt_4_avx512(__m512d const a);
+extern "C" __m512d __attribute__ ((noinline)) __rz_sqrt_4_avx512(__m512d const a);
+extern "C" __m512d __attribute__ ((noinline)) __pz_sqrt_4_avx512(__m512d const a);
+extern "C" __m512d __attribute__ ((noinline)) __fz_exp_4_avx512(__m512d const a);
+extern "C" __m512d __attribute__ ((noinline)) __rz_exp_4_avx512(__m512d const a);
+extern "C" __m512d __attribute__ ((noinline)) __pz_exp_4_avx512(__m512d const a);
+extern "C" __m512d __attribute__ ((noinline)) __fz_log_4_avx512(__m512d const a);
+extern "C" __m512d __attribute__ ((noinline)) __rz_log_4_avx512(__m512d const a);
+extern "C" __m512d __attribute__ ((noinline)) __pz_log_4_avx512(__m512d const a);
+extern "C" __m512d __attribute__ ((noinline)) __fz_pow_4_avx512(__m512d const a, __m512d const b);
+extern "C" __m512d __attribute__ ((noinline)) __rz_pow_4_avx512(__m512d const a, __m512d const b);
+extern "C" __m512d __attribute__ ((noinline)) __pz_pow_4_avx512(__m512d const a, __m512d const b);
+
+#ifndef TARGET_OSX_X8664
+static INLINE void
+__cmplx_split(__m512d const z, vdouble *re, vdouble *im)
+{
+    __m256d lo = _mm512_castpd512_pd256(z);
+    __m256d hi = _mm512_extractf64x4_pd(z, 1);
+
+    *re = _mm256_unpacklo_pd(lo, hi);
+    *im = _mm256_unpackhi_pd(lo, hi);
+}
+
+static INLINE __m512d
+__cmplx_join(vdouble const re, vdouble const im)
+{
+    __m512d z = _mm512_castpd256_pd512(_mm256_unpacklo_pd(re, im));
+
+    return _mm512_insertf64x4(z, _mm256_unpackhi_pd(re, im), 1);
+}
+
+static INLINE __m512d
+__cmplx_div(__m512d const a, __m512d const b, int const precise)
+{
+    vdouble ar, ai, br, bi, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_split(b, &br, &bi);
+    __cmplx_div_d_vec(ar, ai, br, bi, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m512d
+__cmplx_sqrt(__m512d const a, int const precise)
+{
+    vdouble ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_sqrt_d_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m512d
+__cmplx_exp(__m512d const a, int const precise)
+{
+    vdouble ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_exp_d_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m512d
+__cmplx_log(__m512d const a, int const precise)
+{
+    vdouble ar, ai, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_log_d_vec(ar, ai, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+static INLINE __m512d
+__cmplx_pow(__m512d const a, __m512d const b, int const precise)
+{
+    vdouble ar, ai, br, bi, rr, ri;
+
+    __cmplx_split(a, &ar, &ai);
+    __cmplx_split(b, &br, &bi);
+    __cmplx_pow_d_vec(ar, ai, br, bi, precise, &rr, &ri);
+    return __cmplx_join(rr, ri);
+}
+
+#endif
+
+__m512d __attribute__ ((noinline))
+__fz_div_4_avx512(__m512d const a, __m512d const b)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_div(a, b, CMPLX_FAST);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__rz_div_4_avx512(__m512d const a, __m512d const b)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_div(a, b, CMPLX_RELAXED);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__pz_div_4_avx512(__m512d const a, __m512d const b)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_div(a, b, CMPLX_PRECISE);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__fz_sqrt_4_avx512(__m512d const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_sqrt(a, CMPLX_FAST);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__rz_sqrt_4_avx512(__m512d const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_sqrt(a, CMPLX_RELAXED);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__pz_sqrt_4_avx512(__m512d const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_sqrt(a, CMPLX_PRECISE);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__fz_exp_4_avx512(__m512d const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_exp(a, CMPLX_FAST);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__rz_exp_4_avx512(__m512d const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_exp(a, CMPLX_RELAXED);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__pz_exp_4_avx512(__m512d const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_exp(a, CMPLX_PRECISE);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__fz_log_4_avx512(__m512d const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_log(a, CMPLX_FAST);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__rz_log_4_avx512(__m512d const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_log(a, CMPLX_RELAXED);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__pz_log_4_avx512(__m512d const a)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_log(a, CMPLX_PRECISE);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__fz_pow_4_avx512(__m512d const a, __m512d const b)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_pow(a, b, CMPLX_FAST);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__rz_pow_4_avx512(__m512d const a, __m512d const b)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_pow(a, b, CMPLX_RELAXED);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+__m512d __attribute__ ((noinline))
+__pz_pow_4_avx512(__m512d const a, __m512d const b)
+{
+#ifndef TARGET_OSX_X8664
+	return __cmplx_pow(a, b, CMPLX_PRECISE);
+#else
+        assert(0);
+        return ((__m512d) _mm512_set1_epi32(0));
+#endif
+}
+
+#endif // __CMPLX_Z_AVX512_4_H__
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * cosh(x) = h + 1/(4h),  h = exp(|x|)/2
+ *
+ * The expression is well conditioned in h, so no expm1 form is needed
+ * for small arguments.  |x| is clamped so that larger arguments overflow
+ * to infinity.
+ */
+
+#include "hyperbolic_vec.h"
+
+#define COSH_CLAMP_F   100.0f
+#define COSH_CLAMP_D   720.0
+
+vfloat static INLINE
+__cosh_f_vec(vfloat const x, int const precise)
+{
+    vfloat a, k, s, sl, u, ul, h, hl, g, gl, r, rl;
+
+    a = vmin_vf_vf_vf(vabs_vf_vf(x), vcast_vf_f(COSH_CLAMP_F));
+    s = __hyp_reduce_f(a, &k, &sl);
+    u = __hyp_expm1_kernel_f(s, sl, precise, &ul);
+    h = __hyp_exph_f(k, u, ul, precise, &hl);
+    g = vdiv_vf_vf_vf(vcast_vf_f(0.25f), h);
+    r = vadd_vf_vf_vf(h, g);
+    if (precise == HYP_PRECISE) {
+        /* h >= g, so the error of h + g is exact. */
+        gl = vfma_vf_vf_vf_vf(vneg_vf_vf(g), h, vcast_vf_f(0.25f));
+        gl = vdiv_vf_vf_vf(vfma_vf_vf_vf_vf(vneg_vf_vf(g), hl, gl), h);
+        rl = vadd_vf_vf_vf(vsub_vf_vf_vf(g, vsub_vf_vf_vf(r, h)), vadd_vf_vf_vf(hl, gl));
+        /* past the overflow threshold r - h is inf - inf */
+        r = vsel_vf_vo_vf_vf(visinf_vo_vf(r), r, vadd_vf_vf_vf(r, rl));
+    }
+    return vsel_vf_vo_vf_vf(visnan_vo_vf(x), x, r);
+}
+
+vdouble static INLINE
+__cosh_d_vec(vdouble const x, int const precise)
+{
+    vdouble a, k, s, sl, u, ul, h, hl, g, gl, r, rl;
+
+    a = vmin_vd_vd_vd(vabs_vd_vd(x), vcast_vd_d(COSH_CLAMP_D));
+    s = __hyp_reduce_d(a, &k, &sl);
+    u = __hyp_expm1_kernel_d(s, sl, precise, &ul);
+    h = __hyp_exph_d(k, u, ul, precise, &hl);
+    g = vdiv_vd_vd_vd(vcast_vd_d(0.25), h);
+    r = vadd_vd_vd_vd(h, g);
+    if (precise == HYP_PRECISE) {
+        /* h >= g, so the error of h + g is exact. */
+        gl = vfma_vd_vd_vd_vd(vneg_vd_vd(g), h, vcast_vd_d(0.25));
+        gl = vdiv_vd_vd_vd(vfma_vd_vd_vd_vd(vneg_vd_vd(g), hl, gl), h);
+        rl = vadd_vd_vd_vd(vsub_vd_vd_vd(g, vsub_vd_vd_vd(r, h)), vadd_vd_vd_vd(hl, gl));
+        /* past the overflow threshold r - h is inf - inf */
+        r = vsel_vd_vo_vd_vd(visinf_vo_vd(r), r, vadd_vd_vd_vd(r, rl));
+    }
+    return vsel_vd_vo_vd_vd(visnan_vo_vd(x), x, r);
+}
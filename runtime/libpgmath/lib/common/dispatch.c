@@ -37,6 +37,15 @@
  *    spin waiting for the local initialization flag "__math_dispatch_is_init"
  *    to to indicate __math_dispatch() has completed setup.
  *
+ * 3) GNU IFUNC binding (LIBPGMATH_WITH_IFUNC, see mth_ifunc.c).
+ *    The public entry points are indirect functions whose resolvers call
+ *    __math_dispatch_resolve().  Resolvers can run before libc is
+ *    initialized, so they select from CPUID and mth_intrins_defs only;
+ *    the tables are still built once, by method 1.  If any of the
+ *    environment controls below is set, the resolvers bind the entry
+ *    points to their method 2 form instead, which dispatches through
+ *    the tables and so honors them.
+ *
  * Environment variable MTH_I_DEBUG is a bitmask used to control certain aspects of
  * dispatch initialization/shutdown.
  *
@@ -48,6 +57,19 @@
  *          Also generate stderr message for any subsequent "non-master"
  *          thread waiting for __math_dispatch() to complete.
  *
+ * Environment variable MTH_I_STATS is a bitmask that enables call statistics,
+ * reported at program termination.
+ *
+ * 0x1      Summary by intrinsic name.
+ * 0x2      Summary by intrinsic name and type.
+ * 0x4      Summary by entry point.
+ * 0x10     One CSV line per intrinsic/type/precision with the selected entry
+ *          point, its path (vector, generic, split, scalar or error), and
+ *          the number of calls and elements.  Written to MTH_I_STATS_FILE
+ *          if set, otherwise to stderr.
+ *
+ * Calls are counted per thread and summed when the report is generated.
+ *
  * All debug/waring/error messages are directed to stderr.
  *
  */
@@ -282,6 +304,9 @@ __mth_rt_vi_ptrs_t __mth_rt_vi_ptrs = {
 
 __mth_rt_vi_ptrs_t __mth_rt_vi_ptrs_stat;
 uint64_t __mth_rt_stats[frp_size][func_size][sv_size];
+__thread mth_rt_stats_blk_t *__mth_rt_stats_blk;
+static mth_rt_stats_blk_t *__mth_rt_stats_blks;   // All threads' blocks
+static mth_rt_stats_blk_t __mth_rt_stats_blk_nomem;
 static  __mth_rt_vi_ptrs_t __mth_rt_vi_ptrs_new;
 
 #if !defined(WIN64) && !defined(DISPATCH_IS_STATIC)
@@ -436,9 +461,11 @@ typedef enum    {
     stats_by_type   = 1<<1,         // By type, scalar, vector
     stats_by_func   = 1<<2,         // Individual
     stats_disp_err  = 1<<3,         // Dispatch error (internal)
+    stats_csv       = 1<<4,         // Entry points as CSV
     stats_all       = stats_summary | stats_by_type | stats_by_func,
 } stats_e;
 static stats_e __mth_i_stats = stats_none;
+static char *__mth_i_stats_file = NULL;     // MTH_I_STATS_FILE
 
 typedef struct {
   void *pfunc; // Pointer to function
@@ -756,6 +783,136 @@ dump_mth_rt_vi_ptrs()
 }
 
 
+/*
+ * __math_stats_blk_alloc() - allocate the calling thread's statistics
+ * block and add it to the list summed by __math_stats_merge().
+ *
+ * Called from _MTH_I_STATS_INC() on a thread's first profiled call.
+ * Should the allocation fail, the thread counts into a shared block
+ * without synchronization instead.
+ */
+
+mth_rt_stats_blk_t *
+__math_stats_blk_alloc(void)
+{
+  mth_rt_stats_blk_t *p;
+  void *pv;
+
+  if (0 != posix_memalign(&pv, 64, sizeof *p)) {
+    return (__mth_rt_stats_blk = &__mth_rt_stats_blk_nomem);
+  }
+  p = pv;
+  memset(p, 0, sizeof *p);
+  do {
+    p->next = __mth_rt_stats_blks;
+  } while (false == __sync_bool_compare_and_swap(&__mth_rt_stats_blks,
+                                                 p->next, p));
+  return (__mth_rt_stats_blk = p);
+}
+
+/*
+ * __math_stats_merge() - sum every thread's counters into __mth_rt_stats.
+ *
+ * Threads that are still running may be counting, so each counter is
+ * read with an atomic load.
+ */
+
+static void
+__math_stats_merge()
+{
+  mth_rt_stats_blk_t *p;
+  uint64_t *pd;
+  uint64_t *ps;
+  size_t i;
+  size_t n = sizeof __mth_rt_stats / sizeof(uint64_t);
+
+  pd = &__mth_rt_stats[0][0][0];
+  ps = &__mth_rt_stats_blk_nomem.cnt[0][0][0];
+  for (i = 0; i < n; i++) {
+    pd[i] = __atomic_load_n(&ps[i], __ATOMIC_RELAXED);
+  }
+  for (p = __atomic_load_n(&__mth_rt_stats_blks, __ATOMIC_ACQUIRE); p != NULL;
+       p = p->next) {
+    ps = &p->cnt[0][0][0];
+    for (i = 0; i < n; i++) {
+      pd[i] += __atomic_load_n(&ps[i], __ATOMIC_RELAXED);
+    }
+  }
+}
+
+/*
+ * Classify the entry point a call was dispatched to:
+ * native vector kernel, generic (element by element) vector, 512-bit
+ * call split in two 256-bit halves, scalar, or not defined.
+ */
+
+static char *
+entry2path(sv_e s, void *fptr)
+{
+  char *pname = fptr2char(fptr);
+
+  if (__math_dispatch_error == fptr) {
+    return "error";
+  }
+  if (sv2attributes[s].nelmt == 1 &&
+      sv2attributes[s].elmtsz <= elmtsz_64) {
+    return "scalar";
+  }
+  if (0 == strncmp(pname, "__g", 3)) {
+    return "generic";
+  }
+  if (NULL != strstr(pname, "z2yy")) {
+    return "split";
+  }
+  return "vector";
+}
+
+/*
+ * __math_epilog_do_csv() - one line per func/type/precision with the
+ * number of calls and elements, to MTH_I_STATS_FILE or stderr.
+ */
+
+static void
+__math_epilog_do_csv()
+{
+  func_e f;
+  sv_e s;
+  frp_e frp;
+  int lcsv = sizeof(csv) / sizeof(*csv); // Length of string structure csv
+  uint64_t t;
+  FILE *fp = stderr;
+
+  if (NULL != __mth_i_stats_file &&
+      NULL == (fp = fopen(__mth_i_stats_file, "w"))) {
+    fprintf(stderr, "MTH_I_STATS_FILE=%s cannot be opened - using stderr\n",
+      __mth_i_stats_file);
+    fp = stderr;
+  }
+
+  fputs("func,type,precision,width,entry,path,calls,elements\n", fp);
+  for (f = 0; f < func_size; f++) {
+    for (s = 0; s < lcsv; s++) { // Note sv_size can/is larger than csv
+      for (frp = 0; frp < frp_size; frp++) {
+        t = __mth_rt_stats[frp][f][s];
+        if (t != 0) {
+          fprintf(fp, "%s,%s,%s,%s,%s,%s,%" PRIu64 ",%" PRIu64 "\n",
+            cfunc[f], csv[s], frp2text[frp],
+            elmtsz2text[sv2attributes[s].elmtsz],
+            fptr2char(__mth_rt_vi_ptrs_stat[f][s][frp]),
+            entry2path(s, __mth_rt_vi_ptrs_stat[f][s][frp]),
+            t, t * sv2attributes[s].nelmt);
+        }
+      }
+    }
+  }
+
+  if (fp != stderr) {
+    fclose(fp);
+  } else {
+    fflush(stderr);
+  }
+}
+
 static void
 __math_epilog_do_stats()
 {
@@ -772,6 +929,14 @@ __math_epilog_do_stats()
   char  *pf;
   char  *pi;
 
+  __math_stats_merge();
+  if (0 != (stats_csv & __mth_i_stats)) {
+    __math_epilog_do_csv();
+    if (0 == ((stats_all | stats_disp_err) & __mth_i_stats)) {
+      return;
+    }
+  }
+
   totelmt = totcalls = 0;
   memset(elmtbysz, 0, sizeof elmtbysz);
   memset(callsbyfunc, 0, sizeof callsbyfunc);
@@ -927,6 +1092,53 @@ __math_epilog()
   }
 }
 
+/*
+ * __math_cpu_target() - the architecture CPUID selects.
+ *
+ * Uses nothing but the CPUID instruction, so it is safe to call from the
+ * GNU IFUNC resolvers before libc is initialized.
+ */
+
+static arch_e
+__math_cpu_target(void)
+{
+  arch_e target = arch_size;
+
+#if defined(TARGET_LINUX_X8664) || defined(TARGET_OSX_X8664)
+  if (CPUIDX8664(is_avx512vl)() == 1) {
+    target = arch_avx512;
+  } else if (CPUIDX8664(is_avx512f)() == 1) {
+    target = arch_avx512knl;
+  } else if (CPUIDX8664(is_avx2)() == 1) {
+    target = arch_avx2;
+  } else if (CPUIDX8664(is_avx)() == 1) {
+    if (CPUIDX8664(is_intel)() == 1) {
+      target = arch_avx;
+    }
+    if (CPUIDX8664(is_amd)() == 1) {
+      if (CPUIDX8664(is_fma4)() == 1) {
+        target = arch_avxfma4;
+      } else {
+        target = arch_sse4;
+      }
+    }
+  } else {
+    if ((CPUIDX8664(is_sse4a)() == 1) || (CPUIDX8664(is_sse41)() == 1)) {
+      target = arch_sse4;
+    } else {
+      target = arch_em64t;
+    }
+  }
+#endif
+#ifdef TARGET_LINUX_POWER
+  target = ARCH_DEFAULT;
+#endif
+#ifdef TARGET_LINUX_GENERIC
+  target = ARCH_DEFAULT;
+#endif
+  return target;
+}
+
 /*
  * __math_dispatch()
  */
@@ -986,38 +1198,7 @@ __math_dispatch()
     }
 
   } else { /* Get processor architecture using CPUID information */
-#if defined(TARGET_LINUX_X8664) || defined(TARGET_OSX_X8664)
-    if (CPUIDX8664(is_avx512vl)() == 1) {
-      __math_target = arch_avx512;
-    } else if (CPUIDX8664(is_avx512f)() == 1) {
-      __math_target = arch_avx512knl;
-    } else if (CPUIDX8664(is_avx2)() == 1) {
-      __math_target = arch_avx2;
-    } else if (CPUIDX8664(is_avx)() == 1) {
-      if (CPUIDX8664(is_intel)() == 1) {
-        __math_target = arch_avx;
-      }
-      if (CPUIDX8664(is_amd)() == 1) {
-        if (CPUIDX8664(is_fma4)() == 1) {
-          __math_target = arch_avxfma4;
-        } else {
-          __math_target = arch_sse4;
-        }
-      }
-    } else {
-      if ((CPUIDX8664(is_sse4a)() == 1) || (CPUIDX8664(is_sse41)() == 1)) {
-        __math_target = arch_sse4;
-      } else {
-        __math_target = arch_em64t;
-      }
-    }
-#endif
-#ifdef TARGET_LINUX_POWER
-    __math_target = ARCH_DEFAULT;
-#endif
-#ifdef TARGET_LINUX_GENERIC
-    __math_target = ARCH_DEFAULT;
-#endif
+    __math_target = __math_cpu_target();
   }
 
   /*  Allow overriding of the default functions called for fast,
@@ -1188,11 +1369,12 @@ __math_dispatch()
   }
 
   if (__mth_i_stats != 0) {
-    if (__mth_i_stats > stats_all) {
+    if (0 != (__mth_i_stats & ~(stats_all | stats_csv))) {
       fprintf(stderr, "MTH_I_STATS=%#x > %#x, defaulting to summary(%#x)\n",
-        __mth_i_stats, stats_all, stats_summary);
+        __mth_i_stats, stats_all | stats_csv, stats_summary);
       __mth_i_stats = stats_summary;
     }
+    __mth_i_stats_file = getenv("MTH_I_STATS_FILE");
 #if defined(DISPATCH_IS_STATIC)
     fputs("MTH_I_STATS is enabled, but running with static "\
           "initialization\nMust call __math_epilog at program "\
@@ -1285,6 +1467,119 @@ __math_dispatch_init()
   }
 }
 
+/*
+ * Environment variables that change which entry __math_dispatch() puts in
+ * the tables.  Matched including the '=' so that, for instance,
+ * MTH_I_STATS_FILE alone does not count.
+ */
+
+static const char *const dispatch_env[] = {
+    "MTH_I_ARCH=",    "PGI_FASTMATH_CPU=", "MTH_I_FAST=",  "MTH_I_RELAXED=",
+    "MTH_I_PRECISE=", "MTH_I_SLEEF=",      "MTH_I_OVERRIDE=", "MTH_I_STATS=",
+};
+
+/*
+ * dispatch_env_set() - whether any of dispatch_env[] is in the environment.
+ *
+ * Reads environ directly and compares by hand: getenv() and the string
+ * functions may themselves be indirect functions that are not yet
+ * relocated when a resolver runs.
+ */
+
+static bool
+dispatch_env_set(void)
+{
+  extern char **environ;
+  char **pe;
+  const char *e, *v;
+  int i;
+
+  if (environ == NULL) {
+    return false;
+  }
+  for (pe = environ; *pe != NULL; pe++) {
+    for (i = 0; i < sizeof(dispatch_env) / sizeof(*dispatch_env); i++) {
+      for (e = *pe, v = dispatch_env[i]; *v != '\0' && *e == *v; e++, v++)
+        ;
+      if (*v == '\0') {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/*
+ * __math_dispatch_resolve() - return the entry for func/sv/frp on the
+ * architecture CPUID selects, or pinit, the entry point's _init form, if
+ * the environment asks for anything else.
+ *
+ * Only called from the GNU IFUNC resolvers in mth_ifunc.c, which the
+ * dynamic linker (or the static startup code) invokes once per entry point,
+ * possibly before libc is initialized.  So this reads only CPUID, environ
+ * and mth_intrins_defs: no allocation, no I/O, and it does not touch the
+ * dispatch tables, which the constructor builds as usual.  The _init form
+ * looks its kernel up in those tables on every call, after MTH_I_ARCH,
+ * MTH_I_OVERRIDE, MTH_I_STATS and the rest have been applied.
+ */
+
+p2f
+__math_dispatch_resolve(func_e f, sv_e s, frp_e frp, p2f pinit)
+{
+  mth_intrins_defs_t *p;
+  arch_e target;
+  p2f pf;
+  int i;
+
+  if (dispatch_env_set()) {
+    return pinit;
+  }
+  target = __math_cpu_target();
+  pf = NULL;
+  for (i = 0; i < sizeof(mth_intrins_defs) / sizeof(*mth_intrins_defs); i++) {
+    p = &mth_intrins_defs[i];
+    if (p->func != f || p->sv != s || p->pf == NULL) {
+      continue;
+    }
+    if (p->arch == target || (p->arch == arch_any && pf == NULL)) {
+      pf = frp == frp_f ? p->pf : frp == frp_r ? p->pr :
+           frp == frp_p ? p->pp : p->ps;
+      if (p->arch == target) {
+        break;
+      }
+    }
+  }
+  return pf != NULL ? pf : __math_dispatch_error;
+}
+
+/*
+ * __math_dispatch_vreg_size() - return the width, in bits, of the vector
+ * entry points the array entry points in mth_array.c should stream through
+ * for the selected architecture.
+ */
+
+int
+__math_dispatch_vreg_size(void)
+{
+  if (false == __math_dispatch_is_init) {
+    __math_dispatch_init();
+  }
+
+  switch (__math_target) {
+#if defined(TARGET_LINUX_X8664) || defined(TARGET_OSX_X8664)
+  case arch_avx:
+  case arch_avxfma4:
+  case arch_avx2:
+    return 256;
+  case arch_avx512knl:
+  case arch_avx512:
+    return 512;
+#endif
+  default:
+    return 128;
+  }
+}
+
 void
 __math_dispatch_error()
 {
@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Vector building blocks shared by the tanh, sinh and cosh kernels.
+ *
+ * Must be included after one of helperavx2_128.h, helperavx2.h or
+ * helperavx512f.h, which supply the vfloat/vdouble abstraction.
+ *
+ * The argument y is reduced as y = n*ln(2) + s, |s| <= ln(2)/2, and
+ * expm1(s) is approximated by its Taylor polynomial, evaluated as
+ * s + s*s*P(s).  The degree depends on the accuracy class:
+ *
+ *          float   double  truncation error
+ *   fast     7       13      ~0.1 ulp
+ *   relaxed  6       12      ~3 ulp
+ *   precise  8       14      negligible
+ *
+ * The precise variants additionally carry the low order part of the
+ * reduced argument and of expm1 through to the final division, which
+ * keeps the result within about one ulp.
+ *
+ * 2**n is built directly from the bits of the rounding shifter the same way
+ * __sin_f_vec/__sin_d_vec extract the quadrant.
+ */
+
+#ifndef __HYPERBOLIC_VEC_H__
+#define __HYPERBOLIC_VEC_H__
+
+#include "misc.h"
+
+#define HYP_FAST     0
+#define HYP_RELAXED  1
+#define HYP_PRECISE  2
+
+#define HYP_SHIFTER_F   12582912.0f             /* 1.5 * 2**23 */
+#define HYP_SHIFTER_D   6755399441055744.0      /* 1.5 * 2**52 */
+
+/*
+ * exp(a)/2 is computed as (1 + expm1(s)) * 2**(n - 1 - HYP_SCALE) *
+ * 2**HYP_SCALE so that 2**n stays representable up to the overflow
+ * threshold.
+ */
+#define HYP_SCALE_F     32.0f
+#define HYP_POW2SCALE_F 4294967296.0f           /* 2**32 */
+#define HYP_SCALE_D     64.0
+#define HYP_POW2SCALE_D 18446744073709551616.0  /* 2**64 */
+
+/*
+ * Single precision
+ */
+
+/* 1/k!, k = 2..8 */
+#define HYP_F2  5.00000000e-01f
+#define HYP_F3  1.66666672e-01f
+#define HYP_F4  4.16666679e-02f
+#define HYP_F5  8.33333377e-03f
+#define HYP_F6  1.38888892e-03f
+#define HYP_F7  1.98412701e-04f
+#define HYP_F8  2.48015876e-05f
+
+/* y = n*ln(2) + s + sl; k holds n + HYP_SHIFTER_F. */
+vfloat static INLINE
+__hyp_reduce_f(vfloat const y, vfloat *k, vfloat *sl)
+{
+    vfloat s, h, kk;
+
+    kk = vfma_vf_vf_vf_vf(y, vcast_vf_f(R_LN2f), vcast_vf_f(HYP_SHIFTER_F));
+    *k = kk;
+    kk = vsub_vf_vf_vf(kk, vcast_vf_f(HYP_SHIFTER_F));
+    h = vfma_vf_vf_vf_vf(kk, vcast_vf_f(-L2Uf), y);
+    s = vfma_vf_vf_vf_vf(kk, vcast_vf_f(-L2Lf), h);
+    *sl = vfma_vf_vf_vf_vf(kk, vcast_vf_f(-L2Lf), vsub_vf_vf_vf(h, s));
+    return s;
+}
+
+/* 2**(n + bias) where k holds n + HYP_SHIFTER_F. */
+vfloat static INLINE
+__hyp_pow2_f(vfloat const k, float const bias)
+{
+    vint2 e;
+
+    e = vreinterpret_vi2_vf(vadd_vf_vf_vf(k, vcast_vf_f(bias)));
+    e = vsll_vi2_vi2_i(e, 23);
+    e = vadd_vi2_vi2_vi2(e, vcast_vi2_i(0x3f800000));
+    return vreinterpret_vf_vi2(e);
+}
+
+/*
+ * expm1(s + sl) for |s| <= ln(2)/2.  The precise variants also return the
+ * rounding error of the result in *ul, otherwise *ul is zero.
+ */
+vfloat static INLINE
+__hyp_expm1_kernel_f(vfloat const s, vfloat const sl, int const precise,
+                     vfloat *ul)
+{
+    vfloat p, w, u;
+
+    if (precise == HYP_PRECISE) {
+        p = vfma_vf_vf_vf_vf(vcast_vf_f(HYP_F8), s, vcast_vf_f(HYP_F7));
+        p = vfma_vf_vf_vf_vf(p, s, vcast_vf_f(HYP_F6));
+    } else if (precise == HYP_FAST) {
+        p = vfma_vf_vf_vf_vf(vcast_vf_f(HYP_F7), s, vcast_vf_f(HYP_F6));
+    } else {
+        p = vcast_vf_f(HYP_F6);
+    }
+    p = vfma_vf_vf_vf_vf(p, s, vcast_vf_f(HYP_F5));
+    p = vfma_vf_vf_vf_vf(p, s, vcast_vf_f(HYP_F4));
+    p = vfma_vf_vf_vf_vf(p, s, vcast_vf_f(HYP_F3));
+    p = vfma_vf_vf_vf_vf(p, s, vcast_vf_f(HYP_F2));
+    w = vmul_vf_vf_vf(vmul_vf_vf_vf(s, s), p);
+    u = vadd_vf_vf_vf(s, w);
+    if (precise == HYP_PRECISE) {
+        /* |s| >= |w|, so the error of s + w is exact; sl scales by e**s. */
+        *ul = vadd_vf_vf_vf(vsub_vf_vf_vf(w, vsub_vf_vf_vf(u, s)),
+                            vfma_vf_vf_vf_vf(sl, s, sl));
+    } else {
+        *ul = vcast_vf_f(0.0f);
+    }
+    return u;
+}
+
+/* expm1 + *el given the reduction of its argument. */
+vfloat static INLINE
+__hyp_expm1_scale_f(vfloat const k, vfloat const u, vfloat const ul,
+                     int const precise, vfloat *el)
+{
+    vfloat t, tu, tm1, e, b;
+
+    t = __hyp_pow2_f(k, 0.0f);
+    tm1 = vsub_vf_vf_vf(t, vcast_vf_f(1.0f));
+    if (precise != HYP_PRECISE) {
+        *el = vcast_vf_f(0.0f);
+        return vfma_vf_vf_vf_vf(t, u, tm1);
+    }
+
+    /* t*u is exact; two-sum with t - 1. */
+    tu = vmul_vf_vf_vf(t, u);
+    e = vadd_vf_vf_vf(tu, tm1);
+    b = vsub_vf_vf_vf(e, tu);
+    *el = vadd_vf_vf_vf(vsub_vf_vf_vf(tu, vsub_vf_vf_vf(e, b)),
+                        vsub_vf_vf_vf(tm1, b));
+    *el = vfma_vf_vf_vf_vf(t, ul, *el);
+    return e;
+}
+
+/* expm1(y) + *el for -30 <= y <= 88 */
+vfloat static INLINE
+__hyp_expm1_f(vfloat const y, int const precise, vfloat *el)
+{
+    vfloat k, s, sl, u, ul;
+
+    s = __hyp_reduce_f(y, &k, &sl);
+    u = __hyp_expm1_kernel_f(s, sl, precise, &ul);
+    return __hyp_expm1_scale_f(k, u, ul, precise, el);
+}
+
+/*
+ * exp(a)/2 + *hl given the reduction of a, scaled so that 2**n stays
+ * representable up to the overflow threshold.
+ */
+vfloat static INLINE
+__hyp_exph_f(vfloat const k, vfloat const u, vfloat const ul,
+             int const precise, vfloat *hl)
+{
+    vfloat h, t;
+
+    t = __hyp_pow2_f(k, -1.0f - HYP_SCALE_F);
+    h = vadd_vf_vf_vf(u, vcast_vf_f(1.0f));
+    if (precise == HYP_PRECISE) {
+        *hl = vadd_vf_vf_vf(vadd_vf_vf_vf(vsub_vf_vf_vf(vcast_vf_f(1.0f), h), u), ul);
+        *hl = vmul_vf_vf_vf(vmul_vf_vf_vf(*hl, t), vcast_vf_f(HYP_POW2SCALE_F));
+    } else {
+        *hl = vcast_vf_f(0.0f);
+    }
+    return vmul_vf_vf_vf(vmul_vf_vf_vf(h, t), vcast_vf_f(HYP_POW2SCALE_F));
+}
+
+/*
+ * (n + nl)/(d + dl).  The precise variants apply one correction step to
+ * the rounded quotient n/d; the others ignore the low order parts.
+ */
+vfloat static INLINE
+__hyp_div_f(vfloat const n, vfloat const nl, vfloat const d, vfloat const dl,
+            int const precise)
+{
+    vfloat q, r;
+
+    q = vdiv_vf_vf_vf(n, d);
+    if (precise == HYP_PRECISE) {
+        r = vfma_vf_vf_vf_vf(q, d, vneg_vf_vf(n));
+        r = vsub_vf_vf_vf(vfma_vf_vf_vf_vf(q, dl, r), nl);
+        q = vsub_vf_vf_vf(q, vdiv_vf_vf_vf(r, d));
+    }
+    return q;
+}
+
+/* Copy the sign of x on to the non-negative value r. */
+vfloat static INLINE
+__hyp_copysign_f(vfloat const r, vfloat const x)
+{
+    vmask sgn = vand_vm_vm_vm(vreinterpret_vm_vf(x),
+                              vreinterpret_vm_vf(vcast_vf_f(-0.0f)));
+    return vreinterpret_vf_vm(vor_vm_vm_vm(vreinterpret_vm_vf(r), sgn));
+}
+
+/*
+ * Double precision
+ */
+
+/* 1/k!, k = 2..14 */
+#define HYP_D2  5.0000000000000000e-01
+#define HYP_D3  1.6666666666666666e-01
+#define HYP_D4  4.1666666666666664e-02
+#define HYP_D5  8.3333333333333332e-03
+#define HYP_D6  1.3888888888888889e-03
+#define HYP_D7  1.9841269841269841e-04
+#define HYP_D8  2.4801587301587302e-05
+#define HYP_D9  2.7557319223985893e-06
+#define HYP_D10 2.7557319223985888e-07
+#define HYP_D11 2.5052108385441720e-08
+#define HYP_D12 2.0876756987868100e-09
+#define HYP_D13 1.6059043836821613e-10
+#define HYP_D14 1.1470745597729725e-11
+
+vdouble static INLINE
+__hyp_reduce_d(vdouble const y, vdouble *k, vdouble *sl)
+{
+    vdouble s, h, kk;
+
+    kk = vfma_vd_vd_vd_vd(y, vcast_vd_d(R_LN2), vcast_vd_d(HYP_SHIFTER_D));
+    *k = kk;
+    kk = vsub_vd_vd_vd(kk, vcast_vd_d(HYP_SHIFTER_D));
+    h = vfma_vd_vd_vd_vd(kk, vcast_vd_d(-L2U), y);
+    s = vfma_vd_vd_vd_vd(kk, vcast_vd_d(-L2L), h);
+    *sl = vfma_vd_vd_vd_vd(kk, vcast_vd_d(-L2L), vsub_vd_vd_vd(h, s));
+    return s;
+}
+
+vdouble static INLINE
+__hyp_pow2_d(vdouble const k, double const bias)
+{
+    vint2 e;
+
+    e = vreinterpret_vi2_vd(vadd_vd_vd_vd(k, vcast_vd_d(bias)));
+    e = vsll64_vi2_vi2_i(e, 52);
+    e = vadd64_vi2_vi2_vi2(e, (vint2)vcast_vm_i_i(0x3ff00000, 0));
+    return vreinterpret_vd_vi2(e);
+}
+
+vdouble static INLINE
+__hyp_expm1_kernel_d(vdouble const s, vdouble const sl, int const precise,
+                     vdouble *ul)
+{
+    vdouble p, w, u;
+
+    if (precise == HYP_PRECISE) {
+        p = vfma_vd_vd_vd_vd(vcast_vd_d(HYP_D14), s, vcast_vd_d(HYP_D13));
+        p = vfma_vd_vd_vd_vd(p, s, vcast_vd_d(HYP_D12));
+    } else if (precise == HYP_FAST) {
+        p = vfma_vd_vd_vd_vd(vcast_vd_d(HYP_D13), s, vcast_vd_d(HYP_D12));
+    } else {
+        p = vcast_vd_d(HYP_D12);
+    }
+    p = vfma_vd_vd_vd_vd(p, s, vcast_vd_d(HYP_D11));
+    p = vfma_vd_vd_vd_vd(p, s, vcast_vd_d(HYP_D10));
+    p = vfma_vd_vd_vd_vd(p, s, vcast_vd_d(HYP_D9));
+    p = vfma_vd_vd_vd_vd(p, s, vcast_vd_d(HYP_D8));
+    p = vfma_vd_vd_vd_vd(p, s, vcast_vd_d(HYP_D7));
+    p = vfma_vd_vd_vd_vd(p, s, vcast_vd_d(HYP_D6));
+    p = vfma_vd_vd_vd_vd(p, s, vcast_vd_d(HYP_D5));
+    p = vfma_vd_vd_vd_vd(p, s, vcast_vd_d(HYP_D4));
+    p = vfma_vd_vd_vd_vd(p, s, vcast_vd_d(HYP_D3));
+    p = vfma_vd_vd_vd_vd(p, s, vcast_vd_d(HYP_D2));
+    w = vmul_vd_vd_vd(vmul_vd_vd_vd(s, s), p);
+    u = vadd_vd_vd_vd(s, w);
+    if (precise == HYP_PRECISE) {
+        *ul = vadd_vd_vd_vd(vsub_vd_vd_vd(w, vsub_vd_vd_vd(u, s)),
+                            vfma_vd_vd_vd_vd(sl, s, sl));
+    } else {
+        *ul = vcast_vd_d(0.0);
+    }
+    return u;
+}
+
+/* expm1 + *el given the reduction of its argument. */
+vdouble static INLINE
+__hyp_expm1_scale_d(vdouble const k, vdouble const u, vdouble const ul,
+                     int const precise, vdouble *el)
+{
+    vdouble t, tu, tm1, e, b;
+
+    t = __hyp_pow2_d(k, 0.0);
+    tm1 = vsub_vd_vd_vd(t, vcast_vd_d(1.0));
+    if (precise != HYP_PRECISE) {
+        *el = vcast_vd_d(0.0);
+        return vfma_vd_vd_vd_vd(t, u, tm1);
+    }
+
+    tu = vmul_vd_vd_vd(t, u);
+    e = vadd_vd_vd_vd(tu, tm1);
+    b = vsub_vd_vd_vd(e, tu);
+    *el = vadd_vd_vd_vd(vsub_vd_vd_vd(tu, vsub_vd_vd_vd(e, b)),
+                        vsub_vd_vd_vd(tm1, b));
+    *el = vfma_vd_vd_vd_vd(t, ul, *el);
+    return e;
+}
+
+/* expm1(y) + *el for -60 <= y <= 709 */
+vdouble static INLINE
+__hyp_expm1_d(vdouble const y, int const precise, vdouble *el)
+{
+    vdouble k, s, sl, u, ul;
+
+    s = __hyp_reduce_d(y, &k, &sl);
+    u = __hyp_expm1_kernel_d(s, sl, precise, &ul);
+    return __hyp_expm1_scale_d(k, u, ul, precise, el);
+}
+
+vdouble static INLINE
+__hyp_exph_d(vdouble const k, vdouble const u, vdouble const ul,
+             int const precise, vdouble *hl)
+{
+    vdouble h, t;
+
+    t = __hyp_pow2_d(k, -1.0 - HYP_SCALE_D);
+    h = vadd_vd_vd_vd(u, vcast_vd_d(1.0));
+    if (precise == HYP_PRECISE) {
+        *hl = vadd_vd_vd_vd(vadd_vd_vd_vd(vsub_vd_vd_vd(vcast_vd_d(1.0), h), u), ul);
+        *hl = vmul_vd_vd_vd(vmul_vd_vd_vd(*hl, t), vcast_vd_d(HYP_POW2SCALE_D));
+    } else {
+        *hl = vcast_vd_d(0.0);
+    }
+    return vmul_vd_vd_vd(vmul_vd_vd_vd(h, t), vcast_vd_d(HYP_POW2SCALE_D));
+}
+
+vdouble static INLINE
+__hyp_div_d(vdouble const n, vdouble const nl, vdouble const d,
+            vdouble const dl, int const precise)
+{
+    vdouble q, r;
+
+    q = vdiv_vd_vd_vd(n, d);
+    if (precise == HYP_PRECISE) {
+        r = vfma_vd_vd_vd_vd(q, d, vneg_vd_vd(n));
+        r = vsub_vd_vd_vd(vfma_vd_vd_vd_vd(q, dl, r), nl);
+        q = vsub_vd_vd_vd(q, vdiv_vd_vd_vd(r, d));
+    }
+    return q;
+}
+
+vdouble static INLINE
+__hyp_copysign_d(vdouble const r, vdouble const x)
+{
+    vmask sgn = vand_vm_vm_vm(vreinterpret_vm_vd(x),
+                              vreinterpret_vm_vd(vcast_vd_d(-0.0)));
+    return vreinterpret_vd_vm(vor_vm_vm_vm(vreinterpret_vm_vd(r), sgn));
+}
+
+#endif // __HYPERBOLIC_VEC_H__
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Vector natural logarithm kernel, and log and log10 built on it.
+ *
+ * Must be included after one of helperavx2_128.h, helperavx2.h or
+ * helperavx512f.h, which supply the vfloat/vdouble abstraction.
+ *
+ * x = 2**e * m with sqrt(2)/2 <= m < sqrt(2), and with f = (m - 1)/(m + 1)
+ *
+ *   log(m) = 2*atanh(f) = 2*f + 2*f**3*P(f**2),  |f| <= 0.1716
+ *
+ * where P is a minimax polynomial of degree:
+ *
+ *          float   double
+ *   fast     3        7
+ *   relaxed  2        5
+ *   precise  3        7
+ *
+ * The kernel returns log(x) as an unevaluated sum hi + lo that includes the
+ * rounding error of f, except in the relaxed variants.  The precise
+ * variants also keep the rounding error of the final scaling by log10(e),
+ * which holds the result within about half an ulp.
+ */
+
+#ifndef __LOG_VEC_H__
+#define __LOG_VEC_H__
+
+#include "misc.h"
+
+#define LOG_FAST     0
+#define LOG_RELAXED  1
+#define LOG_PRECISE  2
+
+/*
+ * Single precision
+ */
+
+#define LOG_F_LOG10E_HI  0.434294492f
+#define LOG_F_LOG10E_LO  -1.010305e-08f
+
+/* P(z), relaxed */
+#define LOG_F_R0    0.333333433f
+#define LOG_F_R1    0.1999439f
+#define LOG_F_R2    0.147899762f
+
+/* P(z), fast and precise */
+#define LOG_F_P0    0.333333343f
+#define LOG_F_P1    0.200000614f
+#define LOG_F_P2    0.142754108f
+#define LOG_F_P3    0.116652347f
+
+/* x = 2**e * m, sqrt(2)/2 <= m < sqrt(2), for finite x > 0. */
+vfloat static INLINE
+__log_reduce_f(vfloat x, vfloat *e)
+{
+    vopmask tiny;
+    vint2 ix;
+
+    tiny = vlt_vo_vf_vf(x, vcast_vf_f(0x1p-126f));
+    x = vsel_vf_vo_vf_vf(tiny, vmul_vf_vf_vf(x, vcast_vf_f(0x1p+24f)), x);
+
+    /* Offset the bits so that the exponent field rounds at sqrt(2)/2. */
+    ix = vadd_vi2_vi2_vi2(vreinterpret_vi2_vf(x),
+                          vcast_vi2_i(0x3f800000 - 0x3f3504f3));
+    *e = vcast_vf_vi2(vsub_vi2_vi2_vi2(vsrl_vi2_vi2_i(ix, 23),
+                                       vcast_vi2_i(0x7f)));
+    *e = vsel_vf_vo_vf_vf(tiny, vsub_vf_vf_vf(*e, vcast_vf_f(24.0f)), *e);
+    ix = vand_vi2_vi2_vi2(ix, vcast_vi2_i(0x007fffff));
+    return vreinterpret_vf_vi2(vadd_vi2_vi2_vi2(ix, vcast_vi2_i(0x3f3504f3)));
+}
+
+/* log(x) = result + *lo for finite x > 0, including denormals. */
+vfloat static INLINE
+__log_kernel_f(vfloat const x, int const precise, vfloat *lo)
+{
+    vfloat e, m, u, v, f, fl, z, w, el, s;
+
+    m = __log_reduce_f(x, &e);
+
+    /* m - 1 is exact. */
+    u = vsub_vf_vf_vf(m, vcast_vf_f(1.0f));
+    v = vadd_vf_vf_vf(m, vcast_vf_f(1.0f));
+    f = vdiv_vf_vf_vf(u, v);
+    z = vmul_vf_vf_vf(f, f);
+    if (precise == LOG_RELAXED) {
+        w = vfma_vf_vf_vf_vf(vcast_vf_f(LOG_F_R2), z, vcast_vf_f(LOG_F_R1));
+        w = vfma_vf_vf_vf_vf(w, z, vcast_vf_f(LOG_F_R0));
+    } else {
+        w = vfma_vf_vf_vf_vf(vcast_vf_f(LOG_F_P3), z, vcast_vf_f(LOG_F_P2));
+        w = vfma_vf_vf_vf_vf(w, z, vcast_vf_f(LOG_F_P1));
+        w = vfma_vf_vf_vf_vf(w, z, vcast_vf_f(LOG_F_P0));
+    }
+    w = vmul_vf_vf_vf(vmul_vf_vf_vf(f, z), w);
+    el = vmul_vf_vf_vf(e, vcast_vf_f(L2Lf));
+    if (precise != LOG_RELAXED) {
+        /*
+         * f + fl = u/v; v - 1 is exact, so m - (v - 1) is the error of v.
+         * fl only needs a few bits, so 1/v comes from its minimax line on
+         * [1 + sqrt(2)/2, 1 + sqrt(2)] (1.3% error) instead of a divide.
+         */
+        fl = vfma_vf_vf_vf_vf(vneg_vf_vf(f), v, u);
+        fl = vfma_vf_vf_vf_vf(vneg_vf_vf(f),
+                 vsub_vf_vf_vf(m, vsub_vf_vf_vf(v, vcast_vf_f(1.0f))), fl);
+        fl = vmul_vf_vf_vf(fl, vfma_vf_vf_vf_vf(v, vcast_vf_f(-0.24264069f),
+                                          vcast_vf_f(0.99258569f)));
+        el = vfma_vf_vf_vf_vf(fl, vcast_vf_f(2.0f), el);
+    }
+
+    /*
+     * e*ln2_hi is exact and, unless e is zero, larger than 2*f, so the
+     * error of the sum below is exact.
+     */
+    e = vmul_vf_vf_vf(e, vcast_vf_f(L2Uf));
+    f = vadd_vf_vf_vf(f, f);
+    s = vadd_vf_vf_vf(e, f);
+    *lo = vadd_vf_vf_vf(vsub_vf_vf_vf(f, vsub_vf_vf_vf(s, e)),
+                      vfma_vf_vf_vf_vf(w, vcast_vf_f(2.0f), el));
+    return s;
+}
+
+/* Result for x <= 0, infinite or NaN x; r elsewhere. */
+vfloat static INLINE
+__log_special_f(vfloat const x, vfloat r)
+{
+    r = vsel_vf_vo_vf_vf(vispinf_vo_vf(x), x, r);
+    r = vsel_vf_vo_vf_vf(veq_vo_vf_vf(x, vcast_vf_f(0.0f)), vcast_vf_f(-INFINITYf), r);
+    r = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(x, vcast_vf_f(0.0f)), vcast_vf_f(NANf), r);
+    return vsel_vf_vo_vf_vf(visnan_vo_vf(x), x, r);
+}
+
+vfloat static INLINE
+__log_f_vec(vfloat const x, int const precise)
+{
+    vfloat h, l;
+
+    h = __log_kernel_f(x, precise, &l);
+    return __log_special_f(x, vadd_vf_vf_vf(h, l));
+}
+
+vfloat static INLINE
+__log10_f_vec(vfloat const x, int const precise)
+{
+    vfloat h, l, r, rl;
+
+    h = __log_kernel_f(x, precise, &l);
+    r = vmul_vf_vf_vf(h, vcast_vf_f(LOG_F_LOG10E_HI));
+    if (precise == LOG_PRECISE) {
+        rl = vfma_vf_vf_vf_vf(h, vcast_vf_f(LOG_F_LOG10E_HI), vneg_vf_vf(r));
+    } else {
+        rl = vcast_vf_f(0.0f);
+    }
+    if (precise != LOG_RELAXED) {
+        rl = vfma_vf_vf_vf_vf(h, vcast_vf_f(LOG_F_LOG10E_LO), rl);
+    }
+    rl = vfma_vf_vf_vf_vf(l, vcast_vf_f(LOG_F_LOG10E_HI), rl);
+    r = vadd_vf_vf_vf(r, rl);
+    return __log_special_f(x, r);
+}
+
+/*
+ * Double precision
+ */
+
+#define LOG_D_LOG10E_HI  0.43429448190325182
+#define LOG_D_LOG10E_LO  1.0983196502167651e-17
+
+/* P(z), relaxed */
+#define LOG_D_R0    0.33333333333331039
+#define LOG_D_R1    0.20000000005603299
+#define LOG_D_R2    0.14285712069147197
+#define LOG_D_R3    0.11111431141674151
+#define LOG_D_R4    0.090700968306215352
+#define LOG_D_R5    0.083109096463253401
+
+/* P(z), fast and precise */
+#define LOG_D_P0    0.33333333333333331
+#define LOG_D_P1    0.2000000000000044
+#define LOG_D_P2    0.14285714285401802
+#define LOG_D_P3    0.11111111195857672
+#define LOG_D_P4    0.090908978199903151
+#define LOG_D_P5    0.076931198555485775
+#define LOG_D_P6    0.066343864584221132
+#define LOG_D_P7    0.065433142337682743
+
+/* x = 2**e * m, sqrt(2)/2 <= m < sqrt(2), for finite x > 0. */
+vdouble static INLINE
+__log_reduce_d(vdouble x, vdouble *e)
+{
+    vopmask tiny;
+    vint2 ix;
+    vdouble t;
+
+    tiny = vlt_vo_vd_vd(x, vcast_vd_d(0x1p-1022));
+    x = vsel_vd_vo_vd_vd(tiny, vmul_vd_vd_vd(x, vcast_vd_d(0x1p+54)), x);
+
+    /*
+     * Offset the bits so that the exponent field rounds at sqrt(2)/2, and
+     * convert the field to double by way of the bits of 2**52.
+     */
+    ix = vadd64_vi2_vi2_vi2(vreinterpret_vi2_vd(x),
+                            (vint2)vcast_vm_i_i(0x00095f61, 0x9980c433));
+    t = vreinterpret_vd_vi2(vor_vi2_vi2_vi2(vsrl64_vi2_vi2_i(ix, 52),
+                            (vint2)vcast_vm_i_i(0x43300000, 0)));
+    t = vsub_vd_vd_vd(t, vcast_vd_d(0x1p+52 + 1023.0));
+    *e = vsel_vd_vo_vd_vd(tiny, vsub_vd_vd_vd(t, vcast_vd_d(54.0)), t);
+    ix = vand_vi2_vi2_vi2(ix, (vint2)vcast_vm_i_i(0x000fffff, 0xffffffff));
+    return vreinterpret_vd_vi2(vadd64_vi2_vi2_vi2(ix,
+                               (vint2)vcast_vm_i_i(0x3fe6a09e, 0x667f3bcd)));
+}
+
+/* log(x) = result + *lo for finite x > 0, including denormals. */
+vdouble static INLINE
+__log_kernel_d(vdouble const x, int const precise, vdouble *lo)
+{
+    vdouble e, m, u, v, f, fl, z, w, el, s;
+
+    m = __log_reduce_d(x, &e);
+
+    /* m - 1 is exact. */
+    u = vsub_vd_vd_vd(m, vcast_vd_d(1.0));
+    v = vadd_vd_vd_vd(m, vcast_vd_d(1.0));
+    f = vdiv_vd_vd_vd(u, v);
+    z = vmul_vd_vd_vd(f, f);
+    if (precise == LOG_RELAXED) {
+        w = vfma_vd_vd_vd_vd(vcast_vd_d(LOG_D_R5), z, vcast_vd_d(LOG_D_R4));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(LOG_D_R3));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(LOG_D_R2));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(LOG_D_R1));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(LOG_D_R0));
+    } else {
+        w = vfma_vd_vd_vd_vd(vcast_vd_d(LOG_D_P7), z, vcast_vd_d(LOG_D_P6));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(LOG_D_P5));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(LOG_D_P4));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(LOG_D_P3));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(LOG_D_P2));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(LOG_D_P1));
+        w = vfma_vd_vd_vd_vd(w, z, vcast_vd_d(LOG_D_P0));
+    }
+    w = vmul_vd_vd_vd(vmul_vd_vd_vd(f, z), w);
+    el = vmul_vd_vd_vd(e, vcast_vd_d(L2L));
+    if (precise != LOG_RELAXED) {
+        /*
+         * f + fl = u/v; v - 1 is exact, so m - (v - 1) is the error of v.
+         * fl only needs a few bits, so 1/v comes from its minimax line on
+         * [1 + sqrt(2)/2, 1 + sqrt(2)] (1.3% error) instead of a divide.
+         */
+        fl = vfma_vd_vd_vd_vd(vneg_vd_vd(f), v, u);
+        fl = vfma_vd_vd_vd_vd(vneg_vd_vd(f),
+                 vsub_vd_vd_vd(m, vsub_vd_vd_vd(v, vcast_vd_d(1.0))), fl);
+        fl = vmul_vd_vd_vd(fl, vfma_vd_vd_vd_vd(v, vcast_vd_d(-0.24264069),
+                                          vcast_vd_d(0.99258569)));
+        el = vfma_vd_vd_vd_vd(fl, vcast_vd_d(2.0), el);
+    }
+
+    /*
+     * e*ln2_hi is exact and, unless e is zero, larger than 2*f, so the
+     * error of the sum below is exact.
+     */
+    e = vmul_vd_vd_vd(e, vcast_vd_d(L2U));
+    f = vadd_vd_vd_vd(f, f);
+    s = vadd_vd_vd_vd(e, f);
+    *lo = vadd_vd_vd_vd(vsub_vd_vd_vd(f, vsub_vd_vd_vd(s, e)),
+                      vfma_vd_vd_vd_vd(w, vcast_vd_d(2.0), el));
+    return s;
+}
+
+/* Result for x <= 0, infinite or NaN x; r elsewhere. */
+vdouble static INLINE
+__log_special_d(vdouble const x, vdouble r)
+{
+    r = vsel_vd_vo_vd_vd(vispinf_vo_vd(x), x, r);
+    r = vsel_vd_vo_vd_vd(veq_vo_vd_vd(x, vcast_vd_d(0.0)), vcast_vd_d(-INFINITY), r);
+    r = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(x, vcast_vd_d(0.0)), vcast_vd_d(NAN), r);
+    return vsel_vd_vo_vd_vd(visnan_vo_vd(x), x, r);
+}
+
+vdouble static INLINE
+__log_d_vec(vdouble const x, int const precise)
+{
+    vdouble h, l;
+
+    h = __log_kernel_d(x, precise, &l);
+    return __log_special_d(x, vadd_vd_vd_vd(h, l));
+}
+
+vdouble static INLINE
+__log10_d_vec(vdouble const x, int const precise)
+{
+    vdouble h, l, r, rl;
+
+    h = __log_kernel_d(x, precise, &l);
+    r = vmul_vd_vd_vd(h, vcast_vd_d(LOG_D_LOG10E_HI));
+    if (precise == LOG_PRECISE) {
+        rl = vfma_vd_vd_vd_vd(h, vcast_vd_d(LOG_D_LOG10E_HI), vneg_vd_vd(r));
+    } else {
+        rl = vcast_vd_d(0.0);
+    }
+    if (precise != LOG_RELAXED) {
+        rl = vfma_vd_vd_vd_vd(h, vcast_vd_d(LOG_D_LOG10E_LO), rl);
+    }
+    rl = vfma_vd_vd_vd_vd(l, vcast_vd_d(LOG_D_LOG10E_HI), rl);
+    r = vadd_vd_vd_vd(r, rl);
+    return __log_special_d(x, r);
+}
+
+#endif // __LOG_VEC_H__
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Array entry points.
+ *
+ * Instead of one call per vector, these take an element count and strided
+ * input/output arrays and stream the whole array through the dispatched
+ * vector kernels:
+ *
+ *   __[frp][sd]_<NAME>_array(n, x, incx, r, incr)          exp, log, sin,
+ *                                                          cos, tanh, sqrt
+ *   __[frp][sd]_<NAME>_array(n, x, incx, y, incy, r, incr) pow, div
+ *   __[frp][sd]_sincos_array(n, x, incx, s, incs, c, incc)
+ *
+ * r[i*incr] = NAME(x[i*incx]) for 0 <= i < n.  Strides are in elements and
+ * may be negative, in which case the array pointer addresses the element
+ * that is processed first.  The result may be the same array, with the
+ * same stride, as an input.  For sincos, s and c must not overlap x.
+ *
+ * The dispatch table is consulted once per call for the widest vector
+ * length the selected architecture supports, and the vector length
+ * specific worker in mth_array_vl.c then calls the kernel directly for
+ * each vector, using the masked kernel for the alignment peel and for the
+ * remainder.
+ *
+ * The vector sincos table entries return their second result in a
+ * register C cannot name.  Single precision sincos streams through the C
+ * callable form of the fused kernel when the table selects one, and
+ * otherwise, like double precision, is computed as a sin pass followed by
+ * a cos pass.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "mth_intrinsics.h"
+#include "mth_tbldefs.h"
+
+#define ARRAY_VL_PROTOS(_p, _t, _vl) \
+extern void __mth_array_##_p##_vl##_1(p2f, p2f, int64_t, \
+                _t *, int64_t, _t *, int64_t); \
+extern void __mth_array_##_p##_vl##_2(p2f, p2f, int64_t, \
+                _t *, int64_t, _t *, int64_t, _t *, int64_t);
+
+#define ARRAY_VL_SINCOS_PROTO(_p, _t, _vl) \
+extern void __mth_array_##_p##_vl##_sincos(p2f, int64_t, \
+                _t *, int64_t, _t *, int64_t, _t *, int64_t);
+
+ARRAY_VL_PROTOS(s, float, 4)
+ARRAY_VL_PROTOS(d, double, 2)
+#if defined(TARGET_X8664)
+ARRAY_VL_PROTOS(s, float, 8)
+ARRAY_VL_PROTOS(d, double, 4)
+ARRAY_VL_PROTOS(s, float, 16)
+ARRAY_VL_PROTOS(d, double, 8)
+ARRAY_VL_SINCOS_PROTO(s, float, 8)
+ARRAY_VL_SINCOS_PROTO(s, float, 16)
+#endif
+
+#if defined(TARGET_X8664)
+/*
+ * Fused single precision sincos kernels: the table entry, and the form
+ * that returns sin(x) and stores cos(x) through a pointer.
+ */
+extern void __fs_sincos_8_avx2();
+extern void __fs_sincos_8_avx2_ptr();
+extern void __fs_sincos_16_avx512();
+extern void __fs_sincos_16_avx512_ptr();
+#endif
+
+/*
+ * vec is false for functions whose only vector entries are masked.
+ */
+#define VPTR(_func, _sv, _frp, _vec) \
+        ((_vec) ? MTH_DISPATCH_TBL[_func][_sv][_frp] : (p2f)0), \
+        MTH_DISPATCH_TBL[_func][_sv##m][_frp]
+
+static void
+array_s_1(func_e func, frp_e frp, bool vec,
+          int64_t n, float *x, int64_t incx, float *r, int64_t incr)
+{
+  switch (__math_dispatch_vreg_size()) {
+#if defined(TARGET_X8664)
+  case 512:
+    __mth_array_s16_1(VPTR(func, sv_sv16, frp, vec), n, x, incx, r, incr);
+    return;
+  case 256:
+    __mth_array_s8_1(VPTR(func, sv_sv8, frp, vec), n, x, incx, r, incr);
+    return;
+#endif
+  default:
+    __mth_array_s4_1(VPTR(func, sv_sv4, frp, vec), n, x, incx, r, incr);
+    return;
+  }
+}
+
+static void
+array_d_1(func_e func, frp_e frp, bool vec,
+          int64_t n, double *x, int64_t incx, double *r, int64_t incr)
+{
+  switch (__math_dispatch_vreg_size()) {
+#if defined(TARGET_X8664)
+  case 512:
+    __mth_array_d8_1(VPTR(func, sv_dv8, frp, vec), n, x, incx, r, incr);
+    return;
+  case 256:
+    __mth_array_d4_1(VPTR(func, sv_dv4, frp, vec), n, x, incx, r, incr);
+    return;
+#endif
+  default:
+    __mth_array_d2_1(VPTR(func, sv_dv2, frp, vec), n, x, incx, r, incr);
+    return;
+  }
+}
+
+static void
+array_s_2(func_e func, frp_e frp, bool vec,
+          int64_t n, float *x, int64_t incx, float *y, int64_t incy,
+          float *r, int64_t incr)
+{
+  switch (__math_dispatch_vreg_size()) {
+#if defined(TARGET_X8664)
+  case 512:
+    __mth_array_s16_2(VPTR(func, sv_sv16, frp, vec),
+                      n, x, incx, y, incy, r, incr);
+    return;
+  case 256:
+    __mth_array_s8_2(VPTR(func, sv_sv8, frp, vec),
+                     n, x, incx, y, incy, r, incr);
+    return;
+#endif
+  default:
+    __mth_array_s4_2(VPTR(func, sv_sv4, frp, vec),
+                     n, x, incx, y, incy, r, incr);
+    return;
+  }
+}
+
+static void
+array_d_2(func_e func, frp_e frp, bool vec,
+          int64_t n, double *x, int64_t incx, double *y, int64_t incy,
+          double *r, int64_t incr)
+{
+  switch (__math_dispatch_vreg_size()) {
+#if defined(TARGET_X8664)
+  case 512:
+    __mth_array_d8_2(VPTR(func, sv_dv8, frp, vec),
+                     n, x, incx, y, incy, r, incr);
+    return;
+  case 256:
+    __mth_array_d4_2(VPTR(func, sv_dv4, frp, vec),
+                     n, x, incx, y, incy, r, incr);
+    return;
+#endif
+  default:
+    __mth_array_d2_2(VPTR(func, sv_dv2, frp, vec),
+                     n, x, incx, y, incy, r, incr);
+    return;
+  }
+}
+
+static void
+array_s_sincos(frp_e frp, int64_t n, float *x, int64_t incx,
+               float *s, int64_t incs, float *c, int64_t incc)
+{
+#if defined(TARGET_X8664)
+  switch (__math_dispatch_vreg_size()) {
+  case 512:
+    if (MTH_DISPATCH_TBL[func_sincos][sv_sv16][frp] ==
+        (p2f)__fs_sincos_16_avx512) {
+      __mth_array_s16_sincos((p2f)__fs_sincos_16_avx512_ptr,
+                             n, x, incx, s, incs, c, incc);
+      return;
+    }
+    /* Fall through - the 512-bit entry may be two 256-bit calls. */
+  case 256:
+    if (MTH_DISPATCH_TBL[func_sincos][sv_sv8][frp] ==
+        (p2f)__fs_sincos_8_avx2) {
+      __mth_array_s8_sincos((p2f)__fs_sincos_8_avx2_ptr,
+                            n, x, incx, s, incs, c, incc);
+      return;
+    }
+    break;
+  }
+#endif
+  array_s_1(func_sin, frp, true, n, x, incx, s, incs);
+  array_s_1(func_cos, frp, true, n, x, incx, c, incc);
+}
+
+#define ARRAY_FUNC1_FRP(_frp, _name, _vec) \
+void \
+__##_frp##s_##_name##_array(int64_t n, float *x, int64_t incx, \
+                            float *r, int64_t incr) \
+{ \
+  array_s_1(func_##_name, frp_##_frp, _vec, n, x, incx, r, incr); \
+} \
+\
+void \
+__##_frp##d_##_name##_array(int64_t n, double *x, int64_t incx, \
+                            double *r, int64_t incr) \
+{ \
+  array_d_1(func_##_name, frp_##_frp, _vec, n, x, incx, r, incr); \
+}
+
+#define ARRAY_FUNC2_FRP(_frp, _name, _vec) \
+void \
+__##_frp##s_##_name##_array(int64_t n, float *x, int64_t incx, \
+                            float *y, int64_t incy, float *r, int64_t incr) \
+{ \
+  array_s_2(func_##_name, frp_##_frp, _vec, n, x, incx, y, incy, r, incr); \
+} \
+\
+void \
+__##_frp##d_##_name##_array(int64_t n, double *x, int64_t incx, \
+                            double *y, int64_t incy, double *r, int64_t incr) \
+{ \
+  array_d_2(func_##_name, frp_##_frp, _vec, n, x, incx, y, incy, r, incr); \
+}
+
+#define ARRAY_SINCOS_FRP(_frp) \
+void \
+__##_frp##s_sincos_array(int64_t n, float *x, int64_t incx, \
+                         float *s, int64_t incs, float *c, int64_t incc) \
+{ \
+  array_s_sincos(frp_##_frp, n, x, incx, s, incs, c, incc); \
+} \
+\
+void \
+__##_frp##d_sincos_array(int64_t n, double *x, int64_t incx, \
+                         double *s, int64_t incs, double *c, int64_t incc) \
+{ \
+  array_d_1(func_sin, frp_##_frp, true, n, x, incx, s, incs); \
+  array_d_1(func_cos, frp_##_frp, true, n, x, incx, c, incc); \
+}
+
+#define ARRAY_FUNC1(_name, _vec) \
+  ARRAY_FUNC1_FRP(f, _name, _vec) \
+  ARRAY_FUNC1_FRP(r, _name, _vec) \
+  ARRAY_FUNC1_FRP(p, _name, _vec)
+
+#define ARRAY_FUNC2(_name, _vec) \
+  ARRAY_FUNC2_FRP(f, _name, _vec) \
+  ARRAY_FUNC2_FRP(r, _name, _vec) \
+  ARRAY_FUNC2_FRP(p, _name, _vec)
+
+ARRAY_FUNC1(exp, true)
+ARRAY_FUNC1(log, true)
+ARRAY_FUNC1(sin, true)
+ARRAY_FUNC1(cos, true)
+ARRAY_FUNC1(tanh, true)
+ARRAY_FUNC1(sqrt, false)
+ARRAY_FUNC2(pow, true)
+ARRAY_FUNC2(div, false)
+
+ARRAY_SINCOS_FRP(f)
+ARRAY_SINCOS_FRP(r)
+ARRAY_SINCOS_FRP(p)
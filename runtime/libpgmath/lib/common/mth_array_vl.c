@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Vector length specific workers for the array entry points in mth_array.c.
+ *
+ * This file is compiled once for each PRECSIZE/VLEN pair, with the same
+ * instruction set flags as the mth_<VL>defs.c entry points of that width,
+ * so that VFLOAT arguments are passed to the kernels in vector registers.
+ *
+ * Each worker streams n elements through the vector kernel fvec, VLEN
+ * elements at a time.  Contiguous arrays are peeled until the result is
+ * VLEN aligned, and both the peel and the remainder are passed to the
+ * masked kernel fmask with the inactive lanes zero filled.  Strided arrays
+ * are gathered into, and scattered from, an aligned temporary.
+ *
+ * A NULL fvec means the function only has a masked kernel (div, sqrt), in
+ * which case full vectors are passed to fmask with every lane active.
+ *
+ * The sincos worker takes the C callable form of a fused sincos kernel,
+ * VFLOAT k(VFLOAT x, VFLOAT *c), which returns sin(x) and stores cos(x).
+ * It has no masked form: the zero filled lanes of the remainder are
+ * computed and dropped.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "mth_intrinsics.h"
+#include "mth_tbldefs.h"
+
+#if PRECSIZE == 4
+#define PREC    s
+#define FLOAT   float
+#define INT     int32_t
+#else
+#define PREC    d
+#define FLOAT   double
+#define INT     int64_t
+#endif
+
+#define CONCAT4_(a,b,c,d) a##b##c##d
+#define CONCAT4(a,b,c,d) CONCAT4_(a,b,c,d)
+#define VFLOAT  CONCAT4(vr,PREC,VLEN,_t)
+#define VINT    CONCAT4(vi,PREC,VLEN,_t)
+
+#define ARRAY1NAME      CONCAT4(__mth_array_,PREC,VLEN,_1)
+#define ARRAY2NAME      CONCAT4(__mth_array_,PREC,VLEN,_2)
+#define ARRAYSCNAME     CONCAT4(__mth_array_,PREC,VLEN,_sincos)
+
+typedef VFLOAT  (*vfunc1_t)(VFLOAT);
+typedef VFLOAT  (*vfunc1m_t)(VFLOAT, VINT);
+typedef VFLOAT  (*vfunc2_t)(VFLOAT, VFLOAT);
+typedef VFLOAT  (*vfunc2m_t)(VFLOAT, VFLOAT, VINT);
+typedef VFLOAT  (*vfuncsc_t)(VFLOAT, VFLOAT *);
+
+#define ALIGNED __attribute__((aligned((VLEN*sizeof(FLOAT)))))
+
+/*
+ * Number of leading elements of r to peel so that the vector stores that
+ * follow are VLEN aligned.  Arrays that are not even element aligned are
+ * left alone and use unaligned stores throughout.
+ */
+static inline int64_t
+peel_count(FLOAT *r, int64_t n)
+{
+  uintptr_t a = (uintptr_t)r;
+  int64_t k;
+
+  if (a % sizeof(FLOAT) != 0)
+    return 0;
+  k = (VLEN - (a / sizeof(FLOAT)) % VLEN) % VLEN;
+  return k < n ? k : n;
+}
+
+static inline VINT
+lane_mask(int64_t k)
+{
+  VINT m;
+  int i;
+
+  for (i = 0 ; i < VLEN; i++)
+    m[i] = i < k ? (INT)-1 : 0;
+  return m;
+}
+
+static inline VFLOAT
+load_partial(FLOAT *x, int64_t incx, int64_t k)
+{
+  FLOAT t[VLEN] ALIGNED = {0};
+  int64_t i;
+
+  for (i = 0 ; i < k; i++)
+    t[i] = x[i*incx];
+  return *(VFLOAT *)t;
+}
+
+static inline void
+store_partial(FLOAT *r, int64_t incr, int64_t k, VFLOAT v)
+{
+  int64_t i;
+
+  for (i = 0 ; i < k; i++)
+    r[i*incr] = v[i];
+}
+
+static inline VFLOAT
+load_full(FLOAT *x, int64_t incx)
+{
+  VFLOAT v;
+  int i;
+
+  if (incx == 1) {
+    memcpy(&v, x, sizeof(v));
+  } else {
+    for (i = 0 ; i < VLEN; i++)
+      v[i] = x[i*incx];
+  }
+  return v;
+}
+
+static inline void
+store_full(FLOAT *r, int64_t incr, VFLOAT v)
+{
+  int i;
+
+  if (incr == 1) {
+    memcpy(r, &v, sizeof(v));
+  } else {
+    for (i = 0 ; i < VLEN; i++)
+      r[i*incr] = v[i];
+  }
+}
+
+void
+ARRAY1NAME(p2f fvec, p2f fmask, int64_t n,
+           FLOAT *x, int64_t incx, FLOAT *r, int64_t incr)
+{
+  vfunc1_t f = (vfunc1_t)fvec;
+  vfunc1m_t fm = (vfunc1m_t)fmask;
+  VINT all = lane_mask(VLEN);
+  int64_t i = 0;
+  int64_t k;
+
+  if (n <= 0)
+    return;
+
+  if (incx == 1 && incr == 1) {
+    k = peel_count(r, n);
+    if (k > 0) {
+      store_partial(r, 1, k, fm(load_partial(x, 1, k), lane_mask(k)));
+      i = k;
+    }
+  }
+
+  for ( ; i + VLEN <= n; i += VLEN) {
+    VFLOAT v = load_full(&x[i*incx], incx);
+    store_full(&r[i*incr], incr, f ? f(v) : fm(v, all));
+  }
+
+  k = n - i;
+  if (k > 0) {
+    store_partial(&r[i*incr], incr, k,
+                  fm(load_partial(&x[i*incx], incx, k), lane_mask(k)));
+  }
+}
+
+void
+ARRAY2NAME(p2f fvec, p2f fmask, int64_t n,
+           FLOAT *x, int64_t incx, FLOAT *y, int64_t incy,
+           FLOAT *r, int64_t incr)
+{
+  vfunc2_t f = (vfunc2_t)fvec;
+  vfunc2m_t fm = (vfunc2m_t)fmask;
+  VINT all = lane_mask(VLEN);
+  int64_t i = 0;
+  int64_t k;
+
+  if (n <= 0)
+    return;
+
+  if (incx == 1 && incy == 1 && incr == 1) {
+    k = peel_count(r, n);
+    if (k > 0) {
+      store_partial(r, 1, k, fm(load_partial(x, 1, k),
+                                load_partial(y, 1, k), lane_mask(k)));
+      i = k;
+    }
+  }
+
+  for ( ; i + VLEN <= n; i += VLEN) {
+    VFLOAT vx = load_full(&x[i*incx], incx);
+    VFLOAT vy = load_full(&y[i*incy], incy);
+    store_full(&r[i*incr], incr, f ? f(vx, vy) : fm(vx, vy, all));
+  }
+
+  k = n - i;
+  if (k > 0) {
+    store_partial(&r[i*incr], incr, k,
+                  fm(load_partial(&x[i*incx], incx, k),
+                     load_partial(&y[i*incy], incy, k), lane_mask(k)));
+  }
+}
+
+void
+ARRAYSCNAME(p2f fsincos, int64_t n, FLOAT *x, int64_t incx,
+            FLOAT *s, int64_t incs, FLOAT *c, int64_t incc)
+{
+  vfuncsc_t f = (vfuncsc_t)fsincos;
+  VFLOAT vs, vc;
+  int64_t i;
+  int64_t k;
+
+  for (i = 0 ; i + VLEN <= n; i += VLEN) {
+    vs = f(load_full(&x[i*incx], incx), &vc);
+    store_full(&s[i*incs], incs, vs);
+    store_full(&c[i*incc], incc, vc);
+  }
+
+  k = n - i;
+  if (k > 0) {
+    vs = f(load_partial(&x[i*incx], incx, k), &vc);
+    store_partial(&s[i*incs], incs, k, vs);
+    store_partial(&c[i*incc], incc, k, vc);
+  }
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2017-2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * GNU IFUNC binding of the dispatched entry points.
+ *
+ * When libpgmath is built with LIBPGMATH_WITH_IFUNC, this file replaces
+ * mth_128defs.c, mth_256defs.c and mth_512defs.c.  Each public entry point
+ * __[frp][sdcz]_<NAME>_<VL> becomes an indirect function whose resolver
+ * returns the entry __math_dispatch() selected for it, so the dynamic
+ * linker binds every call site once and calls go directly to the kernel
+ * without loading from __mth_rt_vi_ptrs.
+ *
+ * Resolvers may run before libc is initialized (static links, IRELATIVE
+ * relocations), so __math_dispatch_resolve() selects from CPUID and the
+ * mth_intrins_defs table alone.  When one of the environment controls
+ * applied by __math_dispatch() -- MTH_I_ARCH, MTH_I_{FAST,RELAXED,PRECISE},
+ * MTH_I_OVERRIDE or MTH_I_STATS -- is set, it binds each entry point to
+ * its _init form instead, which looks its kernel up in __mth_rt_vi_ptrs
+ * on every call, as the build without IFUNC does.
+ *
+ * The list of entry points is tmp-mth_statsdefs.h, generated from
+ * mth_128defs.c, mth_256defs.c and mth_512defs.c.
+ */
+
+#include <stdint.h>
+#include "mth_tbldefs.h"
+
+#define _STRINGIFY(s) #s
+#define STRINGIFY(s) _STRINGIFY(s)
+
+#undef  DO_MTH_DISPATCH_FUNC
+#define DO_MTH_DISPATCH_FUNC(name_, func_, sv_, frp_)                      \
+  extern void name_##_init();                                              \
+  static p2f name_##_resolve(void)                                         \
+  {                                                                        \
+    return __math_dispatch_resolve(func_, sv_, frp_, name_##_init);        \
+  }                                                                        \
+  void name_() __attribute__((ifunc(STRINGIFY(name_##_resolve))));
+
+#include "tmp-mth_statsdefs.h"
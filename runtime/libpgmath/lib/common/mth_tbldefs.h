@@ -163,6 +163,8 @@ typedef	struct	{
 
 extern	p2f	__mth_rt_vi_ptrs[func_size][sv_size][frp_size];
 extern	p2f	__mth_rt_vi_ptrs_stat[func_size][sv_size][frp_size];
+extern	p2f	__math_dispatch_resolve(func_e, sv_e, frp_e, p2f);
+extern	int	__math_dispatch_vreg_size(void);
 //extern	p2f	__mth_rt_intrins_ptrs[func_size][sv_size][frp_size];
 
 // _func: function
@@ -189,20 +191,42 @@ extern void _s ();
 extern	void __math_dispatch_init();
 #endif
 
-#ifdef	MTH_I_INTRIN_STATS
-#undef	MTH_DISPATCH_FUNC
-#define	MTH_DISPATCH_FUNC(f)	f##_prof
-#undef	MTH_DISPATCH_TBL
-#define	MTH_DISPATCH_TBL	__mth_rt_vi_ptrs_stat
 /*
  * Unsigned integers of number of calls.
  *
+ * Each thread counts into its own mth_rt_stats_blk_t, allocated on the
+ * thread's first profiled call.  The type is cache line aligned, and so
+ * padded to a whole number of lines, so no two threads share a line.
+ * Blocks stay on a list after their thread exits, and __math_epilog()
+ * sums them into __mth_rt_stats while other threads may still be
+ * counting, so counters are read and written with relaxed atomics; the
+ * owning thread's load and store is not a locked read-modify-write.
+ *
  * XXX - Layout of the table is *different* than __mth_rt_vi_ptrs.
  * TBD which layout is better.
  */
+typedef struct mth_rt_stats_blk {
+	uint64_t	cnt[frp_size][func_size][sv_size];
+	struct mth_rt_stats_blk	*next;
+} __attribute__((aligned(64))) mth_rt_stats_blk_t;
+
 extern	uint64_t	__mth_rt_stats[frp_size][func_size][sv_size];
+extern	__thread mth_rt_stats_blk_t	*__mth_rt_stats_blk;
+extern	mth_rt_stats_blk_t	*__math_stats_blk_alloc(void);
+
+#ifdef	MTH_I_INTRIN_STATS
+#undef	MTH_DISPATCH_FUNC
+#define	MTH_DISPATCH_FUNC(f)	f##_prof
+#undef	MTH_DISPATCH_TBL
+#define	MTH_DISPATCH_TBL	__mth_rt_vi_ptrs_stat
 #define	_MTH_I_STATS_INC(_func,_sv,_frp) \
-	(void)__sync_fetch_and_add(&__mth_rt_stats[_frp][_func][_sv], 1);
+	do { \
+	  mth_rt_stats_blk_t *_pblk = __mth_rt_stats_blk; \
+	  if (_pblk == 0) _pblk = __math_stats_blk_alloc(); \
+	  uint64_t *_pcnt = &_pblk->cnt[_frp][_func][_sv]; \
+	  __atomic_store_n(_pcnt, __atomic_load_n(_pcnt, __ATOMIC_RELAXED) + 1, \
+	                   __ATOMIC_RELAXED); \
+	} while (0);
 #else	// MTH_I_INTRIN_STATS
 #define	_MTH_I_STATS_INC(_func,_sv,_frp)
 #endif	// MTH_I_INTRIN_STATS
@@ -0,0 +1,433 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Vector pow built on the log and exp kernels of log_vec.h and
+ * hyperbolic_vec.h.
+ *
+ * Must be included after one of helperavx2_128.h, helperavx2.h or
+ * helperavx512f.h, which supply the vfloat/vdouble abstraction.
+ *
+ * |x|**y = exp(y*log|x|).  log|x| is reduced as in __log_kernel, but the
+ * leading 2*f + 2/3*f**3 of 2*atanh(f) is kept in extended precision and
+ * the correction term of f is exact, so log|x| = hi + lo holds about 64
+ * (double) or 35 (float) bits.  Its product with y is formed exactly as
+ * Y + Yl, which is reduced as n*ln(2) + s, and exp(s) is evaluated with the
+ * expm1 polynomial of the hyperbolic kernels.  2**n is applied in two steps
+ * so that the result overflows and underflows correctly.
+ *
+ * The special cases follow C99 Annex F: pow(x, +-0) and pow(+1, y) are 1
+ * even for NaN, a negative finite x requires an integer y, and the sign of
+ * x is kept for odd integer y.
+ */
+
+#ifndef __POW_VEC_H__
+#define __POW_VEC_H__
+
+#include "misc.h"
+#include "log_vec.h"
+#include "hyperbolic_vec.h"
+
+#define POW_FAST     0
+#define POW_RELAXED  1
+#define POW_PRECISE  2
+
+/*
+ * Single precision
+ */
+
+/* Y is clamped to where exp(Y) certainly overflows or underflows. */
+#define POW_F_YMAX      89.5f
+#define POW_F_YMIN      -104.0f
+#define POW_F_SCALE     32.0f
+#define POW_F_POW2SCALE 4294967296.0f           /* 2**32 */
+#define POW_F_TWO23     8388608.0f              /* 2**23 */
+
+#define POW_F_TWO3_HI    0.666666687f
+#define POW_F_TWO3_LO    -1.98682149e-08f
+
+/* 2*Q(z) */
+#define POW_F_Q0         0.400000154f
+#define POW_F_Q1         0.285622358f
+#define POW_F_Q2         0.230482324f
+
+/* round(a) for 0 <= a < 2**23. */
+vfloat static INLINE
+__pow_rint_f(vfloat const a)
+{
+    return vsub_vf_vf_vf(vadd_vf_vf_vf(a, vcast_vf_f(POW_F_TWO23)),
+                         vcast_vf_f(POW_F_TWO23));
+}
+
+/*
+ * y is an integer; *odd is set for odd integers.  Every float of magnitude
+ * 2**23 or more is an integer, and from 2**24 on it is even.
+ */
+vopmask static INLINE
+__pow_isint_f(vfloat const y, vopmask *odd)
+{
+    vfloat ay, h;
+    vopmask isint;
+
+    ay = vabs_vf_vf(y);
+    isint = vor_vo_vo_vo(vge_vo_vf_vf(ay, vcast_vf_f(POW_F_TWO23)),
+                         veq_vo_vf_vf(__pow_rint_f(ay), ay));
+    h = vmul_vf_vf_vf(ay, vcast_vf_f(0.5f));
+    *odd = vand_vo_vo_vo(vlt_vo_vf_vf(ay, vcast_vf_f(2.0f * POW_F_TWO23)),
+                         vneq_vo_vf_vf(__pow_rint_f(h), h));
+    *odd = vand_vo_vo_vo(*odd, isint);
+    return isint;
+}
+
+/*
+ * log(x) = result + *lo for finite x > 0, including denormals, with
+ * 2*atanh(f) = 2*f + 2/3*f**3 + 2*f**5*Q(f**2).
+ */
+vfloat static INLINE
+__pow_log_f(vfloat const x, vfloat *lo)
+{
+    vfloat e, m, u, v, f, fl, z, zl, c, cl, t, tl, q, s, h;
+
+    m = __log_reduce_f(x, &e);
+
+    /*
+     * f + fl = u/v.  m - 1 is exact and m - (v - 1) is the error of v; with
+     * f close to u/v, 1/v = (1 - f)/2 to working precision.
+     */
+    u = vsub_vf_vf_vf(m, vcast_vf_f(1.0f));
+    v = vadd_vf_vf_vf(m, vcast_vf_f(1.0f));
+    f = vdiv_vf_vf_vf(u, v);
+    fl = vfma_vf_vf_vf_vf(vneg_vf_vf(f), v, u);
+    fl = vfma_vf_vf_vf_vf(vneg_vf_vf(f), vsub_vf_vf_vf(m, vsub_vf_vf_vf(v, vcast_vf_f(1.0f))), fl);
+    fl = vmul_vf_vf_vf(fl, vfma_vf_vf_vf_vf(f, vcast_vf_f(-0.5f), vcast_vf_f(0.5f)));
+
+    /* c + cl = f**3, t + tl = 2/3*f**3 + 2*f**5*Q(f**2) */
+    z = vmul_vf_vf_vf(f, f);
+    zl = vfma_vf_vf_vf_vf(f, f, vneg_vf_vf(z));
+    c = vmul_vf_vf_vf(f, z);
+    cl = vfma_vf_vf_vf_vf(f, zl, vfma_vf_vf_vf_vf(f, z, vneg_vf_vf(c)));
+    t = vmul_vf_vf_vf(c, vcast_vf_f(POW_F_TWO3_HI));
+    tl = vfma_vf_vf_vf_vf(c, vcast_vf_f(POW_F_TWO3_HI), vneg_vf_vf(t));
+    tl = vfma_vf_vf_vf_vf(c, vcast_vf_f(POW_F_TWO3_LO), tl);
+    tl = vfma_vf_vf_vf_vf(cl, vcast_vf_f(POW_F_TWO3_HI), tl);
+
+    q = vfma_vf_vf_vf_vf(vcast_vf_f(POW_F_Q2), z, vcast_vf_f(POW_F_Q1));
+    q = vfma_vf_vf_vf_vf(q, z, vcast_vf_f(POW_F_Q0));
+    q = vmul_vf_vf_vf(vmul_vf_vf_vf(c, z), q);
+    h = vadd_vf_vf_vf(t, q);
+    tl = vadd_vf_vf_vf(tl, vadd_vf_vf_vf(vsub_vf_vf_vf(t, h), q));
+    t = h;
+
+    /* fl enters as 2*fl*(1 + f**2), the derivative of the leading terms. */
+    tl = vfma_vf_vf_vf_vf(e, vcast_vf_f(L2Lf), tl);
+    tl = vfma_vf_vf_vf_vf(vadd_vf_vf_vf(fl, fl), vadd_vf_vf_vf(z, vcast_vf_f(1.0f)), tl);
+
+    /*
+     * e*ln2_hi is exact and, unless e is zero, larger than 2*f, which is
+     * larger than t, so the errors of both sums below are exact.
+     */
+    e = vmul_vf_vf_vf(e, vcast_vf_f(L2Uf));
+    f = vadd_vf_vf_vf(f, f);
+    s = vadd_vf_vf_vf(e, f);
+    tl = vadd_vf_vf_vf(tl, vsub_vf_vf_vf(f, vsub_vf_vf_vf(s, e)));
+    h = vadd_vf_vf_vf(s, t);
+    *lo = vadd_vf_vf_vf(tl, vsub_vf_vf_vf(t, vsub_vf_vf_vf(h, s)));
+    return h;
+}
+
+vfloat static INLINE
+__pow_f_vec(vfloat const x, vfloat const y, int const precise)
+{
+    vfloat ax, h, l, yh, yl, s, sl, k, u, ul, t, r;
+    vopmask isint, odd, o;
+
+    ax = vabs_vf_vf(x);
+    h = __pow_log_f(ax, &l);
+
+    /* yh + yl = y*(h + l); yl is dropped where yh gets clamped. */
+    yh = vmul_vf_vf_vf(y, h);
+    yl = vfma_vf_vf_vf_vf(y, h, vneg_vf_vf(yh));
+    yl = vfma_vf_vf_vf_vf(y, l, yl);
+    o = vand_vo_vo_vo(vlt_vo_vf_vf(yh, vcast_vf_f(POW_F_YMAX)),
+                      vgt_vo_vf_vf(yh, vcast_vf_f(POW_F_YMIN)));
+    yl = vsel_vf_vo_vf_vf(o, yl, vcast_vf_f(0.0f));
+    yh = vmax_vf_vf_vf(vmin_vf_vf_vf(yh, vcast_vf_f(POW_F_YMAX)),
+                       vcast_vf_f(POW_F_YMIN));
+
+    s = __hyp_reduce_f(yh, &k, &sl);
+    /*
+     * yl can be several ulps of s, too large for the first order correction
+     * of the expm1 kernel, so fold it into s first.
+     */
+    sl = vadd_vf_vf_vf(sl, yl);
+    t = vadd_vf_vf_vf(s, sl);
+    sl = vadd_vf_vf_vf(vsub_vf_vf_vf(s, t), sl);
+    s = t;
+    if (precise == POW_PRECISE) {
+        u = __hyp_expm1_kernel_f(s, sl, HYP_PRECISE, &ul);
+        t = vadd_vf_vf_vf(vcast_vf_f(1.0f), u);
+        ul = vadd_vf_vf_vf(vadd_vf_vf_vf(vsub_vf_vf_vf(vcast_vf_f(1.0f), t), u),
+                           ul);
+        r = vadd_vf_vf_vf(t, ul);
+    } else {
+        u = __hyp_expm1_kernel_f(s, sl, precise == POW_FAST ? HYP_FAST :
+                                 HYP_RELAXED, &ul);
+        r = vadd_vf_vf_vf(vcast_vf_f(1.0f), u);
+    }
+
+    /*
+     * r*2**(n -+ POW_F_SCALE) is exact, leaving a single rounding for the
+     * scaling into the overflow or underflow range.
+     */
+    o = vgt_vo_vf_vf(yh, vcast_vf_f(0.0f));
+    k = vadd_vf_vf_vf(k, vsel_vf_vo_vf_vf(o, vcast_vf_f(-POW_F_SCALE),
+                                          vcast_vf_f(POW_F_SCALE)));
+    r = vmul_vf_vf_vf(r, __hyp_pow2_f(k, 0.0f));
+    r = vmul_vf_vf_vf(r, vsel_vf_vo_vf_vf(o, vcast_vf_f(POW_F_POW2SCALE),
+                                          vcast_vf_f(1.0f / POW_F_POW2SCALE)));
+
+    /* Zero and infinite x. */
+    o = vlt_vo_vf_vf(y, vcast_vf_f(0.0f));
+    r = vsel_vf_vo_vf_vf(veq_vo_vf_vf(ax, vcast_vf_f(0.0f)),
+            vsel_vf_vo_vf_vf(o, vcast_vf_f(INFINITYf), vcast_vf_f(0.0f)), r);
+    r = vsel_vf_vo_vf_vf(visinf_vo_vf(ax),
+            vsel_vf_vo_vf_vf(o, vcast_vf_f(0.0f), vcast_vf_f(INFINITYf)), r);
+
+    /* Negative x: odd y keeps the sign, non-integer y has no real result. */
+    isint = __pow_isint_f(y, &odd);
+    r = vreinterpret_vf_vm(vxor_vm_vm_vm(vreinterpret_vm_vf(r),
+            vand_vm_vo32_vm(odd, vand_vm_vm_vm(vreinterpret_vm_vf(x),
+                                 vreinterpret_vm_vf(vcast_vf_f(-0.0f))))));
+    o = vandnot_vo_vo_vo(vor_vo_vo_vo(isint, visinf_vo_vf(x)),
+                         vlt_vo_vf_vf(x, vcast_vf_f(0.0f)));
+    r = vsel_vf_vo_vf_vf(o, vcast_vf_f(NANf), r);
+
+    /* Infinite y. */
+    o = vor_vo_vo_vo(
+            vand_vo_vo_vo(vgt_vo_vf_vf(ax, vcast_vf_f(1.0f)),
+                          vgt_vo_vf_vf(y, vcast_vf_f(0.0f))),
+            vand_vo_vo_vo(vlt_vo_vf_vf(ax, vcast_vf_f(1.0f)),
+                          vlt_vo_vf_vf(y, vcast_vf_f(0.0f))));
+    t = vsel_vf_vo_vf_vf(o, vcast_vf_f(INFINITYf), vcast_vf_f(0.0f));
+    t = vsel_vf_vo_vf_vf(veq_vo_vf_vf(ax, vcast_vf_f(1.0f)), vcast_vf_f(1.0f), t);
+    r = vsel_vf_vo_vf_vf(visinf_vo_vf(y), t, r);
+
+    o = vor_vo_vo_vo(visnan_vo_vf(x), visnan_vo_vf(y));
+    r = vsel_vf_vo_vf_vf(o, vadd_vf_vf_vf(x, y), r);
+    o = vor_vo_vo_vo(veq_vo_vf_vf(y, vcast_vf_f(0.0f)),
+                     veq_vo_vf_vf(x, vcast_vf_f(1.0f)));
+    return vsel_vf_vo_vf_vf(o, vcast_vf_f(1.0f), r);
+}
+
+/*
+ * Double precision
+ */
+
+/* Y is clamped to where exp(Y) certainly overflows or underflows. */
+#define POW_D_YMAX      710.0
+#define POW_D_YMIN      -746.0
+#define POW_D_SCALE     512.0
+#define POW_D_POW2SCALE 1.3407807929942597e+154 /* 2**512 */
+#define POW_D_TWO52     4503599627370496.0      /* 2**52 */
+
+#define POW_D_TWO3_HI    0.66666666666666663
+#define POW_D_TWO3_LO    3.7007434154171883e-17
+
+/* 2*Q(z) */
+#define POW_D_Q0         0.40000000000000002
+#define POW_D_Q1         0.28571428571429364
+#define POW_D_Q2         0.22222222221655907
+#define POW_D_Q3         0.18181818335387601
+#define POW_D_Q4         0.15384594963074133
+#define POW_D_Q5         0.13334804663624358
+#define POW_D_Q6         0.11706237148815904
+#define POW_D_Q7         0.11723170160803062
+
+/* round(a) for 0 <= a < 2**52. */
+vdouble static INLINE
+__pow_rint_d(vdouble const a)
+{
+    return vsub_vd_vd_vd(vadd_vd_vd_vd(a, vcast_vd_d(POW_D_TWO52)),
+                         vcast_vd_d(POW_D_TWO52));
+}
+
+/*
+ * y is an integer; *odd is set for odd integers.  Every double of magnitude
+ * 2**52 or more is an integer, and from 2**53 on it is even.
+ */
+vopmask static INLINE
+__pow_isint_d(vdouble const y, vopmask *odd)
+{
+    vdouble ay, h;
+    vopmask isint;
+
+    ay = vabs_vd_vd(y);
+    isint = vor_vo_vo_vo(vge_vo_vd_vd(ay, vcast_vd_d(POW_D_TWO52)),
+                         veq_vo_vd_vd(__pow_rint_d(ay), ay));
+    h = vmul_vd_vd_vd(ay, vcast_vd_d(0.5));
+    *odd = vand_vo_vo_vo(vlt_vo_vd_vd(ay, vcast_vd_d(2.0 * POW_D_TWO52)),
+                         vneq_vo_vd_vd(__pow_rint_d(h), h));
+    *odd = vand_vo_vo_vo(*odd, isint);
+    return isint;
+}
+
+/*
+ * log(x) = result + *lo for finite x > 0, including denormals, with
+ * 2*atanh(f) = 2*f + 2/3*f**3 + 2*f**5*Q(f**2).
+ */
+vdouble static INLINE
+__pow_log_d(vdouble const x, vdouble *lo)
+{
+    vdouble e, m, u, v, f, fl, z, zl, c, cl, t, tl, q, s, h;
+
+    m = __log_reduce_d(x, &e);
+
+    /*
+     * f + fl = u/v.  m - 1 is exact and m - (v - 1) is the error of v; with
+     * f close to u/v, 1/v = (1 - f)/2 to working precision.
+     */
+    u = vsub_vd_vd_vd(m, vcast_vd_d(1.0));
+    v = vadd_vd_vd_vd(m, vcast_vd_d(1.0));
+    f = vdiv_vd_vd_vd(u, v);
+    fl = vfma_vd_vd_vd_vd(vneg_vd_vd(f), v, u);
+    fl = vfma_vd_vd_vd_vd(vneg_vd_vd(f), vsub_vd_vd_vd(m, vsub_vd_vd_vd(v, vcast_vd_d(1.0))), fl);
+    fl = vmul_vd_vd_vd(fl, vfma_vd_vd_vd_vd(f, vcast_vd_d(-0.5), vcast_vd_d(0.5)));
+
+    /* c + cl = f**3, t + tl = 2/3*f**3 + 2*f**5*Q(f**2) */
+    z = vmul_vd_vd_vd(f, f);
+    zl = vfma_vd_vd_vd_vd(f, f, vneg_vd_vd(z));
+    c = vmul_vd_vd_vd(f, z);
+    cl = vfma_vd_vd_vd_vd(f, zl, vfma_vd_vd_vd_vd(f, z, vneg_vd_vd(c)));
+    t = vmul_vd_vd_vd(c, vcast_vd_d(POW_D_TWO3_HI));
+    tl = vfma_vd_vd_vd_vd(c, vcast_vd_d(POW_D_TWO3_HI), vneg_vd_vd(t));
+    tl = vfma_vd_vd_vd_vd(c, vcast_vd_d(POW_D_TWO3_LO), tl);
+    tl = vfma_vd_vd_vd_vd(cl, vcast_vd_d(POW_D_TWO3_HI), tl);
+
+    q = vfma_vd_vd_vd_vd(vcast_vd_d(POW_D_Q7), z, vcast_vd_d(POW_D_Q6));
+    q = vfma_vd_vd_vd_vd(q, z, vcast_vd_d(POW_D_Q5));
+    q = vfma_vd_vd_vd_vd(q, z, vcast_vd_d(POW_D_Q4));
+    q = vfma_vd_vd_vd_vd(q, z, vcast_vd_d(POW_D_Q3));
+    q = vfma_vd_vd_vd_vd(q, z, vcast_vd_d(POW_D_Q2));
+    q = vfma_vd_vd_vd_vd(q, z, vcast_vd_d(POW_D_Q1));
+    q = vfma_vd_vd_vd_vd(q, z, vcast_vd_d(POW_D_Q0));
+    q = vmul_vd_vd_vd(vmul_vd_vd_vd(c, z), q);
+    h = vadd_vd_vd_vd(t, q);
+    tl = vadd_vd_vd_vd(tl, vadd_vd_vd_vd(vsub_vd_vd_vd(t, h), q));
+    t = h;
+
+    /* fl enters as 2*fl*(1 + f**2), the derivative of the leading terms. */
+    tl = vfma_vd_vd_vd_vd(e, vcast_vd_d(L2L), tl);
+    tl = vfma_vd_vd_vd_vd(vadd_vd_vd_vd(fl, fl), vadd_vd_vd_vd(z, vcast_vd_d(1.0)), tl);
+
+    /*
+     * e*ln2_hi is exact and, unless e is zero, larger than 2*f, which is
+     * larger than t, so the errors of both sums below are exact.
+     */
+    e = vmul_vd_vd_vd(e, vcast_vd_d(L2U));
+    f = vadd_vd_vd_vd(f, f);
+    s = vadd_vd_vd_vd(e, f);
+    tl = vadd_vd_vd_vd(tl, vsub_vd_vd_vd(f, vsub_vd_vd_vd(s, e)));
+    h = vadd_vd_vd_vd(s, t);
+    *lo = vadd_vd_vd_vd(tl, vsub_vd_vd_vd(t, vsub_vd_vd_vd(h, s)));
+    return h;
+}
+
+vdouble static INLINE
+__pow_d_vec(vdouble const x, vdouble const y, int const precise)
+{
+    vdouble ax, h, l, yh, yl, s, sl, k, u, ul, t, r;
+    vopmask isint, odd, o;
+
+    ax = vabs_vd_vd(x);
+    h = __pow_log_d(ax, &l);
+
+    /* yh + yl = y*(h + l); yl is dropped where yh gets clamped. */
+    yh = vmul_vd_vd_vd(y, h);
+    yl = vfma_vd_vd_vd_vd(y, h, vneg_vd_vd(yh));
+    yl = vfma_vd_vd_vd_vd(y, l, yl);
+    o = vand_vo_vo_vo(vlt_vo_vd_vd(yh, vcast_vd_d(POW_D_YMAX)),
+                      vgt_vo_vd_vd(yh, vcast_vd_d(POW_D_YMIN)));
+    yl = vsel_vd_vo_vd_vd(o, yl, vcast_vd_d(0.0));
+    yh = vmax_vd_vd_vd(vmin_vd_vd_vd(yh, vcast_vd_d(POW_D_YMAX)),
+                       vcast_vd_d(POW_D_YMIN));
+
+    s = __hyp_reduce_d(yh, &k, &sl);
+    /*
+     * yl can be several ulps of s, too large for the first order correction
+     * of the expm1 kernel, so fold it into s first.
+     */
+    sl = vadd_vd_vd_vd(sl, yl);
+    t = vadd_vd_vd_vd(s, sl);
+    sl = vadd_vd_vd_vd(vsub_vd_vd_vd(s, t), sl);
+    s = t;
+    if (precise == POW_PRECISE) {
+        u = __hyp_expm1_kernel_d(s, sl, HYP_PRECISE, &ul);
+        t = vadd_vd_vd_vd(vcast_vd_d(1.0), u);
+        ul = vadd_vd_vd_vd(vadd_vd_vd_vd(vsub_vd_vd_vd(vcast_vd_d(1.0), t), u),
+                           ul);
+        r = vadd_vd_vd_vd(t, ul);
+    } else {
+        u = __hyp_expm1_kernel_d(s, sl, precise == POW_FAST ? HYP_FAST :
+                                 HYP_RELAXED, &ul);
+        r = vadd_vd_vd_vd(vcast_vd_d(1.0), u);
+    }
+
+    /*
+     * r*2**(n -+ POW_D_SCALE) is exact, leaving a single rounding for the
+     * scaling into the overflow or underflow range.
+     */
+    o = vgt_vo_vd_vd(yh, vcast_vd_d(0.0));
+    k = vadd_vd_vd_vd(k, vsel_vd_vo_vd_vd(o, vcast_vd_d(-POW_D_SCALE),
+                                          vcast_vd_d(POW_D_SCALE)));
+    r = vmul_vd_vd_vd(r, __hyp_pow2_d(k, 0.0));
+    r = vmul_vd_vd_vd(r, vsel_vd_vo_vd_vd(o, vcast_vd_d(POW_D_POW2SCALE),
+                                          vcast_vd_d(1.0 / POW_D_POW2SCALE)));
+
+    /* Zero and infinite x. */
+    o = vlt_vo_vd_vd(y, vcast_vd_d(0.0));
+    r = vsel_vd_vo_vd_vd(veq_vo_vd_vd(ax, vcast_vd_d(0.0)),
+            vsel_vd_vo_vd_vd(o, vcast_vd_d(INFINITY), vcast_vd_d(0.0)), r);
+    r = vsel_vd_vo_vd_vd(visinf_vo_vd(ax),
+            vsel_vd_vo_vd_vd(o, vcast_vd_d(0.0), vcast_vd_d(INFINITY)), r);
+
+    /* Negative x: odd y keeps the sign, non-integer y has no real result. */
+    isint = __pow_isint_d(y, &odd);
+    r = vreinterpret_vd_vm(vxor_vm_vm_vm(vreinterpret_vm_vd(r),
+            vand_vm_vo64_vm(odd, vand_vm_vm_vm(vreinterpret_vm_vd(x),
+                                 vreinterpret_vm_vd(vcast_vd_d(-0.0))))));
+    o = vandnot_vo_vo_vo(vor_vo_vo_vo(isint, visinf_vo_vd(x)),
+                         vlt_vo_vd_vd(x, vcast_vd_d(0.0)));
+    r = vsel_vd_vo_vd_vd(o, vcast_vd_d(NAN), r);
+
+    /* Infinite y. */
+    o = vor_vo_vo_vo(
+            vand_vo_vo_vo(vgt_vo_vd_vd(ax, vcast_vd_d(1.0)),
+                          vgt_vo_vd_vd(y, vcast_vd_d(0.0))),
+            vand_vo_vo_vo(vlt_vo_vd_vd(ax, vcast_vd_d(1.0)),
+                          vlt_vo_vd_vd(y, vcast_vd_d(0.0))));
+    t = vsel_vd_vo_vd_vd(o, vcast_vd_d(INFINITY), vcast_vd_d(0.0));
+    t = vsel_vd_vo_vd_vd(veq_vo_vd_vd(ax, vcast_vd_d(1.0)), vcast_vd_d(1.0), t);
+    r = vsel_vd_vo_vd_vd(visinf_vo_vd(y), t, r);
+
+    o = vor_vo_vo_vo(visnan_vo_vd(x), visnan_vo_vd(y));
+    r = vsel_vd_vo_vd_vd(o, vadd_vd_vd_vd(x, y), r);
+    o = vor_vo_vo_vo(veq_vo_vd_vd(y, vcast_vd_d(0.0)),
+                     veq_vo_vd_vd(x, vcast_vd_d(1.0)));
+    return vsel_vd_vo_vd_vd(o, vcast_vd_d(1.0), r);
+}
+
+#endif // __POW_VEC_H__
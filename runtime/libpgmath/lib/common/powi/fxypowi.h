@@ -29,10 +29,14 @@ static const vrd8_t Cdp1_8={1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
   r = C##_prec##p1_##_vl;                                                 \
                                                                           \
   i = iy >= 0 ? iy : -iy;                                                 \
-  if (iy > 0 && iy <= 10) {                                               \
+  /*                                                                      \
+   * Small |iy|, including the negative ones such as r**(-3), use a       \
+   * fixed multiplication chain.  The reciprocal is taken by the caller.  \
+   */                                                                     \
+  if (i > 0 && i <= 10) {                                                 \
     vr##_prec##_vl##_t t2;                                                \
     t2 = t * t;                                                           \
-    switch(iy) {                                                          \
+    switch(i) {                                                           \
       case 1:                                                             \
         r = t;                                                            \
         break;                                                            \
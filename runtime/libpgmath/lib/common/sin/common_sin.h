@@ -80,9 +80,15 @@ ll_as_double(int64_t i)
     return *(double*)&i;
 }
 
-/* Payne-Hanek style argument reduction. */
+/*
+ * Payne-Hanek style argument reduction.  |a| = j*pi + f*pi with 0 <= f < 1;
+ * the result r carries the sign of a, |r| = min(f, 1 - f)*pi, and *h is
+ * the sign of (-1)**j, so that sin(a) = (-1)**j*sin(r).  *hc is the sign
+ * of cos(a), which is (-1)**j flipped when f >= 1/2:
+ * cos(a) = *hc*sin(pi/2 - |r|).
+ */
 static double
-reduction_slowpath(double const a, uint64_t *h)
+reduction_slowpath_sc(double const a, uint64_t *h, uint64_t *hc)
 {
     uint64_t result[4];
     uint64_t ia = double_as_ll(a);
@@ -108,6 +114,7 @@ reduction_slowpath(double const a, uint64_t *h)
 
     uint64_t shi = s | 0x3c20000000000000ULL;
     *h = p & 0x8000000000000000ULL;
+    *hc = *h ^ ((p << 1) & 0x8000000000000000ULL);
     if (p & 0x4000000000000000ULL) {
         p = ~p;
         result[2] = ~result[2];
@@ -125,4 +132,12 @@ reduction_slowpath(double const a, uint64_t *h)
     return r;
 }
 
+static double
+reduction_slowpath(double const a, uint64_t *h)
+{
+    uint64_t hc;
+
+    return reduction_slowpath_sc(a, h, &hc);
+}
+
 #endif
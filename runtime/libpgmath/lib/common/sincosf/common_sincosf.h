@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#ifndef COMMON_SINCOSF_H
+#define COMMON_SINCOSF_H
+
+#include <stdint.h>
+
+/* Constants for Cody-Waite argument reduction by PI/2 */
+#define _2_OVER_PI_F 6.36619747e-01f
+#define PI_2_HI_F    1.57079315e+00f
+#define PI_2_MI_F    3.17493937e-06f
+#define PI_2_LO_F    6.22298369e-14f
+#define THRESHOLD_F  3.90000000e+04f
+
+/* Coefficents of approximate sine on [-PI/4,+PI/4] */
+#define S1_F -1.66666546e-01f
+#define S2_F  8.33216087e-03f
+#define S3_F -1.95152959e-04f
+
+/* Coefficents of approximate cosine on [-PI/4,+PI/4] */
+#define C1_F  4.16666456e-02f
+#define C2_F -1.38873163e-03f
+#define C3_F  2.44331571e-05f
+
+/* 192 bits of 1/PI for Payne-Hanek argument reduction. */
+static uint32_t i1opi_f [] = {
+    0x9e21c820,
+    0x6db14acc,
+    0xfa9a6ee0,
+    0xfe13abe8,
+    0x27220a94,
+    0x517cc1b7,
+};
+
+#define PI_2_M63 3.406121580086555e-19
+
+/* -fno-strict-aliasing */
+static int32_t
+float_as_int(float f)
+{
+    return *(int32_t*)&f;
+}
+
+typedef struct {
+    uint32_t x;
+    uint32_t y;
+} uint2;
+
+/* -fno-strict-aliasing */
+static uint2
+umad32wide(uint32_t a, uint32_t b, uint32_t c)
+{
+    union {
+        uint2 ui2;
+        uint64_t ull;
+    } res;
+    res.ull = (uint64_t)a * b + c;
+    return res.ui2;
+}
+
+/*
+ * Payne-Hanek style argument reduction by PI/2 of a finite a.
+ * Returns a - n*PI/2 in [-PI/4,+PI/4] and sets *q to n mod 4.
+ */
+static float
+reduction_slowpath(float const a, int32_t *q)
+{
+    uint2 m;
+    uint32_t ia = float_as_int(a);
+    uint32_t s = ia & 0x80000000;
+    uint32_t result[7];
+    uint32_t hi, lo;
+    uint32_t e;
+    int32_t idx;
+    int32_t i;
+    int32_t j;
+    int32_t n;
+    e = ((ia >> 23) & 0xff) - 127;
+    ia = (ia << 8) | 0x80000000;
+
+    /* compute |a| * 1/pi */
+    idx = 4 - ((e >> 5) & 3);
+
+    hi = 0;
+    for (i = 0; i < 6; i++) {
+        m = umad32wide(i1opi_f[i], ia, hi);
+        lo = m.x;
+        hi = m.y;
+        result[i] = lo;
+    }
+    result[i] = hi;
+
+    e = e & 31;
+    /* shift result such that hi:lo<63:63> is the least significant
+       integer bit, and hi:lo<62:0> are the fractional bits of the result
+    */
+
+    uint64_t p = ((uint64_t)result[idx + 2] << 32) | result[idx + 1];
+
+    if (e) {
+        p = (p << e) | (result[idx] >> (32 - e));
+    }
+
+    /* |a|/pi = k + f: bring 2*f to the nearest integer j in [0,2] */
+    n = ((result[idx + 2] << e) >> 31) << 1;
+    p &= 0x7fffffffffffffffULL;
+    j = (int32_t)((p + 0x2000000000000000ULL) >> 62);
+    n += j;
+
+    /* (2*f - j) * 2**62 in [-2**61,2**61] */
+    double d = (double)((int64_t)p - ((int64_t)j << 62));
+    d *= PI_2_M63;
+    float r = (float)d;
+
+    if (s) {
+        r = -r;
+        n = -n;
+    }
+    *q = n & 3;
+
+    return r;
+}
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2017-2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#ifndef __SINCOS_F_AVX512_H__
+#define __SINCOS_F_AVX512_H__
+
+#include <assert.h>
+#include <immintrin.h>
+#define CONFIG 1
+#include "helperavx512f.h"
+#ifndef TARGET_OSX_X8664
+#include "common_sincosf.h"
+#include "sincos_f_vec.h"
+#endif
+
+/*
+ * __fs_sincos_16_avx512_ptr() returns sin(a) and stores cos(a) in *c, which
+ * must be 64 byte aligned.  It is the form of the kernel C can call.
+ *
+ * __fs_sincos_16_avx512() is the dispatch table entry, which returns sin(a)
+ * in %zmm0 and cos(a) in %zmm1.
+ */
+
+extern "C" vfloat __attribute__ ((noinline)) __fs_sincos_16_avx512_ptr(vfloat const a, vfloat *c);
+
+vfloat __attribute__ ((noinline))
+__fs_sincos_16_avx512_ptr(vfloat const a, vfloat *c)
+{
+#ifndef TARGET_OSX_X8664
+	vfloat s;
+
+	__sincos_f_vec(a, &s, c);
+	return s;
+#else
+        assert(0);
+        return ((vfloat) _mm512_set1_epi32(0));
+#endif
+}
+
+#ifdef TARGET_OSX_X8664
+
+extern "C" vfloat __fs_sincos_16_avx512(vfloat const a);
+
+vfloat
+__fs_sincos_16_avx512(vfloat const a)
+{
+	vfloat s;
+	vfloat c;
+
+	s = __fs_sincos_16_avx512_ptr(a, &c);
+	asm("vmovups\t%0,%%zmm1" : : "m"(c) : "%zmm1");
+
+	return s;
+}
+
+#else
+asm(".globl __fs_sincos_16_avx512\n\
+__fs_sincos_16_avx512:\n\
+\tpushq	%rbp\n\
+\tmovq	%rsp, %rbp\n\
+\tsubq	$128, %rsp\n\
+\tandq	$-64, %rsp\n\
+\tmovq	%rsp, %rdi\n\
+\tcall	__fs_sincos_16_avx512_ptr@PLT\n\
+\tvmovaps	(%rsp), %zmm1\n\
+\tmovq	%rbp, %rsp\n\
+\tpopq	%rbp\n\
+\tret" );
+
+#endif
+
+#endif // __SINCOS_F_AVX512_H__
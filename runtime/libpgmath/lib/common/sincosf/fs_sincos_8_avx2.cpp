@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2017-2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#ifndef __SINCOS_F_AVX2_H__
+#define __SINCOS_F_AVX2_H__
+
+#include <immintrin.h>
+#include "common_sincosf.h"
+#define CONFIG 1
+#include "helperavx2.h"
+#include "sincos_f_vec.h"
+
+/*
+ * __fs_sincos_8_avx2_ptr() returns sin(a) and stores cos(a) in *c, which
+ * must be 32 byte aligned.  It is the form of the kernel C can call.
+ *
+ * __fs_sincos_8_avx2() is the dispatch table entry, which returns sin(a)
+ * in %ymm0 and cos(a) in %ymm1.
+ */
+
+extern "C" vfloat __attribute__ ((noinline)) __fs_sincos_8_avx2_ptr(vfloat const a, vfloat *c);
+
+vfloat __attribute__ ((noinline))
+__fs_sincos_8_avx2_ptr(vfloat const a, vfloat *c)
+{
+	vfloat s;
+
+	__sincos_f_vec(a, &s, c);
+	return s;
+}
+
+#ifdef TARGET_OSX_X8664
+
+extern "C" vfloat __fs_sincos_8_avx2(vfloat const a);
+
+vfloat
+__fs_sincos_8_avx2(vfloat const a)
+{
+	vfloat s;
+	vfloat c;
+
+	s = __fs_sincos_8_avx2_ptr(a, &c);
+	asm("vmovups\t%0,%%ymm1" : : "m"(c) : "%ymm1");
+
+	return s;
+}
+
+#else
+asm(".globl __fs_sincos_8_avx2\n\
+__fs_sincos_8_avx2:\n\
+\tpushq	%rbp\n\
+\tmovq	%rsp, %rbp\n\
+\tsubq	$64, %rsp\n\
+\tandq	$-32, %rsp\n\
+\tmovq	%rsp, %rdi\n\
+\tcall	__fs_sincos_8_avx2_ptr@PLT\n\
+\tvmovaps	(%rsp), %ymm1\n\
+\tmovq	%rbp, %rsp\n\
+\tpopq	%rbp\n\
+\tret" );
+
+#endif
+
+#endif // __SINCOS_F_AVX2_H__
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Single precision sin and cos of the same argument.
+ *
+ * The argument is reduced once, by PI/2, to a in [-PI/4,+PI/4] and the
+ * quadrant n mod 4.  Both polynomials are evaluated on a and the quadrant
+ * selects, and negates, the results:
+ *
+ *   n mod 4    sin(x)      cos(x)
+ *      0       sin(a)      cos(a)
+ *      1       cos(a)     -sin(a)
+ *      2      -sin(a)     -cos(a)
+ *      3      -cos(a)      sin(a)
+ */
+
+#include <math.h>
+#include <common_sincosf.h>
+
+vfloat static INLINE
+__reduction_slowpath(vfloat const a, vint2 *q)
+{
+    union {
+        vfloat v;
+        float t[sizeof(vfloat) / sizeof(float)];
+    } ua, ur;
+    union {
+        vint2 v;
+        int32_t t[sizeof(vint2) / sizeof(int32_t)];
+    } uq;
+
+    ua.v = a;
+    for (unsigned i = 0; i < sizeof(vfloat) / sizeof(float); i++) {
+        uint32_t p = float_as_int(ua.t[i]) & 0x7fffffff;
+        if (p > (uint32_t)float_as_int(THRESHOLD_F) && p < 0x7f800000) {
+            ur.t[i] = reduction_slowpath(ua.t[i], &uq.t[i]);
+        } else {
+            ur.t[i] = 0.0f;
+            uq.t[i] = 0;
+        }
+    }
+    *q = uq.v;
+    return ur.v;
+}
+
+void static INLINE
+__sincos_f_vec(vfloat const x, vfloat *ps, vfloat *pc)
+{
+    vfloat a, k, s, c, t, r2;
+    vint2 p, q;
+
+    k = vfma_vf_vf_vf_vf(x, vcast_vf_f(_2_OVER_PI_F), vcast_vf_f(12582912.0f));
+    q = (vint2)k;
+    k = vsub_vf_vf_vf(k, vcast_vf_f(12582912.0f));
+
+    a = vfma_vf_vf_vf_vf(k, vcast_vf_f(-PI_2_HI_F), x);
+    a = vfma_vf_vf_vf_vf(k, vcast_vf_f(-PI_2_MI_F), a);
+    a = vfma_vf_vf_vf_vf(k, vcast_vf_f(-PI_2_LO_F), a);
+
+    p = vand_vi2_vi2_vi2((vint2)x, vcast_vi2_i(0x7fffffff));
+    vopmask m = vgt_vo_vi2_vi2(p, (vint2)vcast_vf_f(THRESHOLD_F));
+    if (__builtin_expect(!vtestz_i_vo(m), 0)) {
+        vfloat res;
+        vint2 qs;
+        vopmask ninf;
+
+        res = __reduction_slowpath(x, &qs);
+        ninf = vgt_vo_vi2_vi2(vcast_vi2_i(0x7f800000), p);
+        res = vsel_vf_vo_vf_vf(ninf, res, vmul_vf_vf_vf(x, vcast_vf_f(0.0f)));
+
+        a = vsel_vf_vo_vf_vf(m, res, a);
+        q = vsel_vi2_vo_vi2_vi2(m, qs, q);
+    }
+
+    r2 = vmul_vf_vf_vf(a, a);
+
+    s = vcast_vf_f(S3_F);
+    s = vfma_vf_vf_vf_vf(s, r2, vcast_vf_f(S2_F));
+    s = vfma_vf_vf_vf_vf(s, r2, vcast_vf_f(S1_F));
+    t = vmul_vf_vf_vf(r2, a);
+    s = vfma_vf_vf_vf_vf(s, t, a);
+    /* sin(a) has the sign of a on [-PI/4,+PI/4], which also keeps -0 */
+    s = (vfloat)vor_vi2_vi2_vi2(
+            vand_vi2_vi2_vi2((vint2)s, vcast_vi2_i(0x7fffffff)),
+            vand_vi2_vi2_vi2((vint2)a, vcast_vi2_i(0x80000000)));
+
+    c = vcast_vf_f(C3_F);
+    c = vfma_vf_vf_vf_vf(c, r2, vcast_vf_f(C2_F));
+    c = vfma_vf_vf_vf_vf(c, r2, vcast_vf_f(C1_F));
+    t = vmul_vf_vf_vf(r2, r2);
+    c = vfma_vf_vf_vf_vf(c, t, vfma_vf_vf_vf_vf(r2, vcast_vf_f(-0.5f),
+                                                 vcast_vf_f(1.0f)));
+
+    /* Odd quadrants swap sin and cos */
+    vopmask o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(1)),
+                               vcast_vi2_i(1));
+    t = vsel_vf_vo_vf_vf(o, c, s);
+    c = vsel_vf_vo_vf_vf(o, s, c);
+    s = t;
+
+    /* sin is negative in quadrants 2 and 3, cos in quadrants 1 and 2 */
+    s = (vfloat)vxor_vi2_vi2_vi2((vint2)s,
+            vand_vi2_vi2_vi2(vsll_vi2_vi2_i(q, 30), vcast_vi2_i(0x80000000)));
+    q = vadd_vi2_vi2_vi2(q, vcast_vi2_i(1));
+    c = (vfloat)vxor_vi2_vi2_vi2((vint2)c,
+            vand_vi2_vi2_vi2(vsll_vi2_vi2_i(q, 30), vcast_vi2_i(0x80000000)));
+
+    *ps = s;
+    *pc = c;
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * For |x| < SINH_SWITCH:  sinh(x) = sign(x) * (E + E/(E + 1)) / 2,
+ *                         E = expm1(|x|)
+ * otherwise:              sinh(x) = sign(x) * exp(|x|) / 2
+ *
+ * |x| is clamped so that larger arguments overflow to infinity.
+ */
+
+#include "hyperbolic_vec.h"
+
+#define SINH_SWITCH_F  20.0f
+#define SINH_SWITCH_D  40.0
+#define SINH_CLAMP_F   100.0f
+#define SINH_CLAMP_D   720.0
+
+vfloat static INLINE
+__sinh_f_vec(vfloat const x, int const precise)
+{
+    vfloat a, k, s, sl, u, ul, e, el, d, dl, q, r, rl, h, hl;
+
+    a = vmin_vf_vf_vf(vabs_vf_vf(x), vcast_vf_f(SINH_CLAMP_F));
+    s = __hyp_reduce_f(a, &k, &sl);
+    u = __hyp_expm1_kernel_f(s, sl, precise, &ul);
+
+    /* Small and moderate arguments, via expm1. */
+    e = __hyp_expm1_scale_f(k, u, ul, precise, &el);
+    d = vadd_vf_vf_vf(e, vcast_vf_f(1.0f));
+    dl = vadd_vf_vf_vf(vsub_vf_vf_vf(e, vsub_vf_vf_vf(d, vcast_vf_f(1.0f))), el);
+    q = __hyp_div_f(e, el, d, dl, precise);
+    r = vadd_vf_vf_vf(e, q);
+    if (precise == HYP_PRECISE) {
+        rl = vadd_vf_vf_vf(vsub_vf_vf_vf(q, vsub_vf_vf_vf(r, e)), el);
+        r = vadd_vf_vf_vf(r, rl);
+    }
+    r = vmul_vf_vf_vf(r, vcast_vf_f(0.5f));
+
+    /* Large arguments, exp(|x|)/2. */
+    h = __hyp_exph_f(k, u, ul, precise, &hl);
+    h = vadd_vf_vf_vf(h, hl);
+
+    r = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(a, vcast_vf_f(SINH_SWITCH_F)), r, h);
+    r = __hyp_copysign_f(r, x);
+    return vsel_vf_vo_vf_vf(visnan_vo_vf(x), x, r);
+}
+
+vdouble static INLINE
+__sinh_d_vec(vdouble const x, int const precise)
+{
+    vdouble a, k, s, sl, u, ul, e, el, d, dl, q, r, rl, h, hl;
+
+    a = vmin_vd_vd_vd(vabs_vd_vd(x), vcast_vd_d(SINH_CLAMP_D));
+    s = __hyp_reduce_d(a, &k, &sl);
+    u = __hyp_expm1_kernel_d(s, sl, precise, &ul);
+
+    /* Small and moderate arguments, via expm1. */
+    e = __hyp_expm1_scale_d(k, u, ul, precise, &el);
+    d = vadd_vd_vd_vd(e, vcast_vd_d(1.0));
+    dl = vadd_vd_vd_vd(vsub_vd_vd_vd(e, vsub_vd_vd_vd(d, vcast_vd_d(1.0))), el);
+    q = __hyp_div_d(e, el, d, dl, precise);
+    r = vadd_vd_vd_vd(e, q);
+    if (precise == HYP_PRECISE) {
+        rl = vadd_vd_vd_vd(vsub_vd_vd_vd(q, vsub_vd_vd_vd(r, e)), el);
+        r = vadd_vd_vd_vd(r, rl);
+    }
+    r = vmul_vd_vd_vd(r, vcast_vd_d(0.5));
+
+    /* Large arguments, exp(|x|)/2. */
+    h = __hyp_exph_d(k, u, ul, precise, &hl);
+    h = vadd_vd_vd_vd(h, hl);
+
+    r = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(a, vcast_vd_d(SINH_SWITCH_D)), r, h);
+    r = __hyp_copysign_d(r, x);
+    return vsel_vd_vo_vd_vd(visnan_vo_vd(x), x, r);
+}
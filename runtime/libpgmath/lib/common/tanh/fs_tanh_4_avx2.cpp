@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#ifndef __TANH_F_AVX2_4_H__
+#define __TANH_F_AVX2_4_H__
+
+#include <immintrin.h>
+#define CONFIG 1
+#include "helperavx2_128.h"
+#include "tanh_vec.h"
+
+extern "C" vfloat __attribute__ ((noinline)) __fs_tanh_4_avx2(vfloat const a);
+extern "C" vfloat __attribute__ ((noinline)) __rs_tanh_4_avx2(vfloat const a);
+extern "C" vfloat __attribute__ ((noinline)) __ps_tanh_4_avx2(vfloat const a);
+
+vfloat __attribute__ ((noinline))
+__fs_tanh_4_avx2(vfloat const a)
+{
+	return __tanh_f_vec(a, HYP_FAST);
+}
+
+vfloat __attribute__ ((noinline))
+__rs_tanh_4_avx2(vfloat const a)
+{
+	return __tanh_f_vec(a, HYP_RELAXED);
+}
+
+vfloat __attribute__ ((noinline))
+__ps_tanh_4_avx2(vfloat const a)
+{
+	return __tanh_f_vec(a, HYP_PRECISE);
+}
+
+#endif // __TANH_F_AVX2_4_H__
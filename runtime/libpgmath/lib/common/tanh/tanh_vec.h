@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * tanh(x) = sign(x) * -E/(E + 2),  E = expm1(-2|x|)
+ *
+ * |x| is clamped to TANH_THRESHOLD, beyond which tanh(x) rounds to +-1.
+ */
+
+#include "hyperbolic_vec.h"
+
+#define TANH_THRESHOLD_F  9.1f
+#define TANH_THRESHOLD_D  19.1
+
+vfloat static INLINE
+__tanh_f_vec(vfloat const x, int const precise)
+{
+    vfloat a, e, el, d, dl, r;
+
+    a = vmin_vf_vf_vf(vabs_vf_vf(x), vcast_vf_f(TANH_THRESHOLD_F));
+    e = __hyp_expm1_f(vmul_vf_vf_vf(a, vcast_vf_f(-2.0f)), precise, &el);
+    d = vadd_vf_vf_vf(e, vcast_vf_f(2.0f));
+    dl = vadd_vf_vf_vf(vsub_vf_vf_vf(e, vsub_vf_vf_vf(d, vcast_vf_f(2.0f))), el);
+    r = __hyp_div_f(vneg_vf_vf(e), vneg_vf_vf(el), d, dl, precise);
+    r = __hyp_copysign_f(vabs_vf_vf(r), x);
+    return vsel_vf_vo_vf_vf(visnan_vo_vf(x), x, r);
+}
+
+vdouble static INLINE
+__tanh_d_vec(vdouble const x, int const precise)
+{
+    vdouble a, e, el, d, dl, r;
+
+    a = vmin_vd_vd_vd(vabs_vd_vd(x), vcast_vd_d(TANH_THRESHOLD_D));
+    e = __hyp_expm1_d(vmul_vd_vd_vd(a, vcast_vd_d(-2.0)), precise, &el);
+    d = vadd_vd_vd_vd(e, vcast_vd_d(2.0));
+    dl = vadd_vd_vd_vd(vsub_vd_vd_vd(e, vsub_vd_vd_vd(d, vcast_vd_d(2.0))), el);
+    r = __hyp_div_d(vneg_vd_vd(e), vneg_vd_vd(el), d, dl, precise);
+    r = __hyp_copysign_d(vabs_vd_vd(r), x);
+    return vsel_vd_vo_vd_vd(visnan_vo_vd(x), x, r);
+}
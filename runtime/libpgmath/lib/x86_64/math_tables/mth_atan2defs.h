@@ -55,10 +55,10 @@ MTHINTRIN(atan2, dv4m , avxfma4    , __fd_atan2_4_mn       , __rd_atan2_4_mn
 
 MTHINTRIN(atan2, ss   , avx2       , __mth_i_atan2_avx2    , __mth_i_atan2_avx2    , __mth_i_atan2_avx2    ,__math_dispatch_error)
 MTHINTRIN(atan2, ds   , avx2       , __mth_i_datan2_avx2   , __mth_i_datan2_avx2   , __mth_i_datan2_avx2   ,__math_dispatch_error)
-MTHINTRIN(atan2, sv4  , avx2       , __gs_atan2_4_f        , __gs_atan2_4_r        , __gs_atan2_4_p        ,__math_dispatch_error)
-MTHINTRIN(atan2, dv2  , avx2       , __gd_atan2_2_f        , __gd_atan2_2_r        , __gd_atan2_2_p        ,__math_dispatch_error)
-MTHINTRIN(atan2, sv8  , avx2       , __gs_atan2_8_f        , __gs_atan2_8_r        , __gs_atan2_8_p        ,__math_dispatch_error)
-MTHINTRIN(atan2, dv4  , avx2       , __gd_atan2_4_f        , __gd_atan2_4_r        , __gd_atan2_4_p        ,__math_dispatch_error)
+MTHINTRIN(atan2, sv4  , avx2       , __fs_atan2_4_avx2     , __rs_atan2_4_avx2     , __ps_atan2_4_avx2     ,__math_dispatch_error)
+MTHINTRIN(atan2, dv2  , avx2       , __fd_atan2_2_avx2     , __rd_atan2_2_avx2     , __pd_atan2_2_avx2     ,__math_dispatch_error)
+MTHINTRIN(atan2, sv8  , avx2       , __fs_atan2_8_avx2     , __rs_atan2_8_avx2     , __ps_atan2_8_avx2     ,__math_dispatch_error)
+MTHINTRIN(atan2, dv4  , avx2       , __fd_atan2_4_avx2     , __rd_atan2_4_avx2     , __pd_atan2_4_avx2     ,__math_dispatch_error)
 MTHINTRIN(atan2, sv4m , avx2       , __fs_atan2_4_mn       , __rs_atan2_4_mn       , __ps_atan2_4_mn       ,__math_dispatch_error)
 MTHINTRIN(atan2, dv2m , avx2       , __fd_atan2_2_mn       , __rd_atan2_2_mn       , __pd_atan2_2_mn       ,__math_dispatch_error)
 MTHINTRIN(atan2, sv8m , avx2       , __fs_atan2_8_mn       , __rs_atan2_8_mn       , __ps_atan2_8_mn       ,__math_dispatch_error)
@@ -66,12 +66,12 @@ MTHINTRIN(atan2, dv4m , avx2       , __fd_atan2_4_mn       , __rd_atan2_4_mn
 
 MTHINTRIN(atan2, ss   , avx512knl  , __mth_i_atan2_avx2    , __mth_i_atan2_avx2    , __mth_i_atan2_avx2    ,__math_dispatch_error)
 MTHINTRIN(atan2, ds   , avx512knl  , __mth_i_datan2_avx2   , __mth_i_datan2_avx2   , __mth_i_datan2_avx2   ,__math_dispatch_error)
-MTHINTRIN(atan2, sv4  , avx512knl  , __gs_atan2_4_f        , __gs_atan2_4_r        , __gs_atan2_4_p        ,__math_dispatch_error)
-MTHINTRIN(atan2, dv2  , avx512knl  , __gd_atan2_2_f        , __gd_atan2_2_r        , __gd_atan2_2_p        ,__math_dispatch_error)
-MTHINTRIN(atan2, sv8  , avx512knl  , __gs_atan2_8_f        , __gs_atan2_8_r        , __gs_atan2_8_p        ,__math_dispatch_error)
-MTHINTRIN(atan2, dv4  , avx512knl  , __gd_atan2_4_f        , __gd_atan2_4_r        , __gd_atan2_4_p        ,__math_dispatch_error)
-MTHINTRIN(atan2, sv16 , avx512knl  , __gs_atan2_16_f       , __gs_atan2_16_r       , __gs_atan2_16_p       ,__math_dispatch_error)
-MTHINTRIN(atan2, dv8  , avx512knl  , __gd_atan2_8_f        , __gd_atan2_8_r        , __gd_atan2_8_p        ,__math_dispatch_error)
+MTHINTRIN(atan2, sv4  , avx512knl  , __fs_atan2_4_avx2     , __rs_atan2_4_avx2     , __ps_atan2_4_avx2     ,__math_dispatch_error)
+MTHINTRIN(atan2, dv2  , avx512knl  , __fd_atan2_2_avx2     , __rd_atan2_2_avx2     , __pd_atan2_2_avx2     ,__math_dispatch_error)
+MTHINTRIN(atan2, sv8  , avx512knl  , __fs_atan2_8_avx2     , __rs_atan2_8_avx2     , __ps_atan2_8_avx2     ,__math_dispatch_error)
+MTHINTRIN(atan2, dv4  , avx512knl  , __fd_atan2_4_avx2     , __rd_atan2_4_avx2     , __pd_atan2_4_avx2     ,__math_dispatch_error)
+MTHINTRIN(atan2, sv16 , avx512knl  , __fs_atan2_16_z2yy    , __rs_atan2_16_z2yy    , __ps_atan2_16_z2yy    ,__math_dispatch_error)
+MTHINTRIN(atan2, dv8  , avx512knl  , __fd_atan2_8_z2yy     , __rd_atan2_8_z2yy     , __pd_atan2_8_z2yy     ,__math_dispatch_error)
 MTHINTRIN(atan2, sv4m , avx512knl  , __fs_atan2_4_mn       , __rs_atan2_4_mn       , __ps_atan2_4_mn       ,__math_dispatch_error)
 MTHINTRIN(atan2, dv2m , avx512knl  , __fd_atan2_2_mn       , __rd_atan2_2_mn       , __pd_atan2_2_mn       ,__math_dispatch_error)
 MTHINTRIN(atan2, sv8m , avx512knl  , __fs_atan2_8_mn       , __rs_atan2_8_mn       , __ps_atan2_8_mn       ,__math_dispatch_error)
@@ -81,12 +81,12 @@ MTHINTRIN(atan2, dv8m , avx512knl  , __fd_atan2_8_mn       , __rd_atan2_8_mn
 
 MTHINTRIN(atan2, ss   , avx512     , __mth_i_atan2_avx2    , __mth_i_atan2_avx2    , __mth_i_atan2_avx2    ,__math_dispatch_error)
 MTHINTRIN(atan2, ds   , avx512     , __mth_i_datan2_avx2   , __mth_i_datan2_avx2   , __mth_i_datan2_avx2   ,__math_dispatch_error)
-MTHINTRIN(atan2, sv4  , avx512     , __gs_atan2_4_f        , __gs_atan2_4_r        , __gs_atan2_4_p        ,__math_dispatch_error)
-MTHINTRIN(atan2, dv2  , avx512     , __gd_atan2_2_f        , __gd_atan2_2_r        , __gd_atan2_2_p        ,__math_dispatch_error)
-MTHINTRIN(atan2, sv8  , avx512     , __gs_atan2_8_f        , __gs_atan2_8_r        , __gs_atan2_8_p        ,__math_dispatch_error)
-MTHINTRIN(atan2, dv4  , avx512     , __gd_atan2_4_f        , __gd_atan2_4_r        , __gd_atan2_4_p        ,__math_dispatch_error)
-MTHINTRIN(atan2, sv16 , avx512     , __gs_atan2_16_f       , __gs_atan2_16_r       , __gs_atan2_16_p       ,__math_dispatch_error)
-MTHINTRIN(atan2, dv8  , avx512     , __gd_atan2_8_f        , __gd_atan2_8_r        , __gd_atan2_8_p        ,__math_dispatch_error)
+MTHINTRIN(atan2, sv4  , avx512     , __fs_atan2_4_avx2     , __rs_atan2_4_avx2     , __ps_atan2_4_avx2     ,__math_dispatch_error)
+MTHINTRIN(atan2, dv2  , avx512     , __fd_atan2_2_avx2     , __rd_atan2_2_avx2     , __pd_atan2_2_avx2     ,__math_dispatch_error)
+MTHINTRIN(atan2, sv8  , avx512     , __fs_atan2_8_avx2     , __rs_atan2_8_avx2     , __ps_atan2_8_avx2     ,__math_dispatch_error)
+MTHINTRIN(atan2, dv4  , avx512     , __fd_atan2_4_avx2     , __rd_atan2_4_avx2     , __pd_atan2_4_avx2     ,__math_dispatch_error)
+MTHINTRIN(atan2, sv16 , avx512     , __fs_atan2_16_avx512  , __rs_atan2_16_avx512  , __ps_atan2_16_avx512  ,__math_dispatch_error)
+MTHINTRIN(atan2, dv8  , avx512     , __fd_atan2_8_avx512   , __rd_atan2_8_avx512   , __pd_atan2_8_avx512   ,__math_dispatch_error)
 MTHINTRIN(atan2, sv4m , avx512     , __fs_atan2_4_mn       , __rs_atan2_4_mn       , __ps_atan2_4_mn       ,__math_dispatch_error)
 MTHINTRIN(atan2, dv2m , avx512     , __fd_atan2_2_mn       , __rd_atan2_2_mn       , __pd_atan2_2_mn       ,__math_dispatch_error)
 MTHINTRIN(atan2, sv8m , avx512     , __fs_atan2_8_mn       , __rs_atan2_8_mn       , __ps_atan2_8_mn       ,__math_dispatch_error)
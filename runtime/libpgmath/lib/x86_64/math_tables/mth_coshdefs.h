@@ -53,10 +53,10 @@ MTHINTRIN(cosh , dv4m , avxfma4    , __fd_cosh_4_mn        , __rd_cosh_4_mn
 
 MTHINTRIN(cosh , ss   , avx2       , __fss_cosh_avx2       , __fss_cosh_avx2       , __mth_i_cosh_avx2     ,__math_dispatch_error)
 MTHINTRIN(cosh , ds   , avx2       , __fsd_cosh_avx2       , __fsd_cosh_avx2       , __mth_i_dcosh_avx2    ,__math_dispatch_error)
-MTHINTRIN(cosh , sv4  , avx2       , __fvs_cosh_avx2       , __fvs_cosh_avx2       , __gs_cosh_4_p         ,__math_dispatch_error)
-MTHINTRIN(cosh , dv2  , avx2       , __fvd_cosh_avx2       , __fvd_cosh_avx2       , __gd_cosh_2_p         ,__math_dispatch_error)
-MTHINTRIN(cosh , sv8  , avx2       , __fvs_cosh_avx2_256   , __fvs_cosh_vex_256    , __gs_cosh_8_p         ,__math_dispatch_error)
-MTHINTRIN(cosh , dv4  , avx2       , __fvd_cosh_avx2_256   , __fvd_cosh_avx2_256   , __gd_cosh_4_p         ,__math_dispatch_error)
+MTHINTRIN(cosh , sv4  , avx2       , __fvs_cosh_avx2       , __fvs_cosh_avx2       , __ps_cosh_4_avx2      ,__math_dispatch_error)
+MTHINTRIN(cosh , dv2  , avx2       , __fvd_cosh_avx2       , __fvd_cosh_avx2       , __pd_cosh_2_avx2      ,__math_dispatch_error)
+MTHINTRIN(cosh , sv8  , avx2       , __fvs_cosh_avx2_256   , __fvs_cosh_vex_256    , __ps_cosh_8_avx2      ,__math_dispatch_error)
+MTHINTRIN(cosh , dv4  , avx2       , __fvd_cosh_avx2_256   , __fvd_cosh_avx2_256   , __pd_cosh_4_avx2      ,__math_dispatch_error)
 MTHINTRIN(cosh , sv4m , avx2       , __fs_cosh_4_mn        , __rs_cosh_4_mn        , __ps_cosh_4_mn        ,__math_dispatch_error)
 MTHINTRIN(cosh , dv2m , avx2       , __fd_cosh_2_mn        , __rd_cosh_2_mn        , __pd_cosh_2_mn        ,__math_dispatch_error)
 MTHINTRIN(cosh , sv8m , avx2       , __fs_cosh_8_mn        , __rs_cosh_8_mn        , __ps_cosh_8_mn        ,__math_dispatch_error)
@@ -64,12 +64,12 @@ MTHINTRIN(cosh , dv4m , avx2       , __fd_cosh_4_mn        , __rd_cosh_4_mn
 
 MTHINTRIN(cosh , ss   , avx512knl  , __fss_cosh_avx2       , __fss_cosh_avx2       , __mth_i_cosh_avx2     ,__math_dispatch_error)
 MTHINTRIN(cosh , ds   , avx512knl  , __fsd_cosh_avx2       , __fsd_cosh_avx2       , __mth_i_dcosh_avx2    ,__math_dispatch_error)
-MTHINTRIN(cosh , sv4  , avx512knl  , __fvs_cosh_avx2       , __fvs_cosh_avx2       , __gs_cosh_4_p         ,__math_dispatch_error)
-MTHINTRIN(cosh , dv2  , avx512knl  , __fvd_cosh_avx2       , __fvd_cosh_avx2       , __gd_cosh_2_p         ,__math_dispatch_error)
-MTHINTRIN(cosh , sv8  , avx512knl  , __fvs_cosh_avx2_256   , __fvs_cosh_vex_256    , __gs_cosh_8_p         ,__math_dispatch_error)
-MTHINTRIN(cosh , dv4  , avx512knl  , __fvd_cosh_avx2_256   , __fvd_cosh_avx2_256   , __gd_cosh_4_p         ,__math_dispatch_error)
-MTHINTRIN(cosh , sv16 , avx512knl  , __fs_cosh_16_z2yy     , __rs_cosh_16_z2yy     , __gs_cosh_16_p        ,__math_dispatch_error)
-MTHINTRIN(cosh , dv8  , avx512knl  , __fd_cosh_8_z2yy      , __rd_cosh_8_z2yy      , __gd_cosh_8_p         ,__math_dispatch_error)
+MTHINTRIN(cosh , sv4  , avx512knl  , __fvs_cosh_avx2       , __fvs_cosh_avx2       , __ps_cosh_4_avx2      ,__math_dispatch_error)
+MTHINTRIN(cosh , dv2  , avx512knl  , __fvd_cosh_avx2       , __fvd_cosh_avx2       , __pd_cosh_2_avx2      ,__math_dispatch_error)
+MTHINTRIN(cosh , sv8  , avx512knl  , __fvs_cosh_avx2_256   , __fvs_cosh_vex_256    , __ps_cosh_8_avx2      ,__math_dispatch_error)
+MTHINTRIN(cosh , dv4  , avx512knl  , __fvd_cosh_avx2_256   , __fvd_cosh_avx2_256   , __pd_cosh_4_avx2      ,__math_dispatch_error)
+MTHINTRIN(cosh , sv16 , avx512knl  , __fs_cosh_16_z2yy     , __rs_cosh_16_z2yy     , __ps_cosh_16_z2yy     ,__math_dispatch_error)
+MTHINTRIN(cosh , dv8  , avx512knl  , __fd_cosh_8_z2yy      , __rd_cosh_8_z2yy      , __pd_cosh_8_z2yy      ,__math_dispatch_error)
 MTHINTRIN(cosh , sv4m , avx512knl  , __fs_cosh_4_mn        , __rs_cosh_4_mn        , __ps_cosh_4_mn        ,__math_dispatch_error)
 MTHINTRIN(cosh , dv2m , avx512knl  , __fd_cosh_2_mn        , __rd_cosh_2_mn        , __pd_cosh_2_mn        ,__math_dispatch_error)
 MTHINTRIN(cosh , sv8m , avx512knl  , __fs_cosh_8_mn        , __rs_cosh_8_mn        , __ps_cosh_8_mn        ,__math_dispatch_error)
@@ -79,12 +79,12 @@ MTHINTRIN(cosh , dv8m , avx512knl  , __fd_cosh_8_mn        , __rd_cosh_8_mn
 
 MTHINTRIN(cosh , ss   , avx512     , __fss_cosh_avx2       , __fss_cosh_avx2       , __mth_i_cosh_avx2     ,__math_dispatch_error)
 MTHINTRIN(cosh , ds   , avx512     , __fsd_cosh_avx2       , __fsd_cosh_avx2       , __mth_i_dcosh_avx2    ,__math_dispatch_error)
-MTHINTRIN(cosh , sv4  , avx512     , __fvs_cosh_avx2       , __fvs_cosh_avx2       , __gs_cosh_4_p         ,__math_dispatch_error)
-MTHINTRIN(cosh , dv2  , avx512     , __fvd_cosh_avx2       , __fvd_cosh_avx2       , __gd_cosh_2_p         ,__math_dispatch_error)
-MTHINTRIN(cosh , sv8  , avx512     , __fvs_cosh_avx2_256   , __fvs_cosh_vex_256    , __gs_cosh_8_p         ,__math_dispatch_error)
-MTHINTRIN(cosh , dv4  , avx512     , __fvd_cosh_avx2_256   , __fvd_cosh_avx2_256   , __gd_cosh_4_p         ,__math_dispatch_error)
-MTHINTRIN(cosh , sv16 , avx512     , __fs_cosh_16_z2yy     , __rs_cosh_16_z2yy     , __gs_cosh_16_p        ,__math_dispatch_error)
-MTHINTRIN(cosh , dv8  , avx512     , __fd_cosh_8_z2yy      , __rd_cosh_8_z2yy      , __gd_cosh_8_p         ,__math_dispatch_error)
+MTHINTRIN(cosh , sv4  , avx512     , __fvs_cosh_avx2       , __fvs_cosh_avx2       , __ps_cosh_4_avx2      ,__math_dispatch_error)
+MTHINTRIN(cosh , dv2  , avx512     , __fvd_cosh_avx2       , __fvd_cosh_avx2       , __pd_cosh_2_avx2      ,__math_dispatch_error)
+MTHINTRIN(cosh , sv8  , avx512     , __fvs_cosh_avx2_256   , __fvs_cosh_vex_256    , __ps_cosh_8_avx2      ,__math_dispatch_error)
+MTHINTRIN(cosh , dv4  , avx512     , __fvd_cosh_avx2_256   , __fvd_cosh_avx2_256   , __pd_cosh_4_avx2      ,__math_dispatch_error)
+MTHINTRIN(cosh , sv16 , avx512     , __fs_cosh_16_avx512   , __rs_cosh_16_avx512   , __ps_cosh_16_avx512   ,__math_dispatch_error)
+MTHINTRIN(cosh , dv8  , avx512     , __fd_cosh_8_avx512    , __rd_cosh_8_avx512    , __pd_cosh_8_avx512    ,__math_dispatch_error)
 MTHINTRIN(cosh , sv4m , avx512     , __fs_cosh_4_mn        , __rs_cosh_4_mn        , __ps_cosh_4_mn        ,__math_dispatch_error)
 MTHINTRIN(cosh , dv2m , avx512     , __fd_cosh_2_mn        , __rd_cosh_2_mn        , __pd_cosh_2_mn        ,__math_dispatch_error)
 MTHINTRIN(cosh , sv8m , avx512     , __fs_cosh_8_mn        , __rs_cosh_8_mn        , __ps_cosh_8_mn        ,__math_dispatch_error)
@@ -58,25 +58,25 @@ MTHINTRIN(div  , zv2  , avxfma4    , __fvz_div_fma4_256    , __fvz_div_fma4_256
 
 MTHINTRIN(div  , cs   , avx2       , __fsc_div_avx2        , __fsc_div_avx2        , __mth_i_cdiv_c99      ,__math_dispatch_error)
 MTHINTRIN(div  , zs   , avx2       , __fsz_div_avx2_c99    , __fsz_div_avx2_c99    , __mth_i_cddiv_c99     ,__math_dispatch_error)
-MTHINTRIN(div  , zv1  , avx2       , __fsz_div_avx2        , __fsz_div_avx2        , __gz_div_1v_p         ,__math_dispatch_error)
-MTHINTRIN(div  , cv2  , avx2       , __fvc_div_avx2        , __fvc_div_avx2        , __gc_div_2_p          ,__math_dispatch_error)
-MTHINTRIN(div  , cv4  , avx2       , __fvc_div_avx2_256    , __fvc_div_avx2_256    , __gc_div_4_p          ,__math_dispatch_error)
-MTHINTRIN(div  , zv2  , avx2       , __fvz_div_avx2_256    , __fvz_div_avx2_256    , __gz_div_2_p          ,__math_dispatch_error)
+MTHINTRIN(div  , zv1  , avx2       , __fsz_div_avx2        , __fsz_div_avx2        , __pz_div_1v_avx2      ,__math_dispatch_error)
+MTHINTRIN(div  , cv2  , avx2       , __fvc_div_avx2        , __fvc_div_avx2        , __pc_div_2_avx2       ,__math_dispatch_error)
+MTHINTRIN(div  , cv4  , avx2       , __fvc_div_avx2_256    , __fvc_div_avx2_256    , __pc_div_4_avx2       ,__math_dispatch_error)
+MTHINTRIN(div  , zv2  , avx2       , __fvz_div_avx2_256    , __fvz_div_avx2_256    , __pz_div_2_avx2       ,__math_dispatch_error)
 
 MTHINTRIN(div  , cs   , avx512knl  , __fsc_div_avx2        , __fsc_div_avx2        , __mth_i_cdiv_c99      ,__math_dispatch_error)
 MTHINTRIN(div  , zs   , avx512knl  , __fsz_div_avx2_c99    , __fsz_div_avx2_c99    , __mth_i_cddiv_c99     ,__math_dispatch_error)
-MTHINTRIN(div  , zv1  , avx512knl  , __fsz_div_avx2        , __fsz_div_avx2        , __gz_div_1v_p         ,__math_dispatch_error)
-MTHINTRIN(div  , cv2  , avx512knl  , __fvc_div_avx2        , __fvc_div_avx2        , __gc_div_2_p          ,__math_dispatch_error)
-MTHINTRIN(div  , cv4  , avx512knl  , __fvc_div_avx2_256    , __fvc_div_avx2_256    , __gc_div_4_p          ,__math_dispatch_error)
+MTHINTRIN(div  , zv1  , avx512knl  , __fsz_div_avx2        , __fsz_div_avx2        , __pz_div_1v_avx2      ,__math_dispatch_error)
+MTHINTRIN(div  , cv2  , avx512knl  , __fvc_div_avx2        , __fvc_div_avx2        , __pc_div_2_avx2       ,__math_dispatch_error)
+MTHINTRIN(div  , cv4  , avx512knl  , __fvc_div_avx2_256    , __fvc_div_avx2_256    , __pc_div_4_avx2       ,__math_dispatch_error)
 MTHINTRIN(div  , cv8  , avx512knl  , __fvc_div_evex_512    , __fvc_div_evex_512    , __gc_div_8_p          ,__math_dispatch_error)
-MTHINTRIN(div  , zv2  , avx512knl  , __fvz_div_avx2_256    , __fvz_div_avx2_256    , __gz_div_2_p          ,__math_dispatch_error)
+MTHINTRIN(div  , zv2  , avx512knl  , __fvz_div_avx2_256    , __fvz_div_avx2_256    , __pz_div_2_avx2       ,__math_dispatch_error)
 MTHINTRIN(div  , zv4  , avx512knl  , __fvz_div_evex_512    , __fvz_div_evex_512    , __gz_div_4_p          ,__math_dispatch_error)
 
 MTHINTRIN(div  , cs   , avx512     , __fsc_div_avx2        , __fsc_div_avx2        , __mth_i_cdiv_c99      ,__math_dispatch_error)
 MTHINTRIN(div  , zs   , avx512     , __fsz_div_avx2_c99    , __fsz_div_avx2_c99    , __mth_i_cddiv_c99     ,__math_dispatch_error)
-MTHINTRIN(div  , zv1  , avx512     , __fsz_div_avx2        , __fsz_div_avx2        , __gz_div_1v_p         ,__math_dispatch_error)
-MTHINTRIN(div  , cv2  , avx512     , __fvc_div_avx2        , __fvc_div_avx2        , __gc_div_2_p          ,__math_dispatch_error)
-MTHINTRIN(div  , cv4  , avx512     , __fvc_div_avx2_256    , __fvc_div_avx2_256    , __gc_div_4_p          ,__math_dispatch_error)
-MTHINTRIN(div  , cv8  , avx512     , __fvc_div_evex_512    , __fvc_div_evex_512    , __gc_div_8_p          ,__math_dispatch_error)
-MTHINTRIN(div  , zv2  , avx512     , __fvz_div_avx2_256    , __fvz_div_avx2_256    , __gz_div_2_p          ,__math_dispatch_error)
-MTHINTRIN(div  , zv4  , avx512     , __fvz_div_evex_512    , __fvz_div_evex_512    , __gz_div_4_p          ,__math_dispatch_error)
+MTHINTRIN(div  , zv1  , avx512     , __fsz_div_avx2        , __fsz_div_avx2        , __pz_div_1v_avx2      ,__math_dispatch_error)
+MTHINTRIN(div  , cv2  , avx512     , __fvc_div_avx2        , __fvc_div_avx2        , __pc_div_2_avx2       ,__math_dispatch_error)
+MTHINTRIN(div  , cv4  , avx512     , __fvc_div_avx2_256    , __fvc_div_avx2_256    , __pc_div_4_avx2       ,__math_dispatch_error)
+MTHINTRIN(div  , cv8  , avx512     , __fvc_div_evex_512    , __fvc_div_evex_512    , __pc_div_8_avx512     ,__math_dispatch_error)
+MTHINTRIN(div  , zv2  , avx512     , __fvz_div_avx2_256    , __fvz_div_avx2_256    , __pz_div_2_avx2       ,__math_dispatch_error)
+MTHINTRIN(div  , zv4  , avx512     , __fvz_div_evex_512    , __fvz_div_evex_512    , __pz_div_4_avx512     ,__math_dispatch_error)
@@ -75,14 +75,14 @@ MTHINTRIN(exp  , ss   , avx2       , __fss_exp_fma3        , __fss_exp_fma3
 MTHINTRIN(exp  , ds   , avx2       , __fsd_exp_fma3        , __fsd_exp_fma3        , __mth_i_dexp_avx2     ,__math_dispatch_error)
 MTHINTRIN(exp  , cs   , avx2       , cexpf                 , cexpf                 , cexpf                 ,__math_dispatch_error)
 MTHINTRIN(exp  , zs   , avx2       , __fsz_exp_avx2_c99    , __fsz_exp_avx2_c99    , cexp                  ,__math_dispatch_error)
-MTHINTRIN(exp  , zv1  , avx2       , __fsz_exp_1v_avx2     , __fsz_exp_1v_avx2     , __gz_exp_1v_p         ,__math_dispatch_error)
+MTHINTRIN(exp  , zv1  , avx2       , __fsz_exp_1v_avx2     , __fsz_exp_1v_avx2     , __pz_exp_1v_avx2      ,__math_dispatch_error)
 MTHINTRIN(exp  , sv4  , avx2       , __fvs_exp_fma3        , __fvs_exp_fma3        , __gs_exp_4_p          ,__math_dispatch_error)
 MTHINTRIN(exp  , dv2  , avx2       , __fvd_exp_fma3        , __fvd_exp_fma3        , __gd_exp_2_p          ,__math_dispatch_error)
-MTHINTRIN(exp  , cv2  , avx2       , __gc_exp_2_f          , __gc_exp_2_r          , __gc_exp_2_p          ,__math_dispatch_error)
+MTHINTRIN(exp  , cv2  , avx2       , __fc_exp_2_avx2       , __rc_exp_2_avx2       , __pc_exp_2_avx2       ,__math_dispatch_error)
 MTHINTRIN(exp  , sv8  , avx2       , __fvs_exp_fma3_256    , __fvs_exp_fma3_256    , __gs_exp_8_p          ,__math_dispatch_error)
 MTHINTRIN(exp  , dv4  , avx2       , __fvd_exp_fma3_256    , __fvd_exp_fma3_256    , __gd_exp_4_p          ,__math_dispatch_error)
-MTHINTRIN(exp  , cv4  , avx2       , __gc_exp_4_f          , __gc_exp_4_r          , __gc_exp_4_p          ,__math_dispatch_error)
-MTHINTRIN(exp  , zv2  , avx2       , __fvz_exp_avx2        , __fvz_exp_avx2        , __gz_exp_2_p          ,__math_dispatch_error)
+MTHINTRIN(exp  , cv4  , avx2       , __fc_exp_4_avx2       , __rc_exp_4_avx2       , __pc_exp_4_avx2       ,__math_dispatch_error)
+MTHINTRIN(exp  , zv2  , avx2       , __fvz_exp_avx2        , __fvz_exp_avx2        , __pz_exp_2_avx2       ,__math_dispatch_error)
 MTHINTRIN(exp  , sv4m , avx2       , __fs_exp_4_mn         , __rs_exp_4_mn         , __ps_exp_4_mn         ,__math_dispatch_error)
 MTHINTRIN(exp  , dv2m , avx2       , __fd_exp_2_mn         , __rd_exp_2_mn         , __pd_exp_2_mn         ,__math_dispatch_error)
 MTHINTRIN(exp  , sv8m , avx2       , __fs_exp_8_mn         , __rs_exp_8_mn         , __ps_exp_8_mn         ,__math_dispatch_error)
@@ -92,14 +92,14 @@ MTHINTRIN(exp  , ss   , avx512knl  , __fss_exp_fma3        , __fss_exp_fma3
 MTHINTRIN(exp  , ds   , avx512knl  , __fsd_exp_fma3        , __fsd_exp_fma3        , __mth_i_dexp_avx2     ,__math_dispatch_error)
 MTHINTRIN(exp  , cs   , avx512knl  , cexpf                 , cexpf                 , cexpf                 ,__math_dispatch_error)
 MTHINTRIN(exp  , zs   , avx512knl  , __fsz_exp_avx2_c99    , __fsz_exp_avx2_c99    , cexp                  ,__math_dispatch_error)
-MTHINTRIN(exp  , zv1  , avx512knl  , __fsz_exp_1v_avx2     , __fsz_exp_1v_avx2     , __gz_exp_1v_p         ,__math_dispatch_error)
+MTHINTRIN(exp  , zv1  , avx512knl  , __fsz_exp_1v_avx2     , __fsz_exp_1v_avx2     , __pz_exp_1v_avx2      ,__math_dispatch_error)
 MTHINTRIN(exp  , sv4  , avx512knl  , __fvs_exp_fma3        , __fvs_exp_fma3        , __gs_exp_4_p          ,__math_dispatch_error)
 MTHINTRIN(exp  , dv2  , avx512knl  , __fvd_exp_fma3        , __fvd_exp_fma3        , __gd_exp_2_p          ,__math_dispatch_error)
-MTHINTRIN(exp  , cv2  , avx512knl  , __gc_exp_2_f          , __gc_exp_2_r          , __gc_exp_2_p          ,__math_dispatch_error)
+MTHINTRIN(exp  , cv2  , avx512knl  , __fc_exp_2_avx2       , __rc_exp_2_avx2       , __pc_exp_2_avx2       ,__math_dispatch_error)
 MTHINTRIN(exp  , sv8  , avx512knl  , __fvs_exp_fma3_256    , __fvs_exp_fma3_256    , __gs_exp_8_p          ,__math_dispatch_error)
 MTHINTRIN(exp  , dv4  , avx512knl  , __fvd_exp_fma3_256    , __fvd_exp_fma3_256    , __gd_exp_4_p          ,__math_dispatch_error)
-MTHINTRIN(exp  , cv4  , avx512knl  , __gc_exp_4_f          , __gc_exp_4_r          , __gc_exp_4_p          ,__math_dispatch_error)
-MTHINTRIN(exp  , zv2  , avx512knl  , __fvz_exp_avx2        , __fvz_exp_avx2        , __gz_exp_2_p          ,__math_dispatch_error)
+MTHINTRIN(exp  , cv4  , avx512knl  , __fc_exp_4_avx2       , __rc_exp_4_avx2       , __pc_exp_4_avx2       ,__math_dispatch_error)
+MTHINTRIN(exp  , zv2  , avx512knl  , __fvz_exp_avx2        , __fvz_exp_avx2        , __pz_exp_2_avx2       ,__math_dispatch_error)
 MTHINTRIN(exp  , sv16 , avx512knl  , __fvs_exp_evex_512    , __fvs_exp_evex_512    , __gs_exp_16_p         ,__math_dispatch_error)
 MTHINTRIN(exp  , dv8  , avx512knl  , __fvd_exp_evex_512    , __fvd_exp_evex_512    , __gd_exp_8_p          ,__math_dispatch_error)
 MTHINTRIN(exp  , cv8  , avx512knl  , __gc_exp_8_f          , __gc_exp_8_r          , __gc_exp_8_p          ,__math_dispatch_error)
@@ -115,18 +115,18 @@ MTHINTRIN(exp  , ss   , avx512     , __fss_exp_fma3        , __fss_exp_fma3
 MTHINTRIN(exp  , ds   , avx512     , __fsd_exp_fma3        , __fsd_exp_fma3        , __mth_i_dexp_avx2     ,__math_dispatch_error)
 MTHINTRIN(exp  , cs   , avx512     , cexpf                 , cexpf                 , cexpf                 ,__math_dispatch_error)
 MTHINTRIN(exp  , zs   , avx512     , __fsz_exp_avx2_c99    , __fsz_exp_avx2_c99    , cexp                  ,__math_dispatch_error)
-MTHINTRIN(exp  , zv1  , avx512     , __fsz_exp_1v_avx2     , __fsz_exp_1v_avx2     , __gz_exp_1v_p         ,__math_dispatch_error)
+MTHINTRIN(exp  , zv1  , avx512     , __fsz_exp_1v_avx2     , __fsz_exp_1v_avx2     , __pz_exp_1v_avx2      ,__math_dispatch_error)
 MTHINTRIN(exp  , sv4  , avx512     , __fvs_exp_fma3        , __fvs_exp_fma3        , __gs_exp_4_p          ,__math_dispatch_error)
 MTHINTRIN(exp  , dv2  , avx512     , __fvd_exp_fma3        , __fvd_exp_fma3        , __gd_exp_2_p          ,__math_dispatch_error)
-MTHINTRIN(exp  , cv2  , avx512     , __gc_exp_2_f          , __gc_exp_2_r          , __gc_exp_2_p          ,__math_dispatch_error)
+MTHINTRIN(exp  , cv2  , avx512     , __fc_exp_2_avx2       , __rc_exp_2_avx2       , __pc_exp_2_avx2       ,__math_dispatch_error)
 MTHINTRIN(exp  , sv8  , avx512     , __fvs_exp_fma3_256    , __fvs_exp_fma3_256    , __gs_exp_8_p          ,__math_dispatch_error)
 MTHINTRIN(exp  , dv4  , avx512     , __fvd_exp_fma3_256    , __fvd_exp_fma3_256    , __gd_exp_4_p          ,__math_dispatch_error)
-MTHINTRIN(exp  , cv4  , avx512     , __gc_exp_4_f          , __gc_exp_4_r          , __gc_exp_4_p          ,__math_dispatch_error)
-MTHINTRIN(exp  , zv2  , avx512     , __fvz_exp_avx2        , __fvz_exp_avx2        , __gz_exp_2_p          ,__math_dispatch_error)
+MTHINTRIN(exp  , cv4  , avx512     , __fc_exp_4_avx2       , __rc_exp_4_avx2       , __pc_exp_4_avx2       ,__math_dispatch_error)
+MTHINTRIN(exp  , zv2  , avx512     , __fvz_exp_avx2        , __fvz_exp_avx2        , __pz_exp_2_avx2       ,__math_dispatch_error)
 MTHINTRIN(exp  , sv16 , avx512     , __fvs_exp_evex_512    , __fvs_exp_evex_512    , __gs_exp_16_p         ,__math_dispatch_error)
 MTHINTRIN(exp  , dv8  , avx512     , __fvd_exp_evex_512    , __fvd_exp_evex_512    , __gd_exp_8_p          ,__math_dispatch_error)
-MTHINTRIN(exp  , cv8  , avx512     , __gc_exp_8_f          , __gc_exp_8_r          , __gc_exp_8_p          ,__math_dispatch_error)
-MTHINTRIN(exp  , zv4  , avx512     , __fvz_exp_evex_512    , __fvz_exp_evex_512    , __gz_exp_4_p          ,__math_dispatch_error)
+MTHINTRIN(exp  , cv8  , avx512     , __fc_exp_8_avx512     , __rc_exp_8_avx512     , __pc_exp_8_avx512     ,__math_dispatch_error)
+MTHINTRIN(exp  , zv4  , avx512     , __fvz_exp_evex_512    , __fvz_exp_evex_512    , __pz_exp_4_avx512     ,__math_dispatch_error)
 MTHINTRIN(exp  , sv4m , avx512     , __fs_exp_4_mn         , __rs_exp_4_mn         , __ps_exp_4_mn         ,__math_dispatch_error)
 MTHINTRIN(exp  , dv2m , avx512     , __fd_exp_2_mn         , __rd_exp_2_mn         , __pd_exp_2_mn         ,__math_dispatch_error)
 MTHINTRIN(exp  , sv8m , avx512     , __fs_exp_8_mn         , __rs_exp_8_mn         , __ps_exp_8_mn         ,__math_dispatch_error)
@@ -83,8 +83,8 @@ MTHINTRIN(log  , sv4  , avx512     , __fvs_log_fma3        , __rvs_log_fma3
 MTHINTRIN(log  , dv2  , avx512     , __fvd_log_fma3        , __fvd_log_fma3        , __gd_log_2_p          ,__math_dispatch_error)
 MTHINTRIN(log  , sv8  , avx512     , __fvs_log_fma3_256    , __rvs_log_fma3_256    , __gs_log_8_p          ,__math_dispatch_error)
 MTHINTRIN(log  , dv4  , avx512     , __fvd_log_fma3_256    , __fvd_log_fma3_256    , __gd_log_4_p          ,__math_dispatch_error)
-MTHINTRIN(log  , sv16 , avx512     , __fs_log_16_z2yy      , __fs_log_16_z2yy      , __gs_log_16_p         ,__math_dispatch_error)
-MTHINTRIN(log  , dv8  , avx512     , __fd_log_8_z2yy       , __fd_log_8_z2yy       , __gd_log_8_p          ,__math_dispatch_error)
+MTHINTRIN(log  , sv16 , avx512     , __fs_log_16_avx512    , __rs_log_16_avx512    , __ps_log_16_avx512    ,__math_dispatch_error)
+MTHINTRIN(log  , dv8  , avx512     , __fd_log_8_avx512     , __rd_log_8_avx512     , __pd_log_8_avx512     ,__math_dispatch_error)
 MTHINTRIN(log  , sv4m , avx512     , __fs_log_4_mn         , __rs_log_4_mn         , __ps_log_4_mn         ,__math_dispatch_error)
 MTHINTRIN(log  , dv2m , avx512     , __fd_log_2_mn         , __rd_log_2_mn         , __pd_log_2_mn         ,__math_dispatch_error)
 MTHINTRIN(log  , sv8m , avx512     , __fs_log_8_mn         , __rs_log_8_mn         , __ps_log_8_mn         ,__math_dispatch_error)
@@ -114,23 +114,23 @@ MTHINTRIN(log , cv4  , avxfma4     , __gc_log_4_f          , __gc_log_4_r
 MTHINTRIN(log , zv2  , avxfma4     , __gz_log_2_f          , __gz_log_2_r          , __gz_log_2_p         ,__math_dispatch_error)
 MTHINTRIN(log , cs   , avx2        , clogf                 , clogf                 , clogf                ,__math_dispatch_error)
 MTHINTRIN(log , zs   , avx2        , __mth_i_cdlog_c99     , __mth_i_cdlog_c99     , __mth_i_cdlog_c99    ,__math_dispatch_error)
-MTHINTRIN(log , zv1  , avx2        , __gz_log_1v_f         , __gz_log_1v_r         , __gz_log_1v_p        ,__math_dispatch_error)
-MTHINTRIN(log , cv2  , avx2        , __gc_log_2_f          , __gc_log_2_r          , __gc_log_2_p         ,__math_dispatch_error)
-MTHINTRIN(log , cv4  , avx2        , __gc_log_4_f          , __gc_log_4_r          , __gc_log_4_p         ,__math_dispatch_error)
-MTHINTRIN(log , zv2  , avx2        , __gz_log_2_f          , __gz_log_2_r          , __gz_log_2_p         ,__math_dispatch_error)
+MTHINTRIN(log , zv1  , avx2        , __fz_log_1v_avx2      , __rz_log_1v_avx2      , __pz_log_1v_avx2     ,__math_dispatch_error)
+MTHINTRIN(log , cv2  , avx2        , __fc_log_2_avx2       , __rc_log_2_avx2       , __pc_log_2_avx2      ,__math_dispatch_error)
+MTHINTRIN(log , cv4  , avx2        , __fc_log_4_avx2       , __rc_log_4_avx2       , __pc_log_4_avx2      ,__math_dispatch_error)
+MTHINTRIN(log , zv2  , avx2        , __fz_log_2_avx2       , __rz_log_2_avx2       , __pz_log_2_avx2      ,__math_dispatch_error)
 MTHINTRIN(log , cs   , avx512knl   , clogf                 , clogf                 , clogf                ,__math_dispatch_error)
 MTHINTRIN(log , zs   , avx512knl   , __mth_i_cdlog_c99     , __mth_i_cdlog_c99     , __mth_i_cdlog_c99    ,__math_dispatch_error)
-MTHINTRIN(log , zv1  , avx512knl   , __gz_log_1v_f         , __gz_log_1v_r         , __gz_log_1v_p        ,__math_dispatch_error)
-MTHINTRIN(log , cv2  , avx512knl   , __gc_log_2_f          , __gc_log_2_r          , __gc_log_2_p         ,__math_dispatch_error)
-MTHINTRIN(log , cv4  , avx512knl   , __gc_log_4_f          , __gc_log_4_r          , __gc_log_4_p         ,__math_dispatch_error)
+MTHINTRIN(log , zv1  , avx512knl   , __fz_log_1v_avx2      , __rz_log_1v_avx2      , __pz_log_1v_avx2     ,__math_dispatch_error)
+MTHINTRIN(log , cv2  , avx512knl   , __fc_log_2_avx2       , __rc_log_2_avx2       , __pc_log_2_avx2      ,__math_dispatch_error)
+MTHINTRIN(log , cv4  , avx512knl   , __fc_log_4_avx2       , __rc_log_4_avx2       , __pc_log_4_avx2      ,__math_dispatch_error)
 MTHINTRIN(log , cv8  , avx512knl   , __gc_log_8_f          , __gc_log_8_r          , __gc_log_8_p         ,__math_dispatch_error)
-MTHINTRIN(log , zv2  , avx512knl   , __gz_log_2_f          , __gz_log_2_r          , __gz_log_2_p         ,__math_dispatch_error)
+MTHINTRIN(log , zv2  , avx512knl   , __fz_log_2_avx2       , __rz_log_2_avx2       , __pz_log_2_avx2      ,__math_dispatch_error)
 MTHINTRIN(log , zv4  , avx512knl   , __gz_log_4_f          , __gz_log_4_r          , __gz_log_4_p         ,__math_dispatch_error)
 MTHINTRIN(log , cs   , avx512      , clogf                 , clogf                 , clogf                ,__math_dispatch_error)
 MTHINTRIN(log , zs   , avx512      , __mth_i_cdlog_c99     , __mth_i_cdlog_c99     , __mth_i_cdlog_c99    ,__math_dispatch_error)
-MTHINTRIN(log , zv1  , avx512      , __gz_log_1v_f         , __gz_log_1v_r         , __gz_log_1v_p        ,__math_dispatch_error)
-MTHINTRIN(log , cv2  , avx512      , __gc_log_2_f          , __gc_log_2_r          , __gc_log_2_p         ,__math_dispatch_error)
-MTHINTRIN(log , cv4  , avx512      , __gc_log_4_f          , __gc_log_4_r          , __gc_log_4_p         ,__math_dispatch_error)
-MTHINTRIN(log , cv8  , avx512      , __gc_log_8_f          , __gc_log_8_r          , __gc_log_8_p         ,__math_dispatch_error)
-MTHINTRIN(log , zv2  , avx512      , __gz_log_2_f          , __gz_log_2_r          , __gz_log_2_p         ,__math_dispatch_error)
-MTHINTRIN(log , zv4  , avx512      , __gz_log_4_f          , __gz_log_4_r          , __gz_log_4_p         ,__math_dispatch_error)
+MTHINTRIN(log , zv1  , avx512      , __fz_log_1v_avx2      , __rz_log_1v_avx2      , __pz_log_1v_avx2     ,__math_dispatch_error)
+MTHINTRIN(log , cv2  , avx512      , __fc_log_2_avx2       , __rc_log_2_avx2       , __pc_log_2_avx2      ,__math_dispatch_error)
+MTHINTRIN(log , cv4  , avx512      , __fc_log_4_avx2       , __rc_log_4_avx2       , __pc_log_4_avx2      ,__math_dispatch_error)
+MTHINTRIN(log , cv8  , avx512      , __fc_log_8_avx512     , __rc_log_8_avx512     , __pc_log_8_avx512    ,__math_dispatch_error)
+MTHINTRIN(log , zv2  , avx512      , __fz_log_2_avx2       , __rz_log_2_avx2       , __pz_log_2_avx2      ,__math_dispatch_error)
+MTHINTRIN(log , zv4  , avx512      , __fz_log_4_avx512     , __rz_log_4_avx512     , __pz_log_4_avx512    ,__math_dispatch_error)
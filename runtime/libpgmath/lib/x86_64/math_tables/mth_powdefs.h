@@ -83,8 +83,8 @@ MTHINTRIN(pow  , sv4  , avx512     , __fvs_pow_fma3        , __rvs_pow_vex
 MTHINTRIN(pow  , dv2  , avx512     , __fvd_pow_fma3        , __fvd_pow_fma3        , __gd_pow_2_p          ,__math_dispatch_error)
 MTHINTRIN(pow  , sv8  , avx512     , __fvs_pow_fma3_256    , __rvs_pow_vex_256     , __gs_pow_8_p          ,__math_dispatch_error)
 MTHINTRIN(pow  , dv4  , avx512     , __fvd_pow_fma3_256    , __fvd_pow_fma3_256    , __gd_pow_4_p          ,__math_dispatch_error)
-MTHINTRIN(pow  , sv16 , avx512     , __fs_pow_16_z2yy      , __fs_pow_16_z2yy      , __gs_pow_16_p         ,__math_dispatch_error)
-MTHINTRIN(pow  , dv8  , avx512     , __fd_pow_8_z2yy       , __fd_pow_8_z2yy       , __gd_pow_8_p          ,__math_dispatch_error)
+MTHINTRIN(pow  , sv16 , avx512     , __fs_pow_16_avx512    , __rs_pow_16_avx512    , __ps_pow_16_avx512    ,__math_dispatch_error)
+MTHINTRIN(pow  , dv8  , avx512     , __fd_pow_8_avx512     , __rd_pow_8_avx512     , __pd_pow_8_avx512     ,__math_dispatch_error)
 MTHINTRIN(pow  , sv4m , avx512     , __fs_pow_4_mn         , __rs_pow_4_mn         , __ps_pow_4_mn         ,__math_dispatch_error)
 MTHINTRIN(pow  , dv2m , avx512     , __fd_pow_2_mn         , __rd_pow_2_mn         , __pd_pow_2_mn         ,__math_dispatch_error)
 MTHINTRIN(pow  , sv8m , avx512     , __fs_pow_8_mn         , __rs_pow_8_mn         , __ps_pow_8_mn         ,__math_dispatch_error)
@@ -114,23 +114,23 @@ MTHINTRIN(pow , cv4  , avxfma4     , __gc_pow_4_f          , __gc_pow_4_r
 MTHINTRIN(pow , zv2  , avxfma4     , __gz_pow_2_f          , __gz_pow_2_r          , __gz_pow_2_p         ,__math_dispatch_error)
 MTHINTRIN(pow , cs   , avx2        , cpowf                 , cpowf                 , cpowf                ,__math_dispatch_error)
 MTHINTRIN(pow , zs   , avx2        , cpow                  , cpow                  , cpow                 ,__math_dispatch_error)
-MTHINTRIN(pow , zv1  , avx2        , __gz_pow_1v_f         , __gz_pow_1v_r         , __gz_pow_1v_p        ,__math_dispatch_error)
-MTHINTRIN(pow , cv2  , avx2        , __gc_pow_2_f          , __gc_pow_2_r          , __gc_pow_2_p         ,__math_dispatch_error)
-MTHINTRIN(pow , cv4  , avx2        , __gc_pow_4_f          , __gc_pow_4_r          , __gc_pow_4_p         ,__math_dispatch_error)
-MTHINTRIN(pow , zv2  , avx2        , __gz_pow_2_f          , __gz_pow_2_r          , __gz_pow_2_p         ,__math_dispatch_error)
+MTHINTRIN(pow , zv1  , avx2        , __fz_pow_1v_avx2      , __rz_pow_1v_avx2      , __pz_pow_1v_avx2     ,__math_dispatch_error)
+MTHINTRIN(pow , cv2  , avx2        , __fc_pow_2_avx2       , __rc_pow_2_avx2       , __pc_pow_2_avx2      ,__math_dispatch_error)
+MTHINTRIN(pow , cv4  , avx2        , __fc_pow_4_avx2       , __rc_pow_4_avx2       , __pc_pow_4_avx2      ,__math_dispatch_error)
+MTHINTRIN(pow , zv2  , avx2        , __fz_pow_2_avx2       , __rz_pow_2_avx2       , __pz_pow_2_avx2      ,__math_dispatch_error)
 MTHINTRIN(pow , cs   , avx512knl   , cpowf                 , cpowf                 , cpowf                ,__math_dispatch_error)
 MTHINTRIN(pow , zs   , avx512knl   , cpow                  , cpow                  , cpow                 ,__math_dispatch_error)
-MTHINTRIN(pow , zv1  , avx512knl   , __gz_pow_1v_f         , __gz_pow_1v_r         , __gz_pow_1v_p        ,__math_dispatch_error)
-MTHINTRIN(pow , cv2  , avx512knl   , __gc_pow_2_f          , __gc_pow_2_r          , __gc_pow_2_p         ,__math_dispatch_error)
-MTHINTRIN(pow , cv4  , avx512knl   , __gc_pow_4_f          , __gc_pow_4_r          , __gc_pow_4_p         ,__math_dispatch_error)
+MTHINTRIN(pow , zv1  , avx512knl   , __fz_pow_1v_avx2      , __rz_pow_1v_avx2      , __pz_pow_1v_avx2     ,__math_dispatch_error)
+MTHINTRIN(pow , cv2  , avx512knl   , __fc_pow_2_avx2       , __rc_pow_2_avx2       , __pc_pow_2_avx2      ,__math_dispatch_error)
+MTHINTRIN(pow , cv4  , avx512knl   , __fc_pow_4_avx2       , __rc_pow_4_avx2       , __pc_pow_4_avx2      ,__math_dispatch_error)
 MTHINTRIN(pow , cv8  , avx512knl   , __gc_pow_8_f          , __gc_pow_8_r          , __gc_pow_8_p         ,__math_dispatch_error)
-MTHINTRIN(pow , zv2  , avx512knl   , __gz_pow_2_f          , __gz_pow_2_r          , __gz_pow_2_p         ,__math_dispatch_error)
+MTHINTRIN(pow , zv2  , avx512knl   , __fz_pow_2_avx2       , __rz_pow_2_avx2       , __pz_pow_2_avx2      ,__math_dispatch_error)
 MTHINTRIN(pow , zv4  , avx512knl   , __gz_pow_4_f          , __gz_pow_4_r          , __gz_pow_4_p         ,__math_dispatch_error)
 MTHINTRIN(pow , cs   , avx512      , cpowf                 , cpowf                 , cpowf                ,__math_dispatch_error)
 MTHINTRIN(pow , zs   , avx512      , cpow                  , cpow                  , cpow                 ,__math_dispatch_error)
-MTHINTRIN(pow , zv1  , avx512      , __gz_pow_1v_f         , __gz_pow_1v_r         , __gz_pow_1v_p        ,__math_dispatch_error)
-MTHINTRIN(pow , cv2  , avx512      , __gc_pow_2_f          , __gc_pow_2_r          , __gc_pow_2_p         ,__math_dispatch_error)
-MTHINTRIN(pow , cv4  , avx512      , __gc_pow_4_f          , __gc_pow_4_r          , __gc_pow_4_p         ,__math_dispatch_error)
-MTHINTRIN(pow , cv8  , avx512      , __gc_pow_8_f          , __gc_pow_8_r          , __gc_pow_8_p         ,__math_dispatch_error)
-MTHINTRIN(pow , zv2  , avx512      , __gz_pow_2_f          , __gz_pow_2_r          , __gz_pow_2_p         ,__math_dispatch_error)
-MTHINTRIN(pow , zv4  , avx512      , __gz_pow_4_f          , __gz_pow_4_r          , __gz_pow_4_p         ,__math_dispatch_error)
+MTHINTRIN(pow , zv1  , avx512      , __fz_pow_1v_avx2      , __rz_pow_1v_avx2      , __pz_pow_1v_avx2     ,__math_dispatch_error)
+MTHINTRIN(pow , cv2  , avx512      , __fc_pow_2_avx2       , __rc_pow_2_avx2       , __pc_pow_2_avx2      ,__math_dispatch_error)
+MTHINTRIN(pow , cv4  , avx512      , __fc_pow_4_avx2       , __rc_pow_4_avx2       , __pc_pow_4_avx2      ,__math_dispatch_error)
+MTHINTRIN(pow , cv8  , avx512      , __fc_pow_8_avx512     , __rc_pow_8_avx512     , __pc_pow_8_avx512    ,__math_dispatch_error)
+MTHINTRIN(pow , zv2  , avx512      , __fz_pow_2_avx2       , __rz_pow_2_avx2       , __pz_pow_2_avx2      ,__math_dispatch_error)
+MTHINTRIN(pow , zv4  , avx512      , __fz_pow_4_avx512     , __rz_pow_4_avx512     , __pz_pow_4_avx512    ,__math_dispatch_error)
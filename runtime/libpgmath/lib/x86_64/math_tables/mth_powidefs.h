@@ -267,8 +267,8 @@ MTHINTRIN(powi1, sv4  , avx512knl  , __fx_powi1_4          , __fx_powi1_4
 MTHINTRIN(powi1, dv2  , avx512knl  , __fx_powi1_2          , __fx_powi1_2          , __px_powi1_2          ,__math_dispatch_error)
 MTHINTRIN(powi1, sv8  , avx512knl  , __fy_powi1_8          , __fy_powi1_8          , __py_powi1_8          ,__math_dispatch_error)
 MTHINTRIN(powi1, dv4  , avx512knl  , __fy_powi1_4          , __fy_powi1_4          , __py_powi1_4          ,__math_dispatch_error)
-MTHINTRIN(powi1, sv16 , avx512knl  , __gs_powi1_16_f       , __gs_powi1_16_r       , __pz_powi1_16         ,__math_dispatch_error)
-MTHINTRIN(powi1, dv8  , avx512knl  , __gd_powi1_8_f        , __gd_powi1_8_r        , __pz_powi1_8          ,__math_dispatch_error)
+MTHINTRIN(powi1, sv16 , avx512knl  , __fz_powi1_16         , __fz_powi1_16         , __pz_powi1_16         ,__math_dispatch_error)
+MTHINTRIN(powi1, dv8  , avx512knl  , __fz_powi1_8          , __fz_powi1_8          , __pz_powi1_8          ,__math_dispatch_error)
 MTHINTRIN(powi1, sv4m , avx512knl  , __fs_powi1_4_mn       , __rs_powi1_4_mn       , __ps_powi1_4_mn       ,__math_dispatch_error)
 MTHINTRIN(powi1, dv2m , avx512knl  , __fd_powi1_2_mn       , __rd_powi1_2_mn       , __pd_powi1_2_mn       ,__math_dispatch_error)
 MTHINTRIN(powi1, sv8m , avx512knl  , __fs_powi1_8_mn       , __rs_powi1_8_mn       , __ps_powi1_8_mn       ,__math_dispatch_error)
@@ -282,14 +282,14 @@ MTHINTRIN(powi , sv4  , avx512knl  , __gs_powi_4_f         , __gs_powi_4_r
 MTHINTRIN(powi , dv2  , avx512knl  , __gd_powi_2_f         , __gd_powi_2_r         , __px_powi_2           ,__math_dispatch_error)
 MTHINTRIN(powi , sv8  , avx512knl  , __gs_powi_8_f         , __gs_powi_8_r         , __py_powi_8           ,__math_dispatch_error)
 MTHINTRIN(powi , dv4  , avx512knl  , __gd_powi_4_f         , __gd_powi_4_r         , __py_powi_4           ,__math_dispatch_error)
-MTHINTRIN(powi , sv16 , avx512knl  , __gs_powi_16_f        , __gs_powi_16_r        , __pz_powi_16          ,__math_dispatch_error)
-MTHINTRIN(powi , dv8  , avx512knl  , __gd_powi_8_f         , __gd_powi_8_r         , __pz_powi_8           ,__math_dispatch_error)
+MTHINTRIN(powi , sv16 , avx512knl  , __fs_powi_16_avx512   , __fs_powi_16_avx512   , __pz_powi_16          ,__math_dispatch_error)
+MTHINTRIN(powi , dv8  , avx512knl  , __fd_powi_8_avx512    , __fd_powi_8_avx512    , __pz_powi_8           ,__math_dispatch_error)
 MTHINTRIN(powi , sv4m , avx512knl  , __fs_powi_4_mn        , __rs_powi_4_mn        , __ps_powi_4_mn        ,__math_dispatch_error)
 MTHINTRIN(powi , dv2m , avx512knl  , __fd_powi_2_mn        , __rd_powi_2_mn        , __pd_powi_2_mn        ,__math_dispatch_error)
 MTHINTRIN(powi , sv8m , avx512knl  , __fs_powi_8_mn        , __rs_powi_8_mn        , __ps_powi_8_mn        ,__math_dispatch_error)
 MTHINTRIN(powi , dv4m , avx512knl  , __fd_powi_4_mn        , __rd_powi_4_mn        , __pd_powi_4_mn        ,__math_dispatch_error)
-MTHINTRIN(powi , sv16m, avx512knl  , __fs_powi_16_mn       , __rs_powi_16_mn       , __ps_powi_16_mn       ,__math_dispatch_error)
-MTHINTRIN(powi , dv8m , avx512knl  , __fd_powi_8_mn        , __rd_powi_8_mn        , __pd_powi_8_mn        ,__math_dispatch_error)
+MTHINTRIN(powi , sv16m, avx512knl  , __fs_powi_16m_avx512  , __fs_powi_16m_avx512  , __ps_powi_16_mn       ,__math_dispatch_error)
+MTHINTRIN(powi , dv8m , avx512knl  , __fd_powi_8m_avx512   , __fd_powi_8m_avx512   , __pd_powi_8_mn        ,__math_dispatch_error)
 /* R(:)**I8 */
 MTHINTRIN(powk1, ss   , avx512knl  , __mth_i_rpowk         , __mth_i_rpowk         , __pmth_i_rpowk        ,__math_dispatch_error)
 MTHINTRIN(powk1, ds   , avx512knl  , __mth_i_dpowk         , __mth_i_dpowk         , __pmth_i_dpowk        ,__math_dispatch_error)
@@ -297,8 +297,8 @@ MTHINTRIN(powk1, sv4  , avx512knl  , __fx_powk1_4          , __fx_powk1_4
 MTHINTRIN(powk1, dv2  , avx512knl  , __fx_powk1_2          , __fx_powk1_2          , __px_powk1_2          ,__math_dispatch_error)
 MTHINTRIN(powk1, sv8  , avx512knl  , __fy_powk1_8          , __fy_powk1_8          , __py_powk1_8          ,__math_dispatch_error)
 MTHINTRIN(powk1, dv4  , avx512knl  , __fy_powk1_4          , __fy_powk1_4          , __py_powk1_4          ,__math_dispatch_error)
-MTHINTRIN(powk1, sv16 , avx512knl  , __gs_powk1_16_f       , __gs_powk1_16_r       , __pz_powk1_16         ,__math_dispatch_error)
-MTHINTRIN(powk1, dv8  , avx512knl  , __gd_powk1_8_f        , __gd_powk1_8_r        , __pz_powk1_8          ,__math_dispatch_error)
+MTHINTRIN(powk1, sv16 , avx512knl  , __fz_powk1_16         , __fz_powk1_16         , __pz_powk1_16         ,__math_dispatch_error)
+MTHINTRIN(powk1, dv8  , avx512knl  , __fz_powk1_8          , __fz_powk1_8          , __pz_powk1_8          ,__math_dispatch_error)
 MTHINTRIN(powk1, sv4m , avx512knl  , __fs_powk1_4_mn       , __rs_powk1_4_mn       , __ps_powk1_4_mn       ,__math_dispatch_error)
 MTHINTRIN(powk1, dv2m , avx512knl  , __fd_powk1_2_mn       , __rd_powk1_2_mn       , __pd_powk1_2_mn       ,__math_dispatch_error)
 MTHINTRIN(powk1, sv8m , avx512knl  , __fs_powk1_8_mn       , __rs_powk1_8_mn       , __ps_powk1_8_mn       ,__math_dispatch_error)
@@ -312,14 +312,14 @@ MTHINTRIN(powk , sv4  , avx512knl  , __gs_powk_4_f         , __gs_powk_4_r
 MTHINTRIN(powk , dv2  , avx512knl  , __gd_powk_2_f         , __gd_powk_2_r         , __px_powk_2           ,__math_dispatch_error)
 MTHINTRIN(powk , sv8  , avx512knl  , __gs_powk_8_f         , __gs_powk_8_r         , __py_powk_8           ,__math_dispatch_error)
 MTHINTRIN(powk , dv4  , avx512knl  , __gd_powk_4_f         , __gd_powk_4_r         , __py_powk_4           ,__math_dispatch_error)
-MTHINTRIN(powk , sv16 , avx512knl  , __gs_powk_16_f        , __gs_powk_16_r        , __pz_powk_16          ,__math_dispatch_error)
-MTHINTRIN(powk , dv8  , avx512knl  , __gd_powk_8_f         , __gd_powk_8_r         , __pz_powk_8           ,__math_dispatch_error)
+MTHINTRIN(powk , sv16 , avx512knl  , __fs_powk_16_avx512   , __fs_powk_16_avx512   , __pz_powk_16          ,__math_dispatch_error)
+MTHINTRIN(powk , dv8  , avx512knl  , __fd_powk_8_avx512    , __fd_powk_8_avx512    , __pz_powk_8           ,__math_dispatch_error)
 MTHINTRIN(powk , sv4m , avx512knl  , __fs_powk_4_mn        , __rs_powk_4_mn        , __ps_powk_4_mn        ,__math_dispatch_error)
 MTHINTRIN(powk , dv2m , avx512knl  , __fd_powk_2_mn        , __rd_powk_2_mn        , __pd_powk_2_mn        ,__math_dispatch_error)
 MTHINTRIN(powk , sv8m , avx512knl  , __fs_powk_8_mn        , __rs_powk_8_mn        , __ps_powk_8_mn        ,__math_dispatch_error)
 MTHINTRIN(powk , dv4m , avx512knl  , __fd_powk_4_mn        , __rd_powk_4_mn        , __pd_powk_4_mn        ,__math_dispatch_error)
-MTHINTRIN(powk , sv16m, avx512knl  , __fs_powk_16_mn       , __rs_powk_16_mn       , __ps_powk_16_mn       ,__math_dispatch_error)
-MTHINTRIN(powk , dv8m , avx512knl  , __fd_powk_8_mn        , __rd_powk_8_mn        , __pd_powk_8_mn        ,__math_dispatch_error)
+MTHINTRIN(powk , sv16m, avx512knl  , __fs_powk_16m_avx512  , __fs_powk_16m_avx512  , __ps_powk_16_mn       ,__math_dispatch_error)
+MTHINTRIN(powk , dv8m , avx512knl  , __fd_powk_8m_avx512   , __fd_powk_8m_avx512   , __pd_powk_8_mn        ,__math_dispatch_error)
 /* C(:)**I4 */
 MTHINTRIN(powi , cs   , avx512knl  , __mth_i_cpowi_c99     , __mth_i_cpowi_c99     , __mth_i_cpowi_c99     ,__math_dispatch_error)
 MTHINTRIN(powi , zs   , avx512knl  , __mth_i_cdpowi_c99    , __mth_i_cdpowi_c99    , __mth_i_cdpowi_c99    ,__math_dispatch_error)
@@ -337,8 +337,8 @@ MTHINTRIN(powi1, sv4  , avx512     , __fx_powi1_4          , __fx_powi1_4
 MTHINTRIN(powi1, dv2  , avx512     , __fx_powi1_2          , __fx_powi1_2          , __px_powi1_2          ,__math_dispatch_error)
 MTHINTRIN(powi1, sv8  , avx512     , __fy_powi1_8          , __fy_powi1_8          , __py_powi1_8          ,__math_dispatch_error)
 MTHINTRIN(powi1, dv4  , avx512     , __fy_powi1_4          , __fy_powi1_4          , __py_powi1_4          ,__math_dispatch_error)
-MTHINTRIN(powi1, sv16 , avx512     , __gs_powi1_16_f       , __gs_powi1_16_r       , __pz_powi1_16         ,__math_dispatch_error)
-MTHINTRIN(powi1, dv8  , avx512     , __gd_powi1_8_f        , __gd_powi1_8_r        , __pz_powi1_8          ,__math_dispatch_error)
+MTHINTRIN(powi1, sv16 , avx512     , __fz_powi1_16         , __fz_powi1_16         , __pz_powi1_16         ,__math_dispatch_error)
+MTHINTRIN(powi1, dv8  , avx512     , __fz_powi1_8          , __fz_powi1_8          , __pz_powi1_8          ,__math_dispatch_error)
 MTHINTRIN(powi1, sv4m , avx512     , __fs_powi1_4_mn       , __rs_powi1_4_mn       , __ps_powi1_4_mn       ,__math_dispatch_error)
 MTHINTRIN(powi1, dv2m , avx512     , __fd_powi1_2_mn       , __rd_powi1_2_mn       , __pd_powi1_2_mn       ,__math_dispatch_error)
 MTHINTRIN(powi1, sv8m , avx512     , __fs_powi1_8_mn       , __rs_powi1_8_mn       , __ps_powi1_8_mn       ,__math_dispatch_error)
@@ -352,14 +352,14 @@ MTHINTRIN(powi , sv4  , avx512     , __gs_powi_4_f         , __gs_powi_4_r
 MTHINTRIN(powi , dv2  , avx512     , __gd_powi_2_f         , __gd_powi_2_r         , __px_powi_2           ,__math_dispatch_error)
 MTHINTRIN(powi , sv8  , avx512     , __gs_powi_8_f         , __gs_powi_8_r         , __py_powi_8           ,__math_dispatch_error)
 MTHINTRIN(powi , dv4  , avx512     , __gd_powi_4_f         , __gd_powi_4_r         , __py_powi_4           ,__math_dispatch_error)
-MTHINTRIN(powi , sv16 , avx512     , __gs_powi_16_f        , __gs_powi_16_r        , __pz_powi_16          ,__math_dispatch_error)
-MTHINTRIN(powi , dv8  , avx512     , __gd_powi_8_f         , __gd_powi_8_r         , __pz_powi_8           ,__math_dispatch_error)
+MTHINTRIN(powi , sv16 , avx512     , __fs_powi_16_avx512   , __fs_powi_16_avx512   , __pz_powi_16          ,__math_dispatch_error)
+MTHINTRIN(powi , dv8  , avx512     , __fd_powi_8_avx512    , __fd_powi_8_avx512    , __pz_powi_8           ,__math_dispatch_error)
 MTHINTRIN(powi , sv4m , avx512     , __fs_powi_4_mn        , __rs_powi_4_mn        , __ps_powi_4_mn        ,__math_dispatch_error)
 MTHINTRIN(powi , dv2m , avx512     , __fd_powi_2_mn        , __rd_powi_2_mn        , __pd_powi_2_mn        ,__math_dispatch_error)
 MTHINTRIN(powi , sv8m , avx512     , __fs_powi_8_mn        , __rs_powi_8_mn        , __ps_powi_8_mn        ,__math_dispatch_error)
 MTHINTRIN(powi , dv4m , avx512     , __fd_powi_4_mn        , __rd_powi_4_mn        , __pd_powi_4_mn        ,__math_dispatch_error)
-MTHINTRIN(powi , sv16m, avx512     , __fs_powi_16_mn       , __rs_powi_16_mn       , __ps_powi_16_mn       ,__math_dispatch_error)
-MTHINTRIN(powi , dv8m , avx512     , __fd_powi_8_mn        , __rd_powi_8_mn        , __pd_powi_8_mn        ,__math_dispatch_error)
+MTHINTRIN(powi , sv16m, avx512     , __fs_powi_16m_avx512  , __fs_powi_16m_avx512  , __ps_powi_16_mn       ,__math_dispatch_error)
+MTHINTRIN(powi , dv8m , avx512     , __fd_powi_8m_avx512   , __fd_powi_8m_avx512   , __pd_powi_8_mn        ,__math_dispatch_error)
 /* R(:)**I8 */
 MTHINTRIN(powk1, ss   , avx512     , __mth_i_rpowk         , __mth_i_rpowk         , __pmth_i_rpowk        ,__math_dispatch_error)
 MTHINTRIN(powk1, ds   , avx512     , __mth_i_dpowk         , __mth_i_dpowk         , __pmth_i_dpowk        ,__math_dispatch_error)
@@ -367,8 +367,8 @@ MTHINTRIN(powk1, sv4  , avx512     , __fx_powk1_4          , __fx_powk1_4
 MTHINTRIN(powk1, dv2  , avx512     , __fx_powk1_2          , __fx_powk1_2          , __px_powk1_2          ,__math_dispatch_error)
 MTHINTRIN(powk1, sv8  , avx512     , __fy_powk1_8          , __fy_powk1_8          , __py_powk1_8          ,__math_dispatch_error)
 MTHINTRIN(powk1, dv4  , avx512     , __fy_powk1_4          , __fy_powk1_4          , __py_powk1_4          ,__math_dispatch_error)
-MTHINTRIN(powk1, sv16 , avx512     , __gs_powk1_16_f       , __gs_powk1_16_r       , __pz_powk1_16         ,__math_dispatch_error)
-MTHINTRIN(powk1, dv8  , avx512     , __gd_powk1_8_f        , __gd_powk1_8_r        , __pz_powk1_8          ,__math_dispatch_error)
+MTHINTRIN(powk1, sv16 , avx512     , __fz_powk1_16         , __fz_powk1_16         , __pz_powk1_16         ,__math_dispatch_error)
+MTHINTRIN(powk1, dv8  , avx512     , __fz_powk1_8          , __fz_powk1_8          , __pz_powk1_8          ,__math_dispatch_error)
 MTHINTRIN(powk1, sv4m , avx512     , __fs_powk1_4_mn       , __rs_powk1_4_mn       , __ps_powk1_4_mn       ,__math_dispatch_error)
 MTHINTRIN(powk1, dv2m , avx512     , __fd_powk1_2_mn       , __rd_powk1_2_mn       , __pd_powk1_2_mn       ,__math_dispatch_error)
 MTHINTRIN(powk1, sv8m , avx512     , __fs_powk1_8_mn       , __rs_powk1_8_mn       , __ps_powk1_8_mn       ,__math_dispatch_error)
@@ -382,14 +382,14 @@ MTHINTRIN(powk , sv4  , avx512     , __gs_powk_4_f         , __gs_powk_4_r
 MTHINTRIN(powk , dv2  , avx512     , __gd_powk_2_f         , __gd_powk_2_r         , __px_powk_2           ,__math_dispatch_error)
 MTHINTRIN(powk , sv8  , avx512     , __gs_powk_8_f         , __gs_powk_8_r         , __py_powk_8           ,__math_dispatch_error)
 MTHINTRIN(powk , dv4  , avx512     , __gd_powk_4_f         , __gd_powk_4_r         , __py_powk_4           ,__math_dispatch_error)
-MTHINTRIN(powk , sv16 , avx512     , __gs_powk_16_f        , __gs_powk_16_r        , __pz_powk_16          ,__math_dispatch_error)
-MTHINTRIN(powk , dv8  , avx512     , __gd_powk_8_f         , __gd_powk_8_r         , __pz_powk_8           ,__math_dispatch_error)
+MTHINTRIN(powk , sv16 , avx512     , __fs_powk_16_avx512   , __fs_powk_16_avx512   , __pz_powk_16          ,__math_dispatch_error)
+MTHINTRIN(powk , dv8  , avx512     , __fd_powk_8_avx512    , __fd_powk_8_avx512    , __pz_powk_8           ,__math_dispatch_error)
 MTHINTRIN(powk , sv4m , avx512     , __fs_powk_4_mn        , __rs_powk_4_mn        , __ps_powk_4_mn        ,__math_dispatch_error)
 MTHINTRIN(powk , dv2m , avx512     , __fd_powk_2_mn        , __rd_powk_2_mn        , __pd_powk_2_mn        ,__math_dispatch_error)
 MTHINTRIN(powk , sv8m , avx512     , __fs_powk_8_mn        , __rs_powk_8_mn        , __ps_powk_8_mn        ,__math_dispatch_error)
 MTHINTRIN(powk , dv4m , avx512     , __fd_powk_4_mn        , __rd_powk_4_mn        , __pd_powk_4_mn        ,__math_dispatch_error)
-MTHINTRIN(powk , sv16m, avx512     , __fs_powk_16_mn       , __rs_powk_16_mn       , __ps_powk_16_mn       ,__math_dispatch_error)
-MTHINTRIN(powk , dv8m , avx512     , __fd_powk_8_mn        , __rd_powk_8_mn        , __pd_powk_8_mn        ,__math_dispatch_error)
+MTHINTRIN(powk , sv16m, avx512     , __fs_powk_16m_avx512  , __fs_powk_16m_avx512  , __ps_powk_16_mn       ,__math_dispatch_error)
+MTHINTRIN(powk , dv8m , avx512     , __fd_powk_8m_avx512   , __fd_powk_8m_avx512   , __pd_powk_8_mn        ,__math_dispatch_error)
 /* C(:)**I4 */
 MTHINTRIN(powi , cs   , avx512     , __mth_i_cpowi_c99     , __mth_i_cpowi_c99     , __mth_i_cpowi_c99     ,__math_dispatch_error)
 MTHINTRIN(powi , zs   , avx512     , __mth_i_cdpowi_c99    , __mth_i_cdpowi_c99    , __mth_i_cdpowi_c99    ,__math_dispatch_error)
@@ -54,23 +54,23 @@ MTHINTRIN(sqrt  , cv4  , avxfma4    , __gc_sqrt_4_f          , __gc_sqrt_4_r
 MTHINTRIN(sqrt  , zv2  , avxfma4    , __gz_sqrt_2_f          , __gz_sqrt_2_r          , __gz_sqrt_2_p          ,__math_dispatch_error)
 MTHINTRIN(sqrt  , cs   , avx2       , csqrtf                 , csqrtf                 , csqrtf                 ,__math_dispatch_error)
 MTHINTRIN(sqrt  , zs   , avx2       , csqrt                  , csqrt                  , csqrt                  ,__math_dispatch_error)
-MTHINTRIN(sqrt  , zv1  , avx2       , __gz_sqrt_1v_f         , __gz_sqrt_1v_r         , __gz_sqrt_1v_p         ,__math_dispatch_error)
-MTHINTRIN(sqrt  , cv2  , avx2       , __gc_sqrt_2_f          , __gc_sqrt_2_r          , __gc_sqrt_2_p          ,__math_dispatch_error)
-MTHINTRIN(sqrt  , cv4  , avx2       , __gc_sqrt_4_f          , __gc_sqrt_4_r          , __gc_sqrt_4_p          ,__math_dispatch_error)
-MTHINTRIN(sqrt  , zv2  , avx2       , __gz_sqrt_2_f          , __gz_sqrt_2_r          , __gz_sqrt_2_p          ,__math_dispatch_error)
+MTHINTRIN(sqrt  , zv1  , avx2       , __fz_sqrt_1v_avx2      , __rz_sqrt_1v_avx2      , __pz_sqrt_1v_avx2      ,__math_dispatch_error)
+MTHINTRIN(sqrt  , cv2  , avx2       , __fc_sqrt_2_avx2       , __rc_sqrt_2_avx2       , __pc_sqrt_2_avx2       ,__math_dispatch_error)
+MTHINTRIN(sqrt  , cv4  , avx2       , __fc_sqrt_4_avx2       , __rc_sqrt_4_avx2       , __pc_sqrt_4_avx2       ,__math_dispatch_error)
+MTHINTRIN(sqrt  , zv2  , avx2       , __fz_sqrt_2_avx2       , __rz_sqrt_2_avx2       , __pz_sqrt_2_avx2       ,__math_dispatch_error)
 MTHINTRIN(sqrt  , cs   , avx512knl  , csqrtf                 , csqrtf                 , csqrtf                 ,__math_dispatch_error)
 MTHINTRIN(sqrt  , zs   , avx512knl  , csqrt                  , csqrt                  , csqrt                  ,__math_dispatch_error)
-MTHINTRIN(sqrt  , zv1  , avx512knl  , __gz_sqrt_1v_f         , __gz_sqrt_1v_r         , __gz_sqrt_1v_p         ,__math_dispatch_error)
-MTHINTRIN(sqrt  , cv2  , avx512knl  , __gc_sqrt_2_f          , __gc_sqrt_2_r          , __gc_sqrt_2_p          ,__math_dispatch_error)
-MTHINTRIN(sqrt  , cv4  , avx512knl  , __gc_sqrt_4_f          , __gc_sqrt_4_r          , __gc_sqrt_4_p          ,__math_dispatch_error)
+MTHINTRIN(sqrt  , zv1  , avx512knl  , __fz_sqrt_1v_avx2      , __rz_sqrt_1v_avx2      , __pz_sqrt_1v_avx2      ,__math_dispatch_error)
+MTHINTRIN(sqrt  , cv2  , avx512knl  , __fc_sqrt_2_avx2       , __rc_sqrt_2_avx2       , __pc_sqrt_2_avx2       ,__math_dispatch_error)
+MTHINTRIN(sqrt  , cv4  , avx512knl  , __fc_sqrt_4_avx2       , __rc_sqrt_4_avx2       , __pc_sqrt_4_avx2       ,__math_dispatch_error)
 MTHINTRIN(sqrt  , cv8  , avx512knl  , __gc_sqrt_8_f          , __gc_sqrt_8_r          , __gc_sqrt_8_p          ,__math_dispatch_error)
-MTHINTRIN(sqrt  , zv2  , avx512knl  , __gz_sqrt_2_f          , __gz_sqrt_2_r          , __gz_sqrt_2_p          ,__math_dispatch_error)
+MTHINTRIN(sqrt  , zv2  , avx512knl  , __fz_sqrt_2_avx2       , __rz_sqrt_2_avx2       , __pz_sqrt_2_avx2       ,__math_dispatch_error)
 MTHINTRIN(sqrt  , zv4  , avx512knl  , __gz_sqrt_4_f          , __gz_sqrt_4_r          , __gz_sqrt_4_p          ,__math_dispatch_error)
 MTHINTRIN(sqrt  , cs   , avx512     , csqrtf                 , csqrtf                 , csqrtf                 ,__math_dispatch_error)
 MTHINTRIN(sqrt  , zs   , avx512     , csqrt                  , csqrt                  , csqrt                  ,__math_dispatch_error)
-MTHINTRIN(sqrt  , zv1  , avx512     , __gz_sqrt_1v_f         , __gz_sqrt_1v_r         , __gz_sqrt_1v_p         ,__math_dispatch_error)
-MTHINTRIN(sqrt  , cv2  , avx512     , __gc_sqrt_2_f          , __gc_sqrt_2_r          , __gc_sqrt_2_p          ,__math_dispatch_error)
-MTHINTRIN(sqrt  , cv4  , avx512     , __gc_sqrt_4_f          , __gc_sqrt_4_r          , __gc_sqrt_4_p          ,__math_dispatch_error)
-MTHINTRIN(sqrt  , cv8  , avx512     , __gc_sqrt_8_f          , __gc_sqrt_8_r          , __gc_sqrt_8_p          ,__math_dispatch_error)
-MTHINTRIN(sqrt  , zv2  , avx512     , __gz_sqrt_2_f          , __gz_sqrt_2_r          , __gz_sqrt_2_p          ,__math_dispatch_error)
-MTHINTRIN(sqrt  , zv4  , avx512     , __gz_sqrt_4_f          , __gz_sqrt_4_r          , __gz_sqrt_4_p          ,__math_dispatch_error)
+MTHINTRIN(sqrt  , zv1  , avx512     , __fz_sqrt_1v_avx2      , __rz_sqrt_1v_avx2      , __pz_sqrt_1v_avx2      ,__math_dispatch_error)
+MTHINTRIN(sqrt  , cv2  , avx512     , __fc_sqrt_2_avx2       , __rc_sqrt_2_avx2       , __pc_sqrt_2_avx2       ,__math_dispatch_error)
+MTHINTRIN(sqrt  , cv4  , avx512     , __fc_sqrt_4_avx2       , __rc_sqrt_4_avx2       , __pc_sqrt_4_avx2       ,__math_dispatch_error)
+MTHINTRIN(sqrt  , cv8  , avx512     , __fc_sqrt_8_avx512     , __rc_sqrt_8_avx512     , __pc_sqrt_8_avx512     ,__math_dispatch_error)
+MTHINTRIN(sqrt  , zv2  , avx512     , __fz_sqrt_2_avx2       , __rz_sqrt_2_avx2       , __pz_sqrt_2_avx2       ,__math_dispatch_error)
+MTHINTRIN(sqrt  , zv4  , avx512     , __fz_sqrt_4_avx512     , __rz_sqrt_4_avx512     , __pz_sqrt_4_avx512     ,__math_dispatch_error)
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+/** \file powi_512.c
+ * AVX-512 - 512 bit implementation of R(:)**I(:).
+ *
+ * Only AVX512F instructions are used so that the same objects can be
+ * dispatched to on both KNL and Skylake.
+ *
+ * When every lane carries the same exponent - the usual case, since the
+ * exponent is most often loop invariant - the kernels hand off to the
+ * uniform exponent kernels __fz_powk1_{16,8}, which decode the exponent
+ * once per call instead of once per lane.
+ */
+
+
+#include <stdint.h>
+#include <immintrin.h>
+#include "mth_intrinsics.h"
+
+extern vrs16_t __fz_powk1_16(vrs16_t, int64_t);
+extern vrd8_t  __fz_powk1_8(vrd8_t, int64_t);
+
+/**
+ *  \brief Compute R4(:)**I4(:)
+ *  \param[in] _vx (__m512)  R4(:)
+ *  \param[in] _vi (__m512i) I4(:)
+ *  \return (__m512) R4(:)**I4(:)
+ */
+vrs16_t
+__fs_powi_16_avx512(vrs16_t _vx, vis16_t _vi)
+{
+    __m512  vx = (__m512)_vx;
+    __m512i vi = (__m512i)_vi;
+    __m512  vr;
+    __m512i vj;
+    __m512  vf1p0 = _mm512_set1_ps(1.0);
+    __m512i vi0   = _mm512_setzero_si512();
+    __m512i vlsb  = _mm512_set1_epi32(1);
+    __mmask16 km;
+    int32_t i0;
+
+    i0 = _mm_cvtsi128_si32(_mm512_castsi512_si128(vi));
+    if (0 == _mm512_cmpneq_epi32_mask(vi, _mm512_set1_epi32(i0)))
+        return __fz_powk1_16(_vx, i0);
+
+    vj = _mm512_abs_epi32(vi);
+    vr = vf1p0;
+
+    km = _mm512_test_epi32_mask(vj, vj);
+    if (0 == km) return (vrs16_t)vr;
+
+    for (;;) {
+        // Multiply in x**(2**k) where bit k of |I| is set
+        vr = _mm512_mask_mul_ps(vr, _mm512_test_epi32_mask(vj, vlsb), vr, vx);
+        vj = _mm512_srli_epi32(vj, 1);
+        km = _mm512_test_epi32_mask(vj, vj);
+        if (0 == km) break;
+        vx = _mm512_mask_mul_ps(vf1p0, km, vx, vx);
+    }
+
+    km = _mm512_cmplt_epi32_mask(vi, vi0);
+    if (0 != km) {
+        vr = _mm512_mask_div_ps(vr, km, vf1p0, vr);
+    }
+
+    return (vrs16_t)vr;
+}
+
+/**
+ *  \brief Compute R4(:)**I4(:) under mask
+ *  \param[in] _vx (__m512)  R4(:)
+ *  \param[in] _vi (__m512i) I4(:)
+ *  \param[in] _vm (__m512i) I4(:)
+ *  \return (__m512) WHERE(_vm(:) != 0) R4(:)**I4(:)
+ */
+vrs16_t
+__fs_powi_16m_avx512(vrs16_t _vx, vis16_t _vi, vis16_t _vm)
+{
+    __mmask16 km = _mm512_test_epi32_mask((__m512i)_vm, (__m512i)_vm);
+    __m512  vx = _mm512_maskz_mov_ps(km, (__m512)_vx);
+    __m512i vi = _mm512_maskz_mov_epi32(km, (__m512i)_vi);
+
+    return __fs_powi_16_avx512((vrs16_t)vx, (vis16_t)vi);
+}
+
+/**
+ *  \brief Compute R8(:)**I8(:)
+ *  \param[in] _vx (__m512d) R8(:)
+ *  \param[in] _vi (__m512i) I8(:)
+ *  \return (__m512d) R8(:)**I8(:)
+ */
+vrd8_t
+__fd_powk_8_avx512(vrd8_t _vx, vid8_t _vi)
+{
+    __m512d vx = (__m512d)_vx;
+    __m512i vi = (__m512i)_vi;
+    __m512d vr;
+    __m512i vj;
+    __m512d vf1p0 = _mm512_set1_pd(1.0);
+    __m512i vi0   = _mm512_setzero_si512();
+    __m512i vlsb  = _mm512_set1_epi64(1);
+    __mmask8 km;
+    int64_t i0;
+
+    i0 = _mm_cvtsi128_si64(_mm512_castsi512_si128(vi));
+    if (0 == _mm512_cmpneq_epi64_mask(vi, _mm512_set1_epi64(i0)))
+        return __fz_powk1_8(_vx, i0);
+
+    vj = _mm512_abs_epi64(vi);
+    vr = vf1p0;
+
+    km = _mm512_test_epi64_mask(vj, vj);
+    if (0 == km) return (vrd8_t)vr;
+
+    for (;;) {
+        vr = _mm512_mask_mul_pd(vr, _mm512_test_epi64_mask(vj, vlsb), vr, vx);
+        vj = _mm512_srli_epi64(vj, 1);
+        km = _mm512_test_epi64_mask(vj, vj);
+        if (0 == km) break;
+        vx = _mm512_mask_mul_pd(vf1p0, km, vx, vx);
+    }
+
+    km = _mm512_cmplt_epi64_mask(vi, vi0);
+    if (0 != km) {
+        vr = _mm512_mask_div_pd(vr, km, vf1p0, vr);
+    }
+
+    return (vrd8_t)vr;
+}
+
+/**
+ *  \brief Compute R8(:)**I8(:) under mask
+ *  \param[in] _vx (__m512d) R8(:)
+ *  \param[in] _vi (__m512i) I8(:)
+ *  \param[in] _vm (__m512i) I8(:)
+ *  \return (__m512d) WHERE(_vm(:) != 0) R8(:)**I8(:)
+ */
+vrd8_t
+__fd_powk_8m_avx512(vrd8_t _vx, vid8_t _vi, vid8_t _vm)
+{
+    __mmask8 km = _mm512_test_epi64_mask((__m512i)_vm, (__m512i)_vm);
+    __m512d vx = _mm512_maskz_mov_pd(km, (__m512d)_vx);
+    __m512i vi = _mm512_maskz_mov_epi64(km, (__m512i)_vi);
+
+    return __fd_powk_8_avx512((vrd8_t)vx, (vid8_t)vi);
+}
+
+/**
+ *  \brief Compute R8(:)**I4(:)
+ *  \param[in] _vx (__m512d) R8(:)
+ *  \param[in] _vi (__m256i) I4(:)
+ *  \return (__m512d) R8(:)**I4(:)
+ */
+vrd8_t
+__fd_powi_8_avx512(vrd8_t _vx, vis8_t _vi)
+{
+    return __fd_powk_8_avx512(_vx, (vid8_t)_mm512_cvtepi32_epi64((__m256i)_vi));
+}
+
+/**
+ *  \brief Compute R8(:)**I4(:) under mask
+ *  \param[in] _vx (__m512d) R8(:)
+ *  \param[in] _vi (__m256i) I4(:)
+ *  \param[in] _vm (__m512i) I8(:)
+ *  \return (__m512d) WHERE(_vm(:) != 0) R8(:)**I4(:)
+ */
+vrd8_t
+__fd_powi_8m_avx512(vrd8_t _vx, vis8_t _vi, vid8_t _vm)
+{
+    return __fd_powk_8m_avx512(_vx, (vid8_t)_mm512_cvtepi32_epi64((__m256i)_vi), _vm);
+}
+
+/**
+ *  \brief Compute R4(0:7)**I8_lower(:), R4(8:15)**I8_upper(:)
+ *  \param[in] _vx (__m512)  R4(:)
+ *  \param[in] _vl (__m512i) I8(:)
+ *  \param[in] _vu (__m512i) I8(:)
+ *  \return (__m512) R4(:)**I8(:)
+ *
+ * Unlike the AVX2 version there is no need to narrow the exponents to I4
+ * first: each pair of 8-bit lane masks is joined into one 16-bit mask, so
+ * the loop runs on 64-bit exponents directly.
+ */
+vrs16_t
+__fs_powk_16_avx512(vrs16_t _vx, vid8_t _vl, vid8_t _vu)
+{
+    __m512  vx = (__m512)_vx;
+    __m512i vl = (__m512i)_vl;
+    __m512i vu = (__m512i)_vu;
+    __m512  vr;
+    __m512i vjl;
+    __m512i vju;
+    __m512  vf1p0 = _mm512_set1_ps(1.0);
+    __m512i vi0   = _mm512_setzero_si512();
+    __m512i vlsb  = _mm512_set1_epi64(1);
+    __m512i vb;
+    __mmask16 km;
+    int64_t i0;
+
+    i0 = _mm_cvtsi128_si64(_mm512_castsi512_si128(vl));
+    vb = _mm512_set1_epi64(i0);
+    if (0 == (_mm512_cmpneq_epi64_mask(vl, vb) |
+              _mm512_cmpneq_epi64_mask(vu, vb)))
+        return __fz_powk1_16(_vx, i0);
+
+    vjl = _mm512_abs_epi64(vl);
+    vju = _mm512_abs_epi64(vu);
+    vr = vf1p0;
+
+    km = _mm512_kunpackb(_mm512_test_epi64_mask(vju, vju),
+                         _mm512_test_epi64_mask(vjl, vjl));
+    if (0 == km) return (vrs16_t)vr;
+
+    for (;;) {
+        km = _mm512_kunpackb(_mm512_test_epi64_mask(vju, vlsb),
+                             _mm512_test_epi64_mask(vjl, vlsb));
+        vr = _mm512_mask_mul_ps(vr, km, vr, vx);
+        vjl = _mm512_srli_epi64(vjl, 1);
+        vju = _mm512_srli_epi64(vju, 1);
+        km = _mm512_kunpackb(_mm512_test_epi64_mask(vju, vju),
+                             _mm512_test_epi64_mask(vjl, vjl));
+        if (0 == km) break;
+        vx = _mm512_mask_mul_ps(vf1p0, km, vx, vx);
+    }
+
+    km = _mm512_kunpackb(_mm512_cmplt_epi64_mask(vu, vi0),
+                         _mm512_cmplt_epi64_mask(vl, vi0));
+    if (0 != km) {
+        vr = _mm512_mask_div_ps(vr, km, vf1p0, vr);
+    }
+
+    return (vrs16_t)vr;
+}
+
+/**
+ *  \brief Compute R4(0:7)**I8_lower(:), R4(8:15)**I8_upper(:) under mask
+ *  \param[in] _vx (__m512)  R4(:)
+ *  \param[in] _vl (__m512i) I8(:)
+ *  \param[in] _vu (__m512i) I8(:)
+ *  \param[in] _vm (__m512i) I4(:)
+ *  \return (__m512) WHERE(_vm(:) != 0) R4(:)**I8(:)
+ */
+vrs16_t
+__fs_powk_16m_avx512(vrs16_t _vx, vid8_t _vl, vid8_t _vu, vis16_t _vm)
+{
+    __mmask16 km = _mm512_test_epi32_mask((__m512i)_vm, (__m512i)_vm);
+    __m512  vx = _mm512_maskz_mov_ps(km, (__m512)_vx);
+    __m512i vl = _mm512_maskz_mov_epi64((__mmask8)km, (__m512i)_vl);
+    __m512i vu = _mm512_maskz_mov_epi64((__mmask8)(km >> 8), (__m512i)_vu);
+
+    return __fs_powk_16_avx512((vrs16_t)vx, (vid8_t)vl, (vid8_t)vu);
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// RUN: %libpgmath-compile && %libpgmath-run
+
+/* Array entry points: every length up to a few vectors, unaligned starts,
+   unit, positive and negative strides, and results written in place over
+   the input, checked element by element against the C library.  Elements
+   between the strided ones must be left alone. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define NMAX 67              /* longest array */
+#define LEN (NMAX * 3 + 8)   /* buffer length, elements */
+#define GUARD -12345.0       /* contents of the untouched result elements */
+
+#define PROTOS(_p, _t) \
+extern void __p##_p##_exp_array(int64_t, _t *, int64_t, _t *, int64_t); \
+extern void __p##_p##_log_array(int64_t, _t *, int64_t, _t *, int64_t); \
+extern void __p##_p##_sin_array(int64_t, _t *, int64_t, _t *, int64_t); \
+extern void __p##_p##_cos_array(int64_t, _t *, int64_t, _t *, int64_t); \
+extern void __p##_p##_tanh_array(int64_t, _t *, int64_t, _t *, int64_t); \
+extern void __p##_p##_sqrt_array(int64_t, _t *, int64_t, _t *, int64_t); \
+extern void __p##_p##_pow_array(int64_t, _t *, int64_t, _t *, int64_t, \
+                                _t *, int64_t); \
+extern void __p##_p##_div_array(int64_t, _t *, int64_t, _t *, int64_t, \
+                                _t *, int64_t); \
+extern void __p##_p##_sincos_array(int64_t, _t *, int64_t, _t *, int64_t, \
+                                   _t *, int64_t);
+
+PROTOS(s, float)
+PROTOS(d, double)
+
+static double f_exp(double x, double y) { return exp(x); }
+static double f_log(double x, double y) { return log(x); }
+static double f_sin(double x, double y) { return sin(x); }
+static double f_cos(double x, double y) { return cos(x); }
+static double f_tanh(double x, double y) { return tanh(x); }
+static double f_sqrt(double x, double y) { return sqrt(x); }
+static double f_pow(double x, double y) { return pow(x, y); }
+static double f_div(double x, double y) { return x / y; }
+
+static int nfails;
+static int n, inc, off;
+
+/* element 0 of an n element array with stride inc starting off into buf */
+#define BASE(_buf) (inc < 0 ? (_buf) + off - (n - 1) * inc : (_buf) + off)
+
+/*
+ * Check r[0:LEN] after rp[j*inc] = f(x[j*inc], y[j*inc]) for j < n: the
+ * result elements against f and the others against their old values.
+ */
+#define CHECK(_t, _tol) \
+static void \
+check_##_t(const char *name, _t *r, _t *old, _t *rp, _t *x, _t *y, \
+           double (*f)(double, double)) \
+{ \
+  int i, j; \
+  double e; \
+\
+  for (i = 0; i < LEN; i++) { \
+    j = (int)(r + i - rp); \
+    if (j % inc == 0 && j / inc >= 0 && j / inc < n) { \
+      j /= inc; \
+      e = f(x[j * inc], y ? y[j * inc] : 0.0); \
+      if (!(fabs(r[i] - e) <= _tol * fabs(e))) { \
+        printf("%s n=%d inc=%d off=%d [%d]: %.17g, expected %.17g\n", \
+               name, n, inc, off, j, (double)r[i], e); \
+        nfails++; \
+      } \
+    } else if (r[i] != old[i]) { \
+      printf("%s n=%d inc=%d off=%d: element %d overwritten\n", \
+             name, n, inc, off, i); \
+      nfails++; \
+    } \
+  } \
+}
+
+CHECK(float, 1.0e-6)
+CHECK(double, 1.0e-14)
+
+#define FILL(_t, _a, _lo) \
+  for (i = 0; i < LEN; i++) \
+    _a[i] = (_t)(_lo + 0.0371 * i)
+
+#define GUARDS(_t, _a) \
+  for (i = 0; i < LEN; i++) \
+    _a[i] = (_t)GUARD
+
+/* one input, separate result and in place */
+#define TEST1(_p, _t, _name) \
+  GUARDS(_t, r##_p); \
+  memcpy(old##_p, r##_p, sizeof(r##_p)); \
+  __p##_p##_##_name##_array(n, BASE(x##_p), inc, BASE(r##_p), inc); \
+  check_##_t("__p" #_p "_" #_name "_array", r##_p, old##_p, BASE(r##_p), \
+             BASE(x##_p), NULL, f_##_name); \
+  memcpy(r##_p, x##_p, sizeof(r##_p)); \
+  memcpy(old##_p, x##_p, sizeof(r##_p)); \
+  __p##_p##_##_name##_array(n, BASE(r##_p), inc, BASE(r##_p), inc); \
+  check_##_t("__p" #_p "_" #_name "_array in place", r##_p, old##_p, \
+             BASE(r##_p), BASE(x##_p), NULL, f_##_name)
+
+#define TEST2(_p, _t, _name) \
+  GUARDS(_t, r##_p); \
+  memcpy(old##_p, r##_p, sizeof(r##_p)); \
+  __p##_p##_##_name##_array(n, BASE(x##_p), inc, BASE(y##_p), inc, \
+                            BASE(r##_p), inc); \
+  check_##_t("__p" #_p "_" #_name "_array", r##_p, old##_p, BASE(r##_p), \
+             BASE(x##_p), BASE(y##_p), f_##_name)
+
+#define TESTSC(_p, _t) \
+  GUARDS(_t, r##_p); \
+  GUARDS(_t, c##_p); \
+  memcpy(old##_p, r##_p, sizeof(r##_p)); \
+  __p##_p##_sincos_array(n, BASE(x##_p), inc, BASE(r##_p), inc, \
+                         BASE(c##_p), inc); \
+  check_##_t("__p" #_p "_sincos_array sin", r##_p, old##_p, BASE(r##_p), \
+             BASE(x##_p), NULL, f_sin); \
+  check_##_t("__p" #_p "_sincos_array cos", c##_p, old##_p, BASE(c##_p), \
+             BASE(x##_p), NULL, f_cos)
+
+int
+main(void)
+{
+  static float xs[LEN], ys[LEN], rs[LEN], cs[LEN], olds[LEN];
+  static double xd[LEN], yd[LEN], rd[LEN], cd[LEN], oldd[LEN];
+  static const int incs[] = {1, 2, 3, -1, -3};
+  int k, i;
+
+  FILL(float, xs, 0.1);
+  FILL(float, ys, -1.5);
+  FILL(double, xd, 0.1);
+  FILL(double, yd, -1.5);
+
+  for (n = 0; n <= NMAX; n++) {
+    for (k = 0; k < sizeof(incs) / sizeof(*incs); k++) {
+      inc = incs[k];
+      for (off = 0; off < 3; off++) {
+        TEST1(s, float, exp);
+        TEST1(s, float, log);
+        TEST1(s, float, sin);
+        TEST1(s, float, cos);
+        TEST1(s, float, tanh);
+        TEST1(s, float, sqrt);
+        TEST2(s, float, pow);
+        TEST2(s, float, div);
+        TESTSC(s, float);
+        TEST1(d, double, exp);
+        TEST1(d, double, log);
+        TEST1(d, double, sin);
+        TEST1(d, double, cos);
+        TEST1(d, double, tanh);
+        TEST1(d, double, sqrt);
+        TEST2(d, double, pow);
+        TEST2(d, double, div);
+        TESTSC(d, double);
+      }
+    }
+  }
+
+  if (nfails != 0) {
+    printf("array entry points Test Failed\n");
+    exit(-1);
+  }
+  printf("array entry points Test Passed\n");
+  return 0;
+}
@@ -0,0 +1,70 @@
+
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=256 && %libpgmath-run
+
+/* atan against the long double C library over the whole argument range,
+   at the reduction interval boundaries, for zeros, infinities, NaN and
+   denormals, and through the masked entry points with partial masks. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+#include "ulp_check.h"
+
+EXTERN_EFUNC(atan);
+
+static const float fspecial[] = {
+    0.0f, -0.0f, INFINITY, -INFINITY, NAN, 0x1p-149f, -0x1p-149f, 0x1p-127f,
+    0x1p-13f, 0.4375f, -0.6875f, 1.0f, -1.0f, 1.1875f, 2.4375f, -2.4375f,
+    0x1p24f, -0x1.fffffep127f};
+static const double dspecial[] = {
+    0.0, -0.0, INFINITY, -INFINITY, NAN, 0x1p-1074, -0x1p-1074, 0x1p-1023,
+    0x1p-28, 0.4375, -0.6875, 1.0, -1.0, 1.1875, 2.4375, -2.4375,
+    0x1p53, -0x1.fffffffffffffp1023};
+
+int main(int argc, char *argv[])
+{
+    int nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+    parseargs(argc, argv);
+#endif
+    nfails += ULP1S(f, atan, atanl, -30, 30, 1, fspecial, 3.0);
+    nfails += ULP1S(r, atan, atanl, -30, 30, 1, fspecial, 6.0);
+    nfails += ULP1S(p, atan, atanl, -30, 30, 1, fspecial, 1.0);
+    nfails += ULP1D(f, atan, atanl, -60, 60, 1, dspecial, 3.0);
+    nfails += ULP1D(r, atan, atanl, -60, 60, 1, dspecial, 6.0);
+    nfails += ULP1D(p, atan, atanl, -60, 60, 1, dspecial, 1.0);
+
+    if (nfails != 0) {
+        exit(-1);
+    }
+    return 0;
+}
+
+// UNSUPPORTED: sse4
+// UNSUPPORTED: em64t
+// UNSUPPORTED: ppc64le
@@ -0,0 +1,87 @@
+
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=512 && %libpgmath-run
+
+/* atan2 against the long double C library over operand pairs of any
+   magnitude ratio and sign, for every quadrant of signed zeros and
+   infinities, NaN, denormals and the largest finite values, and through
+   the masked entry points with partial masks. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+#include "ulp_check.h"
+
+EXTERN_EFUNC2(atan2);
+
+/* (y, x) pairs */
+static const float fspecial[] = {
+    0.0f, 0.0f,   -0.0f, 0.0f,   0.0f, -0.0f,   -0.0f, -0.0f,
+    0.0f, -1.0f,  -0.0f, -1.0f,  0.0f, 1.0f,    -0.0f, 1.0f,
+    1.0f, 0.0f,   -1.0f, -0.0f,  INFINITY, INFINITY,  -INFINITY, INFINITY,
+    INFINITY, -INFINITY,  -INFINITY, -INFINITY,  INFINITY, 1.0f,
+    1.0f, INFINITY,  1.0f, -INFINITY,  -1.0f, -INFINITY,
+    NAN, 1.0f,    1.0f, NAN,     NAN, INFINITY,  0.0f, NAN,
+    0x1p-149f, 1.0f,  -0x1p-149f, -1.0f,  0x1p-149f, 0x1p-149f,
+    0x1.fffffep127f, 0x1.fffffep127f,  0x1.fffffep127f, 0x1p-149f,
+    0x1p-149f, 0x1.fffffep127f,  1.0f, -1.0f,  -7.0f, 16.0f};
+static const double dspecial[] = {
+    0.0, 0.0,   -0.0, 0.0,   0.0, -0.0,   -0.0, -0.0,
+    0.0, -1.0,  -0.0, -1.0,  0.0, 1.0,    -0.0, 1.0,
+    1.0, 0.0,   -1.0, -0.0,  INFINITY, INFINITY,  -INFINITY, INFINITY,
+    INFINITY, -INFINITY,  -INFINITY, -INFINITY,  INFINITY, 1.0,
+    1.0, INFINITY,  1.0, -INFINITY,  -1.0, -INFINITY,
+    NAN, 1.0,   1.0, NAN,    NAN, INFINITY,  0.0, NAN,
+    0x1p-1074, 1.0,  -0x1p-1074, -1.0,  0x1p-1074, 0x1p-1074,
+    0x1.fffffffffffffp1023, 0x1.fffffffffffffp1023,
+    0x1.fffffffffffffp1023, 0x1p-1074,
+    0x1p-1074, 0x1.fffffffffffffp1023,  1.0, -1.0,  -7.0, 16.0};
+
+int main(int argc, char *argv[])
+{
+    int nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+    parseargs(argc, argv);
+#endif
+    nfails += ULP2S(f, atan2, atan2l, -30, 30, 1, -30, 30, 1, fspecial, 3.0);
+    nfails += ULP2S(r, atan2, atan2l, -30, 30, 1, -30, 30, 1, fspecial, 6.0);
+    nfails += ULP2S(p, atan2, atan2l, -30, 30, 1, -30, 30, 1, fspecial, 1.0);
+    nfails += ULP2D(f, atan2, atan2l, -60, 60, 1, -60, 60, 1, dspecial, 3.0);
+    nfails += ULP2D(r, atan2, atan2l, -60, 60, 1, -60, 60, 1, dspecial, 6.0);
+    nfails += ULP2D(p, atan2, atan2l, -60, 60, 1, -60, 60, 1, dspecial, 1.0);
+
+    if (nfails != 0) {
+        exit(-1);
+    }
+    return 0;
+}
+
+// UNSUPPORTED: sse4
+// UNSUPPORTED: em64t
+// UNSUPPORTED: avx
+// UNSUPPORTED: avx2
+// UNSUPPORTED: ppc64le
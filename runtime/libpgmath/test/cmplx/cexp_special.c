@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=256 && %libpgmath-run
+
+/* Complex exp of operands with large imaginary parts, which take the slow
+   argument reduction of sin and cos, and with subnormal imaginary parts,
+   for every accuracy class. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <complex.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+
+extern vcs4_t __fc_exp_4(vcs4_t);
+extern vcs4_t __rc_exp_4(vcs4_t);
+extern vcs4_t __pc_exp_4(vcs4_t);
+extern vcd2_t __fz_exp_2(vcd2_t);
+extern vcd2_t __rz_exp_2(vcd2_t);
+extern vcd2_t __pz_exp_2(vcd2_t);
+
+#define NS 12
+#define ND 12
+
+/* (re, im) pairs */
+static float fargs[NS][2] = {
+    {0.0f, 1.0e38f}, {0.0f, -1.0e38f}, {0.0f, 3.0e37f}, {0.0f, 1.0e10f},
+    {1.0f, 1.0e30f}, {-1.0f, 7.0e20f}, {0.0f, 1.5e5f}, {0.5f, -2.5e6f},
+    {1.0f, 1.0e-40f}, {1.0f, -1.0e-40f}, {-1.0f, 1.0e-40f}, {1.0f, 1.0e-38f},
+};
+static double dargs[ND][2] = {
+    {0.0, 1.0e308}, {0.0, -1.0e308}, {0.0, 1.0e22}, {0.0, 3.0e300},
+    {1.0, 1.0e200}, {-1.0, -7.0e150}, {0.0, 1.0e17}, {0.5, 6.0e9},
+    {1.0, 1.0e-310}, {1.0, -1.0e-310}, {-1.0, 1.0e-310}, {1.0, 1.0e-300},
+};
+
+/* Each part within a few ulps of the larger part of the reference. */
+static bool
+closef(float r, float i, float complex e)
+{
+    float m = fmaxf(fabsf(crealf(e)), fabsf(cimagf(e)));
+    float tol = 8.0f * FLT_EPSILON * m;
+
+    if (fabsf(cimagf(e)) < FLT_MIN)
+        return fabsf(i - cimagf(e)) <= fabsf(cimagf(e)) * 1.0e-3f &&
+               fabsf(r - crealf(e)) <= tol;
+    return fabsf(r - crealf(e)) <= tol && fabsf(i - cimagf(e)) <= tol;
+}
+
+static bool
+closed(double r, double i, double complex e)
+{
+    double m = fmax(fabs(creal(e)), fabs(cimag(e)));
+    double tol = 8.0 * DBL_EPSILON * m;
+
+    if (fabs(cimag(e)) < DBL_MIN)
+        return fabs(i - cimag(e)) <= fabs(cimag(e)) * 1.0e-9 &&
+               fabs(r - creal(e)) <= tol;
+    return fabs(r - creal(e)) <= tol && fabs(i - cimag(e)) <= tol;
+}
+
+static int
+tests(vcs4_t (*f)(vcs4_t), const char *fname)
+{
+    vcs4_t x, r;
+    int i, j, nfails = 0;
+
+    for (i = 0; i < NS; i += 4) {
+        for (j = 0; j < 4; j++) {
+            x[2*j] = fargs[i + j][0];
+            x[2*j + 1] = fargs[i + j][1];
+        }
+        r = f(x);
+        for (j = 0; j < 4; j++) {
+            float complex e = cexpf(CMPLXF(x[2*j], x[2*j + 1]));
+            if (!closef(r[2*j], r[2*j + 1], e)) {
+                if (verbose)
+                    printf("%s(%g, %g) = (%g, %g), expected (%g, %g)\n",
+                           fname, x[2*j], x[2*j + 1], r[2*j], r[2*j + 1],
+                           crealf(e), cimagf(e));
+                nfails++;
+            }
+        }
+    }
+    printf("%s Test %s\n", fname, nfails ? "Failed" : "Passed");
+    return nfails;
+}
+
+static int
+testd(vcd2_t (*f)(vcd2_t), const char *fname)
+{
+    vcd2_t x, r;
+    int i, j, nfails = 0;
+
+    for (i = 0; i < ND; i += 2) {
+        for (j = 0; j < 2; j++) {
+            x[2*j] = dargs[i + j][0];
+            x[2*j + 1] = dargs[i + j][1];
+        }
+        r = f(x);
+        for (j = 0; j < 2; j++) {
+            double complex e = cexp(CMPLX(x[2*j], x[2*j + 1]));
+            if (!closed(r[2*j], r[2*j + 1], e)) {
+                if (verbose)
+                    printf("%s(%g, %g) = (%g, %g), expected (%g, %g)\n",
+                           fname, x[2*j], x[2*j + 1], r[2*j], r[2*j + 1],
+                           creal(e), cimag(e));
+                nfails++;
+            }
+        }
+    }
+    printf("%s Test %s\n", fname, nfails ? "Failed" : "Passed");
+    return nfails;
+}
+
+int main(int argc, char *argv[])
+{
+    int nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+    parseargs(argc, argv);
+#endif
+
+    nfails += tests(__fc_exp_4, "__fc_exp_4");
+    nfails += tests(__rc_exp_4, "__rc_exp_4");
+    nfails += tests(__pc_exp_4, "__pc_exp_4");
+    nfails += testd(__fz_exp_2, "__fz_exp_2");
+    nfails += testd(__rz_exp_2, "__rz_exp_2");
+    nfails += testd(__pz_exp_2, "__pz_exp_2");
+
+    if (nfails != 0) {
+        exit(-1);
+    }
+    return 0;
+}
+
+// UNSUPPORTED: sse4
+// UNSUPPORTED: em64t
+// UNSUPPORTED: avx
+// UNSUPPORTED: ppc64le
@@ -0,0 +1,109 @@
+
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=512 && %libpgmath-run
+
+/* cosh of infinities and of arguments past the overflow threshold is +inf
+   and of NaN is NaN, for every accuracy class. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+
+static float fargs[] = {INFINITY, -INFINITY, 89.5f, -89.5f, 95.0f, 1.0e30f,
+                         NAN, 1.0f};
+static double dargs[] = {INFINITY, -INFINITY, 711.0, -711.0, 800.0, 1.0e300,
+                          NAN, 1.0};
+
+static int
+checks(VRS_T r, const char *fname)
+{
+    int i, nfails = 0;
+
+    for (i = 0; i < VLS; i++) {
+        float x = fargs[i % 8];
+        if (isnan(x) ? !isnan(r[i]) :
+            fabsf(x) < 2.0f ? fabsf(r[i] - coshf(x)) > 1.0e-6f :
+            r[i] != INFINITY) {
+            if (verbose)
+                printf("%s(%g) = %g\n", fname, x, r[i]);
+            nfails++;
+        }
+    }
+    printf("%s Test %s\n", fname, nfails ? "Failed" : "Passed");
+    return nfails;
+}
+
+static int
+checkd(VRD_T r, const char *fname)
+{
+    int i, nfails = 0;
+
+    for (i = 0; i < VLD; i++) {
+        double x = dargs[i % 8];
+        if (isnan(x) ? !isnan(r[i]) :
+            fabs(x) < 2.0 ? fabs(r[i] - cosh(x)) > 1.0e-15 :
+            r[i] != INFINITY) {
+            if (verbose)
+                printf("%s(%g) = %g\n", fname, x, r[i]);
+            nfails++;
+        }
+    }
+    printf("%s Test %s\n", fname, nfails ? "Failed" : "Passed");
+    return nfails;
+}
+
+int main(int argc, char *argv[])
+{
+    VRS_T sx;
+    VRD_T dx;
+    int i, nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+    parseargs(argc, argv);
+#endif
+    for (i = 0; i < VLS; i++)
+        sx[i] = fargs[i % 8];
+    for (i = 0; i < VLD; i++)
+        dx[i] = dargs[i % 8];
+
+    nfails += checks(CONCAT4(__fs_,cosh,_,VLS)(sx), STRINGIFY(CONCAT4(__fs_,cosh,_,VLS)));
+    nfails += checks(CONCAT4(__rs_,cosh,_,VLS)(sx), STRINGIFY(CONCAT4(__rs_,cosh,_,VLS)));
+    nfails += checks(CONCAT4(__ps_,cosh,_,VLS)(sx), STRINGIFY(CONCAT4(__ps_,cosh,_,VLS)));
+    nfails += checkd(CONCAT4(__fd_,cosh,_,VLD)(dx), STRINGIFY(CONCAT4(__fd_,cosh,_,VLD)));
+    nfails += checkd(CONCAT4(__rd_,cosh,_,VLD)(dx), STRINGIFY(CONCAT4(__rd_,cosh,_,VLD)));
+    nfails += checkd(CONCAT4(__pd_,cosh,_,VLD)(dx), STRINGIFY(CONCAT4(__pd_,cosh,_,VLD)));
+
+    if (nfails != 0) {
+        exit(-1);
+    }
+    return 0;
+}
+
+// UNSUPPORTED: sse4
+// UNSUPPORTED: em64t
+// UNSUPPORTED: avx
+// UNSUPPORTED: avx2
+// UNSUPPORTED: ppc64le
@@ -0,0 +1,85 @@
+
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=256 && %libpgmath-run
+// RUN: env MTH_I_OVERRIDE=atan2+sv8:f=p %libpgmath-run
+// RUN: env MTH_I_FAST=precise %libpgmath-run
+// RUN: env MTH_I_STATS=1 %libpgmath-run
+
+/* The environment controls reach the public entry points, whether they
+   are bound through the dispatch tables or by IFUNC resolvers.  By default
+   the fast and precise 8 x float atan2 kernels differ; MTH_I_OVERRIDE and
+   MTH_I_FAST can both make the fast entry point call the precise kernel,
+   and with MTH_I_STATS set the calls are counted. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+
+EXTERN_EFUNC2(atan2);
+extern __thread void *__mth_rt_stats_blk;
+
+int main(int argc, char *argv[])
+{
+    VRS_T y, x, rf, rp;
+    bool precise;
+    int i, j, ndiffer = 0, nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+    parseargs(argc, argv);
+#endif
+    precise = getenv("MTH_I_OVERRIDE") != NULL || getenv("MTH_I_FAST") != NULL;
+
+    for (j = 0; j < 1000; j++) {
+        for (i = 0; i < VLS; i++) {
+            y[i] = sinf(j * VLS + i) * (j + 1);
+            x[i] = cosf(j * VLS + i) * (i + 1);
+        }
+        rf = CONCAT4(__fs_,atan2,_,VLS)(y, x);
+        rp = CONCAT4(__ps_,atan2,_,VLS)(y, x);
+        for (i = 0; i < VLS; i++)
+            if (rf[i] != rp[i])
+                ndiffer++;
+    }
+    if (verbose)
+        printf("%d of %d results differ\n", ndiffer, 1000 * VLS);
+    if (precise ? ndiffer != 0 : ndiffer == 0)
+        nfails++;
+
+    if ((getenv("MTH_I_STATS") != NULL) != (__mth_rt_stats_blk != NULL))
+        nfails++;
+
+    printf("%s Test %s\n", STRINGIFY(CONCAT4(__fs_,atan2,_,VLS)),
+           nfails ? "Failed" : "Passed");
+    if (nfails != 0) {
+        exit(-1);
+    }
+    return 0;
+}
+
+// UNSUPPORTED: sse4
+// UNSUPPORTED: em64t
+// UNSUPPORTED: avx
+// UNSUPPORTED: ppc64le
@@ -0,0 +1,80 @@
+
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=512 && %libpgmath-run
+
+/* The AVX-512 log kernels against the long double C library over the
+   whole positive range and close to 1, for zeros, infinities, negative
+   arguments, NaN, denormals and the reduction boundary at sqrt(2)/2, and
+   through the masked entry points with partial masks. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+#include "ulp_check.h"
+
+EXTERN_EFUNC(log);
+
+static const float fspecial[] = {
+    1.0f, 0.0f, -0.0f, INFINITY, -INFINITY, -1.0f, NAN, 0x1p-149f,
+    0x1.fffffcp-127f, 0x1p-126f, 0x1.fffffep127f, 0x1.5bf0a8p1f, 2.0f, 0.5f,
+    0x1.000002p0f, 0x1.fffffep-1f, 0x1.6a09e6p-1f, 0x1.6a09e8p-1f};
+static const double dspecial[] = {
+    1.0, 0.0, -0.0, INFINITY, -INFINITY, -1.0, NAN, 0x1p-1074,
+    0x1.ffffffffffffep-1023, 0x1p-1022, 0x1.fffffffffffffp1023,
+    0x1.5bf0a8b145769p1, 2.0, 0.5, 0x1.0000000000001p0, 0x1.fffffffffffffp-1,
+    0x1.6a09e667f3bccp-1, 0x1.6a09e667f3bcdp-1};
+
+int main(int argc, char *argv[])
+{
+    int nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+    parseargs(argc, argv);
+#endif
+    nfails += ULP1S(f, log, logl, -149, 128, 0, fspecial, 3.0);
+    nfails += ULP1S(f, log, logl, -1, 1, 0, fspecial, 3.0);
+    nfails += ULP1S(r, log, logl, -149, 128, 0, fspecial, 6.0);
+    nfails += ULP1S(r, log, logl, -1, 1, 0, fspecial, 6.0);
+    nfails += ULP1S(p, log, logl, -149, 128, 0, fspecial, 1.0);
+    nfails += ULP1S(p, log, logl, -1, 1, 0, fspecial, 1.0);
+    nfails += ULP1D(f, log, logl, -1074, 1024, 0, dspecial, 3.0);
+    nfails += ULP1D(f, log, logl, -1, 1, 0, dspecial, 3.0);
+    nfails += ULP1D(r, log, logl, -1074, 1024, 0, dspecial, 6.0);
+    nfails += ULP1D(r, log, logl, -1, 1, 0, dspecial, 6.0);
+    nfails += ULP1D(p, log, logl, -1074, 1024, 0, dspecial, 1.0);
+    nfails += ULP1D(p, log, logl, -1, 1, 0, dspecial, 1.0);
+
+    if (nfails != 0) {
+        exit(-1);
+    }
+    return 0;
+}
+
+// UNSUPPORTED: sse4
+// UNSUPPORTED: em64t
+// UNSUPPORTED: avx
+// UNSUPPORTED: avx2
+// UNSUPPORTED: ppc64le
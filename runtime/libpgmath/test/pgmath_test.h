@@ -89,6 +89,12 @@ typedef	int64_t	vid8_t	__attribute__((vector_size(8*sizeof(int64_t))));
 #endif
 
 
+/*
+ * VIDI_T is the type of the 32-bit integer exponents of R8**I4, which are
+ * passed in at least 128 bits.  VRSK_ARGS are the 64-bit integer exponents
+ * of R4**I8, two VID_T halves when there is more than one element.
+ */
+
 #if MAX_VREG_SIZE == 64
 #define VLS     1
 #define VLD     1
@@ -96,6 +102,8 @@ typedef	int64_t	vid8_t	__attribute__((vector_size(8*sizeof(int64_t))));
 #define VID_T   vid1_t
 #define VRS_T   vrs1_t
 #define VRD_T   vrd1_t
+#define VIDI_T  vis1_t
+#define VRSK_ARGS VID_T
 #define FMIN	1.0f
 #define DMIN	1.0d
 #define VRET(subscript) vret
@@ -111,6 +119,8 @@ typedef	int64_t	vid8_t	__attribute__((vector_size(8*sizeof(int64_t))));
 #define VID_T   vid2_t
 #define VRS_T   vrs4_t
 #define VRD_T   vrd2_t
+#define VIDI_T  vis4_t
+#define VRSK_ARGS VID_T,VID_T
 #define FMIN	2.0f
 #define DMIN	2.0d
 #define VRET(subscript) vret[subscript]
@@ -126,6 +136,8 @@ typedef	int64_t	vid8_t	__attribute__((vector_size(8*sizeof(int64_t))));
 #define VID_T   vid4_t
 #define VRS_T   vrs8_t
 #define VRD_T   vrd4_t
+#define VIDI_T  vis4_t
+#define VRSK_ARGS VID_T,VID_T
 #define FMIN	6.0f
 #define DMIN	6.0d
 #define VRET(subscript) vret[subscript]
@@ -141,6 +153,8 @@ typedef	int64_t	vid8_t	__attribute__((vector_size(8*sizeof(int64_t))));
 #define VID_T   vid8_t
 #define VRS_T   vrs16_t
 #define VRD_T   vrd8_t
+#define VIDI_T  vis8_t
+#define VRSK_ARGS VID_T,VID_T
 #define FMIN	14.0f
 #define DMIN	14.0d
 #define VRET(subscript) vret[subscript]
@@ -185,9 +199,9 @@ typedef	int64_t	vid8_t	__attribute__((vector_size(8*sizeof(int64_t))));
     CONCAT5(__rs_,name,_,VLS,)(VRS_T,VIS_T), CONCAT5(__rs_,name,_,VLS,m)(VRS_T,VIS_T,VIS_T), \
     CONCAT5(__ps_,name,_,VLS,)(VRS_T,VIS_T), CONCAT5(__ps_,name,_,VLS,m)(VRS_T,VIS_T,VIS_T); \
     extern VRD_T \
-    CONCAT5(__fd_,name,_,VLD,)(VRD_T,VIS_T), CONCAT5(__fd_,name,_,VLD,m)(VRD_T,VIS_T,VID_T), \
-    CONCAT5(__rd_,name,_,VLD,)(VRD_T,VIS_T), CONCAT5(__rd_,name,_,VLD,m)(VRD_T,VIS_T,VID_T), \
-    CONCAT5(__pd_,name,_,VLD,)(VRD_T,VIS_T), CONCAT5(__pd_,name,_,VLD,m)(VRD_T,VIS_T,VID_T)
+    CONCAT5(__fd_,name,_,VLD,)(VRD_T,VIDI_T), CONCAT5(__fd_,name,_,VLD,m)(VRD_T,VIDI_T,VID_T), \
+    CONCAT5(__rd_,name,_,VLD,)(VRD_T,VIDI_T), CONCAT5(__rd_,name,_,VLD,m)(VRD_T,VIDI_T,VID_T), \
+    CONCAT5(__pd_,name,_,VLD,)(VRD_T,VIDI_T), CONCAT5(__pd_,name,_,VLD,m)(VRD_T,VIDI_T,VID_T)
 
 
 #define EXTERN_EFUNC2i1(name) \
@@ -203,9 +217,9 @@ typedef	int64_t	vid8_t	__attribute__((vector_size(8*sizeof(int64_t))));
 
 #define EXTERN_EFUNC2k(name) \
     extern VRS_T \
-    CONCAT5(__fs_,name,_,VLS,)(VRS_T,VID_T), CONCAT5(__fs_,name,_,VLS,m)(VRS_T,VID_T,VIS_T), \
-    CONCAT5(__rs_,name,_,VLS,)(VRS_T,VID_T), CONCAT5(__rs_,name,_,VLS,m)(VRS_T,VID_T,VIS_T), \
-    CONCAT5(__ps_,name,_,VLS,)(VRS_T,VID_T), CONCAT5(__ps_,name,_,VLS,m)(VRS_T,VID_T,VIS_T); \
+    CONCAT5(__fs_,name,_,VLS,)(VRS_T,VRSK_ARGS), CONCAT5(__fs_,name,_,VLS,m)(VRS_T,VRSK_ARGS,VIS_T), \
+    CONCAT5(__rs_,name,_,VLS,)(VRS_T,VRSK_ARGS), CONCAT5(__rs_,name,_,VLS,m)(VRS_T,VRSK_ARGS,VIS_T), \
+    CONCAT5(__ps_,name,_,VLS,)(VRS_T,VRSK_ARGS), CONCAT5(__ps_,name,_,VLS,m)(VRS_T,VRSK_ARGS,VIS_T); \
     extern VRD_T \
     CONCAT5(__fd_,name,_,VLD,)(VRD_T,VID_T), CONCAT5(__fd_,name,_,VLD,m)(VRD_T,VID_T,VID_T), \
     CONCAT5(__rd_,name,_,VLD,)(VRD_T,VID_T), CONCAT5(__rd_,name,_,VLD,m)(VRD_T,VID_T,VID_T), \
@@ -0,0 +1,91 @@
+
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=512 && %libpgmath-run
+
+/* The AVX-512 pow kernels against the long double C library for bases of
+   any magnitude and exponents up to overflow and underflow, for the C99
+   special cases of signed zeros, infinities, NaN, negative bases with
+   integral and nonintegral exponents and denormals, and through the masked
+   entry points with partial masks. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+#include "ulp_check.h"
+
+EXTERN_EFUNC2(pow);
+
+/* (x, y) pairs */
+static const float fspecial[] = {
+    NAN, 0.0f,    NAN, -0.0f,   1.0f, NAN,    1.0f, INFINITY,
+    -1.0f, INFINITY,  -1.0f, -INFINITY,  NAN, 1.0f,  2.0f, NAN,
+    0.0f, -3.0f,  -0.0f, -3.0f,  0.0f, -2.0f,  -0.0f, -2.5f,
+    0.0f, -INFINITY,  -0.0f, -INFINITY,  0.0f, 3.0f,  -0.0f, 3.0f,
+    -0.0f, 2.0f,  -0.0f, 0.5f,  0.5f, INFINITY,  2.0f, INFINITY,
+    0.5f, -INFINITY,  2.0f, -INFINITY,  -INFINITY, -3.0f,  -INFINITY, -2.0f,
+    -INFINITY, 3.0f,  -INFINITY, 2.0f,  INFINITY, -1.0f,  INFINITY, 1.0f,
+    -2.0f, 3.0f,  -2.0f, -3.0f,  -2.0f, 0.5f,  -8.0f, 1.0f / 3.0f,
+    2.0f, 128.0f,  2.0f, -150.0f,  -2.0f, 127.0f,  10.0f, 38.5f,
+    0x1p-149f, 0.5f,  0x1p-149f, -0.25f,  0x1.fffffep127f, 1.0f,
+    0x1.000002p0f, 0x1p30f,  0x1.fffffep-1f, -0x1p30f};
+static const double dspecial[] = {
+    NAN, 0.0,    NAN, -0.0,   1.0, NAN,    1.0, INFINITY,
+    -1.0, INFINITY,  -1.0, -INFINITY,  NAN, 1.0,  2.0, NAN,
+    0.0, -3.0,  -0.0, -3.0,  0.0, -2.0,  -0.0, -2.5,
+    0.0, -INFINITY,  -0.0, -INFINITY,  0.0, 3.0,  -0.0, 3.0,
+    -0.0, 2.0,  -0.0, 0.5,  0.5, INFINITY,  2.0, INFINITY,
+    0.5, -INFINITY,  2.0, -INFINITY,  -INFINITY, -3.0,  -INFINITY, -2.0,
+    -INFINITY, 3.0,  -INFINITY, 2.0,  INFINITY, -1.0,  INFINITY, 1.0,
+    -2.0, 3.0,  -2.0, -3.0,  -2.0, 0.5,  -8.0, 1.0 / 3.0,
+    2.0, 1024.0,  2.0, -1075.0,  -2.0, 1023.0,  10.0, 308.5,
+    0x1p-1074, 0.5,  0x1p-1074, -0.25,  0x1.fffffffffffffp1023, 1.0,
+    0x1.0000000000001p0, 0x1p60,  0x1.fffffffffffffp-1, -0x1p60};
+
+int main(int argc, char *argv[])
+{
+    int nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+    parseargs(argc, argv);
+#endif
+    nfails += ULP2S(f, pow, powl, -20, 20, 0, -10, 3, 1, fspecial, 3.0);
+    nfails += ULP2S(r, pow, powl, -20, 20, 0, -10, 3, 1, fspecial, 6.0);
+    nfails += ULP2S(p, pow, powl, -20, 20, 0, -10, 3, 1, fspecial, 1.0);
+    nfails += ULP2D(f, pow, powl, -40, 40, 0, -20, 5, 1, dspecial, 3.0);
+    nfails += ULP2D(r, pow, powl, -40, 40, 0, -20, 5, 1, dspecial, 6.0);
+    nfails += ULP2D(p, pow, powl, -40, 40, 0, -20, 5, 1, dspecial, 1.0);
+
+    if (nfails != 0) {
+        exit(-1);
+    }
+    return 0;
+}
+
+// UNSUPPORTED: sse4
+// UNSUPPORTED: em64t
+// UNSUPPORTED: avx
+// UNSUPPORTED: avx2
+// UNSUPPORTED: ppc64le
@@ -0,0 +1,284 @@
+
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=512 && %libpgmath-run
+
+/* R4**I4, R4**I8, R8**I4 and R8**I8 at 512 bits, with per-lane exponents,
+   with the same exponent in every lane (which the per-lane kernels hand
+   off to the uniform exponent kernels) and with a scalar exponent, against
+   the long double C library: bases near 1 with exponents up to +-NEXP,
+   signed zeros, infinities, NaN, denormals and overflow, and the masked
+   entry points with partial masks.  The fast and relaxed kernels square
+   repeatedly, so their bound grows by an ulp per unit of |n|; x**-n is
+   1/x**n, which is zero once x**n overflows, so no special exponent takes
+   a denormal result through an overflowed power. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+#include "ulp_check.h"
+
+#define NEXP 40
+
+static const float fspecial[] = {
+    0.0f, -0.0f, INFINITY, -INFINITY, NAN, 1.0f, -1.0f, -2.0f, 0.5f,
+    0x1p-149f, -0x1p-149f, 0x1.fffffep127f, -0x1.fffffep127f, 0x1p-126f,
+    3.0f, -10.0f};
+static const double dspecial[] = {
+    0.0, -0.0, INFINITY, -INFINITY, NAN, 1.0, -1.0, -2.0, 0.5,
+    0x1p-1074, -0x1p-1074, 0x1.fffffffffffffp1023, -0x1.fffffffffffffp1023,
+    0x1p-1022, 3.0, -10.0};
+static const int64_t nspecial[] = {
+    0, 1, -1, 2, -2, 3, -3, 4, -5, 11, -11, 64, -64, 127, -126, 1075};
+
+/*
+ * x**n through the entry point of class frp ('f', 'r' or 'p') of each
+ * kind: I4 or I8 exponents per lane, or one I4 or I8 scalar exponent n[0].
+ * If k < VL only the first k lanes are enabled.
+ */
+
+#define PICK(_frp, _pre, _name, _vl, _m) \
+    (_frp == 'f' ? CONCAT5(__f,_pre,_name,_vl,_m) : \
+     _frp == 'r' ? CONCAT5(__r,_pre,_name,_vl,_m) : \
+                   CONCAT5(__p,_pre,_name,_vl,_m))
+
+static VRS_T
+powi_s(int frp, VRS_T x, const int64_t *n, int k)
+{
+    VIS_T vi, vm;
+    int i;
+
+    for (i = 0; i < VLS; i++) {
+        vi[i] = n[i];
+        vm[i] = i < k ? -1 : 0;
+    }
+    return k < VLS ? PICK(frp, s_, powi_, VLS, m)(x, vi, vm) :
+                     PICK(frp, s_, powi_, VLS, )(x, vi);
+}
+
+static VRS_T
+powk_s(int frp, VRS_T x, const int64_t *n, int k)
+{
+    VID_T lo, hi;
+    VIS_T vm;
+    int i;
+
+    for (i = 0; i < VLS; i++)
+        vm[i] = i < k ? -1 : 0;
+    for (i = 0; i < VLD; i++) {
+        lo[i] = n[i];
+        hi[i] = n[VLD + i];
+    }
+    return k < VLS ? PICK(frp, s_, powk_, VLS, m)(x, lo, hi, vm) :
+                     PICK(frp, s_, powk_, VLS, )(x, lo, hi);
+}
+
+static VRS_T
+powi1_s(int frp, VRS_T x, const int64_t *n, int k)
+{
+    VIS_T vm;
+    int i;
+
+    for (i = 0; i < VLS; i++)
+        vm[i] = i < k ? -1 : 0;
+    return k < VLS ? PICK(frp, s_, powi1_, VLS, m)(x, n[0], vm) :
+                     PICK(frp, s_, powi1_, VLS, )(x, n[0]);
+}
+
+static VRS_T
+powk1_s(int frp, VRS_T x, const int64_t *n, int k)
+{
+    VIS_T vm;
+    int i;
+
+    for (i = 0; i < VLS; i++)
+        vm[i] = i < k ? -1 : 0;
+    return k < VLS ? PICK(frp, s_, powk1_, VLS, m)(x, n[0], vm) :
+                     PICK(frp, s_, powk1_, VLS, )(x, n[0]);
+}
+
+static VRD_T
+powi_d(int frp, VRD_T x, const int64_t *n, int k)
+{
+    VIDI_T vi = {0};
+    VID_T vm;
+    int i;
+
+    for (i = 0; i < VLD; i++) {
+        vi[i] = n[i];
+        vm[i] = i < k ? -1 : 0;
+    }
+    return k < VLD ? PICK(frp, d_, powi_, VLD, m)(x, vi, vm) :
+                     PICK(frp, d_, powi_, VLD, )(x, vi);
+}
+
+static VRD_T
+powk_d(int frp, VRD_T x, const int64_t *n, int k)
+{
+    VID_T vi, vm;
+    int i;
+
+    for (i = 0; i < VLD; i++) {
+        vi[i] = n[i];
+        vm[i] = i < k ? -1 : 0;
+    }
+    return k < VLD ? PICK(frp, d_, powk_, VLD, m)(x, vi, vm) :
+                     PICK(frp, d_, powk_, VLD, )(x, vi);
+}
+
+static VRD_T
+powi1_d(int frp, VRD_T x, const int64_t *n, int k)
+{
+    VID_T vm;
+    int i;
+
+    for (i = 0; i < VLD; i++)
+        vm[i] = i < k ? -1 : 0;
+    return k < VLD ? PICK(frp, d_, powi1_, VLD, m)(x, n[0], vm) :
+                     PICK(frp, d_, powi1_, VLD, )(x, n[0]);
+}
+
+static VRD_T
+powk1_d(int frp, VRD_T x, const int64_t *n, int k)
+{
+    VID_T vm;
+    int i;
+
+    for (i = 0; i < VLD; i++)
+        vm[i] = i < k ? -1 : 0;
+    return k < VLD ? PICK(frp, d_, powk1_, VLD, m)(x, n[0], vm) :
+                     PICK(frp, d_, powk1_, VLD, )(x, n[0]);
+}
+
+/*
+ * Check entry point f, whose exponents are per lane unless uniform is set:
+ * random bases near 1 with random exponents, every exponent in
+ * [-NEXP, NEXP] in all lanes, the special bases with the special
+ * exponents, and the first 1 .. VL-1 lanes.  A lane fails when it is more
+ * than tol + ntol * |n| ulps away from the reference.
+ */
+
+#define POWI_CHECK(_s, _e, _vr, _vl, _ulps) \
+static int \
+check_##_s(_vr (*f)(int, _vr, const int64_t *, int), int frp, \
+           const char *fname, int uniform, const _e *special, double tol, \
+           double ntol) \
+{ \
+    _vr x, r; \
+    int64_t n[_vl]; \
+    int i, j, k, nfails = 0; \
+    double worst = 0.0; \
+    char name[32]; \
+\
+    sprintf(name, "__%c%s", frp, fname); \
+    for (j = 0; j < NSWEEP; j++) { \
+        for (i = 0; i < _vl; i++) { \
+            x[i] = (_e)ulp_arg(-1, 1, 1); \
+            n[i] = uniform && i > 0 ? n[0] : \
+                   (int64_t)(ulp_rand() * (2 * NEXP + 1)) - NEXP; \
+        } \
+        r = f(frp, x, n, _vl); \
+        for (i = 0; i < _vl; i++) \
+            ULP_LANE(_ulps, r[i], powl(x[i], n[i]), x[i], n[i], \
+                     tol + ntol * llabs(n[i])); \
+    } \
+    for (j = -NEXP; j <= NEXP; j++) { \
+        for (i = 0; i < _vl; i++) { \
+            x[i] = (_e)ulp_arg(-1, 1, 1); \
+            n[i] = j; \
+        } \
+        r = f(frp, x, n, _vl); \
+        for (i = 0; i < _vl; i++) \
+            ULP_LANE(_ulps, r[i], powl(x[i], n[i]), x[i], n[i], \
+                     tol + ntol * llabs(n[i])); \
+    } \
+    for (j = 0; j < NELEM(nspecial); j++) { \
+        for (k = 0; k < NELEM(fspecial); k += _vl) { \
+            for (i = 0; i < _vl; i++) { \
+                x[i] = special[(k + i) % NELEM(fspecial)]; \
+                n[i] = nspecial[uniform ? j : (j + i) % NELEM(nspecial)]; \
+            } \
+            r = f(frp, x, n, _vl); \
+            for (i = 0; i < _vl; i++) \
+                ULP_LANE(_ulps, r[i], powl(x[i], n[i]), x[i], n[i], \
+                         tol + ntol * llabs(n[i])); \
+        } \
+    } \
+    for (k = 1; k < _vl; k++) { \
+        for (i = 0; i < _vl; i++) { \
+            x[i] = (_e)ulp_arg(-1, 1, 1); \
+            n[i] = uniform && i > 0 ? n[0] : \
+                   (int64_t)(ulp_rand() * (2 * NEXP + 1)) - NEXP; \
+        } \
+        r = f(frp, x, n, k); \
+        for (i = 0; i < k; i++) \
+            ULP_LANE(_ulps, r[i], powl(x[i], n[i]), x[i], n[i], \
+                     tol + ntol * llabs(n[i])); \
+    } \
+    ULP_REPORT; \
+}
+
+POWI_CHECK(s, float, VRS_T, VLS, ULPS_S)
+POWI_CHECK(d, double, VRD_T, VLD, ULPS_D)
+
+int main(int argc, char *argv[])
+{
+    static const char frps[] = "frp";
+    static const double ntol[] = {1.0, 1.0, 0.0};
+    int i, nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+    parseargs(argc, argv);
+#endif
+    for (i = 0; i < 3; i++) {
+        nfails += check_s(powi_s, frps[i], "s_powi_" STRINGIFY(VLS), 0,
+                          fspecial, 1.0, ntol[i]);
+        nfails += check_s(powk_s, frps[i], "s_powk_" STRINGIFY(VLS), 0,
+                          fspecial, 1.0, ntol[i]);
+        nfails += check_s(powi1_s, frps[i], "s_powi1_" STRINGIFY(VLS), 1,
+                          fspecial, 1.0, ntol[i]);
+        nfails += check_s(powk1_s, frps[i], "s_powk1_" STRINGIFY(VLS), 1,
+                          fspecial, 1.0, ntol[i]);
+        nfails += check_d(powi_d, frps[i], "d_powi_" STRINGIFY(VLD), 0,
+                          dspecial, 1.0, ntol[i]);
+        nfails += check_d(powk_d, frps[i], "d_powk_" STRINGIFY(VLD), 0,
+                          dspecial, 1.0, ntol[i]);
+        nfails += check_d(powi1_d, frps[i], "d_powi1_" STRINGIFY(VLD), 1,
+                          dspecial, 1.0, ntol[i]);
+        nfails += check_d(powk1_d, frps[i], "d_powk1_" STRINGIFY(VLD), 1,
+                          dspecial, 1.0, ntol[i]);
+    }
+
+    if (nfails != 0) {
+        exit(-1);
+    }
+    return 0;
+}
+
+// UNSUPPORTED: sse4
+// UNSUPPORTED: em64t
+// UNSUPPORTED: avx
+// UNSUPPORTED: avx2
+// UNSUPPORTED: ppc64le
@@ -0,0 +1,133 @@
+
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=128 && %libpgmath-run
+
+/* Single precision sincos array entry points against the long double C
+   library: arrays of every length up to a few vectors, and one long array,
+   with unaligned starts, mixing random arguments over the whole range with
+   zeros, infinities, NaN, denormals and arguments past the Payne-Hanek
+   switch.  The array entries use the fused kernel when the dispatch table
+   selects it, and the masked kernel for the alignment peel and for the
+   remainder.  Elements outside the arrays must be left alone. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+#include "ulp_check.h"
+
+#define NMAX 67              /* longest short array */
+#define NLONG 4109           /* long array */
+#define LEN (NLONG + 8)      /* buffer length, elements */
+#define GUARD -12345.0f      /* contents of the untouched result elements */
+
+extern void __fs_sincos_array(int64_t, float *, int64_t, float *, int64_t,
+                              float *, int64_t);
+extern void __rs_sincos_array(int64_t, float *, int64_t, float *, int64_t,
+                              float *, int64_t);
+extern void __ps_sincos_array(int64_t, float *, int64_t, float *, int64_t,
+                              float *, int64_t);
+
+static const float fspecial[] = {
+    0.0f, -0.0f, INFINITY, -INFINITY, NAN, 0x1p-149f, -0x1p-149f, 0x1p-127f,
+    0x1p-12f, 3.1415927f, -4.712389f, 38999.0f, -39001.0f, 1.0e30f,
+    -0x1.fffffep127f};
+
+static float x[LEN], s[LEN], c[LEN];
+
+/*
+ * Run f over the n elements from x + off and check s and c against sinl
+ * and cosl, and that the elements around them still hold GUARD.  Unless
+ * zsign is set, sin(-0) may be +0: the relaxed array entry computes sin
+ * with the relaxed sin kernel, which does not keep the sign of zero.
+ */
+static int
+check(void (*f)(int64_t, float *, int64_t, float *, int64_t, float *,
+                int64_t),
+      const char *name, int n, int off, bool zsign, double tol)
+{
+    int i, nfails = 0;
+    double worst = 0.0;
+    long double ref;
+
+    for (i = 0; i < LEN; i++)
+        s[i] = c[i] = GUARD;
+    f(n, x + off, 1, s + off, 1, c + off, 1);
+    for (i = 0; i < LEN; i++) {
+        if (i >= off && i < off + n) {
+            ref = sinl(x[i]);
+            if (!zsign && ref == 0.0L)
+                ref = copysignl(ref, s[i]);
+            ULP_LANE(ULPS_S, s[i], ref, x[i], 0, tol);
+            ULP_LANE(ULPS_S, c[i], cosl(x[i]), x[i], 1, tol);
+        } else if (s[i] != GUARD || c[i] != GUARD) {
+            printf("%s n=%d off=%d: element %d overwritten\n",
+                   name, n, off, i);
+            nfails++;
+        }
+    }
+    if (nfails)
+        printf("%s n=%d off=%d Test Failed\n", name, n, off);
+    return nfails;
+}
+
+int main(int argc, char *argv[])
+{
+    int i, n, off, nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+    parseargs(argc, argv);
+#endif
+    for (i = 0; i < LEN; i++)
+        x[i] = i % 3 == 0 ? fspecial[(i / 3) % NELEM(fspecial)] :
+                            (float)ulp_arg(-20, 127, 1);
+
+    for (n = 0; n <= NMAX; n++) {
+        for (off = 0; off < 3; off++) {
+            nfails += check(__fs_sincos_array, "__fs_sincos_array", n, off,
+                            true, 3.0);
+            nfails += check(__rs_sincos_array, "__rs_sincos_array", n, off,
+                            false, 6.0);
+            nfails += check(__ps_sincos_array, "__ps_sincos_array", n, off,
+                            true, 1.0);
+        }
+    }
+    nfails += check(__fs_sincos_array, "__fs_sincos_array", NLONG, 1, true,
+                    3.0);
+    nfails += check(__rs_sincos_array, "__rs_sincos_array", NLONG, 1, false,
+                    6.0);
+    nfails += check(__ps_sincos_array, "__ps_sincos_array", NLONG, 1, true,
+                    1.0);
+
+    printf("sincos array entry points Test %s\n", nfails ? "Failed" : "Passed");
+    if (nfails != 0) {
+        exit(-1);
+    }
+    return 0;
+}
+
+// UNSUPPORTED: sse4
+// UNSUPPORTED: em64t
+// UNSUPPORTED: ppc64le
@@ -0,0 +1,65 @@
+
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=128 && %libpgmath-run
+
+/* Single precision sincos against the long double C library over the
+   whole argument range, including the arguments past the point where the
+   fused kernels switch to Payne-Hanek reduction, for zeros, infinities,
+   NaN and denormals, and through the masked entry points with partial
+   masks.  Both results come from one call. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+#include "ulp_check.h"
+
+EXTERN_EFUNC(sincos);
+
+static const float fspecial[] = {
+    0.0f, -0.0f, INFINITY, -INFINITY, NAN, 0x1p-149f, -0x1p-149f, 0x1p-127f,
+    0x1p-12f, 0.7853982f, -1.5707964f, 3.1415927f, -4.712389f, 6.2831855f,
+    38999.0f, -39001.0f, 0x1p24f, 1.0e30f, -0x1.fffffep127f};
+
+int main(int argc, char *argv[])
+{
+    int nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+    parseargs(argc, argv);
+#endif
+    nfails += ULPSINCOSS(f, -20, 127, fspecial, 3.0);
+    nfails += ULPSINCOSS(r, -20, 127, fspecial, 6.0);
+    nfails += ULPSINCOSS(p, -20, 127, fspecial, 1.0);
+
+    if (nfails != 0) {
+        exit(-1);
+    }
+    return 0;
+}
+
+// UNSUPPORTED: sse4
+// UNSUPPORTED: em64t
+// UNSUPPORTED: ppc64le
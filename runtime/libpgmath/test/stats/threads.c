@@ -0,0 +1,148 @@
+
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=256 -pthread && env MTH_I_STATS=0x10 MTH_I_STATS_FILE=%t.csv %libpgmath-run
+
+/* Per-thread call statistics: threads that count into their own blocks
+   and exit before the report, unmasked and masked vector and scalar entry
+   points in every accuracy class, summed into the CSV report, which must
+   give the exact number of calls and elements of each. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+
+#define NTHREADS 8
+#define NCALLS 1000     /* calls by thread i are NCALLS * (i + 1) */
+
+EXTERN_EFUNC(exp);
+extern float __fs_exp_1(float), __rs_exp_1(float), __ps_exp_1(float);
+extern void __math_epilog(void);
+
+static volatile float sink;
+
+static void *
+worker(void *arg)
+{
+    int i, n = NCALLS * ((int)(intptr_t)arg + 1);
+    VRS_T x = {0};
+    VIS_T m = {0};
+
+    m[0] = -1;
+    for (i = 0; i < n; i++) {
+        x[0] = 0.5f + i * 0.001f;     /* not 0: exp(0) returns early */
+        sink = CONCAT4(__fs_,exp,_,VLS)(x)[0];
+        sink = CONCAT5(__rs_,exp,_,VLS,m)(x, m)[0];
+        sink = __ps_exp_1(x[0]);
+    }
+    return NULL;
+}
+
+/*
+ * Read the calls and elements columns of the CSV line that starts with key,
+ * "func,type,precision,".  Returns whether there is one.
+ */
+
+static int
+report(const char *csv, const char *key, long *calls, long *elmts)
+{
+    FILE *fp = fopen(csv, "r");
+    char line[256];
+    char *p;
+    int i, found = 0;
+
+    if (fp == NULL)
+        return 0;
+    while (fgets(line, sizeof line, fp) != NULL) {
+        if (strncmp(line, key, strlen(key)) != 0)
+            continue;
+        for (i = 0, p = line; i < 6 && p != NULL; i++)
+            p = strchr(p + 1, ',');
+        if (p != NULL && sscanf(p, ",%ld,%ld", calls, elmts) == 2)
+            found = 1;
+    }
+    fclose(fp);
+    return found;
+}
+
+static int
+check(const char *csv, const char *key, long ncalls, long nelmt)
+{
+    long calls = -1, elmts = -1;
+
+    if (!report(csv, key, &calls, &elmts) || calls != ncalls ||
+        elmts != ncalls * nelmt) {
+        printf("%s: %ld calls, %ld elements, expected %ld and %ld\n",
+               key, calls, elmts, ncalls, ncalls * nelmt);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    pthread_t tid[NTHREADS];
+    char *csv = getenv("MTH_I_STATS_FILE");
+    char key[32];
+    long ncalls, calls, elmts;
+    int i, nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+    parseargs(argc, argv);
+#endif
+    if (csv == NULL || getenv("MTH_I_STATS") == NULL) {
+        printf("MTH_I_STATS and MTH_I_STATS_FILE must be set\n");
+        exit(-1);
+    }
+
+    for (i = 0; i < NTHREADS; i++)
+        pthread_create(&tid[i], NULL, worker, (void *)(intptr_t)i);
+    for (i = 0; i < NTHREADS; i++)
+        pthread_join(tid[i], NULL);
+    worker((void *)0);
+    ncalls = NCALLS * (NTHREADS * (NTHREADS + 1) / 2 + 1);
+
+    /* Write the report now; the destructor rewrites it at exit. */
+    __math_epilog();
+
+    sprintf(key, "exp,sv%d,fast,", VLS);
+    nfails += check(csv, key, ncalls, VLS);
+    sprintf(key, "exp,sv%dm,relaxed,", VLS);
+    nfails += check(csv, key, ncalls, VLS);
+    nfails += check(csv, "exp,ss,precise,", ncalls, 1);
+    sprintf(key, "exp,sv%d,precise,", VLS);
+    nfails += report(csv, key, &calls, &elmts);
+
+    printf("per thread statistics Test %s\n", nfails ? "Failed" : "Passed");
+    if (nfails != 0) {
+        exit(-1);
+    }
+    return 0;
+}
+
+// UNSUPPORTED: sse4
+// UNSUPPORTED: em64t
+// UNSUPPORTED: ppc64le
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Accuracy checks of vector entry points against the long double C
+ * library, for use after pgmath_test.h.
+ *
+ * Each check runs the entry point over NSWEEP vectors of arguments whose
+ * magnitudes are log-uniform in [2**elo, 2**ehi), over a table of special
+ * arguments, and through the masked entry point with only the first
+ * 1 .. VL-1 lanes enabled, and fails if any lane is more than tol ulps
+ * away from the reference.  Special values must match exactly: a NaN for
+ * a NaN, the same infinity and the same signed zero.
+ */
+
+#define NSWEEP 4096
+
+static uint64_t ulp_seed = 0x2545f4914f6cdd1dULL;
+
+static double
+ulp_rand(void)
+{
+    ulp_seed ^= ulp_seed << 13;
+    ulp_seed ^= ulp_seed >> 7;
+    ulp_seed ^= ulp_seed << 17;
+    return (double)(ulp_seed >> 11) * 0x1.0p-53;
+}
+
+/* A random argument with magnitude in [2**elo, 2**ehi), negative half of
+   the time if sgn is set. */
+static long double
+ulp_arg(int elo, int ehi, int sgn)
+{
+    long double x;
+
+    x = ldexpl(1.0L + ulp_rand(), elo + (int)(ulp_rand() * (ehi - elo)));
+    return sgn && ulp_rand() < 0.5 ? -x : x;
+}
+
+/*
+ * Error of r in ulps of the reference result ref, which is rr once rounded
+ * to the type of r.  Results that overflow must be the same infinity.
+ */
+static double
+ulp_err(long double r, long double ref, long double rr, int mant, int emin)
+{
+    if (isnan(ref) || isnan(r))
+        return isnan(ref) && isnan(r) ? 0.0 : HUGE_VAL;
+    if (isinf(ref) || ref == 0.0L)
+        return r == ref && signbit(r) == signbit(ref) ? 0.0 : HUGE_VAL;
+    if (isinf(r))
+        return r == rr ? 0.0 : HUGE_VAL;
+    return fabsl(r - ref) /
+           ldexpl(1.0L, (ilogbl(ref) < emin ? emin : ilogbl(ref)) - mant);
+}
+
+#define ULPS_S(_r, _ref) ulp_err(_r, _ref, (float)(_ref), 23, -126)
+#define ULPS_D(_r, _ref) ulp_err(_r, _ref, (double)(_ref), 52, -1022)
+
+/*
+ * Count result _r for arguments _x and _y as a failure when it is more
+ * than _tol ulps from _ref.
+ */
+#define ULP_LANE(_ulps, _r, _ref, _x, _y, _tol) \
+    do { \
+        long double t = _ref; \
+        double e = _ulps(_r, t); \
+        if (e > worst) \
+            worst = e; \
+        if (e > _tol) { \
+            if (verbose || nfails < 10) \
+                printf("%s(%.9Lg, %.9Lg) = %.17Lg, expected %.17Lg\n", \
+                       name, (long double)(_x), (long double)(_y), \
+                       (long double)(_r), t); \
+            nfails++; \
+        } \
+    } while (0)
+
+#define ULP_REPORT \
+    if (verbose) \
+        printf("%s max error %.3g ulp\n", name, worst); \
+    printf("%s Test %s\n", name, nfails ? "Failed" : "Passed"); \
+    return nfails
+
+/* One vector argument, element type _e, vector length _vl. */
+#define ULP_CHECK1(_s, _e, _vr, _vi, _vl, _ulps) \
+static int \
+ulp_check1##_s(_vr (*f)(_vr), _vr (*fm)(_vr, _vi), const char *name, \
+               long double (*ref)(long double), int elo, int ehi, int sgn, \
+               const _e *special, int nspecial, double tol) \
+{ \
+    _vr x, r; \
+    _vi m; \
+    int i, j, k, nfails = 0; \
+    double worst = 0.0; \
+\
+    for (j = 0; j < NSWEEP; j++) { \
+        for (i = 0; i < _vl; i++) \
+            x[i] = (_e)ulp_arg(elo, ehi, sgn); \
+        r = f(x); \
+        for (i = 0; i < _vl; i++) \
+            ULP_LANE(_ulps, r[i], ref(x[i]), x[i], 0, tol); \
+    } \
+    for (j = 0; j < nspecial; j += _vl) { \
+        for (i = 0; i < _vl; i++) \
+            x[i] = special[(j + i) % nspecial]; \
+        r = f(x); \
+        for (i = 0; i < _vl; i++) \
+            ULP_LANE(_ulps, r[i], ref(x[i]), x[i], 0, tol); \
+    } \
+    for (k = 1; k < _vl; k++) { \
+        for (i = 0; i < _vl; i++) { \
+            x[i] = (_e)ulp_arg(elo, ehi, sgn); \
+            m[i] = i < k ? -1 : 0; \
+        } \
+        r = fm(x, m); \
+        for (i = 0; i < k; i++) \
+            ULP_LANE(_ulps, r[i], ref(x[i]), x[i], 0, tol); \
+    } \
+    ULP_REPORT; \
+}
+
+/* Two vector arguments; special holds pairs. */
+#define ULP_CHECK2(_s, _e, _vr, _vi, _vl, _ulps) \
+static int \
+ulp_check2##_s(_vr (*f)(_vr, _vr), _vr (*fm)(_vr, _vr, _vi), \
+               const char *name, long double (*ref)(long double, long double), \
+               int elo, int ehi, int sgn, int yelo, int yehi, int ysgn, \
+               const _e *special, int nspecial, double tol) \
+{ \
+    _vr x, y, r; \
+    _vi m; \
+    int i, j, k, nfails = 0; \
+    double worst = 0.0; \
+\
+    for (j = 0; j < NSWEEP; j++) { \
+        for (i = 0; i < _vl; i++) { \
+            x[i] = (_e)ulp_arg(elo, ehi, sgn); \
+            y[i] = (_e)ulp_arg(yelo, yehi, ysgn); \
+        } \
+        r = f(x, y); \
+        for (i = 0; i < _vl; i++) \
+            ULP_LANE(_ulps, r[i], ref(x[i], y[i]), x[i], y[i], tol); \
+    } \
+    for (j = 0; j < nspecial; j += _vl) { \
+        for (i = 0; i < _vl; i++) { \
+            x[i] = special[2 * ((j + i) % nspecial)]; \
+            y[i] = special[2 * ((j + i) % nspecial) + 1]; \
+        } \
+        r = f(x, y); \
+        for (i = 0; i < _vl; i++) \
+            ULP_LANE(_ulps, r[i], ref(x[i], y[i]), x[i], y[i], tol); \
+    } \
+    for (k = 1; k < _vl; k++) { \
+        for (i = 0; i < _vl; i++) { \
+            x[i] = (_e)ulp_arg(elo, ehi, sgn); \
+            y[i] = (_e)ulp_arg(yelo, yehi, ysgn); \
+            m[i] = i < k ? -1 : 0; \
+        } \
+        r = fm(x, y, m); \
+        for (i = 0; i < k; i++) \
+            ULP_LANE(_ulps, r[i], ref(x[i], y[i]), x[i], y[i], tol); \
+    } \
+    ULP_REPORT; \
+}
+
+ULP_CHECK1(s, float, VRS_T, VIS_T, VLS, ULPS_S)
+ULP_CHECK1(d, double, VRD_T, VID_T, VLD, ULPS_D)
+ULP_CHECK2(s, float, VRS_T, VIS_T, VLS, ULPS_S)
+ULP_CHECK2(d, double, VRD_T, VID_T, VLD, ULPS_D)
+
+#define NELEM(_a) ((int)(sizeof(_a) / sizeof(*(_a))))
+
+/*
+ * Check the entry points of function _name in accuracy class _frp (f, r
+ * or p), unmasked and masked, with the given argument ranges, special
+ * arguments and tolerance in ulps.
+ */
+#define ULP1S(_frp, _name, _ref, _elo, _ehi, _sgn, _sp, _tol) \
+    ulp_check1s(CONCAT6(__,_frp,s_,_name,_,VLS), \
+                CONCAT7(__,_frp,s_,_name,_,VLS,m), \
+                STRINGIFY(CONCAT6(__,_frp,s_,_name,_,VLS)), \
+                _ref, _elo, _ehi, _sgn, _sp, NELEM(_sp), _tol)
+#define ULP1D(_frp, _name, _ref, _elo, _ehi, _sgn, _sp, _tol) \
+    ulp_check1d(CONCAT6(__,_frp,d_,_name,_,VLD), \
+                CONCAT7(__,_frp,d_,_name,_,VLD,m), \
+                STRINGIFY(CONCAT6(__,_frp,d_,_name,_,VLD)), \
+                _ref, _elo, _ehi, _sgn, _sp, NELEM(_sp), _tol)
+#define ULP2S(_frp, _name, _ref, _elo, _ehi, _sgn, _yelo, _yehi, _ysgn, \
+              _sp, _tol) \
+    ulp_check2s(CONCAT6(__,_frp,s_,_name,_,VLS), \
+                CONCAT7(__,_frp,s_,_name,_,VLS,m), \
+                STRINGIFY(CONCAT6(__,_frp,s_,_name,_,VLS)), \
+                _ref, _elo, _ehi, _sgn, _yelo, _yehi, _ysgn, \
+                _sp, NELEM(_sp) / 2, _tol)
+#define ULP2D(_frp, _name, _ref, _elo, _ehi, _sgn, _yelo, _yehi, _ysgn, \
+              _sp, _tol) \
+    ulp_check2d(CONCAT6(__,_frp,d_,_name,_,VLD), \
+                CONCAT7(__,_frp,d_,_name,_,VLD,m), \
+                STRINGIFY(CONCAT6(__,_frp,d_,_name,_,VLD)), \
+                _ref, _elo, _ehi, _sgn, _yelo, _yehi, _ysgn, \
+                _sp, NELEM(_sp) / 2, _tol)
+
+#if MAX_VREG_SIZE >= 128 && defined(__x86_64__) && !defined(_WIN32)
+/*
+ * The vector sincos entries return sin(x) in the first vector register and
+ * cos(x) in the second, which C cannot name.  ulp_sincos_call(f, &c, x)
+ * and ulp_sincos_callm(f, &c, x, m) call the unmasked and masked entry f
+ * and store the second result in c.
+ */
+#if MAX_VREG_SIZE == 512
+#define ULP_VREG1 "%zmm1"
+#elif MAX_VREG_SIZE == 256
+#define ULP_VREG1 "%ymm1"
+#else
+#define ULP_VREG1 "%xmm1"
+#endif
+
+extern VRS_T ulp_sincos_call(VRS_T (*)(VRS_T), VRS_T *, VRS_T);
+extern VRS_T ulp_sincos_callm(VRS_T (*)(VRS_T, VIS_T), VRS_T *, VRS_T, VIS_T);
+
+asm(".text\n"
+    ".globl ulp_sincos_call\n"
+    ".globl ulp_sincos_callm\n"
+    "ulp_sincos_call:\n"
+    "ulp_sincos_callm:\n"
+    "\tpushq\t%rbx\n"
+    "\tmovq\t%rsi, %rbx\n"
+    "\tcall\t*%rdi\n"
+    "\tvmovups\t" ULP_VREG1 ", (%rbx)\n"
+    "\tpopq\t%rbx\n"
+    "\tret\n");
+
+/*
+ * Single precision sincos: both results of every lane within tol ulps of
+ * sinl and cosl, over the sweep, the special arguments and partial masks.
+ */
+static int
+ulp_sincos_s(VRS_T (*f)(VRS_T), VRS_T (*fm)(VRS_T, VIS_T), const char *name,
+             int elo, int ehi, const float *special, int nspecial, double tol)
+{
+    VRS_T x, s, c;
+    VIS_T m;
+    int i, j, k, nfails = 0;
+    double worst = 0.0;
+
+    for (j = 0; j < NSWEEP + nspecial; j += j < NSWEEP ? 1 : VLS) {
+        for (i = 0; i < VLS; i++)
+            x[i] = j < NSWEEP ? (float)ulp_arg(elo, ehi, 1) :
+                   special[(j - NSWEEP + i) % nspecial];
+        s = ulp_sincos_call(f, &c, x);
+        for (i = 0; i < VLS; i++) {
+            ULP_LANE(ULPS_S, s[i], sinl(x[i]), x[i], 0, tol);
+            ULP_LANE(ULPS_S, c[i], cosl(x[i]), x[i], 1, tol);
+        }
+    }
+    for (k = 1; k < VLS; k++) {
+        for (i = 0; i < VLS; i++) {
+            x[i] = (float)ulp_arg(elo, ehi, 1);
+            m[i] = i < k ? -1 : 0;
+        }
+        s = ulp_sincos_callm(fm, &c, x, m);
+        for (i = 0; i < k; i++) {
+            ULP_LANE(ULPS_S, s[i], sinl(x[i]), x[i], 0, tol);
+            ULP_LANE(ULPS_S, c[i], cosl(x[i]), x[i], 1, tol);
+        }
+    }
+    ULP_REPORT;
+}
+
+#define ULPSINCOSS(_frp, _elo, _ehi, _sp, _tol) \
+    ulp_sincos_s(CONCAT6(__,_frp,s_,sincos,_,VLS), \
+                 CONCAT7(__,_frp,s_,sincos,_,VLS,m), \
+                 STRINGIFY(CONCAT6(__,_frp,s_,sincos,_,VLS)), \
+                 _elo, _ehi, _sp, NELEM(_sp), _tol)
+#endif
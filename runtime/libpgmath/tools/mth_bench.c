@@ -0,0 +1,924 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Throughput and accuracy sweep over the libpgmath dispatch tables.
+ *
+ * For every architecture the CPU can run, every function, every scalar/
+ * vector type and every fast/relaxed/precise class, the entry in the
+ * dispatch table (MTH_DISPATCH_TBL) is run over an array of inputs drawn
+ * from a range representative of the function and the result is written
+ * as one CSV line:
+ *
+ *   arch,func,sv,frp,kernel,ns_per_elem,tsc_per_elem,max_ulp,worst_x,
+ *   worst_y,generic,generic_ns_per_elem,speedup
+ *
+ * max_ulp is the largest error, in units in the last place of the result
+ * precision, against a long double reference; complex results use the
+ * normwise error |r - ref| / ulp(max(|Re ref|, |Im ref|)).  worst_x and
+ * worst_y are the inputs, in %a format, where it occurred.  The long
+ * double reference carries 11 extra bits over double, so errors below
+ * about 0.01 ulp are not resolved for double precision entries.
+ *
+ * For vector entries the generic lane loop (__g<p>_<func>_<vl>_<frp>,
+ * which calls the scalar entry point once per lane) is timed as well when
+ * the library exports one, so that the speedup column shows whether a
+ * native kernel is worth its table slot.
+ *
+ * The dispatch tables are set up once, by a constructor, from MTH_I_ARCH.
+ * Each architecture is therefore measured in a child process that
+ * re-executes this program with MTH_I_ARCH set.
+ *
+ * sincos is not covered: its vector entries return their second result
+ * in a register C cannot name.
+ *
+ * Usage: pgmath-bench [-a arch[,arch...]] [-f func[,func...]] [-p frp]
+ *                     [-n elements] [-t ms] [-r lo:hi] [-o file]
+ */
+
+#define _GNU_SOURCE
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include <time.h>
+#include <dlfcn.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#if defined(TARGET_X8664)
+#include <x86intrin.h>
+#endif
+#if defined(TARGET_OSX_X8664)
+#include <limits.h>
+#include <mach-o/dyld.h>
+#endif
+#include "mth_intrinsics.h"
+#include "mth_tbldefs.h"
+
+extern void __math_dispatch_error();
+
+#if defined(TARGET_X8664)
+#define TARGET_256 __attribute__((target("avx2,fma")))
+#define TARGET_512 __attribute__((target("avx512f")))
+#else
+#define TARGET_256
+#define TARGET_512
+#endif
+
+/*
+ * How the arguments of an entry are passed.
+ */
+typedef enum {
+  ARGS_X,       // f(x)
+  ARGS_XY,      // f(x, y)
+  ARGS_XI1,     // f(x, int32_t)
+  ARGS_XK1,     // f(x, int64_t)
+  ARGS_XI,      // f(x, I4(:))
+  ARGS_XK,      // f(x, I8(:)), R4 vectors take the I8 lanes in two halves
+} args_e;
+
+typedef struct {
+  args_e args;
+  bool masked;
+} bench_t;
+
+/*
+ * Input ranges.  logscale draws the magnitude uniformly in log space, with
+ * a random sign when lo is negative (the magnitude then ranges over
+ * [min(|hi|,1e-3), |hi|]).  Complex inputs draw both parts from
+ * [-crange, crange], or y parts from [-cyrange, cyrange].
+ */
+typedef struct {
+  double lo, hi;
+  bool logscale;
+} range_t;
+
+typedef struct {
+  func_e func;
+  const char *name;
+  range_t xs, xd;       // x, single and double precision
+  range_t y;            // y, or the integer exponent
+  double crange;
+  double cyrange;
+} func_info_t;
+
+static const func_info_t funcs[] = {
+  {func_acos,  "acos",  {-1, 1}, {-1, 1},           {0}, 2, 0},
+  {func_asin,  "asin",  {-1, 1}, {-1, 1},           {0}, 2, 0},
+  {func_atan,  "atan",  {-1e3, 1e3, true}, {-1e3, 1e3, true}, {0}, 2, 0},
+  {func_atan2, "atan2", {-10, 10}, {-10, 10},       {-10, 10}, 0, 0},
+  {func_cos,   "cos",   {-100, 100}, {-100, 100},   {0}, 10, 0},
+  {func_sin,   "sin",   {-100, 100}, {-100, 100},   {0}, 10, 0},
+  {func_tan,   "tan",   {-1.5, 1.5}, {-1.5, 1.5},   {0}, 10, 0},
+  {func_cosh,  "cosh",  {-80, 80}, {-700, 700},     {0}, 10, 0},
+  {func_sinh,  "sinh",  {-80, 80}, {-700, 700},     {0}, 10, 0},
+  {func_tanh,  "tanh",  {-10, 10}, {-20, 20},       {0}, 10, 0},
+  {func_exp,   "exp",   {-87, 88}, {-708, 709},     {0}, 20, 0},
+  {func_log,   "log",   {1e-30, 1e30, true}, {1e-300, 1e300, true}, {0}, 100, 0},
+  {func_log10, "log10", {1e-30, 1e30, true}, {1e-300, 1e300, true}, {0}, 100, 0},
+  {func_pow,   "pow",   {1e-2, 1e2, true}, {1e-2, 1e2, true}, {-15, 15}, 10, 3},
+  {func_powi1, "powi1", {0.5, 2}, {0.5, 2},         {-16, 16}, 2, 0},
+  {func_powi,  "powi",  {0.5, 2}, {0.5, 2},         {-16, 16}, 2, 0},
+  {func_powk1, "powk1", {0.5, 2}, {0.5, 2},         {-16, 16}, 2, 0},
+  {func_powk,  "powk",  {0.5, 2}, {0.5, 2},         {-16, 16}, 2, 0},
+  {func_div,   "div",   {-1e3, 1e3, true}, {-1e3, 1e3, true},
+                        {-1e3, 1e3, true}, 1e3, 1e3},
+  {func_sqrt,  "sqrt",  {1e-30, 1e30, true}, {1e-300, 1e300, true}, {0}, 100, 0},
+  {func_mod,   "mod",   {-1e3, 1e3}, {-1e3, 1e3},   {0.1, 100}, 0, 0},
+};
+
+static const char *frp_name[] = {"f", "r", "p"};
+
+/*
+ * Scalar/vector types.  vl is the number of real or complex elements per
+ * call, gvl the vector length part of the generic lane loop name.
+ */
+typedef enum { P_S, P_D, P_C, P_Z } prec_e;
+
+typedef void (*runner_t)(const bench_t *, p2f, int64_t,
+                         const void *, const void *, const int64_t *, void *);
+
+typedef struct {
+  sv_e sv;
+  const char *name;
+  prec_e prec;
+  int vl;
+  const char *gvl;
+  bool masked;
+  runner_t run;
+} sv_info_t;
+
+/*
+ * Runners.  Each one streams n elements through fp, vl elements per call.
+ * The vector runners carry the instruction set of their width so that the
+ * arguments are passed in vector registers, as the kernels expect.
+ */
+
+#define SCALAR_RUNNER(_name, _ft) \
+static void \
+_name(const bench_t *b, p2f fp, int64_t n, const void *_x, const void *_y, \
+      const int64_t *k, void *_r) \
+{ \
+  const _ft *x = _x; \
+  const _ft *y = _y; \
+  _ft *r = _r; \
+  int64_t i; \
+\
+  for (i = 0; i < n; i++) { \
+    switch (b->args) { \
+    case ARGS_X: \
+      r[i] = ((_ft (*)(_ft))fp)(x[i]); \
+      break; \
+    case ARGS_XY: \
+      r[i] = ((_ft (*)(_ft, _ft))fp)(x[i], y[i]); \
+      break; \
+    case ARGS_XI1: \
+    case ARGS_XI: \
+      r[i] = ((_ft (*)(_ft, int32_t))fp)(x[i], (int32_t)k[i]); \
+      break; \
+    case ARGS_XK1: \
+    case ARGS_XK: \
+      r[i] = ((_ft (*)(_ft, int64_t))fp)(x[i], k[i]); \
+      break; \
+    } \
+  } \
+}
+
+#define VREAL_RUNNER(_name, _target, _ft, _vl, _vt, _mt, _it, _kt, _nk) \
+static _target void \
+_name(const bench_t *b, p2f fp, int64_t n, const void *_x, const void *_y, \
+      const int64_t *k, void *_r) \
+{ \
+  const _ft *x = _x; \
+  const _ft *y = _y; \
+  _ft *r = _r; \
+  _vt vx, vy, vr; \
+  _mt vm; \
+  _it vi; \
+  _kt vk[2]; \
+  int64_t i; \
+  int l; \
+\
+  memset(&vi, 0, sizeof(vi)); \
+  memset(vk, 0, sizeof(vk)); \
+  for (l = 0; l < _vl; l++) \
+    vm[l] = -1; \
+  for (i = 0; i + _vl <= n; i += _vl) { \
+    memcpy(&vx, &x[i], sizeof(vx)); \
+    switch (b->args) { \
+    case ARGS_X: \
+      vr = b->masked ? ((_vt (*)(_vt, _mt))fp)(vx, vm) \
+                     : ((_vt (*)(_vt))fp)(vx); \
+      break; \
+    case ARGS_XY: \
+      memcpy(&vy, &y[i], sizeof(vy)); \
+      vr = b->masked ? ((_vt (*)(_vt, _vt, _mt))fp)(vx, vy, vm) \
+                     : ((_vt (*)(_vt, _vt))fp)(vx, vy); \
+      break; \
+    case ARGS_XI1: \
+      vr = b->masked ? ((_vt (*)(_vt, int32_t, _mt))fp)(vx, k[i], vm) \
+                     : ((_vt (*)(_vt, int32_t))fp)(vx, k[i]); \
+      break; \
+    case ARGS_XK1: \
+      vr = b->masked ? ((_vt (*)(_vt, int64_t, _mt))fp)(vx, k[i], vm) \
+                     : ((_vt (*)(_vt, int64_t))fp)(vx, k[i]); \
+      break; \
+    case ARGS_XI: \
+      for (l = 0; l < _vl; l++) \
+        vi[l] = k[i + l]; \
+      vr = b->masked ? ((_vt (*)(_vt, _it, _mt))fp)(vx, vi, vm) \
+                     : ((_vt (*)(_vt, _it))fp)(vx, vi); \
+      break; \
+    case ARGS_XK: \
+    default: \
+      memcpy(vk, &k[i], _vl * sizeof(int64_t)); \
+      if (_nk == 1) { \
+        vr = b->masked ? ((_vt (*)(_vt, _kt, _mt))fp)(vx, vk[0], vm) \
+                       : ((_vt (*)(_vt, _kt))fp)(vx, vk[0]); \
+      } else { \
+        vr = b->masked \
+             ? ((_vt (*)(_vt, _kt, _kt, _mt))fp)(vx, vk[0], vk[1], vm) \
+             : ((_vt (*)(_vt, _kt, _kt))fp)(vx, vk[0], vk[1]); \
+      } \
+      break; \
+    } \
+    memcpy(&r[i], &vr, sizeof(vr)); \
+  } \
+}
+
+/*
+ * Complex runners; x, y and r hold (re, im) pairs.  Complex powi/powk
+ * only take a scalar exponent.
+ */
+#define CMPLX_RUNNER(_name, _target, _ft, _vl, _vt) \
+static _target void \
+_name(const bench_t *b, p2f fp, int64_t n, const void *_x, const void *_y, \
+      const int64_t *k, void *_r) \
+{ \
+  const _ft *x = _x; \
+  const _ft *y = _y; \
+  _ft *r = _r; \
+  _vt vx, vy, vr; \
+  int64_t i; \
+\
+  for (i = 0; i + _vl <= n; i += _vl) { \
+    memcpy(&vx, &x[2*i], sizeof(vx)); \
+    switch (b->args) { \
+    case ARGS_XY: \
+      memcpy(&vy, &y[2*i], sizeof(vy)); \
+      vr = ((_vt (*)(_vt, _vt))fp)(vx, vy); \
+      break; \
+    case ARGS_XI1: \
+    case ARGS_XI: \
+      vr = ((_vt (*)(_vt, int32_t))fp)(vx, k[i]); \
+      break; \
+    case ARGS_XK1: \
+    case ARGS_XK: \
+      vr = ((_vt (*)(_vt, int64_t))fp)(vx, k[i]); \
+      break; \
+    default: \
+      vr = ((_vt (*)(_vt))fp)(vx); \
+      break; \
+    } \
+    memcpy(&r[2*i], &vr, sizeof(vr)); \
+  } \
+}
+
+SCALAR_RUNNER(run_ss, float)
+SCALAR_RUNNER(run_ds, double)
+CMPLX_RUNNER(run_cs, , float, 1, float complex)
+CMPLX_RUNNER(run_zs, , double, 1, double complex)
+CMPLX_RUNNER(run_cv1, , float, 1, vcs1_t)
+VREAL_RUNNER(run_sv4, , float, 4, vrs4_t, vis4_t, vis4_t, vid2_t, 2)
+VREAL_RUNNER(run_dv2, , double, 2, vrd2_t, vid2_t, vis4_t, vid2_t, 1)
+CMPLX_RUNNER(run_cv2, , float, 2, vcs2_t)
+CMPLX_RUNNER(run_zv1, , double, 1, vcd1_t)
+#if defined(TARGET_X8664)
+VREAL_RUNNER(run_sv8, TARGET_256, float, 8, vrs8_t, vis8_t, vis8_t, vid4_t, 2)
+VREAL_RUNNER(run_dv4, TARGET_256, double, 4, vrd4_t, vid4_t, vis4_t, vid4_t, 1)
+CMPLX_RUNNER(run_cv4, TARGET_256, float, 4, vcs4_t)
+CMPLX_RUNNER(run_zv2, TARGET_256, double, 2, vcd2_t)
+VREAL_RUNNER(run_sv16, TARGET_512, float, 16, vrs16_t, vis16_t, vis16_t, vid8_t, 2)
+VREAL_RUNNER(run_dv8, TARGET_512, double, 8, vrd8_t, vid8_t, vis8_t, vid8_t, 1)
+CMPLX_RUNNER(run_cv8, TARGET_512, float, 8, vcs8_t)
+CMPLX_RUNNER(run_zv4, TARGET_512, double, 4, vcd4_t)
+#endif
+
+static const sv_info_t svs[] = {
+  {sv_ss,    "ss",    P_S, 1,  NULL, false, run_ss},
+  {sv_ds,    "ds",    P_D, 1,  NULL, false, run_ds},
+  {sv_cs,    "cs",    P_C, 1,  NULL, false, run_cs},
+  {sv_zs,    "zs",    P_Z, 1,  NULL, false, run_zs},
+  {sv_cv1,   "cv1",   P_C, 1,  NULL, false, run_cv1},
+  {sv_sv4,   "sv4",   P_S, 4,  "4",  false, run_sv4},
+  {sv_dv2,   "dv2",   P_D, 2,  "2",  false, run_dv2},
+  {sv_cv2,   "cv2",   P_C, 2,  "2",  false, run_cv2},
+  {sv_zv1,   "zv1",   P_Z, 1,  "1v", false, run_zv1},
+  {sv_sv4m,  "sv4m",  P_S, 4,  NULL, true,  run_sv4},
+  {sv_dv2m,  "dv2m",  P_D, 2,  NULL, true,  run_dv2},
+#if defined(TARGET_X8664)
+  {sv_sv8,   "sv8",   P_S, 8,  "8",  false, run_sv8},
+  {sv_dv4,   "dv4",   P_D, 4,  "4",  false, run_dv4},
+  {sv_cv4,   "cv4",   P_C, 4,  "4",  false, run_cv4},
+  {sv_zv2,   "zv2",   P_Z, 2,  "2",  false, run_zv2},
+  {sv_sv16,  "sv16",  P_S, 16, "16", false, run_sv16},
+  {sv_dv8,   "dv8",   P_D, 8,  "8",  false, run_dv8},
+  {sv_cv8,   "cv8",   P_C, 8,  "8",  false, run_cv8},
+  {sv_zv4,   "zv4",   P_Z, 4,  "4",  false, run_zv4},
+  {sv_sv8m,  "sv8m",  P_S, 8,  NULL, true,  run_sv8},
+  {sv_dv4m,  "dv4m",  P_D, 4,  NULL, true,  run_dv4},
+  {sv_sv16m, "sv16m", P_S, 16, NULL, true,  run_sv16},
+  {sv_dv8m,  "dv8m",  P_D, 8,  NULL, true,  run_dv8},
+#endif
+};
+
+/*
+ * Architectures, and whether this CPU can run them.
+ */
+typedef struct {
+  const char *name;
+  bool (*supported)(void);
+} arch_info_t;
+
+#if defined(TARGET_X8664)
+static bool cpu_any(void)       { return true; }
+static bool cpu_sse4(void)      { return __builtin_cpu_supports("sse4.1"); }
+static bool cpu_avx(void)       { return __builtin_cpu_supports("avx"); }
+static bool cpu_avxfma4(void)   { return __builtin_cpu_supports("fma4"); }
+static bool cpu_avx2(void)
+{
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+static bool cpu_avx512knl(void) { return __builtin_cpu_supports("avx512f"); }
+static bool cpu_avx512(void)
+{
+  return __builtin_cpu_supports("avx512f") &&
+         __builtin_cpu_supports("avx512vl") &&
+         __builtin_cpu_supports("avx512bw") &&
+         __builtin_cpu_supports("avx512dq");
+}
+
+static const arch_info_t archs[] = {
+  {"em64t", cpu_any},
+  {"sse4", cpu_sse4},
+  {"avx", cpu_avx},
+  {"avxfma4", cpu_avxfma4},
+  {"avx2", cpu_avx2},
+  {"avx512knl", cpu_avx512knl},
+  {"avx512", cpu_avx512},
+};
+#else
+/* Only the architecture the library selects by itself. */
+static const arch_info_t archs[] = {};
+#endif
+
+#define NARCHS (sizeof(archs) / sizeof(*archs))
+#define NFUNCS (sizeof(funcs) / sizeof(*funcs))
+#define NSVS   (sizeof(svs) / sizeof(*svs))
+
+/*
+ * Options.
+ */
+static int64_t nelem = 4096;
+static double min_ms = 5.0;
+static bool have_range = false;
+static double range_lo, range_hi;
+static const char *only_funcs = NULL;
+static const char *only_archs = NULL;
+static const char *only_frps = "frp";
+
+static bool
+in_list(const char *list, const char *name)
+{
+  size_t len = strlen(name);
+  const char *p = list;
+
+  if (list == NULL)
+    return true;
+  while ((p = strstr(p, name)) != NULL) {
+    if ((p == list || p[-1] == ',') && (p[len] == ',' || p[len] == '\0'))
+      return true;
+    p += len;
+  }
+  return false;
+}
+
+/*
+ * Input generation.
+ */
+
+static uint64_t rng_state = 0x9e3779b97f4a7c15ULL;
+
+static double
+rng_unit(void)
+{
+  /* xorshift64* */
+  rng_state ^= rng_state >> 12;
+  rng_state ^= rng_state << 25;
+  rng_state ^= rng_state >> 27;
+  return (double)((rng_state * 0x2545f4914f6cdd1dULL) >> 11) * 0x1.0p-53;
+}
+
+static double
+draw(range_t r)
+{
+  if (have_range) {
+    r.lo = range_lo;
+    r.hi = range_hi;
+    r.logscale = false;
+  }
+  if (r.logscale) {
+    double hi = fabs(r.hi);
+    double lo = r.lo > 0 ? r.lo : fmin(hi, 1e-3);
+    double m = exp(log(lo) + (log(hi) - log(lo)) * rng_unit());
+    return r.lo < 0 && rng_unit() < 0.5 ? -m : m;
+  }
+  return r.lo + (r.hi - r.lo) * rng_unit();
+}
+
+/*
+ * Reference results.
+ */
+
+static long double
+ref_real(func_e f, long double x, long double y, int64_t k)
+{
+  switch (f) {
+  case func_acos:  return acosl(x);
+  case func_asin:  return asinl(x);
+  case func_atan:  return atanl(x);
+  case func_atan2: return atan2l(x, y);
+  case func_cos:   return cosl(x);
+  case func_sin:   return sinl(x);
+  case func_tan:   return tanl(x);
+  case func_cosh:  return coshl(x);
+  case func_sinh:  return sinhl(x);
+  case func_tanh:  return tanhl(x);
+  case func_exp:   return expl(x);
+  case func_log:   return logl(x);
+  case func_log10: return log10l(x);
+  case func_pow:   return powl(x, y);
+  case func_powi1:
+  case func_powi:
+  case func_powk1:
+  case func_powk:  return powl(x, (long double)k);
+  case func_div:   return x / y;
+  case func_sqrt:  return sqrtl(x);
+  case func_mod:   return fmodl(x, y);
+  default:         return NAN;
+  }
+}
+
+static long double complex
+ref_cmplx(func_e f, long double complex x, long double complex y, int64_t k)
+{
+  switch (f) {
+  case func_acos:  return cacosl(x);
+  case func_asin:  return casinl(x);
+  case func_atan:  return catanl(x);
+  case func_cos:   return ccosl(x);
+  case func_sin:   return csinl(x);
+  case func_tan:   return ctanl(x);
+  case func_cosh:  return ccoshl(x);
+  case func_sinh:  return csinhl(x);
+  case func_tanh:  return ctanhl(x);
+  case func_exp:   return cexpl(x);
+  case func_log:   return clogl(x);
+  case func_log10: return clogl(x) / logl(10.0L);
+  case func_pow:   return cpowl(x, y);
+  case func_powi1:
+  case func_powi:
+  case func_powk1:
+  case func_powk:  return cpowl(x, (long double)k);
+  case func_div:   return x / y;
+  case func_sqrt:  return csqrtl(x);
+  default:         return NAN;
+  }
+}
+
+/*
+ * Error of got against ref in units of the last place of a p bit
+ * precision with minimum normal exponent emin.
+ */
+static double
+ulp_error(long double ref, long double got, long double scale, int p, int emin)
+{
+  int e;
+
+  if (isnan(ref) || isnan(got))
+    return isnan(ref) && isnan(got) ? 0.0 : INFINITY;
+  if (isinf(ref) || isinf(got))
+    return ref == got ? 0.0 : INFINITY;
+  if (scale == 0.0L)
+    return got == 0.0L ? 0.0 : INFINITY;
+  (void)frexpl(scale, &e);
+  if (e < emin)
+    e = emin;
+  return (double)(fabsl(got - ref) / ldexpl(1.0L, e - p));
+}
+
+/*
+ * Timing.
+ */
+
+static double
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint64_t
+ticks(void)
+{
+#if defined(TARGET_X8664)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+/*
+ * Best per element time over repeated passes, lasting at least min_ms.
+ */
+static void
+time_entry(const sv_info_t *s, const bench_t *b, p2f fp, const void *x,
+           const void *y, const int64_t *k, void *r,
+           double *ns, double *tsc)
+{
+  double t0, t1, tstart, best_ns = INFINITY;
+  uint64_t c0, c1, best_tsc = UINT64_MAX;
+
+  s->run(b, fp, nelem, x, y, k, r);     /* warm up */
+  tstart = now_ns();
+  do {
+    t0 = now_ns();
+    c0 = ticks();
+    s->run(b, fp, nelem, x, y, k, r);
+    c1 = ticks();
+    t1 = now_ns();
+    if (t1 - t0 < best_ns)
+      best_ns = t1 - t0;
+    if (c1 - c0 < best_tsc)
+      best_tsc = c1 - c0;
+  } while (t1 - tstart < min_ms * 1e6);
+
+  *ns = best_ns / nelem;
+  *tsc = (double)best_tsc / nelem;
+}
+
+static const char *
+entry_name(p2f fp)
+{
+  Dl_info info;
+
+  if (dladdr((void *)fp, &info) != 0 && info.dli_sname != NULL)
+    return info.dli_sname;
+  return "?";
+}
+
+static args_e
+entry_args(func_e f, bool cmplx, bool scalar)
+{
+  switch (f) {
+  case func_atan2:
+  case func_pow:
+  case func_div:
+  case func_mod:
+    return ARGS_XY;
+  case func_powi1:
+    return ARGS_XI1;
+  case func_powk1:
+    return ARGS_XK1;
+  case func_powi:
+    return cmplx || scalar ? ARGS_XI1 : ARGS_XI;
+  case func_powk:
+    return cmplx || scalar ? ARGS_XK1 : ARGS_XK;
+  default:
+    return ARGS_X;
+  }
+}
+
+/*
+ * Measure every entry of the architecture the library selected.
+ */
+/*
+ * The library may bind its own references to the error entry locally, so
+ * compare names as well as addresses.
+ */
+static bool
+is_error_entry(p2f fp)
+{
+  return fp == NULL || fp == (p2f)__math_dispatch_error ||
+         strcmp(entry_name(fp), "__math_dispatch_error") == 0;
+}
+
+static void
+bench_arch(const char *arch)
+{
+  size_t fi, si;
+  int frp;
+  int64_t i;
+  int64_t n2 = 2 * nelem;
+  float *xs = malloc(n2 * sizeof(float));
+  float *ys = malloc(n2 * sizeof(float));
+  float *rs = malloc(n2 * sizeof(float));
+  double *xd = malloc(n2 * sizeof(double));
+  double *yd = malloc(n2 * sizeof(double));
+  double *rd = malloc(n2 * sizeof(double));
+  int64_t *k = malloc(nelem * sizeof(int64_t));
+
+  /* Sets up the tables if the library has no constructor to do so. */
+  (void)__math_dispatch_vreg_size();
+
+  for (fi = 0; fi < NFUNCS; fi++) {
+    const func_info_t *fn = &funcs[fi];
+
+    if (!in_list(only_funcs, fn->name))
+      continue;
+    for (si = 0; si < NSVS; si++) {
+      const sv_info_t *s = &svs[si];
+      bool cmplx = s->prec == P_C || s->prec == P_Z;
+      bool dbl = s->prec == P_D || s->prec == P_Z;
+      bench_t b = {entry_args(fn->func, cmplx, s->vl == 1 && !cmplx),
+                   s->masked};
+      int p = dbl ? 53 : 24;
+      int emin = dbl ? -1021 : -125;
+
+      if (cmplx && (fn->crange == 0 || s->masked))
+        continue;
+
+      /* Inputs, the same for each class and architecture. */
+      rng_state = 0x9e3779b97f4a7c15ULL + fi;
+      for (i = 0; i < (cmplx ? n2 : nelem); i++) {
+        if (cmplx) {
+          range_t cr = {-fn->crange, fn->crange};
+          range_t cy = {-fn->cyrange, fn->cyrange};
+          xd[i] = draw(cr);
+          yd[i] = fn->cyrange != 0 ? draw(cy) : draw(cr);
+        } else {
+          xd[i] = draw(dbl ? fn->xd : fn->xs);
+          yd[i] = draw(fn->y);
+        }
+        xs[i] = xd[i];
+        ys[i] = yd[i];
+        if (!dbl) {
+          xd[i] = xs[i];
+          yd[i] = ys[i];
+        }
+      }
+      for (i = 0; i < nelem; i++)
+        k[i] = (int64_t)lrint(draw(fn->y));
+      /* The vector exponent entries differ from powi1/powk1 in that. */
+      if (b.args == ARGS_XI1 || b.args == ARGS_XK1)
+        for (i = 1; i < nelem; i++)
+          k[i] = k[i - (i % s->vl)];
+
+      for (frp = frp_f; frp <= frp_p; frp++) {
+        p2f fp = MTH_DISPATCH_TBL[fn->func][s->sv][frp];
+        p2f gp = NULL;
+        double ns, tsc, gns = 0, gtsc, worst = 0;
+        int64_t iw = 0;
+        char gname[64] = "";
+
+        if (!strchr(only_frps, frp_name[frp][0]))
+          continue;
+        /*
+         * The generic masked wrappers call the unmasked entry of the same
+         * width, which an architecture without such vectors leaves empty.
+         */
+        if (is_error_entry(fp) ||
+            (s->masked &&
+             is_error_entry(MTH_DISPATCH_TBL[fn->func]
+                                            [s->sv - (sv_sv4m - sv_sv4)][frp])))
+          continue;
+
+        /* Accuracy */
+        s->run(&b, fp, nelem, dbl ? (void *)xd : (void *)xs,
+               dbl ? (void *)yd : (void *)ys, k, dbl ? (void *)rd : (void *)rs);
+        for (i = 0; i < nelem; i++) {
+          double e;
+
+          if (cmplx) {
+            long double complex x = CMPLXL(xd[2*i], xd[2*i+1]);
+            long double complex y = CMPLXL(yd[2*i], yd[2*i+1]);
+            long double complex ref = ref_cmplx(fn->func, x, y, k[i]);
+            long double complex got = dbl ? CMPLXL(rd[2*i], rd[2*i+1])
+                                          : CMPLXL(rs[2*i], rs[2*i+1]);
+            long double sc = fmaxl(fabsl(creall(ref)), fabsl(cimagl(ref)));
+
+            if (isfinite(creall(ref)) && isfinite(cimagl(ref)) &&
+                isfinite(creall(got)) && isfinite(cimagl(got)))
+              e = ulp_error(0, cabsl(got - ref), sc, p, emin);
+            else
+              e = fmax(ulp_error(creall(ref), creall(got), sc, p, emin),
+                       ulp_error(cimagl(ref), cimagl(got), sc, p, emin));
+          } else {
+            long double ref = ref_real(fn->func, xd[i], yd[i], k[i]);
+            long double got = dbl ? rd[i] : rs[i];
+
+            e = ulp_error(ref, got, fabsl(ref), p, emin);
+          }
+          if (e > worst) {
+            worst = e;
+            iw = i;
+          }
+        }
+
+        /* Throughput */
+        time_entry(s, &b, fp, dbl ? (void *)xd : (void *)xs,
+                   dbl ? (void *)yd : (void *)ys, k,
+                   dbl ? (void *)rd : (void *)rs, &ns, &tsc);
+
+        if (s->gvl != NULL) {
+          snprintf(gname, sizeof(gname), "__g%c_%s_%s_%s",
+                   "sdcz"[s->prec], fn->name, s->gvl, frp_name[frp]);
+          gp = (p2f)dlsym(RTLD_DEFAULT, gname);
+          if (gp != NULL && gp != fp) {
+            time_entry(s, &b, gp, dbl ? (void *)xd : (void *)xs,
+                       dbl ? (void *)yd : (void *)ys, k,
+                       dbl ? (void *)rd : (void *)rs, &gns, &gtsc);
+          } else {
+            gname[0] = '\0';
+          }
+        }
+
+        printf("%s,%s,%s,%s,%s,%.3f,%.2f,%.3g,", arch, fn->name, s->name,
+               frp_name[frp], entry_name(fp), ns, tsc, worst);
+        if (cmplx && b.args == ARGS_XY)
+          printf("%a%+ai,%a%+ai,", xd[2*iw], xd[2*iw+1],
+                 yd[2*iw], yd[2*iw+1]);
+        else if (cmplx && b.args != ARGS_X)
+          printf("%a%+ai,%" PRId64 ",", xd[2*iw], xd[2*iw+1], k[iw]);
+        else if (cmplx)
+          printf("%a%+ai,,", xd[2*iw], xd[2*iw+1]);
+        else if (b.args == ARGS_XY)
+          printf("%a,%a,", xd[iw], yd[iw]);
+        else if (b.args != ARGS_X)
+          printf("%a,%" PRId64 ",", xd[iw], k[iw]);
+        else
+          printf("%a,,", xd[iw]);
+        if (gname[0] != '\0')
+          printf("%s,%.3f,%.2f\n", gname, gns, gns / ns);
+        else
+          printf(",,\n");
+        fflush(stdout);
+      }
+    }
+  }
+
+  free(xs);
+  free(ys);
+  free(rs);
+  free(xd);
+  free(yd);
+  free(rd);
+  free(k);
+}
+
+/*
+ * The executable to re-run for each architecture.  argv[0] is only a
+ * fallback, since it need not be a path; execvp then searches PATH.
+ */
+static const char *
+self_path(const char *argv0)
+{
+#if defined(__linux__)
+  return "/proc/self/exe";
+#elif defined(TARGET_OSX_X8664)
+  static char path[PATH_MAX];
+  uint32_t size = sizeof(path);
+
+  if (_NSGetExecutablePath(path, &size) == 0)
+    return path;
+  return argv0;
+#else
+  return argv0;
+#endif
+}
+
+static void
+usage(const char *prog)
+{
+  fprintf(stderr,
+    "Usage: %s [-a arch[,arch...]] [-f func[,func...]] [-p frp]\n"
+    "       [-n elements] [-t ms] [-r lo:hi] [-o file]\n"
+    "  -a  architectures to measure (default: all this CPU supports)\n"
+    "  -f  functions to measure (default: all)\n"
+    "  -p  any of the letters f, r and p (default: frp)\n"
+    "  -n  elements per pass, a multiple of 16 (default: 4096)\n"
+    "  -t  minimum time per entry in milliseconds (default: 5)\n"
+    "  -r  draw every real input uniformly from [lo, hi]\n"
+    "  -o  write the CSV to file instead of stdout\n", prog);
+  exit(1);
+}
+
+int
+main(int argc, char *argv[])
+{
+  const char *child_arch = NULL;
+  const char *output = NULL;
+  size_t a;
+  int c;
+
+  while ((c = getopt(argc, argv, "a:f:p:n:t:r:o:A:")) != -1) {
+    switch (c) {
+    case 'a':
+      only_archs = optarg;
+      break;
+    case 'f':
+      only_funcs = optarg;
+      break;
+    case 'p':
+      only_frps = optarg;
+      break;
+    case 'n':
+      nelem = strtoll(optarg, NULL, 0);
+      if (nelem <= 0 || nelem % 16 != 0)
+        usage(argv[0]);
+      break;
+    case 't':
+      min_ms = strtod(optarg, NULL);
+      break;
+    case 'r':
+      if (sscanf(optarg, "%lf:%lf", &range_lo, &range_hi) != 2)
+        usage(argv[0]);
+      have_range = true;
+      break;
+    case 'o':
+      output = optarg;
+      break;
+    case 'A':                   /* internal: child for one architecture */
+      child_arch = optarg;
+      break;
+    default:
+      usage(argv[0]);
+    }
+  }
+
+  /* Children write to the stdout they inherit. */
+  if (child_arch != NULL) {
+    bench_arch(child_arch);
+    return 0;
+  }
+  if (output != NULL && freopen(output, "w", stdout) == NULL) {
+    perror(output);
+    exit(1);
+  }
+
+  printf("arch,func,sv,frp,kernel,ns_per_elem,tsc_per_elem,max_ulp,"
+         "worst_x,worst_y,generic,generic_ns_per_elem,speedup\n");
+  fflush(stdout);
+
+  if (NARCHS == 0) {
+    bench_arch("default");
+    return 0;
+  }
+
+  for (a = 0; a < NARCHS; a++) {
+    char **cargv;
+    pid_t pid;
+    int status;
+    int i;
+
+    if (!in_list(only_archs, archs[a].name) || !archs[a].supported())
+      continue;
+    pid = fork();
+    if (pid == 0) {
+      cargv = calloc(argc + 3, sizeof(char *));
+      for (i = 0; i < argc; i++)
+        cargv[i] = argv[i];
+      cargv[argc] = "-A";
+      cargv[argc + 1] = (char *)archs[a].name;
+      setenv("MTH_I_ARCH", archs[a].name, 1);
+      execvp(self_path(argv[0]), cargv);
+      perror("execvp");
+      _exit(1);
+    }
+    if (pid < 0 || waitpid(pid, &status, 0) < 0 ||
+        !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+      fprintf(stderr, "%s: measuring %s failed\n", argv[0], archs[a].name);
+  }
+
+  return 0;
+}
@@ -175,8 +175,13 @@ function func_pow_decl_scalar(name, frp, sd, ik)
         "_" frp "(" vts[sd] " x, " sts[ik] " iy)"
   print "{"
   print "  " sts[sd] " (*fptr)(" sts[sd] ", " sts[ik] ");"
+  #
+  # The scalar complex entries are in the func_pow<IK> rows of the
+  # dispatch table, not func_pow<IK>1.
+  #
   print "  fptr = (" sts[sd] "(*)(" sts[sd] ", " sts[ik]\
-        "))MTH_DISPATCH_TBL[func_" name ik "1][sv_" sd "s][frp_" frp "];"
+        "))MTH_DISPATCH_TBL[func_" name ik (sd == "z" ? "" : "1") \
+        "][sv_" sd "s][frp_" frp "];"
 
   print "  return __ZGV" VL_XYZ "N" vls[sd] "v"\
         "__mth_i_" vs[sd] vs[ik"1"] "(x, iy, fptr);"
@@ -0,0 +1,34 @@
+# Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+########## Make rule for test fcache01  ########
+
+fcache01: run
+	
+build:  $(SRC)/fcache01.f90 $(SRC)/fcache01c.c
+	-$(RM) fcache01.$(EXESUFFIX) core *.d *.mod FOR*.DAT FTN* ftn* fort.*
+	@echo ------------------------------------ building test $@
+	-$(CC) -c $(CFLAGS) $(SRC)/check.c -o check.$(OBJX)
+	-$(CC) -c $(CFLAGS) $(SRC)/fcache01c.c -o fcache01c.$(OBJX)
+	-$(FC) -c $(FFLAGS) $(SRC)/fcache01.f90 -o fcache01.$(OBJX)
+	-$(FC) $(FFLAGS) $(LDFLAGS) fcache01.$(OBJX) fcache01c.$(OBJX) check.$(OBJX) $(LIBS) -o fcache01.$(EXESUFFIX)
+
+run:
+	@echo ------------------------------------ executing test fcache01
+	fcache01.$(EXESUFFIX)
+
+verify: ;
+
+fcache01.run: run
+
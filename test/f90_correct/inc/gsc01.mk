@@ -0,0 +1,34 @@
+# Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+########## Make rule for test gsc01  ########
+
+gsc01: run
+	
+build:  $(SRC)/gsc01.f90 $(SRC)/gsc01c.c
+	-$(RM) gsc01.$(EXESUFFIX) core *.d *.mod FOR*.DAT FTN* ftn* fort.*
+	@echo ------------------------------------ building test $@
+	-$(CC) -c $(CFLAGS) $(SRC)/check.c -o check.$(OBJX)
+	-$(CC) -c $(CFLAGS) $(SRC)/gsc01c.c -o gsc01c.$(OBJX)
+	-$(FC) -c $(FFLAGS) $(SRC)/gsc01.f90 -o gsc01.$(OBJX)
+	-$(FC) $(FFLAGS) $(LDFLAGS) gsc01.$(OBJX) gsc01c.$(OBJX) check.$(OBJX) $(LIBS) -o gsc01.$(EXESUFFIX)
+
+run:
+	@echo ------------------------------------ executing test gsc01
+	gsc01.$(EXESUFFIX)
+
+verify: ;
+
+gsc01.run: run
+
@@ -0,0 +1,34 @@
+# Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+########## Make rule for test pmem01  ########
+
+pmem01: run
+	
+build:  $(SRC)/pmem01.f90 $(SRC)/pmem01c.c
+	-$(RM) pmem01.$(EXESUFFIX) core *.d *.mod FOR*.DAT FTN* ftn* fort.*
+	@echo ------------------------------------ building test $@
+	-$(CC) -c $(CFLAGS) $(SRC)/check.c -o check.$(OBJX)
+	-$(CC) -c $(CFLAGS) $(SRC)/pmem01c.c -o pmem01c.$(OBJX)
+	-$(FC) -c $(FFLAGS) $(SRC)/pmem01.f90 -o pmem01.$(OBJX)
+	-$(FC) $(FFLAGS) $(LDFLAGS) pmem01.$(OBJX) pmem01c.$(OBJX) check.$(OBJX) $(LIBS) -o pmem01.$(EXESUFFIX)
+
+run:
+	@echo ------------------------------------ executing test pmem01
+	F90_COPY_PAR_MINSZ=65536 F90_COPY_NT_MINSZ=262144 pmem01.$(EXESUFFIX)
+
+verify: ;
+
+pmem01.run: run
+
@@ -0,0 +1,184 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for CSHIFT of whole contiguous arrays, which are shifted a plane
+!* or a line at a time: every DIM of rank 3 arrays of 1, 2, 4, 8 and 16
+!* byte elements and of CHARACTER, scalar shifts that are negative, zero
+!* and at least the extent, shift arrays that vary along the plane or are
+!* all equal, a strided section and a result section, and an array large
+!* enough to be split among threads.  DIM is a variable, so that every
+!* CSHIFT calls the runtime.  The elements are their own indices and each
+!* result is the number of CSHIFTs that differ from a loop.
+
+program p
+  parameter(NbrTests=16)
+  parameter(N1=5, N2=4, N3=3, NS=9)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+  integer :: sv(NS)
+  data sv /-7, -5, -1, 0, 1, 2, 4, 5, 9/
+
+  integer :: idx(N1, N2, N3), ref(N1, N2, N3), sfull(N1, N2, N3)
+  integer :: r4(N1 + 2, N2, N3)
+  character*3 :: cidx(N1, N2, N3)
+  integer, allocatable :: sh(:, :), big(:, :, :), bref(:, :, :), &
+                          bfull(:, :, :), bsh(:, :)
+  real*8, allocatable :: b8(:, :, :)
+  integer :: d, m, i
+
+  results = 0
+  idx = reshape((/(i, i = 1, N1 * N2 * N3)/), shape(idx))
+  cidx = chars(idx)
+
+  do d = 1, 3
+    ! scalar shifts
+    do m = 1, NS
+      sfull = sv(m)
+      call cref(idx, d, sfull, ref)
+      call bad(1, any(cshift(int(idx, 1), sv(m), d) .ne. ref))
+      call bad(2, any(cshift(int(idx, 2), sv(m), d) .ne. ref))
+      call bad(3, any(cshift(idx, sv(m), d) .ne. ref))
+      call bad(4, any(cshift(dble(idx), sv(m), d) .ne. ref))
+      call bad(5, any(cshift(dcmplx(idx, -idx), sv(m), d) .ne. &
+                      dcmplx(ref, -ref)))
+      call bad(6, any(cshift(cidx, sv(m), d) .ne. chars(ref)))
+    enddo
+
+    ! shift arrays, varying along the plane
+    call plane(d, shape(idx), sh)
+    do i = 1, size(sh, 2)
+      sh(:, i) = sv(mod((/(m, m = 1, size(sh, 1))/) + 3 * i, NS) + 1)
+    enddo
+    call expand(d, sh, sfull)
+    call cref(idx, d, sfull, ref)
+    call bad(7, any(cshift(int(idx, 1), sh, d) .ne. ref))
+    call bad(8, any(cshift(int(idx, 2), sh, d) .ne. ref))
+    call bad(9, any(cshift(idx, sh, d) .ne. ref))
+    call bad(10, any(cshift(dble(idx), sh, d) .ne. ref))
+    call bad(11, any(cshift(dcmplx(idx, -idx), sh, d) .ne. &
+                     dcmplx(ref, -ref)))
+    call bad(12, any(cshift(cidx, sh, d) .ne. chars(ref)))
+
+    ! shift arrays with one value
+    do m = 1, NS
+      sh = sv(m)
+      sfull = sv(m)
+      call cref(idx, d, sfull, ref)
+      call bad(13, any(cshift(idx, sh, d) .ne. ref) .or. &
+                   any(cshift(cidx, sh, d) .ne. chars(ref)))
+    enddo
+
+    ! a strided source and a result section
+    do m = 1, NS
+      sfull(1:3, :, :) = sv(m)
+      call cref(idx(1:N1:2, :, :), d, sfull(1:3, :, :), ref(1:3, :, :))
+      call bad(14, any(cshift(idx(1:N1:2, :, :), sv(m), d) .ne. &
+                       ref(1:3, :, :)))
+      sfull = sv(m)
+      call cref(idx, d, sfull, ref)
+      r4 = 0
+      r4(2:N1 + 1, :, :) = cshift(idx, sv(m), d)
+      call bad(15, any(r4(2:N1 + 1, :, :) .ne. ref) .or. &
+                   any(r4(1, :, :) .ne. 0) .or. any(r4(N1 + 2, :, :) .ne. 0))
+    enddo
+  enddo
+
+  ! more than a megabyte, scalar and array shifts
+  allocate(big(64, 64, 40), bref(64, 64, 40), bfull(64, 64, 40))
+  big = reshape((/(i, i = 1, size(big))/), shape(big))
+  allocate(b8(64, 64, 40))
+  b8 = big
+  do d = 1, 3
+    bfull = -67
+    call cref(big, d, bfull, bref)
+    call bad(16, any(cshift(b8, -67, d) .ne. bref))
+    call plane(d, shape(big), bsh)
+    do i = 1, size(bsh, 2)
+      bsh(:, i) = (/(m, m = 1, size(bsh, 1))/) - i
+    enddo
+    call expand(d, bsh, bfull)
+    call cref(big, d, bfull, bref)
+    call bad(16, any(cshift(b8, bsh, d) .ne. bref))
+  enddo
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  subroutine bad(t, b)
+    integer :: t
+    logical :: b
+    if (b) results(t) = results(t) + 1
+  end subroutine
+
+  ! The element of a CHARACTER test array with index n.
+  elemental character*3 function chars(n)
+    integer, intent(in) :: n
+    chars = achar(64 + modulo(n, 26)) // achar(97 + modulo(n / 26, 26)) // &
+            achar(48 + modulo(n, 10))
+  end function
+
+  ! Allocate s with the shape of an array of shape e without dimension d.
+  subroutine plane(d, e, s)
+    integer :: d, e(3)
+    integer, allocatable :: s(:, :)
+    if (allocated(s)) deallocate(s)
+    select case (d)
+    case (1)
+      allocate(s(e(2), e(3)))
+    case (2)
+      allocate(s(e(1), e(3)))
+    case default
+      allocate(s(e(1), e(2)))
+    end select
+  end subroutine
+
+  ! Copy the value of s for each line along dimension d to its elements.
+  subroutine expand(d, s, f)
+    integer :: d, s(:, :), f(:, :, :)
+    integer :: i, j, k
+    do k = 1, size(f, 3)
+      do j = 1, size(f, 2)
+        do i = 1, size(f, 1)
+          select case (d)
+          case (1)
+            f(i, j, k) = s(j, k)
+          case (2)
+            f(i, j, k) = s(i, k)
+          case default
+            f(i, j, k) = s(i, j)
+          end select
+        enddo
+      enddo
+    enddo
+  end subroutine
+
+  ! r = a circularly shifted along d by f, elementwise.
+  subroutine cref(a, d, f, r)
+    integer :: a(:, :, :), d, f(:, :, :), r(:, :, :)
+    integer :: i, j, k, q(3)
+    do k = 1, size(a, 3)
+      do j = 1, size(a, 2)
+        do i = 1, size(a, 1)
+          q = (/i, j, k/)
+          q(d) = modulo(q(d) - 1 + f(i, j, k), size(a, d)) + 1
+          r(i, j, k) = a(q(1), q(2), q(3))
+        enddo
+      enddo
+    enddo
+  end subroutine
+
+end program
@@ -0,0 +1,267 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for the DOT_PRODUCT kernels: every kind, lengths around the
+!* unroll factor, contiguous, strided, mixed and reversed vectors, and
+!* the conjugated first argument of complex DOT_PRODUCT.  The elements
+!* are small integers, so every summation order gives the same result.
+!* Each result is the number of lengths for which DOT_PRODUCT differs
+!* from a loop.
+
+program p
+  parameter(NbrTests=9)
+  parameter(NLEN=17)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  integer :: lens(NLEN)
+  data lens /0, 1, 2, 3, 4, 5, 7, 8, 9, 11, 12, 15, 16, 17, 33, 255, &
+             1000/
+  data expect /NbrTests*0/
+  integer :: k
+
+  results = 0
+  do k = 1, NLEN
+    results(1) = results(1) + test_i1(lens(k))
+    results(2) = results(2) + test_i2(lens(k))
+    results(3) = results(3) + test_i4(lens(k))
+    results(4) = results(4) + test_i8(lens(k))
+    results(5) = results(5) + test_r4(lens(k))
+    results(6) = results(6) + test_r8(lens(k))
+    results(7) = results(7) + test_c8(lens(k))
+    results(8) = results(8) + test_c16(lens(k))
+    results(9) = results(9) + test_l4(lens(k))
+  enddo
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  ! Element i of a test array, in [-8, 8].
+  integer function v(i)
+    integer :: i
+    v = mod(i * 7, 17) - 8
+  end function
+
+  integer function test_i1(n)
+    integer :: n, i
+    integer*1 :: a(2*n), b(2*n), r, rs, rm, rr
+    do i = 1, 2*n
+      a(i) = mod(i, 3) - 1
+      b(i) = mod(i, 5) - 2
+    enddo
+    r = 0
+    rs = 0
+    rm = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i) * b(i)
+      rs = rs + a(2*i - 1) * b(2*i)
+      rm = rm + a(i) * b(2*i)
+      rr = rr + a(n + 1 - i) * b(i)
+    enddo
+    test_i1 = 0
+    if (dot_product(a(1:n), b(1:n)) .ne. r .or. &
+        dot_product(a(1:2*n:2), b(2:2*n:2)) .ne. rs .or. &
+        dot_product(a(1:n), b(2:2*n:2)) .ne. rm .or. &
+        dot_product(a(n:1:-1), b(1:n)) .ne. rr) test_i1 = 1
+  end function
+
+  integer function test_i2(n)
+    integer :: n, i
+    integer*2 :: a(2*n), b(2*n), r, rs, rm, rr
+    do i = 1, 2*n
+      a(i) = v(i)
+      b(i) = v(i + 3)
+    enddo
+    r = 0
+    rs = 0
+    rm = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i) * b(i)
+      rs = rs + a(2*i - 1) * b(2*i)
+      rm = rm + a(i) * b(2*i)
+      rr = rr + a(n + 1 - i) * b(i)
+    enddo
+    test_i2 = 0
+    if (dot_product(a(1:n), b(1:n)) .ne. r .or. &
+        dot_product(a(1:2*n:2), b(2:2*n:2)) .ne. rs .or. &
+        dot_product(a(1:n), b(2:2*n:2)) .ne. rm .or. &
+        dot_product(a(n:1:-1), b(1:n)) .ne. rr) test_i2 = 1
+  end function
+
+  integer function test_i4(n)
+    integer :: n, i
+    integer*4 :: a(2*n), b(2*n), r, rs, rm, rr
+    do i = 1, 2*n
+      a(i) = v(i) * 1000
+      b(i) = v(i + 3)
+    enddo
+    r = 0
+    rs = 0
+    rm = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i) * b(i)
+      rs = rs + a(2*i - 1) * b(2*i)
+      rm = rm + a(i) * b(2*i)
+      rr = rr + a(n + 1 - i) * b(i)
+    enddo
+    test_i4 = 0
+    if (dot_product(a(1:n), b(1:n)) .ne. r .or. &
+        dot_product(a(1:2*n:2), b(2:2*n:2)) .ne. rs .or. &
+        dot_product(a(1:n), b(2:2*n:2)) .ne. rm .or. &
+        dot_product(a(n:1:-1), b(1:n)) .ne. rr) test_i4 = 1
+  end function
+
+  integer function test_i8(n)
+    integer :: n, i
+    integer*8 :: a(2*n), b(2*n), r, rs, rm, rr
+    do i = 1, 2*n
+      a(i) = v(i) * 1000000000_8
+      b(i) = v(i + 3)
+    enddo
+    r = 0
+    rs = 0
+    rm = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i) * b(i)
+      rs = rs + a(2*i - 1) * b(2*i)
+      rm = rm + a(i) * b(2*i)
+      rr = rr + a(n + 1 - i) * b(i)
+    enddo
+    test_i8 = 0
+    if (dot_product(a(1:n), b(1:n)) .ne. r .or. &
+        dot_product(a(1:2*n:2), b(2:2*n:2)) .ne. rs .or. &
+        dot_product(a(1:n), b(2:2*n:2)) .ne. rm .or. &
+        dot_product(a(n:1:-1), b(1:n)) .ne. rr) test_i8 = 1
+  end function
+
+  integer function test_r4(n)
+    integer :: n, i
+    real*4 :: a(2*n), b(2*n), r, rs, rm, rr
+    do i = 1, 2*n
+      a(i) = v(i)
+      b(i) = v(i + 3)
+    enddo
+    r = 0
+    rs = 0
+    rm = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i) * b(i)
+      rs = rs + a(2*i - 1) * b(2*i)
+      rm = rm + a(i) * b(2*i)
+      rr = rr + a(n + 1 - i) * b(i)
+    enddo
+    test_r4 = 0
+    if (dot_product(a(1:n), b(1:n)) .ne. r .or. &
+        dot_product(a(1:2*n:2), b(2:2*n:2)) .ne. rs .or. &
+        dot_product(a(1:n), b(2:2*n:2)) .ne. rm .or. &
+        dot_product(a(n:1:-1), b(1:n)) .ne. rr) test_r4 = 1
+  end function
+
+  integer function test_r8(n)
+    integer :: n, i
+    real*8 :: a(2*n), b(2*n), r, rs, rm, rr
+    do i = 1, 2*n
+      a(i) = v(i) * 0.5d0
+      b(i) = v(i + 3)
+    enddo
+    r = 0
+    rs = 0
+    rm = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i) * b(i)
+      rs = rs + a(2*i - 1) * b(2*i)
+      rm = rm + a(i) * b(2*i)
+      rr = rr + a(n + 1 - i) * b(i)
+    enddo
+    test_r8 = 0
+    if (dot_product(a(1:n), b(1:n)) .ne. r .or. &
+        dot_product(a(1:2*n:2), b(2:2*n:2)) .ne. rs .or. &
+        dot_product(a(1:n), b(2:2*n:2)) .ne. rm .or. &
+        dot_product(a(n:1:-1), b(1:n)) .ne. rr) test_r8 = 1
+  end function
+
+  integer function test_c8(n)
+    integer :: n, i
+    complex*8 :: a(2*n), b(2*n), r, rs, rm, rr
+    do i = 1, 2*n
+      a(i) = cmplx(v(i), v(i + 5))
+      b(i) = cmplx(v(i + 3), v(i + 1))
+    enddo
+    r = 0
+    rs = 0
+    rm = 0
+    rr = 0
+    do i = 1, n
+      r = r + conjg(a(i)) * b(i)
+      rs = rs + conjg(a(2*i - 1)) * b(2*i)
+      rm = rm + conjg(a(i)) * b(2*i)
+      rr = rr + conjg(a(n + 1 - i)) * b(i)
+    enddo
+    test_c8 = 0
+    if (dot_product(a(1:n), b(1:n)) .ne. r .or. &
+        dot_product(a(1:2*n:2), b(2:2*n:2)) .ne. rs .or. &
+        dot_product(a(1:n), b(2:2*n:2)) .ne. rm .or. &
+        dot_product(a(n:1:-1), b(1:n)) .ne. rr) test_c8 = 1
+  end function
+
+  integer function test_c16(n)
+    integer :: n, i
+    complex*16 :: a(2*n), b(2*n), r, rs, rm, rr
+    do i = 1, 2*n
+      a(i) = dcmplx(v(i), v(i + 5))
+      b(i) = dcmplx(v(i + 3), v(i + 1))
+    enddo
+    r = 0
+    rs = 0
+    rm = 0
+    rr = 0
+    do i = 1, n
+      r = r + conjg(a(i)) * b(i)
+      rs = rs + conjg(a(2*i - 1)) * b(2*i)
+      rm = rm + conjg(a(i)) * b(2*i)
+      rr = rr + conjg(a(n + 1 - i)) * b(i)
+    enddo
+    test_c16 = 0
+    if (dot_product(a(1:n), b(1:n)) .ne. r .or. &
+        dot_product(a(1:2*n:2), b(2:2*n:2)) .ne. rs .or. &
+        dot_product(a(1:n), b(2:2*n:2)) .ne. rm .or. &
+        dot_product(a(n:1:-1), b(1:n)) .ne. rr) test_c16 = 1
+  end function
+
+  integer function test_l4(n)
+    integer :: n, i
+    logical*4 :: a(2*n), b(2*n), r, rs
+    do i = 1, 2*n
+      a(i) = mod(i, 3) .eq. 0
+      b(i) = i .eq. n
+    enddo
+    r = .false.
+    rs = .false.
+    do i = 1, n
+      r = r .or. (a(i) .and. b(i))
+      rs = rs .or. (a(2*i - 1) .and. b(2*i))
+    enddo
+    test_l4 = 0
+    if (dot_product(a(1:n), b(1:n)) .neqv. r .or. &
+        dot_product(a(1:2*n:2), b(2:2*n:2)) .neqv. rs) test_l4 = 1
+  end function
+
+end program
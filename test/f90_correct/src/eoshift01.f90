@@ -0,0 +1,225 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for EOSHIFT of whole contiguous arrays, which are shifted and
+!* filled a plane or a line at a time: every DIM of rank 3 arrays of 1,
+!* 2, 4, 8 and 16 byte elements and of CHARACTER, scalar shifts that are
+!* negative, zero and at least the extent, shift arrays, the default,
+!* scalar and array boundaries, CHARACTER boundaries, a strided section
+!* and a result section, and an array large enough to be split among
+!* threads.  DIM is a variable, so that every EOSHIFT calls the runtime.
+!* The elements are their own indices and each result is the number of
+!* EOSHIFTs that differ from a loop.
+
+program p
+  parameter(NbrTests=22)
+  parameter(N1=5, N2=4, N3=3, NS=9)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+  integer :: sv(NS)
+  data sv /-7, -5, -1, 0, 1, 2, 4, 5, 9/
+
+  integer :: idx(N1, N2, N3), ref(N1, N2, N3), sfull(N1, N2, N3)
+  integer :: bfull(N1, N2, N3), r4(N1 + 2, N2, N3)
+  character*3 :: cidx(N1, N2, N3)
+  integer, allocatable :: sh(:, :), bnd(:, :), big(:, :, :), &
+                          bref(:, :, :), bigf(:, :, :), bsh(:, :)
+  character*3, allocatable :: cbnd(:, :)
+  real*8, allocatable :: b8(:, :, :)
+  integer :: d, m, i
+
+  results = 0
+  idx = reshape((/(i, i = 1, N1 * N2 * N3)/), shape(idx))
+  cidx = chars(idx)
+
+  do d = 1, 3
+    call plane(d, shape(idx), sh)
+    call plane(d, shape(idx), bnd)
+    allocate(cbnd(size(bnd, 1), size(bnd, 2)))
+    do i = 1, size(sh, 2)
+      sh(:, i) = sv(mod((/(m, m = 1, size(sh, 1))/) + 3 * i, NS) + 1)
+      bnd(:, i) = -(/(m, m = 1, size(bnd, 1))/) - 10 * i
+    enddo
+    cbnd = chars(bnd)
+
+    ! scalar shifts with the default and a scalar boundary
+    do m = 1, NS
+      sfull = sv(m)
+      call eref(idx, d, sfull, ref)
+      call bad(1, any(eoshift(int(idx, 1), sv(m), dim=d) .ne. ref))
+      call bad(2, any(eoshift(int(idx, 2), sv(m), dim=d) .ne. ref))
+      call bad(3, any(eoshift(idx, sv(m), dim=d) .ne. ref))
+      call bad(4, any(eoshift(dble(idx), sv(m), dim=d) .ne. ref))
+      call bad(5, any(eoshift(dcmplx(idx, -idx), sv(m), dim=d) .ne. &
+                      dcmplx(ref, -ref)))
+      call bad(6, any(eoshift(cidx, sv(m), dim=d) .ne. &
+                      merge('   ', chars(ref), ref .eq. 0)))
+      bfull = -99
+      call bad(7, any(eoshift(int(idx, 1), sv(m), -99_1, d) .ne. &
+                      fill(ref, bfull)))
+      call bad(8, any(eoshift(int(idx, 2), sv(m), -99_2, d) .ne. &
+                      fill(ref, bfull)))
+      call bad(9, any(eoshift(idx, sv(m), -99, d) .ne. fill(ref, bfull)))
+      call bad(10, any(eoshift(dble(idx), sv(m), -99d0, d) .ne. &
+                       fill(ref, bfull)))
+      call bad(11, any(eoshift(dcmplx(idx, -idx), sv(m), (-99d0, 99d0), d) &
+                       .ne. dcmplx(fill(ref, bfull), -fill(ref, bfull))))
+      call bad(12, any(eoshift(cidx, sv(m), 'xyz', d) .ne. &
+                       merge('xyz', chars(ref), ref .eq. 0)))
+
+      ! a scalar shift with an array boundary
+      call expand(d, bnd, bfull)
+      call bad(13, any(eoshift(idx, sv(m), bnd, d) .ne. fill(ref, bfull)) &
+               .or. any(eoshift(cidx, sv(m), cbnd, d) .ne. &
+                        merge(chars(bfull), chars(ref), ref .eq. 0)))
+    enddo
+
+    ! shift arrays with an array boundary
+    call expand(d, sh, sfull)
+    call expand(d, bnd, bfull)
+    call eref(idx, d, sfull, ref)
+    call bad(14, any(eoshift(int(idx, 1), sh, int(bnd, 1), d) .ne. &
+                     fill(ref, bfull)))
+    call bad(15, any(eoshift(int(idx, 2), sh, int(bnd, 2), d) .ne. &
+                     fill(ref, bfull)))
+    call bad(16, any(eoshift(idx, sh, bnd, d) .ne. fill(ref, bfull)))
+    call bad(17, any(eoshift(dble(idx), sh, dble(bnd), d) .ne. &
+                     fill(ref, bfull)))
+    call bad(18, any(eoshift(dcmplx(idx, -idx), sh, dcmplx(bnd, -bnd), d) &
+                     .ne. dcmplx(fill(ref, bfull), -fill(ref, bfull))))
+    call bad(19, any(eoshift(cidx, sh, cbnd, d) .ne. &
+                     merge(chars(bfull), chars(ref), ref .eq. 0)))
+
+    ! shift arrays with the default and a scalar boundary
+    bfull = -99
+    call bad(20, any(eoshift(idx, sh, dim=d) .ne. ref) .or. &
+                 any(eoshift(idx, sh, -99, d) .ne. fill(ref, bfull)) .or. &
+                 any(eoshift(cidx, sh, dim=d) .ne. &
+                     merge('   ', chars(ref), ref .eq. 0)) .or. &
+                 any(eoshift(cidx, sh, 'xyz', d) .ne. &
+                     merge('xyz', chars(ref), ref .eq. 0)))
+
+    ! a strided source and a result section
+    do m = 1, NS
+      sfull(1:3, :, :) = sv(m)
+      call eref(idx(1:N1:2, :, :), d, sfull(1:3, :, :), ref(1:3, :, :))
+      call bad(21, any(eoshift(idx(1:N1:2, :, :), sv(m), dim=d) .ne. &
+                       ref(1:3, :, :)))
+      sfull = sv(m)
+      call eref(idx, d, sfull, ref)
+      r4 = 0
+      r4(2:N1 + 1, :, :) = eoshift(idx, sv(m), dim=d)
+      call bad(21, any(r4(2:N1 + 1, :, :) .ne. ref) .or. &
+                   any(r4(1, :, :) .ne. 0) .or. any(r4(N1 + 2, :, :) .ne. 0))
+    enddo
+    deallocate(cbnd)
+  enddo
+
+  ! more than a megabyte, scalar and array shifts
+  allocate(big(64, 64, 40), bref(64, 64, 40), bigf(64, 64, 40))
+  big = reshape((/(i, i = 1, size(big))/), shape(big))
+  allocate(b8(64, 64, 40))
+  b8 = big
+  do d = 1, 3
+    bigf = -7
+    call eref(big, d, bigf, bref)
+    call bad(22, any(eoshift(b8, -7, dim=d) .ne. bref))
+    call plane(d, shape(big), bsh)
+    do i = 1, size(bsh, 2)
+      bsh(:, i) = mod((/(m, m = 1, size(bsh, 1))/) + i, 11) - 5
+    enddo
+    call expand(d, bsh, bigf)
+    call eref(big, d, bigf, bref)
+    call bad(22, any(eoshift(b8, bsh, 0.5d0, d) .ne. &
+                     merge(0.5d0, dble(bref), bref .eq. 0)))
+  enddo
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  subroutine bad(t, b)
+    integer :: t
+    logical :: b
+    if (b) results(t) = results(t) + 1
+  end subroutine
+
+  ! The element of a CHARACTER test array with index n.
+  elemental character*3 function chars(n)
+    integer, intent(in) :: n
+    chars = achar(64 + modulo(n, 26)) // achar(97 + modulo(n / 26, 26)) // &
+            achar(48 + modulo(n, 10))
+  end function
+
+  ! r, or the boundary b where r has none of the array's elements.
+  elemental integer function fill(r, b)
+    integer, intent(in) :: r, b
+    fill = merge(b, r, r .eq. 0)
+  end function
+
+  ! Allocate s with the shape of an array of shape e without dimension d.
+  subroutine plane(d, e, s)
+    integer :: d, e(3)
+    integer, allocatable :: s(:, :)
+    if (allocated(s)) deallocate(s)
+    select case (d)
+    case (1)
+      allocate(s(e(2), e(3)))
+    case (2)
+      allocate(s(e(1), e(3)))
+    case default
+      allocate(s(e(1), e(2)))
+    end select
+  end subroutine
+
+  ! Copy the value of s for each line along dimension d to its elements.
+  subroutine expand(d, s, f)
+    integer :: d, s(:, :), f(:, :, :)
+    integer :: i, j, k
+    do k = 1, size(f, 3)
+      do j = 1, size(f, 2)
+        do i = 1, size(f, 1)
+          select case (d)
+          case (1)
+            f(i, j, k) = s(j, k)
+          case (2)
+            f(i, j, k) = s(i, k)
+          case default
+            f(i, j, k) = s(i, j)
+          end select
+        enddo
+      enddo
+    enddo
+  end subroutine
+
+  ! r = a end-off shifted along d by f, elementwise, 0 where shifted out.
+  subroutine eref(a, d, f, r)
+    integer :: a(:, :, :), d, f(:, :, :), r(:, :, :)
+    integer :: i, j, k, q(3)
+    do k = 1, size(a, 3)
+      do j = 1, size(a, 2)
+        do i = 1, size(a, 1)
+          q = (/i, j, k/)
+          q(d) = q(d) + f(i, j, k)
+          r(i, j, k) = 0
+          if (q(d) .ge. 1 .and. q(d) .le. size(a, d)) &
+            r(i, j, k) = a(q(1), q(2), q(3))
+        enddo
+      enddo
+    enddo
+  end subroutine
+
+end program
@@ -0,0 +1,102 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for the cache of formats encoded at runtime, which keeps the
+!* last 64 format texts used.  Formats held in a character variable,
+!* (I1) to (I80), are used in turns that need more entries than the
+!* cache holds: each new, again while they are all kept, the first ones
+!* again once they have been evicted, and then the ones still kept and
+!* those they evicted.  Every write is checked, and fcache01c.c reads the
+!* hit and miss counters that FORTRANOPT=io_stats reports, so each turn
+!* must hit and miss exactly as least recently used eviction does.  The
+!* odd results are the number of wrong records of a turn and the even
+!* ones the hits and misses that differ from what is expected.
+
+program p
+  parameter(NbrTests=10, NFMT=80, NKEEP=64)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+  integer(8) :: before(2), after(2)
+
+  interface
+    subroutine fcache01c(counts) bind(C)
+      integer(8) :: counts(2)
+    end subroutine
+  end interface
+
+  results = 0
+
+  ! 1, 2: every format new
+  call fcache01c(before)
+  call turn(1, NFMT, results(1))
+  call fcache01c(after)
+  results(2) = miscount(0, NFMT)
+
+  ! 3, 4: the last NKEEP formats, all kept
+  call turn(NFMT - NKEEP + 1, NFMT, results(3))
+  call fcache01c(after)
+  results(4) = miscount(NKEEP, NFMT)
+
+  ! 5, 6: the first NFMT - NKEEP, evicted by the others, which evict the
+  !       least recently used, NFMT - NKEEP + 1 to 2 * (NFMT - NKEEP)
+  call turn(1, NFMT - NKEEP, results(5))
+  call fcache01c(after)
+  results(6) = miscount(NKEEP, 2 * NFMT - NKEEP)
+
+  ! 7, 8: the formats after those, still kept
+  call turn(2 * (NFMT - NKEEP) + 1, NFMT, results(7))
+  call fcache01c(after)
+  results(8) = miscount(2 * NKEEP - (NFMT - NKEEP), 2 * NFMT - NKEEP)
+
+  ! 9, 10: the ones evicted in 5
+  call turn(NFMT - NKEEP + 1, 2 * (NFMT - NKEEP), results(9))
+  call fcache01c(after)
+  results(10) = miscount(2 * NKEEP - (NFMT - NKEEP), 3 * NFMT - 2 * NKEEP)
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  ! write with the formats (Ilo) to (Ihi) and count wrong records
+  subroutine turn(lo, hi, nbad)
+    integer :: lo, hi, nbad
+    character(len=16) :: fmt
+    character(len=NFMT + 8) :: line
+    integer :: w
+
+    ! built without i/o, which could encode formats of its own
+    do w = lo, hi
+      if (w .lt. 10) then
+        fmt = '(i' // achar(48 + w) // ')'
+      else
+        fmt = '(i' // achar(48 + w / 10) // achar(48 + mod(w, 10)) // ')'
+      endif
+      line = 'x'
+      write(line, fmt) 7
+      if (len_trim(line) .ne. w .or. line(w:w) .ne. '7' .or. &
+          line(1:w - 1) .ne. ' ') nbad = nbad + 1
+    enddo
+  end subroutine
+
+  ! hits and misses since the start that differ from those expected
+  integer function miscount(hits, misses)
+    integer :: hits, misses
+
+    miscount = 0
+    if (after(1) - before(1) .ne. hits) miscount = miscount + 1
+    if (after(2) - before(2) .ne. misses) miscount = miscount + 1
+  end function
+end program
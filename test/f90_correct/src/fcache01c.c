@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Reads the format cache counters of the runtime, which it reports on
+   stderr when FORTRANOPT has io_stats, by calling the report with stderr
+   sent to a temporary file.  counts[0] and counts[1] are set to the hits
+   and misses so far, or to -1 if the report cannot be read. */
+
+#include <stdio.h>
+#include <unistd.h>
+
+extern void __fortio_fmt_cache_stats(void);
+
+void
+fcache01c(long *counts)
+{
+  FILE *tmp;
+  int fd;
+
+  counts[0] = counts[1] = -1;
+  tmp = tmpfile();
+  if (tmp == NULL)
+    return;
+  fflush(stderr);
+  fd = dup(2);
+  if (fd < 0 || dup2(fileno(tmp), 2) < 0) {
+    fclose(tmp);
+    return;
+  }
+  __fortio_fmt_cache_stats();
+  fflush(stderr);
+  dup2(fd, 2);
+  close(fd);
+  rewind(tmp);
+  if (fscanf(tmp, "FIO format cache: %ld hits, %ld misses", &counts[0],
+             &counts[1]) != 2)
+    counts[0] = counts[1] = -1;
+  fclose(tmp);
+}
@@ -0,0 +1,43 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for the gather-scatter plans and the local gather-scatter
+!* kernels of the runtime.  The HPF library's MAXVAL_SCATTER and
+!* MINVAL_SCATTER are not procedures of the language, so gsc01c.c calls
+!* their runtime entries: the same call repeated, the same index array
+!* with new contents, new values through the same indices, more index
+!* vectors than plans kept, masks that change, repeated indices and runs
+!* of consecutive indices.  It also calls the gather, scatter and
+!* gather-scatter kernels with repeated offsets, where the last element
+!* stored must win, and with runs copied as blocks.  Each result is the
+!* number of calls that differ from a loop.
+
+program p
+  parameter(NbrTests=10)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+
+  interface
+    subroutine gsc01c(results) bind(C)
+      integer :: results(*)
+    end subroutine
+  end interface
+
+  results = 0
+  call gsc01c(results)
+
+  call check(results, expect, NbrTests)
+end program
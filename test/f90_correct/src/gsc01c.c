@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Calls the runtime's MAXVAL_SCATTER and MINVAL_SCATTER entries and its
+   local gather, scatter and gather-scatter kernels and compares them with
+   plain loops.  Each element of results is the number of mismatches of
+   one test.  The descriptors are opaque here; f90_template1 fills them in
+   as it does for C_F_POINTER. */
+
+#include <string.h>
+
+/* runtime type codes */
+#define T_CPLX8 9
+#define T_LOG4 19
+#define T_INT4 25
+#define T_INT8 26
+#define T_REAL4 27
+#define T_REAL8 28
+#define T_INT1 32
+
+#define NPLANS 8 /* plans the runtime keeps */
+#define NX 300   /* elements scattered */
+#define NR 40    /* elements of the result */
+#define NK 1000  /* elements moved by the kernels */
+
+typedef long desc[64];
+
+extern void f90_template1(void *dd, int *flags, int *kind, int *len, int *l1,
+                          int *u1);
+extern void fort_maxval_scatter(void *rb, void *ab, void *bb, void *mb,
+                                void *rd, void *ad, void *bd, void *md, ...);
+extern void fort_minval_scatter(void *rb, void *ab, void *bb, void *mb,
+                                void *rd, void *ad, void *bd, void *md, ...);
+extern void (*__fort_local_gather[])();
+extern void (*__fort_local_scatter[])();
+extern void (*__fort_local_gathscat[])();
+extern void local_gathscat_RUNS(int n, char *dst, int *sv, char *src, int *gv,
+                                int kind, int len, int *runs, int nruns);
+
+static unsigned int seed = 12345;
+
+static int
+rnd(int n)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 8) % n;
+}
+
+static void
+describe(void *d, int kind, int len, int n)
+{
+  int flags = 0, one = 1;
+
+  f90_template1(d, &flags, &kind, &len, &one, &n);
+}
+
+/* scalar .TRUE. mask */
+static int true4 = -1;
+static int log4 = T_LOG4;
+
+/* r = MAXVAL_SCATTER(a, b, x, mask) for integer*4, checked against a loop */
+
+static int
+maxval_i4(int *a, int *b, int *x, int *m)
+{
+  static desc rd, ad, bd, xd, md;
+  int r[NR], e[NR];
+  int i;
+
+  describe(rd, T_INT4, 4, NR);
+  describe(bd, T_INT4, 4, NR);
+  describe(ad, T_INT4, 4, NX);
+  describe(xd, T_INT4, 4, NX);
+  describe(md, T_LOG4, 4, NX);
+  memset(r, 0, sizeof(r));
+  if (m)
+    fort_maxval_scatter(r, a, b, m, rd, ad, bd, md, x, xd);
+  else
+    fort_maxval_scatter(r, a, b, &true4, rd, ad, bd, &log4, x, xd);
+  memcpy(e, b, sizeof(e));
+  for (i = 0; i < NX; ++i)
+    if ((m == NULL || m[i]) && a[i] > e[x[i] - 1])
+      e[x[i] - 1] = a[i];
+  return memcmp(r, e, sizeof(r)) != 0;
+}
+
+/* r = MINVAL_SCATTER(a, b, x) for real*8 */
+
+static int
+minval_r8(double *a, double *b, int *x)
+{
+  static desc rd, ad, bd, xd;
+  double r[NR], e[NR];
+  int i;
+
+  describe(rd, T_REAL8, 8, NR);
+  describe(bd, T_REAL8, 8, NR);
+  describe(ad, T_REAL8, 8, NX);
+  describe(xd, T_INT4, 4, NX);
+  memset(r, 0, sizeof(r));
+  fort_minval_scatter(r, a, b, &true4, rd, ad, bd, &log4, x, xd);
+  memcpy(e, b, sizeof(e));
+  for (i = 0; i < NX; ++i)
+    if (a[i] < e[x[i] - 1])
+      e[x[i] - 1] = a[i];
+  return memcmp(r, e, sizeof(r)) != 0;
+}
+
+/* MAXVAL_SCATTER of n elements of type _t, checked against a loop */
+
+#define MAXVAL(_name, _t, _k)                                                \
+  static int _name(_t *a, _t *b, int *x, int n)                              \
+  {                                                                          \
+    static desc rd, ad, bd, xd;                                              \
+    _t r[NK], e[NK];                                                         \
+    int i;                                                                   \
+                                                                             \
+    describe(rd, _k, sizeof(_t), n);                                         \
+    describe(bd, _k, sizeof(_t), n);                                         \
+    describe(ad, _k, sizeof(_t), n);                                         \
+    describe(xd, T_INT4, 4, n);                                              \
+    fort_maxval_scatter(r, a, b, &true4, rd, ad, bd, &log4, x, xd);          \
+    memcpy(e, b, n * sizeof(_t));                                            \
+    for (i = 0; i < n; ++i)                                                  \
+      if (a[i] > e[x[i] - 1])                                                \
+        e[x[i] - 1] = a[i];                                                  \
+    return memcmp(r, e, n * sizeof(_t)) != 0;                                \
+  }
+
+MAXVAL(maxval_i1, signed char, T_INT1)
+MAXVAL(maxval_i8, long long, T_INT8)
+MAXVAL(maxval_r4, float, T_REAL4)
+
+/* index vector with runs of 16 to 40 consecutive indices, in 1 .. n */
+
+static void
+runs(int *x, int n)
+{
+  int i, j, k;
+
+  for (i = 0; i < n; i = j) {
+    k = rnd(n) + 1;
+    for (j = i; j < n && j < i + 16 + rnd(25); ++j)
+      x[j] = (k + j - i - 1) % n + 1;
+    if (j < n)
+      x[j++] = rnd(n) + 1;
+  }
+}
+
+/* the local kernels for the 4 and 8 byte types: n elements, offsets with
+   repeats, where the last element stored to an offset must win */
+
+static int
+kernels(void)
+{
+  static const int kinds[] = {T_INT4, T_REAL4, T_LOG4,
+                              T_INT8, T_REAL8, T_CPLX8};
+  static long long s8[NK], d8[NK], e8[NK];
+  static int s4[NK], d4[NK], e4[NK], sv[NK], gv[NK];
+  int i, k, n, t, bad = 0;
+
+  for (t = 0; t < 60; ++t) {
+    n = t < 50 ? t : rnd(NK);
+    for (i = 0; i < NK; ++i) {
+      s4[i] = rnd(1 << 30);
+      s8[i] = (long long)rnd(1 << 30) << 32 | rnd(1 << 30);
+      sv[i] = rnd(t & 1 ? 7 : NK);
+      gv[i] = rnd(NK);
+    }
+    for (k = 0; k < 6; ++k) {
+      if (k < 3) {
+        memset(d4, 0, sizeof(d4));
+        memset(e4, 0, sizeof(e4));
+        __fort_local_gather[kinds[k]](n, d4, s4, gv);
+        for (i = 0; i < n; ++i)
+          e4[i] = s4[gv[i]];
+        bad += memcmp(d4, e4, sizeof(d4)) != 0;
+        __fort_local_scatter[kinds[k]](n, d4, sv, s4);
+        for (i = 0; i < n; ++i)
+          e4[sv[i]] = s4[i];
+        bad += memcmp(d4, e4, sizeof(d4)) != 0;
+        __fort_local_gathscat[kinds[k]](n, d4, sv, s4, gv);
+        for (i = 0; i < n; ++i)
+          e4[sv[i]] = s4[gv[i]];
+        bad += memcmp(d4, e4, sizeof(d4)) != 0;
+      } else {
+        memset(d8, 0, sizeof(d8));
+        memset(e8, 0, sizeof(e8));
+        __fort_local_gather[kinds[k]](n, d8, s8, gv);
+        for (i = 0; i < n; ++i)
+          e8[i] = s8[gv[i]];
+        bad += memcmp(d8, e8, sizeof(d8)) != 0;
+        __fort_local_scatter[kinds[k]](n, d8, sv, s8);
+        for (i = 0; i < n; ++i)
+          e8[sv[i]] = s8[i];
+        bad += memcmp(d8, e8, sizeof(d8)) != 0;
+        __fort_local_gathscat[kinds[k]](n, d8, sv, s8, gv);
+        for (i = 0; i < n; ++i)
+          e8[sv[i]] = s8[gv[i]];
+        bad += memcmp(d8, e8, sizeof(d8)) != 0;
+      }
+    }
+  }
+  return bad;
+}
+
+/* block copies of the runs of at least 16 offset pairs that both go up
+   by one, with the elements between them moved one at a time */
+
+static int
+run_copies(void)
+{
+  static double s[NK], d[NK], e[NK];
+  static int sv[NK], gv[NK], rs[NK];
+  int i, j, n, nruns, t, bad = 0;
+
+  for (t = 0; t < 40; ++t) {
+    for (i = 0; i < NK; ++i)
+      s[i] = rnd(1 << 20);
+    runs(sv, NK / 2);
+    runs(gv, NK / 2);
+    for (i = 0; i < NK / 2; ++i)
+      sv[i] = sv[i] - 1 + (t & 1) * NK / 2;
+    if (t & 2) /* one run through the source */
+      for (i = 1; i < NK / 2; ++i)
+        gv[i] = gv[i - 1] + 1;
+    n = NK / 2;
+    nruns = 0;
+    for (i = 0; i < n; i = j) {
+      for (j = i + 1;
+           j < n && sv[j] == sv[j - 1] + 1 && gv[j] == gv[j - 1] + 1; ++j)
+        ;
+      if (j - i >= 16) {
+        rs[2 * nruns] = i;
+        rs[2 * nruns + 1] = j - i;
+        ++nruns;
+      }
+    }
+    memset(d, 0, sizeof(d));
+    memset(e, 0, sizeof(e));
+    local_gathscat_RUNS(n, (char *)d, sv, (char *)s, gv, T_REAL8, 8, rs,
+                        nruns);
+    for (i = 0; i < n; ++i)
+      e[sv[i]] = s[gv[i]];
+    bad += memcmp(d, e, sizeof(d)) != 0;
+  }
+  return bad;
+}
+
+void
+gsc01c(int *results)
+{
+  static int a[NX], b[NR], x[NX], m[NX], xs[12][NX];
+  static double a8[NX], b8[NR];
+  static signed char a1[NK], b1[NK];
+  static long long ai8[NK], bi8[NK];
+  static float a4[NK], b4[NK];
+  static int xr[NK];
+  int i, j, t;
+
+  for (i = 0; i < NX; ++i) {
+    a[i] = rnd(2000) - 1000;
+    x[i] = rnd(NR) + 1;
+  }
+  for (i = 0; i < NR; ++i)
+    b[i] = rnd(2000) - 1000;
+
+  /* the same call twice: the second one uses the plan of the first */
+  results[0] += maxval_i4(a, b, x, NULL);
+  results[0] += maxval_i4(a, b, x, NULL);
+
+  /* the same index array with new contents each time: a plan made for
+     the old contents must not be used */
+  for (t = 0; t < 20; ++t) {
+    for (i = 0; i < NX; ++i)
+      x[i] = t & 1 ? rnd(NR) + 1 : (i + t) % NR + 1;
+    results[1] += maxval_i4(a, b, x, NULL);
+    x[rnd(NX)] = rnd(NR) + 1; /* change one index */
+    results[1] += maxval_i4(a, b, x, NULL);
+  }
+
+  /* the same indices with new values: the plan is reused */
+  for (t = 0; t < 20; ++t) {
+    for (i = 0; i < NX; ++i)
+      a[i] = rnd(2000) - 1000;
+    results[2] += maxval_i4(a, b, x, NULL);
+  }
+
+  /* more index vectors than plans, used round robin and then in
+     reverse order, so plans are evicted and made again */
+  for (j = 0; j < 12; ++j)
+    for (i = 0; i < NX; ++i)
+      xs[j][i] = rnd(NR) + 1;
+  for (i = 0; i < NX; ++i)
+    a8[i] = rnd(2000) - 1000.5;
+  for (i = 0; i < NR; ++i)
+    b8[i] = rnd(2000) - 1000.5;
+  for (t = 0; t < 3; ++t)
+    for (j = 0; j < 12; ++j)
+      results[3] += minval_r8(a8, b8, xs[j]);
+  for (j = 11; j >= 0; --j)
+    results[3] += minval_r8(a8, b8, xs[j]);
+
+  /* a few vectors, fewer than the plans kept, used again and again */
+  for (t = 0; t < 5; ++t)
+    for (j = 0; j < NPLANS / 2; ++j)
+      results[4] += minval_r8(a8, b8, xs[j]);
+
+  /* a mask whose contents change, and no elements or every element */
+  for (t = 0; t < 20; ++t) {
+    for (i = 0; i < NX; ++i)
+      m[i] = t == 0 ? 0 : t == 1 ? -1 : rnd(3) == 0 ? -1 : 0;
+    results[5] += maxval_i4(a, b, x, m);
+  }
+
+  /* every element to the same place */
+  for (i = 0; i < NX; ++i)
+    x[i] = NR / 2;
+  results[6] += maxval_i4(a, b, x, NULL);
+  for (i = 0; i < NX; ++i)
+    x[i] = i % 3 + 1;
+  results[6] += maxval_i4(a, b, x, NULL);
+
+  /* runs of consecutive indices, of several kinds */
+  for (t = 0; t < 10; ++t) {
+    for (i = 0; i < NK; ++i) {
+      a1[i] = rnd(256) - 128;
+      b1[i] = rnd(256) - 128;
+      ai8[i] = (long long)(rnd(2000) - 1000) << 33;
+      bi8[i] = (long long)(rnd(2000) - 1000) << 33;
+      a4[i] = rnd(2000) - 1000.25f;
+      b4[i] = rnd(2000) - 1000.25f;
+    }
+    runs(xr, NK);
+    results[7] += maxval_i1(a1, b1, xr, NK);
+    results[7] += maxval_i8(ai8, bi8, xr, NK);
+    results[7] += maxval_r4(a4, b4, xr, NK);
+    for (i = 0; i < NK; ++i)
+      xr[i] = i + 1;
+    results[7] += maxval_r4(a4, b4, xr, NK);
+  }
+
+  results[8] = kernels();
+  results[9] = run_copies();
+}
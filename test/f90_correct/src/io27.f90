@@ -0,0 +1,133 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for sequential formatted record reads: records ended by LF and
+!* by CR LF, an empty record, a record much longer than the record
+!* buffer, a last record with no newline, nonadvancing reads up to end of
+!* record and end of file, list-directed and namelist reads over several
+!* records, BACKSPACE after a read, and a WRITE after reads.  Without the
+!* crlf FORTRANOPT a CR is part of the record.  Each result is the number
+!* of values that differ from what was written.
+
+program p
+  parameter(NbrTests=10)
+  parameter(NLONG=5000)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+
+  character(len=NLONG) :: long, buf
+  character(len=8) :: s
+  character(len=1), parameter :: lf = achar(10), cr = achar(13)
+  integer :: i, j, k, ios, sz, a(300), n1, n2
+  real :: x
+  namelist /nl/ n1, n2, x
+
+  results = 0
+  do i = 1, NLONG
+    long(i:i) = achar(iachar('a') + mod(i, 26))
+  end do
+
+  open(10, file='io27.dat', access='stream', form='unformatted', &
+       status='replace')
+  write(10) '  12  34' // lf
+  write(10) '  56  78' // cr // lf
+  write(10) lf
+  write(10) 'abc' // cr // lf
+  write(10) long // lf
+  write(10) 'last'
+  close(10)
+
+  open(10, file='io27.dat', form='formatted', status='old')
+  read(10, '(2i4)') i, j
+  if (i .ne. 12 .or. j .ne. 34) results(1) = results(1) + 1
+  read(10, '(2i4)') i, j
+  if (i .ne. 56 .or. j .ne. 78) results(1) = results(1) + 1
+  read(10, '(a)') s
+  if (s .ne. ' ') results(2) = results(2) + 1
+  read(10, '(a)') s
+  if (s .ne. 'abc' // cr) results(3) = results(3) + 1
+  read(10, '(a)') buf
+  if (buf .ne. long) results(4) = results(4) + 1
+  read(10, '(a)', iostat=ios) s
+  if (ios .ne. 0 .or. s .ne. 'last') results(5) = results(5) + 1
+  read(10, '(a)', iostat=ios) s
+  if (ios .ge. 0) results(5) = results(5) + 1
+
+  ! nonadvancing: end of record, then end of file after the last record
+  rewind(10)
+  read(10, '(a4)', advance='no', iostat=ios, size=sz) s
+  if (ios .ne. 0 .or. sz .ne. 4 .or. s .ne. '  12') &
+    results(6) = results(6) + 1
+  read(10, '(a8)', advance='no', iostat=ios, size=sz) s
+  if (ios .ge. 0 .or. sz .ne. 4 .or. s(1:4) .ne. '  34') &
+    results(6) = results(6) + 1
+  do k = 1, 4
+    read(10, '(a)') s
+  end do
+  read(10, '(a8)', advance='no', iostat=ios, size=sz) s
+  if (ios .ge. 0 .or. sz .ne. 4 .or. s(1:4) .ne. 'last') &
+    results(6) = results(6) + 1
+  read(10, '(a8)', advance='no', iostat=ios, size=sz) s
+  if (ios .ge. 0 .or. sz .ne. 0) results(6) = results(6) + 1
+
+  ! BACKSPACE after a read sees the same record again
+  rewind(10)
+  read(10, '(a)') s
+  read(10, '(a)') s
+  backspace(10)
+  read(10, '(2i4)') i, j
+  if (i .ne. 56 .or. j .ne. 78) results(7) = results(7) + 1
+
+  ! a WRITE after reads replaces what follows
+  write(10, '(a)') 'new'
+  rewind(10)
+  k = 0
+  do
+    read(10, '(a)', iostat=ios) s
+    if (ios .ne. 0) exit
+    k = k + 1
+  end do
+  if (k .ne. 3 .or. s .ne. 'new') results(8) = results(8) + 1
+  close(10)
+
+  ! list-directed over long records
+  open(10, file='io27.dat', form='formatted', status='replace')
+  write(10, '(100i5)') (i, i = 1, 100)
+  write(10, '(200i5)') (i, i = 101, 300)
+  close(10)
+  open(10, file='io27.dat', form='formatted', status='old')
+  read(10, *) a
+  do i = 1, 300
+    if (a(i) .ne. i) results(9) = results(9) + 1
+  end do
+  close(10)
+
+  ! namelist over several records
+  open(10, file='io27.dat', access='stream', form='unformatted', &
+       status='replace')
+  write(10) '&nl' // lf // ' n1 = 7,' // lf // ' n2 = 9,' // lf // &
+            ' x = 2.5' // lf // '/' // lf
+  close(10)
+  n1 = 0
+  n2 = 0
+  x = 0
+  open(10, file='io27.dat', form='formatted', status='old')
+  read(10, nml=nl)
+  if (n1 .ne. 7 .or. n2 .ne. 9 .or. x .ne. 2.5) results(10) = results(10) + 1
+  close(10, status='delete')
+
+  call check(results, expect, NbrTests)
+end program
@@ -0,0 +1,112 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for the conversion of decimal input to real: exact cases,
+!* powers of ten that are not exact, a value halfway between two doubles,
+!* subnormals, the largest double, more than 19 significant digits
+!* exactly at and just past a halfway point, a D exponent, and single
+!* precision.  Values are read list-directed, with F editing and with
+!* namelist.  Each result is the number of values whose bits differ from
+!* the correctly rounded ones.
+
+program p
+  parameter(NbrTests=5)
+  parameter(ND=25, NS=5)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+
+  character(len=70) :: dstr(ND), sstr(NS)
+  character(len=100) :: line
+  integer*8 :: dbits(ND)
+  integer*4 :: sbits(NS)
+  real*8 :: d
+  real*4 :: s
+  integer :: i
+  namelist /nl/ d
+
+  data dstr / &
+    '0.1', &
+    '1e23', &
+    '9007199254740993', &
+    '2.2250738585072011e-308', &
+    '2.2250738585072014e-308', &
+    '4.9e-324', &
+    '2.4703282292062328e-324', &
+    '1.7976931348623157e308', &
+    '123456789012345678', &
+    '-3.14159', &
+    '1.5e+300', &
+    '8.98846567431158e307', &
+    '0.1000000000000000055511151231257827021181583404541015625', &
+    '1.00000000000000011102230246251565404236316680908203125', &
+    '1.000000000000000111022302462515654042363166809082031250000000001', &
+    '7.2057594037927933e16', &
+    '1e-5', &
+    '6.02214076e23', &
+    '-0.0', &
+    '0.30000000000000004', &
+    '1e22', &
+    '1e-22', &
+    '5e-310', &
+    '123.456e-2', &
+    '9.999999999999999e22' /
+  data dbits / &
+    4591870180066957722_8, 4950912855330343670_8, 4845873199050653696_8, &
+    4503599627370495_8, 4503599627370496_8, 1_8, 1_8, &
+    9218868437227405311_8, 4862596447618666293_8, -4609115386278082962_8, &
+    9097811302482466869_8, 9214364837600034816_8, 4591870180066957722_8, &
+    4607182418800017408_8, 4607182418800017409_8, 4859383997932765184_8, &
+    4532020583610935537_8, 4962933279127225623_8, 0_8, &
+    4599075939470750516_8, 4936209963552724370_8, 4277919505920253670_8, &
+    101201126653655_8, 4608238783128613432_8, 4950912855330343670_8 /
+  data sstr / '0.1', '3.4028235e38', '1.17549435e-38', '16777217', '-2.5' /
+  data sbits / 1036831949, 2139095039, 8388608, 1266679808, -1071644672 /
+
+  results = 0
+  dbits(19) = ibset(0_8, 63) ! -0.0
+
+  do i = 1, ND
+    d = 0
+    read(dstr(i), *) d
+    if (transfer(d, 0_8) .ne. dbits(i)) results(1) = results(1) + 1
+    d = 0
+    read(dstr(i), '(f70.0)') d
+    if (transfer(d, 0_8) .ne. dbits(i)) results(2) = results(2) + 1
+    d = 0
+    line = '&nl d = ' // trim(dstr(i)) // ' /'
+    read(line, nml=nl)
+    if (transfer(d, 0_8) .ne. dbits(i)) results(3) = results(3) + 1
+  end do
+
+  do i = 1, NS
+    s = 0
+    read(sstr(i), *) s
+    if (transfer(s, 0) .ne. sbits(i)) results(4) = results(4) + 1
+  end do
+
+  ! D exponent, leading sign and blanks
+  line = '  +1.5D+300'
+  read(line, *) d
+  if (transfer(d, 0_8) .ne. dbits(11)) results(5) = results(5) + 1
+  line = '1.0d-1'
+  read(line, *) d
+  if (transfer(d, 0_8) .ne. dbits(1)) results(5) = results(5) + 1
+  line = '-314159d-5'
+  read(line, *) d
+  if (transfer(d, 0_8) .ne. dbits(10)) results(5) = results(5) + 1
+
+  call check(results, expect, NbrTests)
+end program
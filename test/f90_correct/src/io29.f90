@@ -0,0 +1,73 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for E, ES, EN, D and G output where rounding to the field's
+!* digits carries into a new leading digit, with and without a scale
+!* factor and in each nearest rounding mode, and for list-directed output
+!* of values just below a power of ten, which must read back unchanged.
+!* Each result is the number of fields that differ from what is expected.
+
+program p
+  parameter(NbrTests=3)
+  parameter(NF=14, NL=8)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+
+  character(len=16) :: fmts(NF), want(NF), got
+  real*8 :: vals(NF), lvals(NL), y
+  real*4 :: x, z
+  character(len=40) :: line
+  integer :: i
+
+  data fmts / '(e10.3)', '(e10.3)', '(es10.3)', '(en12.3)', '(d10.3)', &
+              '(g10.3)', '(1p,e11.3)', '(e11.4)', '(rc,e10.3)', &
+              '(rn,e10.3)', '(rc,es10.2)', '(e12.5)', '(es10.3)', &
+              '(e10.3)' /
+  data vals / 9.9996d0, -9.9996d0, 9.9996d0, 999.9996d0, 9.9996d0, &
+              9.9996d10, 9.9996d0, 0.99995001d0, 9.99951d0, &
+              9.99951d0, 9.996d0, 99999.9d-20, 0.0099996d0, 0.5d0 /
+  data want / ' 0.100E+02', '-0.100E+02', ' 1.000E+01', '   1.000E+03', &
+              ' 0.100D+02', ' 0.100E+12', '  1.000E+01', ' 0.1000E+01', &
+              ' 0.100E+02', ' 0.100E+02', '  1.00E+01', ' 0.10000E-14', &
+              ' 1.000E-02', ' 0.500E+00' /
+  data lvals / 0.99999999999999989d0, 9.9999999999999982d0, &
+               99999.999999999985d0, 999999999999999.88d0, &
+               9.9999999999999995d-8, 0.9999999999999999d300, &
+               1.0d0, 99.999999999999986d0 /
+
+  results = 0
+  do i = 1, NF
+    write(got, fmts(i)) vals(i)
+    if (got .ne. want(i)) results(1) = results(1) + 1
+  end do
+
+  do i = 1, NL
+    write(line, *) lvals(i)
+    read(line, *) y
+    if (y .ne. lvals(i)) results(2) = results(2) + 1
+  end do
+
+  x = 0.99999994
+  write(line, *) x
+  read(line, *) z
+  if (z .ne. x) results(3) = results(3) + 1
+  x = 9.9999990
+  write(line, *) x
+  read(line, *) z
+  if (z .ne. x) results(3) = results(3) + 1
+
+  call check(results, expect, NbrTests)
+end program
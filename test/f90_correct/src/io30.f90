@@ -0,0 +1,107 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for formats held in character variables, which are encoded at
+!* run time and cached by their text: the same text used again, different
+!* texts of the same length, the same variable changed between
+!* statements, more distinct formats than the cache keeps, a format array,
+!* a text longer than the longest one kept, and an invalid format, which
+!* must fail every time.  Each result is the number of records that
+!* differ from what is expected.
+
+program p
+  parameter(NbrTests=7)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+
+  character(len=20) :: fmt, fa, fb
+  character(len=10) :: farr(2)
+  character(len=2000) :: flong, out
+  character(len=40) :: line, want
+  integer :: i, j, ios
+
+  results = 0
+
+  ! the same text again and again
+  fmt = '(i4,a,i4)'
+  do i = 1, 50
+    write(line, fmt) i, ':', 2 * i
+    write(want, '(i4,a,i4)') i, ':', 2 * i
+    if (line .ne. want) results(1) = results(1) + 1
+  end do
+
+  ! different texts of the same length
+  fa = '(i5)'
+  fb = '(i6)'
+  do i = 1, 20
+    write(line, fa) i
+    if (len_trim(line) .ne. 5) results(2) = results(2) + 1
+    write(line, fb) i
+    if (len_trim(line) .ne. 6) results(2) = results(2) + 1
+  end do
+
+  ! one variable changed between statements
+  do i = 1, 20
+    write(fmt, '(a,i2,a)') '(i', i + 1, ')'
+    write(line, fmt) 1
+    if (len_trim(line) .ne. i + 1) results(3) = results(3) + 1
+  end do
+
+  ! more distinct formats than are kept, twice over
+  do j = 1, 2
+    do i = 1, 150
+      write(fmt, '(a,i3,a)') '(', i, 'x,a1)'
+      write(line, '(a)') ' '
+      if (i .le. 39) then
+        write(line, fmt) '*'
+        if (index(line, '*') .ne. i + 1) results(4) = results(4) + 1
+      else
+        write(out, fmt) '*'
+        if (index(out, '*') .ne. i + 1) results(4) = results(4) + 1
+      end if
+    end do
+  end do
+
+  ! a format array
+  farr(1) = '(i3,'
+  farr(2) = 'i3)'
+  write(line, farr) 7, 8
+  if (line .ne. '  7  8') results(5) = results(5) + 1
+
+  ! a text longer than the longest kept
+  flong = '('
+  do i = 2, 1990, 3
+    flong(i:i + 2) = '1x,'
+  end do
+  flong(1992:1995) = 'i3)'
+  do j = 1, 2
+    write(out, flong(1:1995)) 5
+    if (index(out, '5') .ne. 666) results(6) = results(6) + 1
+  end do
+
+  ! an invalid format fails each time
+  fmt = '(i4,q9)'
+  do j = 1, 3
+    ios = 0
+    write(line, fmt, iostat=ios) 1
+    if (ios .eq. 0) results(7) = results(7) + 1
+  end do
+  fmt = '(i4)'
+  write(line, fmt, iostat=ios) 1
+  if (ios .ne. 0 .or. line .ne. '   1') results(7) = results(7) + 1
+
+  call check(results, expect, NbrTests)
+end program
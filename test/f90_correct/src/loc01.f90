@@ -0,0 +1,452 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for MINLOC, MAXLOC and FINDLOC of every integer and real kind
+!* against a loop: lengths around the vector width, the unroll factor
+!* and the 1024 element block, contiguous and strided arrays, with and
+!* without a mask of the same size as the elements, FINDLOC with BACK,
+!* and the DIM forms.  The arrays have many ties, a later element that
+!* beats the first block and ties with it again, elements equal to the
+!* starting value of the search (HUGE and its negative), and for reals
+!* NaNs, which never match, and zeros of both signs, which are equal.
+!* Each result is the number of mismatches over all lengths.
+
+program p
+  use ieee_arithmetic
+  parameter(NbrTests=8)
+  parameter(NLEN=24)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  integer :: lens(NLEN)
+  data lens /0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, &
+             65, 127, 1023, 1024, 1025, 2049, 4099/
+  data expect /NbrTests*0/
+  integer :: k
+
+  results = 0
+  do k = 1, NLEN
+    results(1) = results(1) + test_i1(lens(k))
+    results(2) = results(2) + test_i2(lens(k))
+    results(3) = results(3) + test_i4(lens(k))
+    results(4) = results(4) + test_i8(lens(k))
+    results(5) = results(5) + test_r4(lens(k))
+    results(6) = results(6) + test_r8(lens(k))
+    results(7) = results(7) + test_dim(lens(k))
+  enddo
+  results(8) = test_dim(1030) + test_dim(3000)
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  ! Element i of a test array, in [-6, 6].
+  integer function v(i)
+    integer :: i
+    v = mod(i * 7, 13) - 6
+  end function
+
+  ! 1 if location l(1) is not k
+  integer function ne(l, k)
+    integer :: l(1), k
+    ne = 0
+    if (l(1) .ne. k) ne = 1
+  end function
+
+  ! First location of the least (mx: greatest) of the d(i) with m(i) set,
+  ! skipping NaNs, or 0.
+  integer function rloc(d, m, n, mx)
+    integer :: n, i
+    real*8 :: d(n)
+    logical :: m(n), mx
+    rloc = 0
+    do i = 1, n
+      if (.not. m(i) .or. ieee_is_nan(d(i))) cycle
+      if (rloc .eq. 0) then
+        rloc = i
+      else if ((mx .and. d(i) .gt. d(rloc)) .or. &
+               (.not. mx .and. d(i) .lt. d(rloc))) then
+        rloc = i
+      endif
+    enddo
+  end function
+
+  ! First (back: last) location of x among the d(i) with m(i) set, or 0.
+  integer function rfind(d, m, n, x, back)
+    integer :: n, i
+    real*8 :: d(n), x
+    logical :: m(n), back
+    rfind = 0
+    do i = 1, n
+      if (m(i) .and. d(i) .eq. x) then
+        rfind = i
+        if (.not. back) return
+      endif
+    enddo
+  end function
+
+
+  integer function test_i1(n)
+    integer :: n, i, j
+    integer*1 :: a(2*n), x
+    logical*1 :: m(2*n)
+    logical :: lm(2*n), tt(2*n)
+    real*8 :: d(2*n)
+    test_i1 = 0
+    tt = .true.
+    do j = 1, 3
+      do i = 1, 2*n
+        m(i) = mod(i, 3) .ne. 1
+        select case (j)
+        case (1)
+          a(i) = v(i)
+        case (2)
+          a(i) = huge(x)
+        case (3)
+          a(i) = -huge(x) - 1_1
+        end select
+      enddo
+      if (j .eq. 1 .and. n .gt. 2) then
+        a(n/2 + 1) = -9
+        a(n) = -9
+        a(n - 1) = 9
+      endif
+      d = a
+      lm = m
+      x = 0
+      if (n .gt. 0) x = a(n/2 + 1)
+      test_i1 = test_i1 + &
+        ne(minloc(a(1:n)), rloc(d, tt, n, .false.)) + &
+        ne(maxloc(a(1:n)), rloc(d, tt, n, .true.)) + &
+        ne(minloc(a(1:n), mask=m(1:n)), rloc(d, lm, n, .false.)) + &
+        ne(maxloc(a(1:n), mask=m(1:n)), rloc(d, lm, n, .true.)) + &
+        ne(findloc(a(1:n), x), rfind(d, tt, n, dble(x), .false.)) + &
+        ne(findloc(a(1:n), x, back=.true.), rfind(d, tt, n, dble(x), .true.))
+      test_i1 = test_i1 + &
+        ne(findloc(a(1:n), x, mask=m(1:n)), &
+           rfind(d, lm, n, dble(x), .false.)) + &
+        ne(findloc(a(1:n), x, mask=m(1:n), back=.true.), &
+           rfind(d, lm, n, dble(x), .true.)) + &
+        ne(minloc(a(1:2*n:2)), rloc(d(1:2*n:2), tt, n, .false.)) + &
+        ne(maxloc(a(1:2*n:2), mask=m(1:2*n:2)), &
+           rloc(d(1:2*n:2), lm(1:2*n:2), n, .true.)) + &
+        ne(findloc(a(1:2*n:2), x, back=.true.), &
+           rfind(d(1:2*n:2), tt, n, dble(x), .true.))
+    enddo
+  end function
+
+
+  integer function test_i2(n)
+    integer :: n, i, j
+    integer*2 :: a(2*n), x
+    logical*2 :: m(2*n)
+    logical :: lm(2*n), tt(2*n)
+    real*8 :: d(2*n)
+    test_i2 = 0
+    tt = .true.
+    do j = 1, 3
+      do i = 1, 2*n
+        m(i) = mod(i, 3) .ne. 1
+        select case (j)
+        case (1)
+          a(i) = v(i)
+        case (2)
+          a(i) = huge(x)
+        case (3)
+          a(i) = -huge(x) - 1_2
+        end select
+      enddo
+      if (j .eq. 1 .and. n .gt. 2) then
+        a(n/2 + 1) = -9
+        a(n) = -9
+        a(n - 1) = 9
+      endif
+      d = a
+      lm = m
+      x = 0
+      if (n .gt. 0) x = a(n/2 + 1)
+      test_i2 = test_i2 + &
+        ne(minloc(a(1:n)), rloc(d, tt, n, .false.)) + &
+        ne(maxloc(a(1:n)), rloc(d, tt, n, .true.)) + &
+        ne(minloc(a(1:n), mask=m(1:n)), rloc(d, lm, n, .false.)) + &
+        ne(maxloc(a(1:n), mask=m(1:n)), rloc(d, lm, n, .true.)) + &
+        ne(findloc(a(1:n), x), rfind(d, tt, n, dble(x), .false.)) + &
+        ne(findloc(a(1:n), x, back=.true.), rfind(d, tt, n, dble(x), .true.))
+      test_i2 = test_i2 + &
+        ne(findloc(a(1:n), x, mask=m(1:n)), &
+           rfind(d, lm, n, dble(x), .false.)) + &
+        ne(findloc(a(1:n), x, mask=m(1:n), back=.true.), &
+           rfind(d, lm, n, dble(x), .true.)) + &
+        ne(minloc(a(1:2*n:2)), rloc(d(1:2*n:2), tt, n, .false.)) + &
+        ne(maxloc(a(1:2*n:2), mask=m(1:2*n:2)), &
+           rloc(d(1:2*n:2), lm(1:2*n:2), n, .true.)) + &
+        ne(findloc(a(1:2*n:2), x, back=.true.), &
+           rfind(d(1:2*n:2), tt, n, dble(x), .true.))
+    enddo
+  end function
+
+
+  integer function test_i4(n)
+    integer :: n, i, j
+    integer*4 :: a(2*n), x
+    logical*4 :: m(2*n)
+    logical :: lm(2*n), tt(2*n)
+    real*8 :: d(2*n)
+    test_i4 = 0
+    tt = .true.
+    do j = 1, 3
+      do i = 1, 2*n
+        m(i) = mod(i, 3) .ne. 1
+        select case (j)
+        case (1)
+          a(i) = v(i) * 100000
+        case (2)
+          a(i) = huge(x)
+        case (3)
+          a(i) = -huge(x) - 1
+        end select
+      enddo
+      if (j .eq. 1 .and. n .gt. 2) then
+        a(n/2 + 1) = -900000
+        a(n) = -900000
+        a(n - 1) = 900000
+      endif
+      d = a
+      lm = m
+      x = 0
+      if (n .gt. 0) x = a(n/2 + 1)
+      test_i4 = test_i4 + &
+        ne(minloc(a(1:n)), rloc(d, tt, n, .false.)) + &
+        ne(maxloc(a(1:n)), rloc(d, tt, n, .true.)) + &
+        ne(minloc(a(1:n), mask=m(1:n)), rloc(d, lm, n, .false.)) + &
+        ne(maxloc(a(1:n), mask=m(1:n)), rloc(d, lm, n, .true.)) + &
+        ne(findloc(a(1:n), x), rfind(d, tt, n, dble(x), .false.)) + &
+        ne(findloc(a(1:n), x, back=.true.), rfind(d, tt, n, dble(x), .true.))
+      test_i4 = test_i4 + &
+        ne(findloc(a(1:n), x, mask=m(1:n)), &
+           rfind(d, lm, n, dble(x), .false.)) + &
+        ne(findloc(a(1:n), x, mask=m(1:n), back=.true.), &
+           rfind(d, lm, n, dble(x), .true.)) + &
+        ne(minloc(a(1:2*n:2)), rloc(d(1:2*n:2), tt, n, .false.)) + &
+        ne(maxloc(a(1:2*n:2), mask=m(1:2*n:2)), &
+           rloc(d(1:2*n:2), lm(1:2*n:2), n, .true.)) + &
+        ne(findloc(a(1:2*n:2), x, back=.true.), &
+           rfind(d(1:2*n:2), tt, n, dble(x), .true.))
+    enddo
+  end function
+
+
+  integer function test_i8(n)
+    integer :: n, i, j
+    integer*8 :: a(2*n), x
+    logical*8 :: m(2*n)
+    logical :: lm(2*n), tt(2*n)
+    real*8 :: d(2*n)
+    test_i8 = 0
+    tt = .true.
+    do j = 1, 3
+      do i = 1, 2*n
+        m(i) = mod(i, 3) .ne. 1
+        select case (j)
+        case (1)
+          a(i) = v(i) * 1000000000_8
+        case (2)
+          a(i) = huge(x)
+        case (3)
+          a(i) = -huge(x) - 1_8
+        end select
+      enddo
+      if (j .eq. 1 .and. n .gt. 2) then
+        a(n/2 + 1) = -9000000000_8
+        a(n) = -9000000000_8
+        a(n - 1) = 9000000000_8
+      endif
+      d = a
+      lm = m
+      x = 0
+      if (n .gt. 0) x = a(n/2 + 1)
+      test_i8 = test_i8 + &
+        ne(minloc(a(1:n)), rloc(d, tt, n, .false.)) + &
+        ne(maxloc(a(1:n)), rloc(d, tt, n, .true.)) + &
+        ne(minloc(a(1:n), mask=m(1:n)), rloc(d, lm, n, .false.)) + &
+        ne(maxloc(a(1:n), mask=m(1:n)), rloc(d, lm, n, .true.)) + &
+        ne(findloc(a(1:n), x), rfind(d, tt, n, dble(x), .false.)) + &
+        ne(findloc(a(1:n), x, back=.true.), rfind(d, tt, n, dble(x), .true.))
+      test_i8 = test_i8 + &
+        ne(findloc(a(1:n), x, mask=m(1:n)), &
+           rfind(d, lm, n, dble(x), .false.)) + &
+        ne(findloc(a(1:n), x, mask=m(1:n), back=.true.), &
+           rfind(d, lm, n, dble(x), .true.)) + &
+        ne(minloc(a(1:2*n:2)), rloc(d(1:2*n:2), tt, n, .false.)) + &
+        ne(maxloc(a(1:2*n:2), mask=m(1:2*n:2)), &
+           rloc(d(1:2*n:2), lm(1:2*n:2), n, .true.)) + &
+        ne(findloc(a(1:2*n:2), x, back=.true.), &
+           rfind(d(1:2*n:2), tt, n, dble(x), .true.))
+    enddo
+  end function
+
+
+  integer function test_r4(n)
+    integer :: n, i, j
+    real*4 :: a(2*n), x
+    logical*4 :: m(2*n)
+    logical :: lm(2*n), tt(2*n)
+    real*8 :: d(2*n)
+    test_r4 = 0
+    tt = .true.
+    do j = 1, 4
+      do i = 1, 2*n
+        m(i) = mod(i, 3) .ne. 1
+        select case (j)
+        case (1)
+          a(i) = v(i) * 0.5
+        case (2)
+          a(i) = huge(x)
+        case (3)
+          a(i) = -huge(x)
+        case (4)
+          a(i) = 0
+          if (mod(i, 2) .eq. 1) a(i) = -a(i)
+        end select
+        if (j .eq. 1 .and. mod(i, 5) .eq. 0) &
+          a(i) = ieee_value(x, ieee_quiet_nan)
+      enddo
+      if (j .eq. 1 .and. n .gt. 2) then
+        a(n/2 + 1) = -4.75
+        a(n) = -4.75
+        a(n - 1) = 4.75
+      endif
+      d = a
+      lm = m
+      x = 0
+      if (n .gt. 0) x = a(n/2 + 1)
+      test_r4 = test_r4 + &
+        ne(minloc(a(1:n)), rloc(d, tt, n, .false.)) + &
+        ne(maxloc(a(1:n)), rloc(d, tt, n, .true.)) + &
+        ne(minloc(a(1:n), mask=m(1:n)), rloc(d, lm, n, .false.)) + &
+        ne(maxloc(a(1:n), mask=m(1:n)), rloc(d, lm, n, .true.)) + &
+        ne(findloc(a(1:n), x), rfind(d, tt, n, dble(x), .false.)) + &
+        ne(findloc(a(1:n), x, back=.true.), rfind(d, tt, n, dble(x), .true.))
+      test_r4 = test_r4 + &
+        ne(findloc(a(1:n), x, mask=m(1:n)), &
+           rfind(d, lm, n, dble(x), .false.)) + &
+        ne(findloc(a(1:n), x, mask=m(1:n), back=.true.), &
+           rfind(d, lm, n, dble(x), .true.)) + &
+        ne(minloc(a(1:2*n:2)), rloc(d(1:2*n:2), tt, n, .false.)) + &
+        ne(maxloc(a(1:2*n:2), mask=m(1:2*n:2)), &
+           rloc(d(1:2*n:2), lm(1:2*n:2), n, .true.)) + &
+        ne(findloc(a(1:2*n:2), x, back=.true.), &
+           rfind(d(1:2*n:2), tt, n, dble(x), .true.))
+      x = ieee_value(x, ieee_quiet_nan)
+      test_r4 = test_r4 + ne(findloc(a(1:n), x), 0)
+    enddo
+  end function
+
+
+  integer function test_r8(n)
+    integer :: n, i, j
+    real*8 :: a(2*n), x
+    logical*8 :: m(2*n)
+    logical :: lm(2*n), tt(2*n)
+    real*8 :: d(2*n)
+    test_r8 = 0
+    tt = .true.
+    do j = 1, 4
+      do i = 1, 2*n
+        m(i) = mod(i, 3) .ne. 1
+        select case (j)
+        case (1)
+          a(i) = v(i) * 0.25d0
+        case (2)
+          a(i) = huge(x)
+        case (3)
+          a(i) = -huge(x)
+        case (4)
+          a(i) = 0
+          if (mod(i, 2) .eq. 1) a(i) = -a(i)
+        end select
+        if (j .eq. 1 .and. mod(i, 5) .eq. 0) &
+          a(i) = ieee_value(x, ieee_quiet_nan)
+      enddo
+      if (j .eq. 1 .and. n .gt. 2) then
+        a(n/2 + 1) = -2.375d0
+        a(n) = -2.375d0
+        a(n - 1) = 2.375d0
+      endif
+      d = a
+      lm = m
+      x = 0
+      if (n .gt. 0) x = a(n/2 + 1)
+      test_r8 = test_r8 + &
+        ne(minloc(a(1:n)), rloc(d, tt, n, .false.)) + &
+        ne(maxloc(a(1:n)), rloc(d, tt, n, .true.)) + &
+        ne(minloc(a(1:n), mask=m(1:n)), rloc(d, lm, n, .false.)) + &
+        ne(maxloc(a(1:n), mask=m(1:n)), rloc(d, lm, n, .true.)) + &
+        ne(findloc(a(1:n), x), rfind(d, tt, n, dble(x), .false.)) + &
+        ne(findloc(a(1:n), x, back=.true.), rfind(d, tt, n, dble(x), .true.))
+      test_r8 = test_r8 + &
+        ne(findloc(a(1:n), x, mask=m(1:n)), &
+           rfind(d, lm, n, dble(x), .false.)) + &
+        ne(findloc(a(1:n), x, mask=m(1:n), back=.true.), &
+           rfind(d, lm, n, dble(x), .true.)) + &
+        ne(minloc(a(1:2*n:2)), rloc(d(1:2*n:2), tt, n, .false.)) + &
+        ne(maxloc(a(1:2*n:2), mask=m(1:2*n:2)), &
+           rloc(d(1:2*n:2), lm(1:2*n:2), n, .true.)) + &
+        ne(findloc(a(1:2*n:2), x, back=.true.), &
+           rfind(d(1:2*n:2), tt, n, dble(x), .true.))
+      x = ieee_value(x, ieee_quiet_nan)
+      test_r8 = test_r8 + ne(findloc(a(1:n), x), 0)
+    enddo
+  end function
+
+
+  ! MINLOC, MAXLOC and FINDLOC with DIM of an n by 3 array, along the
+  ! contiguous first dimension and the strided second one.
+  integer function test_dim(n)
+    integer :: n, i, j
+    real*4 :: b(n, 3), x
+    logical*4 :: m(n, 3)
+    logical :: lm(n, 3), tt(3*n)
+    real*8 :: d(n, 3)
+    integer :: l1(3), l2(n)
+    test_dim = 0
+    tt = .true.
+    do j = 1, 3
+      do i = 1, n
+        b(i, j) = v(i + j)
+        m(i, j) = mod(i + j, 4) .ne. 0
+      enddo
+    enddo
+    d = b
+    lm = m
+    x = -6
+    l1 = minloc(b, dim=1)
+    do j = 1, 3
+      test_dim = test_dim + ne(l1(j:j), rloc(d(:, j), tt, n, .false.))
+    enddo
+    l1 = maxloc(b, dim=1, mask=m)
+    do j = 1, 3
+      test_dim = test_dim + ne(l1(j:j), rloc(d(:, j), lm(:, j), n, .true.))
+    enddo
+    l1 = findloc(b, x, dim=1, back=.true.)
+    do j = 1, 3
+      test_dim = test_dim + ne(l1(j:j), rfind(d(:, j), tt, n, dble(x), .true.))
+    enddo
+    l2 = minloc(b, dim=2, mask=m)
+    do i = 1, n
+      test_dim = test_dim + ne(l2(i:i), rloc(d(i, :), lm(i, :), 3, .false.))
+    enddo
+  end function
+
+end program
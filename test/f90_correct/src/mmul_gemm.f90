@@ -0,0 +1,318 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for the blocked MATMUL of REAL and COMPLEX matrices large enough
+!* to take it: odd sizes that leave partial tiles, sizes either side of the
+!* cut-over, transposed and strided operands and strided results.
+!* The elements are small integers, so every sum is exact and the result
+!* must equal a plain loop nest.  Each result is the number of elements
+!* that differ.
+
+program p
+  parameter(NbrTests=16)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+
+  results(1) = test_r4(67, 129, 71)
+  results(2) = test_r4(15, 16, 17)
+  results(3) = test_r4(64, 64, 64)
+  results(4) = test_r4(1, 300, 200)
+  results(5) = test_r8(67, 129, 71)
+  results(6) = test_r8(200, 33, 5)
+  results(7) = test_c8(67, 129, 71)
+  results(8) = test_c8(17, 16, 15)
+  results(9) = test_c16(67, 129, 71)
+  results(10) = test_c16(130, 70, 90)
+  results(11) = test_r4_t(67, 129, 71)
+  results(12) = test_r8_t(80, 67, 96)
+  results(13) = test_r4_s(67, 129, 71)
+  results(14) = test_r8_s(80, 67, 96)
+  results(15) = test_c8_t(67, 129, 71)
+  results(16) = test_c16_s(80, 67, 96)
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  ! Element (i,j) of an m x n operand, in [-8, 8].
+  integer function v(i, j, s)
+    integer :: i, j, s
+    v = mod(i * 7 + j * 13 + s * 5, 17) - 8
+  end function
+
+  integer function test_r4(m, k, n)
+    integer :: m, k, n, i, j, l
+    real*4 :: a(m, k), b(k, n), c(m, n), r(m, n)
+    do j = 1, k
+      do i = 1, m
+        a(i, j) = v(i, j, 1)
+      enddo
+    enddo
+    do j = 1, n
+      do i = 1, k
+        b(i, j) = v(i, j, 2)
+      enddo
+    enddo
+    r = 0
+    do j = 1, n
+      do l = 1, k
+        do i = 1, m
+          r(i, j) = r(i, j) + a(i, l) * b(l, j)
+        enddo
+      enddo
+    enddo
+    c = matmul(a, b)
+    test_r4 = count(c .ne. r)
+  end function
+
+  integer function test_r8(m, k, n)
+    integer :: m, k, n, i, j, l
+    real*8 :: a(m, k), b(k, n), c(m, n), r(m, n)
+    do j = 1, k
+      do i = 1, m
+        a(i, j) = v(i, j, 3)
+      enddo
+    enddo
+    do j = 1, n
+      do i = 1, k
+        b(i, j) = v(i, j, 4)
+      enddo
+    enddo
+    r = 0
+    do j = 1, n
+      do l = 1, k
+        do i = 1, m
+          r(i, j) = r(i, j) + a(i, l) * b(l, j)
+        enddo
+      enddo
+    enddo
+    c = matmul(a, b)
+    test_r8 = count(c .ne. r)
+  end function
+
+  integer function test_c8(m, k, n)
+    integer :: m, k, n, i, j, l
+    complex*8 :: a(m, k), b(k, n), c(m, n), r(m, n)
+    do j = 1, k
+      do i = 1, m
+        a(i, j) = cmplx(v(i, j, 5), v(i, j, 6))
+      enddo
+    enddo
+    do j = 1, n
+      do i = 1, k
+        b(i, j) = cmplx(v(i, j, 7), v(i, j, 8))
+      enddo
+    enddo
+    r = 0
+    do j = 1, n
+      do l = 1, k
+        do i = 1, m
+          r(i, j) = r(i, j) + a(i, l) * b(l, j)
+        enddo
+      enddo
+    enddo
+    c = matmul(a, b)
+    test_c8 = count(c .ne. r)
+  end function
+
+  integer function test_c16(m, k, n)
+    integer :: m, k, n, i, j, l
+    complex*16 :: a(m, k), b(k, n), c(m, n), r(m, n)
+    do j = 1, k
+      do i = 1, m
+        a(i, j) = dcmplx(v(i, j, 9), v(i, j, 10))
+      enddo
+    enddo
+    do j = 1, n
+      do i = 1, k
+        b(i, j) = dcmplx(v(i, j, 11), v(i, j, 12))
+      enddo
+    enddo
+    r = 0
+    do j = 1, n
+      do l = 1, k
+        do i = 1, m
+          r(i, j) = r(i, j) + a(i, l) * b(l, j)
+        enddo
+      enddo
+    enddo
+    c = matmul(a, b)
+    test_c16 = count(c .ne. r)
+  end function
+
+  ! matmul(transpose(a), b)
+  integer function test_r4_t(m, k, n)
+    integer :: m, k, n, i, j, l
+    real*4 :: a(k, m), b(k, n), c(m, n), r(m, n)
+    do j = 1, m
+      do i = 1, k
+        a(i, j) = v(i, j, 13)
+      enddo
+    enddo
+    do j = 1, n
+      do i = 1, k
+        b(i, j) = v(i, j, 14)
+      enddo
+    enddo
+    r = 0
+    do j = 1, n
+      do l = 1, k
+        do i = 1, m
+          r(i, j) = r(i, j) + a(l, i) * b(l, j)
+        enddo
+      enddo
+    enddo
+    c = matmul(transpose(a), b)
+    test_r4_t = count(c .ne. r)
+  end function
+
+  integer function test_r8_t(m, k, n)
+    integer :: m, k, n, i, j, l
+    real*8 :: a(k, m), b(k, n), c(m, n), r(m, n)
+    do j = 1, m
+      do i = 1, k
+        a(i, j) = v(i, j, 15)
+      enddo
+    enddo
+    do j = 1, n
+      do i = 1, k
+        b(i, j) = v(i, j, 16)
+      enddo
+    enddo
+    r = 0
+    do j = 1, n
+      do l = 1, k
+        do i = 1, m
+          r(i, j) = r(i, j) + a(l, i) * b(l, j)
+        enddo
+      enddo
+    enddo
+    c = matmul(transpose(a), b)
+    test_r8_t = count(c .ne. r)
+  end function
+
+  ! Strided operands and a strided result; the elements in between must
+  ! be left alone.
+  integer function test_r4_s(m, k, n)
+    integer :: m, k, n, i, j, l
+    real*4 :: a(2*m, k), b(k, 3*n), c(2*m, n), r(m, n)
+    a = 99
+    b = 99
+    do j = 1, k
+      do i = 1, m
+        a(2*i-1, j) = v(i, j, 17)
+      enddo
+    enddo
+    do j = 1, n
+      do i = 1, k
+        b(i, 3*j) = v(i, j, 18)
+      enddo
+    enddo
+    r = 0
+    do j = 1, n
+      do l = 1, k
+        do i = 1, m
+          r(i, j) = r(i, j) + a(2*i-1, l) * b(l, 3*j)
+        enddo
+      enddo
+    enddo
+    c = -1
+    c(2:2*m:2, :) = matmul(a(1:2*m:2, :), b(:, 3:3*n:3))
+    test_r4_s = count(c(2:2*m:2, :) .ne. r) + count(c(1:2*m:2, :) .ne. -1)
+  end function
+
+  integer function test_r8_s(m, k, n)
+    integer :: m, k, n, i, j, l
+    real*8 :: a(2*m, k), b(k, 3*n), c(2*m, n), r(m, n)
+    a = 99
+    b = 99
+    do j = 1, k
+      do i = 1, m
+        a(2*i-1, j) = v(i, j, 19)
+      enddo
+    enddo
+    do j = 1, n
+      do i = 1, k
+        b(i, 3*j) = v(i, j, 20)
+      enddo
+    enddo
+    r = 0
+    do j = 1, n
+      do l = 1, k
+        do i = 1, m
+          r(i, j) = r(i, j) + a(2*i-1, l) * b(l, 3*j)
+        enddo
+      enddo
+    enddo
+    c = -1
+    c(2:2*m:2, :) = matmul(a(1:2*m:2, :), b(:, 3:3*n:3))
+    test_r8_s = count(c(2:2*m:2, :) .ne. r) + count(c(1:2*m:2, :) .ne. -1)
+  end function
+
+  integer function test_c8_t(m, k, n)
+    integer :: m, k, n, i, j, l
+    complex*8 :: a(k, m), b(k, n), c(m, n), r(m, n)
+    do j = 1, m
+      do i = 1, k
+        a(i, j) = cmplx(v(i, j, 21), v(i, j, 22))
+      enddo
+    enddo
+    do j = 1, n
+      do i = 1, k
+        b(i, j) = cmplx(v(i, j, 23), v(i, j, 24))
+      enddo
+    enddo
+    r = 0
+    do j = 1, n
+      do l = 1, k
+        do i = 1, m
+          r(i, j) = r(i, j) + a(l, i) * b(l, j)
+        enddo
+      enddo
+    enddo
+    c = matmul(transpose(a), b)
+    test_c8_t = count(c .ne. r)
+  end function
+
+  integer function test_c16_s(m, k, n)
+    integer :: m, k, n, i, j, l
+    complex*16 :: a(2*m, k), b(k, 3*n), c(2*m, n), r(m, n)
+    a = 99
+    b = 99
+    do j = 1, k
+      do i = 1, m
+        a(2*i-1, j) = dcmplx(v(i, j, 25), v(i, j, 26))
+      enddo
+    enddo
+    do j = 1, n
+      do i = 1, k
+        b(i, 3*j) = dcmplx(v(i, j, 27), v(i, j, 28))
+      enddo
+    enddo
+    r = 0
+    do j = 1, n
+      do l = 1, k
+        do i = 1, m
+          r(i, j) = r(i, j) + a(2*i-1, l) * b(l, 3*j)
+        enddo
+      enddo
+    enddo
+    c = -1
+    c(2:2*m:2, :) = matmul(a(1:2*m:2, :), b(:, 3:3*n:3))
+    test_c16_s = count(c(2:2*m:2, :) .ne. r) + count(c(1:2*m:2, :) .ne. -1)
+  end function
+
+end program
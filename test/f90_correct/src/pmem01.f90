@@ -0,0 +1,75 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for the threaded copy and fill engine of libflangrti, run with
+!* F90_COPY_PAR_MINSZ and F90_COPY_NT_MINSZ small enough that arrays of a
+!* few megabytes are split among threads and filled with streaming
+!* stores.  pmem01c.c calls the __c_mset, __c_mzero and __c_mcopy
+!* routines and the engine directly, with sizes on both sides of each
+!* threshold, unaligned destinations and fill patterns of every length;
+!* the rest fills and copies large arrays and sections here.  Each result
+!* is the number of fills or copies that differ from a loop.
+
+program p
+  parameter(NbrTests=9)
+  parameter(N=1000003)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+
+  interface
+    subroutine pmem01c(results) bind(C)
+      integer :: results(*)
+    end subroutine
+  end interface
+
+  integer, allocatable :: a(:), b(:)
+  real*8, allocatable :: c(:, :)
+  integer :: i
+
+  results = 0
+  call pmem01c(results)
+
+  ! whole arrays and a section passed by copy-in and copy-out
+  allocate(a(N), b(2*N), c(1000, 1001))
+  a = 7
+  do i = 1, N
+    if (a(i) .ne. 7) results(8) = results(8) + 1
+  enddo
+  b = 0
+  b(1:2*N:2) = a
+  do i = 1, 2*N
+    if (b(i) .ne. 7 * mod(i, 2)) results(8) = results(8) + 1
+  enddo
+  do i = 1, 1001
+    c(:, i) = i
+  enddo
+  call twice(c(1:1000:2, :), 500, 1001)
+  do i = 1, 1001
+    if (any(c(1:1000:2, i) .ne. 2 * i) .or. any(c(2:1000:2, i) .ne. i)) &
+      results(9) = results(9) + 1
+  enddo
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  subroutine twice(x, m, n)
+    integer :: m, n
+    real*8 :: x(m, n)
+    x = 2 * x
+  end subroutine
+
+end program
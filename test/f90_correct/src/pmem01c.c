@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Calls the fill and copy routines of libflangrti that the compiler emits,
+   and the engine behind them, with sizes on both sides of the engine's
+   own threshold, of PAR_MINSZ and of NT_MINSZ, and with destinations that
+   are not aligned.  pmem01.mk runs the test with F90_COPY_PAR_MINSZ and
+   F90_COPY_NT_MINSZ set to these, so that arrays of a few megabytes are
+   split among threads and streamed.  Each element of results is the
+   number of calls that wrote a wrong byte, inside or around the
+   destination. */
+
+#include <stdlib.h>
+#include <string.h>
+
+#define PAR_MINSZ (64L * 1024) /* F90_COPY_PAR_MINSZ in pmem01.mk */
+#define NT_MINSZ (256L * 1024) /* F90_COPY_NT_MINSZ in pmem01.mk */
+#define GUARD 64               /* bytes checked on each side */
+#define NBUF ((4L << 20) + 64) /* largest fill or copy, bytes */
+
+extern void __c_mset1(char *dest, int value, long cnt);
+extern void __c_mset2(short *dest, int value, long cnt);
+extern void __c_mset4(int *dest, int value, long cnt);
+extern void __c_mset8(long long *dest, long long value, long cnt);
+extern void __c_mzero1(char *dest, long cnt);
+extern void __c_mzero2(short *dest, long cnt);
+extern void __c_mzero4(int *dest, long cnt);
+extern void __c_mzero8(long long *dest, long cnt);
+extern void __c_mcopy1(char *dest, char *src, long cnt);
+extern void __c_mcopy2(short *dest, short *src, long cnt);
+extern void __c_mcopy4(int *dest, int *src, long cnt);
+extern void __c_mcopy8(long long *dest, long long *src, long cnt);
+extern void __c_pmcopy(void *dest, const void *src, size_t n);
+extern void __c_pmset(void *dest, const void *val, size_t len, size_t cnt);
+extern int __c_pmem_nthreads(size_t n);
+
+/* sizes in bytes, before they are rounded down to whole elements */
+static const long sizes[] = {
+    0, 1, 17, 64 * 1024 - 8, 64 * 1024, 64 * 1024 + 24,
+    2 * PAR_MINSZ - 1, 2 * PAR_MINSZ, 3 * PAR_MINSZ + 40,
+    NT_MINSZ - 16, NT_MINSZ, NT_MINSZ + 8, 1000003, NBUF - 56};
+#define NSIZES (sizeof(sizes) / sizeof(sizes[0]))
+
+static char *buf, *ref, *src;
+static long span; /* bytes of buf in play */
+
+/* fill the first n bytes of the buffer and their guards, and of its
+   reference, with a pattern unlike any fill */
+static void
+scribble(long n)
+{
+  long i;
+
+  span = n + 2 * GUARD;
+  if (span > NBUF + 2 * GUARD)
+    span = NBUF + 2 * GUARD;
+  for (i = 0; i < span; ++i)
+    buf[i] = ref[i] = (char)(i * 7 + 3);
+}
+
+static int
+differs(void)
+{
+  return memcmp(buf, ref, span) != 0;
+}
+
+/* fill n bytes at offset off with cnt copies of the len bytes at val,
+   through f, and compare with a byte loop */
+
+static int
+check_fill(int f, long n, long off, const char *val, long len)
+{
+  long cnt, i;
+  char *d;
+  short v2;
+  int v4;
+  long long v8;
+
+  cnt = n / len;
+  scribble(off + n);
+  d = buf + GUARD + off;
+  memcpy(&v2, val, sizeof(v2));
+  memcpy(&v4, val, sizeof(v4));
+  memcpy(&v8, val, sizeof(v8));
+  switch (f) {
+  case 0:
+    __c_mset1(d, *val, cnt);
+    break;
+  case 1:
+    __c_mset2((short *)d, v2, cnt);
+    break;
+  case 2:
+    __c_mset4((int *)d, v4, cnt);
+    break;
+  case 3:
+    __c_mset8((long long *)d, v8, cnt);
+    break;
+  case 4:
+    __c_mzero1(d, cnt);
+    break;
+  case 5:
+    __c_mzero2((short *)d, cnt);
+    break;
+  case 6:
+    __c_mzero4((int *)d, cnt);
+    break;
+  case 7:
+    __c_mzero8((long long *)d, cnt);
+    break;
+  default:
+    __c_pmset(d, val, len, cnt);
+    break;
+  }
+  for (i = 0; i < cnt * len; ++i)
+    ref[GUARD + off + i] = f >= 4 && f <= 7 ? 0 : val[i % len];
+  return differs();
+}
+
+/* copy n bytes from src + soff to offset doff through f */
+
+static int
+check_copy(int f, long n, long doff, long soff, long len)
+{
+  long cnt;
+  char *d, *s;
+
+  cnt = n / len;
+  scribble(doff + n);
+  d = buf + GUARD + doff;
+  s = src + soff;
+  switch (f) {
+  case 0:
+    __c_mcopy1(d, s, cnt);
+    break;
+  case 1:
+    __c_mcopy2((short *)d, (short *)s, cnt);
+    break;
+  case 2:
+    __c_mcopy4((int *)d, (int *)s, cnt);
+    break;
+  case 3:
+    __c_mcopy8((long long *)d, (long long *)s, cnt);
+    break;
+  default:
+    __c_pmcopy(d, s, cnt * len);
+    break;
+  }
+  memcpy(ref + GUARD + doff, s, cnt * len);
+  return differs();
+}
+
+void
+pmem01c(int *results)
+{
+  static const long lens[] = {1, 2, 4, 8};
+  static const long patlens[] = {1, 2, 3, 4, 8, 12, 16, 24};
+  char val[24];
+  long i, k, n, off;
+  int f, t;
+
+  buf = malloc(NBUF + 2 * GUARD);
+  ref = malloc(NBUF + 2 * GUARD);
+  src = malloc(NBUF + 64);
+  if (buf == NULL || ref == NULL || src == NULL) {
+    results[0] = -1;
+    return;
+  }
+  for (i = 0; i < NBUF + 64; ++i)
+    src[i] = (char)(i * 13 + i / 251);
+  for (i = 0; i < 24; ++i)
+    val[i] = (char)(0x81 + i * 5);
+
+  for (k = 0; k < NSIZES; ++k) {
+    for (off = 0; off < 3; ++off) {
+      n = sizes[k] - (off ? 64 : 0);
+      if (n < 0)
+        continue;
+
+      /* __c_mset<n> and __c_mzero<n> on element aligned destinations */
+      for (f = 0; f < 8; ++f)
+        results[f / 4] += check_fill(f, n, off * lens[f % 4] * 5,
+                                     val, lens[f % 4]);
+
+      /* the engine's fill, any pattern length and alignment */
+      for (t = 0; t < 8; ++t)
+        results[2] += check_fill(8, n, off * 21 + t, val, patlens[t]);
+
+      /* __c_mcopy<n> and the engine's copy */
+      for (f = 0; f < 4; ++f)
+        results[3] += check_copy(f, n, off * lens[f] * 3, off * lens[f],
+                                 lens[f]);
+      results[4] += check_copy(4, n, off * 7 + 1, off * 3 + 5, 1);
+    }
+  }
+
+  /* copies that overlap are left to the element loop */
+  for (i = 0; i < NBUF / 8 + 8; ++i)
+    ((long long *)buf)[i] = i;
+  __c_mcopy8((long long *)buf + 8, (long long *)buf, NBUF / 8);
+  for (i = 0; i < NBUF / 8; ++i)
+    if (((long long *)buf)[i + 8] != i % 8)
+      ++results[5];
+
+  /* never more threads than PAR_MINSZ shares, and one below two */
+  if (__c_pmem_nthreads(2 * PAR_MINSZ - 1) != 1)
+    ++results[6];
+  for (k = 0; k < NSIZES; ++k) {
+    t = __c_pmem_nthreads(sizes[k]);
+    if (t < 1 || (t > 1 && t > sizes[k] / PAR_MINSZ))
+      ++results[6];
+  }
+
+  free(buf);
+  free(ref);
+  free(src);
+}
@@ -0,0 +1,121 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for RESHAPE of contiguous arrays: no PAD, a PAD that is
+!* repeated, a PAD of size zero when SOURCE has enough elements, a PAD
+!* that is a rank 2 array, a zero-size SOURCE with PAD, character
+!* elements, and ORDER.  Each result is the number of elements that
+!* differ from the expected value.
+
+program p
+  parameter(NbrTests=8)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+
+  integer :: src(10), pad(3), nopad(0), pad2(2, 2), empty(0)
+  integer :: r1(2, 5), r2(4, 4), r3(3, 3), r4(5, 2)
+  character(len=3) :: csrc(4), cpad(2), cr(3, 3)
+  integer :: i, j, k
+
+  results = 0
+  src = (/ (i, i = 1, 10) /)
+  pad = (/ -1, -2, -3 /)
+  pad2 = reshape((/ 101, 102, 103, 104 /), (/ 2, 2 /))
+
+  ! no PAD
+  r1 = reshape(src, (/ 2, 5 /))
+  do j = 1, 5
+    do i = 1, 2
+      if (r1(i, j) .ne. i + 2 * (j - 1)) results(1) = results(1) + 1
+    end do
+  end do
+
+  ! PAD repeated to fill the result
+  r2 = reshape(src, (/ 4, 4 /), pad)
+  do j = 1, 4
+    do i = 1, 4
+      k = i + 4 * (j - 1)
+      if (k .le. 10) then
+        if (r2(i, j) .ne. k) results(2) = results(2) + 1
+      else
+        if (r2(i, j) .ne. -(mod(k - 11, 3) + 1)) results(2) = results(2) + 1
+      end if
+    end do
+  end do
+
+  ! zero-size PAD, SOURCE has enough elements
+  r3 = reshape(src, (/ 3, 3 /), nopad)
+  do j = 1, 3
+    do i = 1, 3
+      if (r3(i, j) .ne. i + 3 * (j - 1)) results(3) = results(3) + 1
+    end do
+  end do
+
+  ! rank 2 PAD
+  r2 = reshape(src, (/ 4, 4 /), pad2)
+  do j = 1, 4
+    do i = 1, 4
+      k = i + 4 * (j - 1)
+      if (k .le. 10) then
+        if (r2(i, j) .ne. k) results(4) = results(4) + 1
+      else
+        if (r2(i, j) .ne. 100 + mod(k - 11, 4) + 1) results(4) = results(4) + 1
+      end if
+    end do
+  end do
+
+  ! zero-size SOURCE, all PAD
+  r3 = reshape(empty, (/ 3, 3 /), pad)
+  do j = 1, 3
+    do i = 1, 3
+      k = i + 3 * (j - 1)
+      if (r3(i, j) .ne. -(mod(k - 1, 3) + 1)) results(5) = results(5) + 1
+    end do
+  end do
+
+  ! character elements with PAD
+  csrc = (/ 'abc', 'def', 'ghi', 'jkl' /)
+  cpad = (/ 'xyz', 'uvw' /)
+  cr = reshape(csrc, (/ 3, 3 /), cpad)
+  do j = 1, 3
+    do i = 1, 3
+      k = i + 3 * (j - 1)
+      if (k .le. 4) then
+        if (cr(i, j) .ne. csrc(k)) results(6) = results(6) + 1
+      else
+        if (cr(i, j) .ne. cpad(mod(k - 5, 2) + 1)) results(6) = results(6) + 1
+      end if
+    end do
+  end do
+
+  ! ORDER
+  r1 = reshape(src, (/ 2, 5 /), order = (/ 2, 1 /))
+  do j = 1, 5
+    do i = 1, 2
+      if (r1(i, j) .ne. j + 5 * (i - 1)) results(7) = results(7) + 1
+    end do
+  end do
+
+  ! ORDER with a zero-size PAD
+  r4 = reshape(src, (/ 5, 2 /), nopad, (/ 2, 1 /))
+  do j = 1, 2
+    do i = 1, 5
+      if (r4(i, j) .ne. j + 2 * (i - 1)) results(8) = results(8) + 1
+    end do
+  end do
+
+  call check(results, expect, NbrTests)
+end program
@@ -0,0 +1,250 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for SPREAD of whole contiguous arrays, which are replicated
+!* directly: rank 1 to 2 and rank 2 to 3 along every DIM of 1, 4, 8 and
+!* 16 byte elements and of CHARACTER, NCOPIES of 0, 1, a few and enough
+!* to pass the 4 KB doubling, scalar sources and a strided source.  DIM
+!* and NCOPIES are variables.  The elements are their own indices and
+!* each result is the number of SPREADs that differ from a loop.
+
+program p
+  parameter(NbrTests=12)
+  parameter(NNC=5)
+  parameter(M=7, N=3)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+  integer :: nc(NNC)
+  data nc /0, 1, 2, 5, 700/
+
+  integer :: v1(M), v2(M, N), i, j, k, d
+  character*3 :: c1(M), c2(M, N)
+
+  results = 0
+  v1 = (/(i, i = 1, M)/)
+  v2 = reshape((/(i, i = 1, M * N)/), (/M, N/))
+  c1 = chars(v1)
+  c2 = chars(v2)
+
+  do k = 1, NNC
+    do d = 1, 2
+      call bad(1, test_i1_1(d, nc(k)))
+      call bad(2, test_i4_1(d, nc(k)))
+      call bad(3, test_c16_1(d, nc(k)))
+      call bad(4, test_ch_1(d, nc(k)))
+    enddo
+    do d = 1, 3
+      call bad(5, test_i4_2(d, nc(k)))
+      call bad(6, test_r8_2(d, nc(k)))
+      call bad(7, test_ch_2(d, nc(k)))
+    enddo
+    call bad(8, test_scalar(nc(k)))
+    do d = 1, 2
+      call bad(9, test_strided(d, nc(k)))
+    enddo
+  enddo
+
+  ! the shapes
+  d = 2
+  k = 0
+  if (any(shape(spread(v2, d, k)) .ne. (/M, 0, N/))) results(10) = 1
+  k = 4
+  if (any(shape(spread(v2, d, k)) .ne. (/M, 4, N/))) results(11) = 1
+  d = 3
+  if (any(shape(spread(c2, d, k)) .ne. (/M, N, 4/))) results(12) = 1
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  subroutine bad(t, b)
+    integer :: t
+    logical :: b
+    if (b) results(t) = results(t) + 1
+  end subroutine
+
+  ! The element of a CHARACTER test array with index n.
+  elemental character*3 function chars(n)
+    integer, intent(in) :: n
+    write(chars, '(i3.3)') n
+  end function
+
+  ! The index into v1 of element (i, j) of spread(v1, d, nc).
+  integer function s1(d, i, j)
+    integer :: d, i, j
+    s1 = merge(j, i, d .eq. 1)
+  end function
+
+  ! The index into v2 of element (i, j, k) of spread(v2, d, nc).
+  integer function s2(d, i, j, k)
+    integer :: d, i, j, k
+    select case (d)
+    case (1)
+      s2 = j + (k - 1) * M
+    case (2)
+      s2 = i + (k - 1) * M
+    case default
+      s2 = i + (j - 1) * M
+    end select
+  end function
+
+  ! The shape of spread of an array of shape e along d, ncopies n.
+  function spshape(e, d, n)
+    integer :: e(:), d, n
+    integer :: spshape(size(e) + 1)
+    spshape(1:d - 1) = e(1:d - 1)
+    spshape(d) = n
+    spshape(d + 1:) = e(d:)
+  end function
+
+  logical function test_i1_1(d, n)
+    integer :: d, n, e(2), i, j
+    integer*1, allocatable :: r(:, :)
+    e = spshape(shape(v1), d, n)
+    allocate(r(e(1), e(2)))
+    r = spread(int(v1, 1), d, n)
+    test_i1_1 = .false.
+    do j = 1, e(2)
+      do i = 1, e(1)
+        if (r(i, j) .ne. s1(d, i, j)) test_i1_1 = .true.
+      enddo
+    enddo
+  end function
+
+  logical function test_i4_1(d, n)
+    integer :: d, n, e(2), i, j
+    integer*4, allocatable :: r(:, :)
+    e = spshape(shape(v1), d, n)
+    allocate(r(e(1), e(2)))
+    r = spread(v1, d, n)
+    test_i4_1 = .false.
+    do j = 1, e(2)
+      do i = 1, e(1)
+        if (r(i, j) .ne. s1(d, i, j)) test_i4_1 = .true.
+      enddo
+    enddo
+  end function
+
+  logical function test_c16_1(d, n)
+    integer :: d, n, e(2), i, j
+    complex*16, allocatable :: r(:, :)
+    e = spshape(shape(v1), d, n)
+    allocate(r(e(1), e(2)))
+    r = spread(dcmplx(v1, -v1), d, n)
+    test_c16_1 = .false.
+    do j = 1, e(2)
+      do i = 1, e(1)
+        if (r(i, j) .ne. dcmplx(s1(d, i, j), -s1(d, i, j))) &
+          test_c16_1 = .true.
+      enddo
+    enddo
+  end function
+
+  logical function test_ch_1(d, n)
+    integer :: d, n, e(2), i, j
+    character*3, allocatable :: r(:, :)
+    e = spshape(shape(v1), d, n)
+    allocate(r(e(1), e(2)))
+    r = spread(c1, d, n)
+    test_ch_1 = .false.
+    do j = 1, e(2)
+      do i = 1, e(1)
+        if (r(i, j) .ne. chars(s1(d, i, j))) test_ch_1 = .true.
+      enddo
+    enddo
+  end function
+
+  logical function test_i4_2(d, n)
+    integer :: d, n, e(3), i, j, k
+    integer*4, allocatable :: r(:, :, :)
+    e = spshape(shape(v2), d, n)
+    allocate(r(e(1), e(2), e(3)))
+    r = spread(v2, d, n)
+    test_i4_2 = .false.
+    do k = 1, e(3)
+      do j = 1, e(2)
+        do i = 1, e(1)
+          if (r(i, j, k) .ne. s2(d, i, j, k)) test_i4_2 = .true.
+        enddo
+      enddo
+    enddo
+  end function
+
+  logical function test_r8_2(d, n)
+    integer :: d, n, e(3), i, j, k
+    real*8, allocatable :: r(:, :, :)
+    e = spshape(shape(v2), d, n)
+    allocate(r(e(1), e(2), e(3)))
+    r = spread(dble(v2), d, n)
+    test_r8_2 = .false.
+    do k = 1, e(3)
+      do j = 1, e(2)
+        do i = 1, e(1)
+          if (r(i, j, k) .ne. s2(d, i, j, k)) test_r8_2 = .true.
+        enddo
+      enddo
+    enddo
+  end function
+
+  logical function test_ch_2(d, n)
+    integer :: d, n, e(3), i, j, k
+    character*3, allocatable :: r(:, :, :)
+    e = spshape(shape(v2), d, n)
+    allocate(r(e(1), e(2), e(3)))
+    r = spread(c2, d, n)
+    test_ch_2 = .false.
+    do k = 1, e(3)
+      do j = 1, e(2)
+        do i = 1, e(1)
+          if (r(i, j, k) .ne. chars(s2(d, i, j, k))) test_ch_2 = .true.
+        enddo
+      enddo
+    enddo
+  end function
+
+  ! scalar sources
+  logical function test_scalar(n)
+    integer :: n
+    integer*2, allocatable :: r2(:)
+    complex*16, allocatable :: r16(:)
+    character*3, allocatable :: rc(:)
+    allocate(r2(n), r16(n), rc(n))
+    r2 = spread(-7_2, 1, n)
+    r16 = spread((1.0d0, -2.0d0), 1, n)
+    rc = spread(c1(4), 1, n)
+    test_scalar = any(r2 .ne. -7) .or. any(r16 .ne. (1.0d0, -2.0d0)) .or. &
+                  any(rc .ne. c1(4))
+  end function
+
+  ! a strided source and a result section
+  logical function test_strided(d, n)
+    integer :: d, n, e(2), i, j
+    integer, allocatable :: r(:, :), w(:, :)
+    e = spshape((/(M + 1) / 2/), d, n)
+    allocate(r(e(1), e(2)), w(e(1) + 2, e(2)))
+    r = spread(v1(1:M:2), d, n)
+    w = 0
+    w(2:e(1) + 1, :) = spread(v1(1:M:2), d, n)
+    test_strided = any(w(1, :) .ne. 0) .or. any(w(e(1) + 2, :) .ne. 0)
+    do j = 1, e(2)
+      do i = 1, e(1)
+        if (r(i, j) .ne. 2 * s1(d, i, j) - 1 .or. &
+            w(i + 1, j) .ne. 2 * s1(d, i, j) - 1) test_strided = .true.
+      enddo
+    enddo
+  end function
+
+end program
@@ -0,0 +1,236 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for the unmasked SUM kernels: every kind, lengths around the
+!* vector width and unroll factor, contiguous, strided and reversed
+!* arrays, SUM with DIM, and infinities and NaNs.  The elements are small
+!* integers whose partial sums stay small, so every summation order gives
+!* the same result.  Each result is the number of lengths for which SUM
+!* differs from a loop.
+
+program p
+  use ieee_arithmetic
+  parameter(NbrTests=14)
+  parameter(NLEN=19)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  integer :: lens(NLEN)
+  data lens /0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 255, 256, &
+             257, 1000, 4099/
+  data expect /NbrTests*0/
+
+  real*4 :: s4(8)
+  real*8 :: s8(8), d8(6, 5)
+  complex*8 :: c8(3)
+  integer :: k
+
+  results = 0
+  do k = 1, NLEN
+    results(1) = results(1) + test_i1(lens(k))
+    results(2) = results(2) + test_i2(lens(k))
+    results(3) = results(3) + test_i4(lens(k))
+    results(4) = results(4) + test_i8(lens(k))
+    results(5) = results(5) + test_r4(lens(k))
+    results(6) = results(6) + test_r8(lens(k))
+    results(7) = results(7) + test_c8(lens(k))
+    results(8) = results(8) + test_c16(lens(k))
+  enddo
+
+  ! DIM
+  do k = 1, 5
+    d8(:, k) = (/1, 2, 3, 4, 5, 6/) * k
+  enddo
+  if (any(sum(d8, dim=1) .ne. (/21, 42, 63, 84, 105/))) results(9) = 1
+  if (any(sum(d8, dim=2) .ne. (/15, 30, 45, 60, 75, 90/))) results(10) = 1
+
+  ! an infinity stays infinite, opposite infinities and NaNs give NaN
+  s4 = 1.0
+  s4(6) = ieee_value(s4(6), ieee_positive_inf)
+  if (sum(s4) .ne. s4(6)) results(11) = 1
+  s8 = 1.0d0
+  s8(3) = ieee_value(s8(3), ieee_negative_inf)
+  s8(7) = ieee_value(s8(7), ieee_positive_inf)
+  if (.not. ieee_is_nan(sum(s8))) results(12) = 1
+  s8 = 1.0d0
+  s8(8) = ieee_value(s8(8), ieee_quiet_nan)
+  if (.not. ieee_is_nan(sum(s8))) results(13) = 1
+  c8 = (1.0, 1.0)
+  c8(2) = cmplx(1.0, ieee_value(1.0, ieee_positive_inf))
+  if (real(sum(c8)) .ne. 3.0 .or. aimag(sum(c8)) .ne. aimag(c8(2))) &
+    results(14) = 1
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  ! Element i of a test array, in [-8, 8].
+  integer function v(i)
+    integer :: i
+    v = mod(i * 7, 17) - 8
+  end function
+
+  integer function test_i1(n)
+    integer :: n, i
+    integer*1 :: a(2*n), r, rs, rr
+    do i = 1, 2*n
+      a(i) = mod(i, 3) - 1
+    enddo
+    r = 0
+    rs = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i)
+      rs = rs + a(2*i - 1)
+      rr = rr + a(n + 1 - i)
+    enddo
+    test_i1 = 0
+    if (sum(a(1:n)) .ne. r .or. sum(a(1:2*n:2)) .ne. rs .or. &
+        sum(a(n:1:-1)) .ne. rr) test_i1 = 1
+  end function
+
+  integer function test_i2(n)
+    integer :: n, i
+    integer*2 :: a(2*n), r, rs, rr
+    do i = 1, 2*n
+      a(i) = v(i)
+    enddo
+    r = 0
+    rs = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i)
+      rs = rs + a(2*i - 1)
+      rr = rr + a(n + 1 - i)
+    enddo
+    test_i2 = 0
+    if (sum(a(1:n)) .ne. r .or. sum(a(1:2*n:2)) .ne. rs .or. &
+        sum(a(n:1:-1)) .ne. rr) test_i2 = 1
+  end function
+
+  integer function test_i4(n)
+    integer :: n, i
+    integer*4 :: a(2*n), r, rs, rr
+    do i = 1, 2*n
+      a(i) = v(i) * 1000
+    enddo
+    r = 0
+    rs = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i)
+      rs = rs + a(2*i - 1)
+      rr = rr + a(n + 1 - i)
+    enddo
+    test_i4 = 0
+    if (sum(a(1:n)) .ne. r .or. sum(a(1:2*n:2)) .ne. rs .or. &
+        sum(a(n:1:-1)) .ne. rr) test_i4 = 1
+  end function
+
+  integer function test_i8(n)
+    integer :: n, i
+    integer*8 :: a(2*n), r, rs, rr
+    do i = 1, 2*n
+      a(i) = v(i) * 1000000000_8
+    enddo
+    r = 0
+    rs = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i)
+      rs = rs + a(2*i - 1)
+      rr = rr + a(n + 1 - i)
+    enddo
+    test_i8 = 0
+    if (sum(a(1:n)) .ne. r .or. sum(a(1:2*n:2)) .ne. rs .or. &
+        sum(a(n:1:-1)) .ne. rr) test_i8 = 1
+  end function
+
+  integer function test_r4(n)
+    integer :: n, i
+    real*4 :: a(2*n), r, rs, rr
+    do i = 1, 2*n
+      a(i) = v(i)
+    enddo
+    r = 0
+    rs = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i)
+      rs = rs + a(2*i - 1)
+      rr = rr + a(n + 1 - i)
+    enddo
+    test_r4 = 0
+    if (sum(a(1:n)) .ne. r .or. sum(a(1:2*n:2)) .ne. rs .or. &
+        sum(a(n:1:-1)) .ne. rr) test_r4 = 1
+  end function
+
+  integer function test_r8(n)
+    integer :: n, i
+    real*8 :: a(2*n), r, rs, rr
+    do i = 1, 2*n
+      a(i) = v(i) * 0.5d0
+    enddo
+    r = 0
+    rs = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i)
+      rs = rs + a(2*i - 1)
+      rr = rr + a(n + 1 - i)
+    enddo
+    test_r8 = 0
+    if (sum(a(1:n)) .ne. r .or. sum(a(1:2*n:2)) .ne. rs .or. &
+        sum(a(n:1:-1)) .ne. rr) test_r8 = 1
+  end function
+
+  integer function test_c8(n)
+    integer :: n, i
+    complex*8 :: a(2*n), r, rs, rr
+    do i = 1, 2*n
+      a(i) = cmplx(v(i), v(i + 5))
+    enddo
+    r = 0
+    rs = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i)
+      rs = rs + a(2*i - 1)
+      rr = rr + a(n + 1 - i)
+    enddo
+    test_c8 = 0
+    if (sum(a(1:n)) .ne. r .or. sum(a(1:2*n:2)) .ne. rs .or. &
+        sum(a(n:1:-1)) .ne. rr) test_c8 = 1
+  end function
+
+  integer function test_c16(n)
+    integer :: n, i
+    complex*16 :: a(2*n), r, rs, rr
+    do i = 1, 2*n
+      a(i) = dcmplx(v(i), v(i + 3))
+    enddo
+    r = 0
+    rs = 0
+    rr = 0
+    do i = 1, n
+      r = r + a(i)
+      rs = rs + a(2*i - 1)
+      rr = rr + a(n + 1 - i)
+    enddo
+    test_c16 = 0
+    if (sum(a(1:n)) .ne. r .or. sum(a(1:2*n:2)) .ne. rs .or. &
+        sum(a(n:1:-1)) .ne. rr) test_c16 = 1
+  end function
+
+end program
@@ -0,0 +1,131 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for the pairwise SUM kernels, run with F90_SUM_PAIRWISE=1: real
+!* and complex sums of 2**20 (complex: 2**18) copies of 0.1, contiguous,
+!* strided and with DIM, must be within 64 ulps of the exact sum, which a
+!* pairwise sum meets with room to spare and a sequential or blocked one
+!* misses by thousands of ulps.  Small integer-valued sums must be exact,
+!* an infinity must stay infinite and a NaN must give NaN.
+
+program p
+  use ieee_arithmetic
+  parameter(NbrTests=12)
+  parameter(N=2**20)
+  parameter(NC=2**18)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+
+  real*4, allocatable :: a4(:), b4(:, :)
+  real*8, allocatable :: a8(:)
+  complex*8, allocatable :: c8(:)
+  complex*16, allocatable :: c16(:)
+  real*4 :: s4
+  real*8 :: s8
+  complex*8 :: z8
+  complex*16 :: z16
+  integer :: i
+
+  results = 0
+
+  allocate(a4(2*N))
+  a4 = 0.1
+  a4(2:2*N:2) = 1.0e6
+  if (bad4(sum(a4(1:2*N:2)), N * dble(a4(1)))) results(1) = 1
+  a4 = 0.1
+  if (bad4(sum(a4(1:N)), N * dble(a4(1)))) results(2) = 1
+  deallocate(a4)
+
+  allocate(a8(2*N))
+  a8 = 0.1d0
+  a8(2:2*N:2) = 1.0d6
+  if (bad8(sum(a8(1:2*N:2)), N * a8(1))) results(3) = 1
+  a8 = 0.1d0
+  if (bad8(sum(a8(1:N)), N * a8(1))) results(4) = 1
+  deallocate(a8)
+
+  allocate(c8(2*NC))
+  c8 = (0.1, -0.1)
+  z8 = sum(c8(1:NC))
+  if (bad4(real(z8), NC * dble(real(c8(1)))) .or. &
+      bad4(aimag(z8), NC * dble(aimag(c8(1))))) results(5) = 1
+  z8 = sum(c8(1:2*NC:2))
+  if (bad4(real(z8), NC * dble(real(c8(1)))) .or. &
+      bad4(aimag(z8), NC * dble(aimag(c8(1))))) results(6) = 1
+  deallocate(c8)
+
+  allocate(c16(2*NC))
+  c16 = (0.1d0, -0.1d0)
+  z16 = sum(c16(1:2*NC:2))
+  if (bad8(dble(z16), NC * dble(c16(1))) .or. &
+      bad8(dimag(z16), NC * dimag(c16(1)))) results(7) = 1
+  deallocate(c16)
+
+  ! DIM, along and across the contiguous dimension
+  allocate(b4(NC, 4))
+  b4 = 0.1
+  if (any(bad4v(sum(b4, dim=1), NC * dble(b4(1, 1))))) results(8) = 1
+  deallocate(b4)
+  allocate(b4(4, NC))
+  b4 = 0.1
+  if (any(bad4v(sum(b4, dim=2), NC * dble(b4(1, 1))))) results(9) = 1
+  deallocate(b4)
+
+  ! small integers add up exactly in any order
+  allocate(a8(4099))
+  do i = 1, 4099
+    a8(i) = mod(i * 7, 17) - 8
+  enddo
+  s8 = 0
+  do i = 1, 4099
+    s8 = s8 + a8(i)
+  enddo
+  if (sum(a8) .ne. s8 .or. sum(a8(4099:1:-1)) .ne. s8) results(10) = 1
+  deallocate(a8)
+
+  ! an infinity stays infinite, a NaN gives NaN
+  allocate(a4(1000))
+  a4 = 1.0
+  a4(700) = ieee_value(s4, ieee_negative_inf)
+  if (sum(a4) .ne. a4(700) .or. sum(a4(1:1000:3)) .ne. a4(700)) &
+    results(11) = 1
+  a4(700) = 1.0
+  a4(999) = ieee_value(s4, ieee_quiet_nan)
+  if (.not. ieee_is_nan(sum(a4))) results(12) = 1
+  deallocate(a4)
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  logical function bad4(s, x)
+    real*4 :: s
+    real*8 :: x
+    bad4 = abs(s - x) > 64 * epsilon(s) * abs(x)
+  end function
+
+  logical function bad8(s, x)
+    real*8 :: s, x
+    bad8 = abs(s - x) > 64 * epsilon(s) * abs(x)
+  end function
+
+  elemental logical function bad4v(s, x)
+    real*4, intent(in) :: s
+    real*8, intent(in) :: x
+    bad4v = abs(s - x) > 64 * epsilon(s) * abs(x)
+  end function
+
+end program
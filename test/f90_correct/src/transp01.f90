@@ -0,0 +1,374 @@
+!** Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!**
+!** Licensed under the Apache License, Version 2.0 (the "License");
+!** you may not use this file except in compliance with the License.
+!** You may obtain a copy of the License at
+!**
+!**     http://www.apache.org/licenses/LICENSE-2.0
+!**
+!** Unless required by applicable law or agreed to in writing, software
+!** distributed under the License is distributed on an "AS IS" BASIS,
+!** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!** See the License for the specific language governing permissions and
+!** limitations under the License.
+
+!* Tests for the blocked transpose: TRANSPOSE and RESHAPE with
+!* ORDER=(2,1) of 1, 2, 4, 8 and 16 byte elements and of CHARACTER, in
+!* shapes that are not multiples of the tile and large enough to be
+!* split, square arrays transposed onto themselves, and the buffer
+!* routines of the transposed MATMUL with ALPHA other than 1 and with
+!* conjugated complex elements.  The elements are their own indices and
+!* each result is the number of shapes for which a transpose differs
+!* from a loop.
+
+program p
+  parameter(NbrTests=17)
+  parameter(NSH=9)
+
+  integer :: results(NbrTests)
+  integer :: expect(NbrTests)
+  data expect /NbrTests*0/
+  integer :: rows(NSH), cols(NSH)
+  data rows /1, 1, 7, 8, 9, 33, 17, 100, 130/
+  data cols /1, 13, 5, 8, 16, 7, 64, 37, 257/
+  integer :: sq(7)
+  data sq /1, 2, 7, 32, 33, 65, 100/
+  integer :: k
+
+  results = 0
+  do k = 1, NSH
+    results(1) = results(1) + test_i1(rows(k), cols(k))
+    results(2) = results(2) + test_i2(rows(k), cols(k))
+    results(3) = results(3) + test_i4(rows(k), cols(k))
+    results(4) = results(4) + test_r8(rows(k), cols(k))
+    results(5) = results(5) + test_c16(rows(k), cols(k))
+    results(6) = results(6) + test_ch(rows(k), cols(k))
+    results(7) = results(7) + test_reshape(rows(k), cols(k))
+    results(8) = results(8) + test_alloc(rows(k), cols(k))
+    results(9) = results(9) + test_buf_r4(rows(k), cols(k))
+    results(10) = results(10) + test_buf_r8(rows(k), cols(k))
+    results(11) = results(11) + test_buf_c8(rows(k), cols(k), 1)
+    results(12) = results(12) + test_buf_c8(rows(k), cols(k), 2)
+    results(13) = results(13) + test_buf_c16(rows(k), cols(k), 1)
+    results(14) = results(14) + test_buf_c16(rows(k), cols(k), 2)
+  enddo
+  do k = 1, size(sq)
+    results(15) = results(15) + test_sq_r4(sq(k))
+    results(16) = results(16) + test_sq_c16(sq(k))
+    results(17) = results(17) + test_sq_ch(sq(k))
+  enddo
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  ! Element (i, j) of an m x n test matrix.
+  elemental integer function v(i, j, m)
+    integer, intent(in) :: i, j, m
+    v = i + (j - 1) * m
+  end function
+
+  ! The element of a CHARACTER test array with index n.
+  elemental character*5 function chars(n)
+    integer, intent(in) :: n
+    write(chars, '(i5.5)') n
+  end function
+
+  integer function test_i1(m, n)
+    integer :: m, n, i, j
+    integer*1 :: a(m, n), r(n, m)
+    do j = 1, n
+      do i = 1, m
+        a(i, j) = int(mod(v(i, j, m), 127), 1)
+      enddo
+    enddo
+    r = transpose(a)
+    test_i1 = 0
+    do j = 1, n
+      do i = 1, m
+        if (r(j, i) .ne. a(i, j)) test_i1 = 1
+      enddo
+    enddo
+  end function
+
+  integer function test_i2(m, n)
+    integer :: m, n, i, j
+    integer*2 :: a(m, n), r(n, m)
+    do j = 1, n
+      do i = 1, m
+        a(i, j) = v(i, j, m)
+      enddo
+    enddo
+    r = transpose(a)
+    test_i2 = 0
+    do j = 1, n
+      do i = 1, m
+        if (r(j, i) .ne. a(i, j)) test_i2 = 1
+      enddo
+    enddo
+  end function
+
+  integer function test_i4(m, n)
+    integer :: m, n, i, j
+    integer*4 :: a(m, n), r(n, m)
+    do j = 1, n
+      do i = 1, m
+        a(i, j) = v(i, j, m)
+      enddo
+    enddo
+    r = transpose(a)
+    test_i4 = 0
+    do j = 1, n
+      do i = 1, m
+        if (r(j, i) .ne. a(i, j)) test_i4 = 1
+      enddo
+    enddo
+  end function
+
+  integer function test_r8(m, n)
+    integer :: m, n, i, j
+    real*8 :: a(m, n), r(n, m)
+    do j = 1, n
+      do i = 1, m
+        a(i, j) = v(i, j, m)
+      enddo
+    enddo
+    r = transpose(a)
+    test_r8 = 0
+    do j = 1, n
+      do i = 1, m
+        if (r(j, i) .ne. a(i, j)) test_r8 = 1
+      enddo
+    enddo
+  end function
+
+  integer function test_c16(m, n)
+    integer :: m, n, i, j
+    complex*16 :: a(m, n), r(n, m)
+    do j = 1, n
+      do i = 1, m
+        a(i, j) = dcmplx(v(i, j, m), -j)
+      enddo
+    enddo
+    r = transpose(a)
+    test_c16 = 0
+    do j = 1, n
+      do i = 1, m
+        if (r(j, i) .ne. a(i, j)) test_c16 = 1
+      enddo
+    enddo
+  end function
+
+  integer function test_ch(m, n)
+    integer :: m, n, i, j
+    character*5 :: a(m, n), r(n, m)
+    do j = 1, n
+      do i = 1, m
+        a(i, j) = chars(v(i, j, m))
+      enddo
+    enddo
+    r = transpose(a)
+    test_ch = 0
+    do j = 1, n
+      do i = 1, m
+        if (r(j, i) .ne. a(i, j)) test_ch = 1
+      enddo
+    enddo
+  end function
+
+  ! RESHAPE with ORDER=(2,1) fills the result by rows.
+  integer function test_reshape(m, n)
+    integer :: m, n, i, j
+    integer*2 :: s2(m * n), r2(m, n)
+    real*4 :: s4(m * n), r4(m, n)
+    complex*16 :: s16(m * n), r16(m, n)
+    character*5 :: sc(m * n), rc(m, n)
+    do i = 1, m * n
+      s2(i) = i
+      s4(i) = i
+      s16(i) = dcmplx(i, -i)
+      sc(i) = chars(i)
+    enddo
+    r2 = reshape(s2, (/m, n/), order=(/2, 1/))
+    r4 = reshape(s4, (/m, n/), order=(/2, 1/))
+    r16 = reshape(s16, (/m, n/), order=(/2, 1/))
+    rc = reshape(sc, (/m, n/), order=(/2, 1/))
+    test_reshape = 0
+    do j = 1, n
+      do i = 1, m
+        if (r2(i, j) .ne. s2(j + (i - 1) * n) .or. &
+            r4(i, j) .ne. s4(j + (i - 1) * n) .or. &
+            r16(i, j) .ne. s16(j + (i - 1) * n) .or. &
+            rc(i, j) .ne. sc(j + (i - 1) * n)) test_reshape = 1
+      enddo
+    enddo
+  end function
+
+  ! TRANSPOSE of allocatable arrays, to an allocatable result.
+  integer function test_alloc(m, n)
+    integer :: m, n, i, j
+    real*4, allocatable :: a(:, :), r(:, :)
+    allocate(a(m, n))
+    do j = 1, n
+      do i = 1, m
+        a(i, j) = v(i, j, m)
+      enddo
+    enddo
+    r = transpose(a)
+    test_alloc = 0
+    if (size(r, 1) .ne. n .or. size(r, 2) .ne. m) then
+      test_alloc = 1
+      return
+    endif
+    do j = 1, n
+      do i = 1, m
+        if (r(j, i) .ne. a(i, j)) test_alloc = 1
+      enddo
+    enddo
+  end function
+
+  ! Square arrays transposed onto themselves.
+  integer function test_sq_r4(n)
+    integer :: n, i, j
+    real*4 :: a(n, n)
+    do j = 1, n
+      do i = 1, n
+        a(i, j) = v(i, j, n)
+      enddo
+    enddo
+    a = transpose(a)
+    test_sq_r4 = 0
+    do j = 1, n
+      do i = 1, n
+        if (a(j, i) .ne. v(i, j, n)) test_sq_r4 = 1
+      enddo
+    enddo
+  end function
+
+  integer function test_sq_c16(n)
+    integer :: n, i, j
+    complex*16, allocatable :: a(:, :)
+    allocate(a(n, n))
+    do j = 1, n
+      do i = 1, n
+        a(i, j) = dcmplx(v(i, j, n), -i)
+      enddo
+    enddo
+    a = transpose(a)
+    test_sq_c16 = 0
+    do j = 1, n
+      do i = 1, n
+        if (a(j, i) .ne. dcmplx(v(i, j, n), -i)) test_sq_c16 = 1
+      enddo
+    enddo
+  end function
+
+  integer function test_sq_ch(n)
+    integer :: n, i, j
+    character*5 :: a(n, n)
+    do j = 1, n
+      do i = 1, n
+        a(i, j) = chars(v(i, j, n))
+      enddo
+    enddo
+    a = transpose(a)
+    test_sq_ch = 0
+    do j = 1, n
+      do i = 1, n
+        if (a(j, i) .ne. chars(v(i, j, n))) test_sq_ch = 1
+      enddo
+    enddo
+  end function
+
+  ! buf(m, n) = alpha * transpose(a(1:n, 1:m)), a having leading
+  ! dimension n + 3; the buffer routines take it as an INTEGER*8.
+  integer function test_buf_r4(m, n)
+    integer :: m, n, i, j
+    integer*8 :: lda
+    real*4 :: a(n + 3, m), buf(m, n), alpha
+    a = -1
+    do j = 1, m
+      do i = 1, n
+        a(i, j) = v(i, j, n)
+      enddo
+    enddo
+    lda = n + 3
+    alpha = -2.5
+    call ftn_transpose_real4(a, lda, alpha, buf, m, n)
+    test_buf_r4 = 0
+    do j = 1, m
+      do i = 1, n
+        if (buf(j, i) .ne. alpha * a(i, j)) test_buf_r4 = 1
+      enddo
+    enddo
+  end function
+
+  integer function test_buf_r8(m, n)
+    integer :: m, n, i, j
+    integer*8 :: lda
+    real*8 :: a(n + 3, m), buf(m, n), alpha
+    a = -1
+    do j = 1, m
+      do i = 1, n
+        a(i, j) = v(i, j, n)
+      enddo
+    enddo
+    lda = n + 3
+    alpha = 0.5d0
+    call ftn_transpose_real8(a, lda, alpha, buf, m, n)
+    test_buf_r8 = 0
+    do j = 1, m
+      do i = 1, n
+        if (buf(j, i) .ne. alpha * a(i, j)) test_buf_r8 = 1
+      enddo
+    enddo
+  end function
+
+  ! ta == 2 conjugates the elements as well.
+  integer function test_buf_c8(m, n, ta)
+    integer :: m, n, ta, i, j
+    integer*8 :: lda
+    complex*8 :: a(n + 3, m), buf(m, n), alpha, x
+    a = (-1.0, -1.0)
+    do j = 1, m
+      do i = 1, n
+        a(i, j) = cmplx(v(i, j, n), -j)
+      enddo
+    enddo
+    lda = n + 3
+    alpha = (2.0, -1.0)
+    call ftn_transpose_cmplx8(ta, a, lda, alpha, buf, m, n)
+    test_buf_c8 = 0
+    do j = 1, m
+      do i = 1, n
+        x = a(i, j)
+        if (ta .eq. 2) x = conjg(x)
+        if (buf(j, i) .ne. alpha * x) test_buf_c8 = 1
+      enddo
+    enddo
+  end function
+
+  integer function test_buf_c16(m, n, ta)
+    integer :: m, n, ta, i, j
+    integer*8 :: lda
+    complex*16 :: a(n + 3, m), buf(m, n), alpha, x
+    a = (-1.0d0, -1.0d0)
+    do j = 1, m
+      do i = 1, n
+        a(i, j) = dcmplx(v(i, j, n), -j)
+      enddo
+    enddo
+    lda = n + 3
+    alpha = (0.0d0, 3.0d0)
+    call ftn_transpose_cmplx16(ta, a, lda, alpha, buf, m, n)
+    test_buf_c16 = 0
+    do j = 1, m
+      do i = 1, n
+        x = a(i, j)
+        if (ta .eq. 2) x = conjg(x)
+        if (buf(j, i) .ne. alpha * x) test_buf_c16 = 1
+      enddo
+    enddo
+  end function
+
+end program
@@ -0,0 +1,116 @@
+!* Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!*
+!* Licensed under the Apache License, Version 2.0 (the "License");
+!* you may not use this file except in compliance with the License.
+!* You may obtain a copy of the License at
+!*
+!*     http://www.apache.org/licenses/LICENSE-2.0
+!*
+!* Unless required by applicable law or agreed to in writing, software
+!* distributed under the License is distributed on an "AS IS" BASIS,
+!* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!* See the License for the specific language governing permissions and
+!* limitations under the License.
+
+!       I/O statements from several threads at once: each thread writes
+!       and reads its own unit and internal files, all threads write whole
+!       records to one shared unit, and threads inquire by file name about
+!       files another thread keeps opening and closing.  Each result is
+!       the number of wrong or missing records.
+
+program io01
+use omp_lib
+integer, parameter :: NT = 4, NREC = 500, NTESTS = 5
+integer :: results(NTESTS), expect(NTESTS)
+integer :: t, i, u, a, b, c, ios, cnt(0:NT-1), num
+character(len=16) :: fname, line
+logical :: ex, op
+
+expect = 0
+results = 0
+call omp_set_dynamic(.false.)
+call omp_set_num_threads(NT)
+
+! 1: own unit per thread, 2: internal files
+!$omp parallel private(t, i, u, fname, line, a, b) &
+!$omp reduction(+:results)
+t = omp_get_thread_num()
+u = 20 + t
+write(fname, '(a,i1,a)') 'io01_', t, '.dat'
+open(u, file=fname, status='replace', form='formatted')
+do i = 1, NREC
+    write(u, '(2i8)') t, i
+    write(line, '(i6,i6)') t, i * 3
+    read(line, *) a, b
+    if (a .ne. t .or. b .ne. i * 3) results(2) = results(2) + 1
+enddo
+close(u)
+!$omp end parallel
+
+do t = 0, NT - 1
+    write(fname, '(a,i1,a)') 'io01_', t, '.dat'
+    open(40, file=fname, status='old', form='formatted')
+    do i = 1, NREC
+        read(40, '(2i8)', iostat=ios) a, b
+        if (ios .ne. 0 .or. a .ne. t .or. b .ne. i) results(1) = results(1) + 1
+    enddo
+    read(40, '(2i8)', iostat=ios) a, b
+    if (ios .eq. 0) results(1) = results(1) + 1
+    close(40, status='delete')
+enddo
+
+! 3: whole records from every thread on one shared unit
+open(30, file='io01_shared.dat', status='replace', form='formatted')
+!$omp parallel private(t, i)
+t = omp_get_thread_num()
+do i = 1, NREC
+    write(30, '(3i8)') t, i, t
+enddo
+!$omp end parallel
+close(30)
+
+cnt = 0
+open(30, file='io01_shared.dat', status='old', form='formatted')
+do
+    read(30, '(3i8)', iostat=ios) a, b, c
+    if (ios .ne. 0) exit
+    if (a .lt. 0 .or. a .ge. NT .or. c .ne. a) then
+        results(3) = results(3) + 1
+    else
+        cnt(a) = cnt(a) + 1
+        if (b .ne. cnt(a)) results(3) = results(3) + 1
+    endif
+enddo
+close(30, status='delete')
+do t = 0, NT - 1
+    if (cnt(t) .ne. NREC) results(3) = results(3) + 1
+enddo
+
+! 4: inquire by file name while another thread opens and closes it,
+! 5: inquire by unit meanwhile
+!$omp parallel private(t, i, fname, ex, op, num, u) reduction(+:results)
+t = omp_get_thread_num()
+u = 50 + t
+if (mod(t, 2) .eq. 0) then
+    write(fname, '(a,i1,a)') 'io01_q', t, '.dat'
+    do i = 1, NREC
+        open(u, file=fname, status='unknown', form='formatted')
+        write(u, '(i8)') i
+        close(u)
+    enddo
+    open(u, file=fname, status='old')
+    close(u, status='delete')
+else
+    write(fname, '(a,i1,a)') 'io01_q', t - 1, '.dat'
+    do i = 1, NREC
+        inquire(file=fname, opened=op, number=num)
+        if (op .and. num .ne. u - 1) results(4) = results(4) + 1
+        inquire(unit=u - 1, opened=op)
+    enddo
+    inquire(unit=u, opened=op)
+    if (op) results(5) = results(5) + 1
+endif
+!$omp end parallel
+
+call check(results, expect, NTESTS)
+end
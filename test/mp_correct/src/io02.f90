@@ -0,0 +1,154 @@
+!* Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!*
+!* Licensed under the Apache License, Version 2.0 (the "License");
+!* you may not use this file except in compliance with the License.
+!* You may obtain a copy of the License at
+!*
+!*     http://www.apache.org/licenses/LICENSE-2.0
+!*
+!* Unless required by applicable law or agreed to in writing, software
+!* distributed under the License is distributed on an "AS IS" BASIS,
+!* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!* See the License for the specific language governing permissions and
+!* limitations under the License.
+
+!       Recursive I/O from several threads at once: pairs of threads
+!       each write a unit from a function called while writing the
+!       other's, on units with their own locks and on units that share
+!       one, and statements nested deeper than the runtime once tracked.
+!       A deadlock hangs the test.  Each record is one item, unit * 100000
+!       plus its number, negated for the outer statements, so that nothing
+!       of an outer record is written before its function returns.  Each
+!       result is the number of wrong or missing records.
+
+module rec
+integer, parameter :: NT = 4, NREC = 300, NDEEP = 40, M = 100000
+contains
+    ! write record i to unit u and return i
+    integer function wr(u, i)
+    integer :: u, i
+    write(u, '(i8)') u * M + i
+    wr = i
+    end function
+
+    ! n statements deep, through internal files
+    recursive integer function deep(n) result(r)
+    integer :: n
+    character(len=16) :: line
+    if (n .le. 1) then
+        r = 1
+    else
+        write(line, '(i8)') deep(n - 1) + 1
+        read(line, '(i8)') r
+    endif
+    end function
+end module
+
+program io02
+use omp_lib
+use rec
+integer :: results(4), expect(4)
+integer :: t, i, k, u, v, ios, a, b, c, d, p
+integer :: units(0:NT-1, 2)
+character(len=16) :: fname
+logical :: op
+
+expect = 0
+results = 0
+call omp_set_dynamic(.false.)
+call omp_set_num_threads(NT)
+
+! 1: threads 2p and 2p+1 write units 10+2p and 11+2p, each from a
+!    function called while writing the other's.
+! 2: thread 2p writes unit 10+2p from a function called while writing
+!    11+2p, and thread 2p+1 writes 74+2p while writing 75+2p: different
+!    units, but they share locks if units 64 apart do.
+do k = 1, 2
+    do t = 0, NT - 1
+        p = t / 2
+        if (k .eq. 1) then
+            units(t, 1) = 10 + 2 * p + mod(t, 2)
+            units(t, 2) = 11 + 2 * p - mod(t, 2)
+        else
+            units(t, 1) = 10 + 2 * p + 65 * mod(t, 2)
+            units(t, 2) = 11 + 2 * p + 63 * mod(t, 2)
+        endif
+    enddo
+    do t = 0, NT - 1
+        do i = 1, 2
+            u = units(t, i)
+            inquire(unit=u, opened=op)
+            if (op) cycle
+            write(fname, '(a,i3.3,a)') 'io02_', u, '.dat'
+            open(u, file=fname, status='replace', form='formatted')
+        enddo
+    enddo
+    !$omp parallel private(t, i, u, v)
+    t = omp_get_thread_num()
+    u = units(t, 1)
+    v = units(t, 2)
+    do i = 1, NREC
+        write(u, '(i8)') -(u * M + wr(v, i))
+    enddo
+    !$omp end parallel
+    do t = 0, NT - 1
+        do i = 1, 2
+            u = units(t, i)
+            inquire(unit=u, opened=op)
+            if (.not. op) cycle
+            close(u)
+            write(fname, '(a,i3.3,a)') 'io02_', u, '.dat'
+            open(u, file=fname, status='old', form='formatted')
+            a = 0
+            b = 0
+            do
+                read(u, '(i8)', iostat=ios) c
+                if (ios .ne. 0) exit
+                d = mod(abs(c), M)
+                if (abs(c) / M .ne. u) then
+                    results(k) = results(k) + 1
+                else if (c .gt. 0) then
+                    ! records written by the nested statements, in order
+                    a = a + 1
+                    if (d .ne. a) results(k) = results(k) + 1
+                else
+                    ! records of the outer statements, in order
+                    b = b + 1
+                    if (d .ne. b) results(k) = results(k) + 1
+                endif
+            enddo
+            if (a .ne. NREC * count(units(:, 2) .eq. u)) &
+                results(k) = results(k) + 1
+            if (b .ne. NREC * count(units(:, 1) .eq. u)) &
+                results(k) = results(k) + 1
+            close(u, status='delete')
+        enddo
+    enddo
+enddo
+
+! 3: internal files NDEEP statements deep on half the threads, while
+! 4: the other half write and read back their own units
+!$omp parallel private(t, i, u, c, d, ios, fname) reduction(+:results)
+t = omp_get_thread_num()
+if (mod(t, 2) .eq. 0) then
+    do i = 1, NREC / 10
+        if (deep(NDEEP) .ne. NDEEP) results(3) = results(3) + 1
+    enddo
+else
+    u = 60 + t
+    write(fname, '(a,i3.3,a)') 'io02_', u, '.dat'
+    open(u, file=fname, status='replace', form='formatted')
+    do i = 1, NREC
+        write(u, '(2i8)') u, i
+    enddo
+    rewind(u)
+    do i = 1, NREC
+        read(u, '(2i8)', iostat=ios) c, d
+        if (ios .ne. 0 .or. c .ne. u .or. d .ne. i) results(4) = results(4) + 1
+    enddo
+    close(u, status='delete')
+endif
+!$omp end parallel
+
+call check(results, expect, 4)
+end
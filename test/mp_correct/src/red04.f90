@@ -0,0 +1,115 @@
+!* Copyright (c) 2018, NVIDIA CORPORATION.  All rights reserved.
+!*
+!* Licensed under the Apache License, Version 2.0 (the "License");
+!* you may not use this file except in compliance with the License.
+!* You may obtain a copy of the License at
+!*
+!*     http://www.apache.org/licenses/LICENSE-2.0
+!*
+!* Unless required by applicable law or agreed to in writing, software
+!* distributed under the License is distributed on an "AS IS" BASIS,
+!* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+!* See the License for the specific language governing permissions and
+!* limitations under the License.
+
+!       Array intrinsic reductions large enough to be spread over the
+!       threads of a parallel region, for several team sizes, with a
+!       dynamic team that may be smaller than asked for, and from inside
+!       a parallel region.  The values are small integers, so real sums
+!       are exact whatever the partition.
+
+module data
+integer, parameter :: N = 1200000
+integer, parameter :: N1 = 1500, N2 = 800
+integer, parameter :: NSIZES = 5
+integer, parameter :: NPER = 8
+integer, parameter :: NTESTS = NSIZES*NPER + 1
+integer :: ia(N)
+real :: ra(N)
+logical :: ma(N)
+integer :: ib(N1, N2)
+contains
+    subroutine init
+	integer :: i, j
+	do i = 1, N
+	    ia(i) = mod(i * 7, 13) - 6
+	    ra(i) = mod(i * 5, 11)
+	    ma(i) = mod(i, 3) .ne. 0
+	enddo
+	! the maximum 7 first occurs late, the minimum -7 more than once
+	ia(N - 5) = 7
+	ia(N - 1) = 7
+	ia(N/2 + 3) = -7
+	ia(N - 2) = -7
+	do j = 1, N2
+	    do i = 1, N1
+		ib(i, j) = mod(i + 3 * j, 9)
+	    enddo
+	enddo
+    end subroutine
+endmodule
+
+program red04
+use data
+use omp_lib
+integer :: results(NTESTS), expect(NTESTS)
+integer :: sizes(NSIZES) = (/1, 2, 3, 7, 4/)
+integer :: k, t, i, j, s, loc(1), c1(N2), c2(N1)
+integer :: isum, imsum
+real :: rsum, rmsum
+integer :: c1ok, c2ok, inner
+
+call init
+
+isum = 0
+imsum = 0
+rsum = 0
+rmsum = 0
+do i = 1, N
+    isum = isum + ia(i)
+    rsum = rsum + ra(i)
+    if (ma(i)) then
+	imsum = imsum + ia(i)
+	rmsum = rmsum + ra(i)
+    endif
+enddo
+c1 = 0
+c2 = 0
+do j = 1, N2
+    do i = 1, N1
+	c1(j) = c1(j) + ib(i, j)
+	c2(i) = c2(i) + ib(i, j)
+    enddo
+enddo
+
+expect = 1
+results = 0
+do k = 1, NSIZES
+    call omp_set_num_threads(sizes(k))
+    ! the last size lets the runtime give a smaller team
+    call omp_set_dynamic(k .eq. NSIZES)
+    t = (k - 1) * NPER
+    if (sum(ia) .eq. isum) results(t + 1) = 1
+    if (sum(ia, mask=ma) .eq. imsum) results(t + 2) = 1
+    if (sum(ra) .eq. rsum) results(t + 3) = 1
+    if (sum(ra, mask=ma) .eq. rmsum) results(t + 4) = 1
+    loc = maxloc(ia)
+    if (loc(1) .eq. N - 5) results(t + 5) = 1
+    loc = minloc(ia)
+    if (loc(1) .eq. N/2 + 3) results(t + 6) = 1
+    if (all(sum(ib, dim=1) .eq. c1)) results(t + 7) = 1
+    if (all(sum(ib, dim=2) .eq. c2)) results(t + 8) = 1
+enddo
+
+! already in a parallel region: each thread reduces on its own
+call omp_set_dynamic(.false.)
+call omp_set_num_threads(4)
+inner = 0
+!$omp parallel private(s) reduction(+:inner)
+s = sum(ia)
+if (s .ne. isum) inner = inner + 1
+!$omp end parallel
+if (inner .eq. 0) results(NTESTS) = 1
+
+call check(results, expect, NTESTS)
+end
@@ -567,11 +567,10 @@ semantio(int rednum, SST *top)
       PT_TMPUSED(i, 0);
     }
     if (flg.smp || flg.accmp || XBIT(125, 0x1)) {
-      /* begin i/o critical section */
-      if (flg.smp || flg.accmp)
-        sptr = sym_mkfunc_nodesc("_mp_bcs_nest", DT_NONE);
-      else
-        sptr = mk_iofunc(RTE_f90io_begin, DT_NONE, 0);
+      /* begin i/o critical section; the runtime locks just the unit the
+       * statement names, so statements on different units run in parallel.
+       */
+      sptr = mk_iofunc(RTE_f90io_begin, DT_NONE, 0);
       (void)begin_io_call(A_CALL, sptr, 0);
       ast = end_io_call();
       STD_LINENO(io_call.std) = gbl.lineno;
@@ -4424,10 +4423,7 @@ fio_end_err(int lab, int elab)
   int ast;
   int astlab;
   if (flg.smp || flg.accmp || XBIT(125, 0x1)) {
-    if (flg.smp || flg.accmp)
-      begin_io_call(A_CALL, sym_mkfunc_nodesc("_mp_ecs_nest", DT_NONE), 0);
-    else
-      (void)begin_io_call(A_CALL, mk_iofunc(RTE_f90io_end, DT_NONE, 0), 0);
+    (void)begin_io_call(A_CALL, mk_iofunc(RTE_f90io_end, DT_NONE, 0), 0);
     ast = end_io_call();
   }
   if (lab)